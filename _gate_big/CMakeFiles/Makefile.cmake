@@ -0,0 +1,119 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/jerry-core/CMakeLists.txt"
+  "/root/repo/jerry-libc/CMakeLists.txt"
+  "/root/repo/jerry-libm/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeASMInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-ASM.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "jerry-libc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "jerry-libm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "jerry-core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/debug.linux.dir/DependInfo.cmake"
+  "CMakeFiles/debug.linux-mem_stress_test.dir/DependInfo.cmake"
+  "CMakeFiles/debug.linux-cp.dir/DependInfo.cmake"
+  "CMakeFiles/debug.linux-cp_minimal.dir/DependInfo.cmake"
+  "CMakeFiles/debug.linux-mem_stats.dir/DependInfo.cmake"
+  "CMakeFiles/debug.linux-cp_minimal-mem_stats.dir/DependInfo.cmake"
+  "CMakeFiles/release.linux.dir/DependInfo.cmake"
+  "CMakeFiles/release.linux-mem_stress_test.dir/DependInfo.cmake"
+  "CMakeFiles/release.linux-cp.dir/DependInfo.cmake"
+  "CMakeFiles/release.linux-cp_minimal.dir/DependInfo.cmake"
+  "CMakeFiles/release.linux-mem_stats.dir/DependInfo.cmake"
+  "CMakeFiles/release.linux-cp_minimal-mem_stats.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-api.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-context.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-date-helpers.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-heap.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-libm.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-lit-char-helpers.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-literal-storage.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-longjmp.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-number-to-integer.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-number-to-string.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-poolman.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-string-to-number.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-strings.dir/DependInfo.cmake"
+  "CMakeFiles/unit-test-vm-profile.dir/DependInfo.cmake"
+  "jerry-libc/CMakeFiles/jerry-libc-all.dir/DependInfo.cmake"
+  "jerry-libc/CMakeFiles/debug.jerry-libc.linux.lib.dir/DependInfo.cmake"
+  "jerry-libc/CMakeFiles/release.jerry-libc.linux.lib.dir/DependInfo.cmake"
+  "jerry-libc/CMakeFiles/unittests.jerry-libc.linux.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/jerry-libm-all.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/debug.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/debug-mem_stress_test.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/debug-cp.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/debug-cp_minimal.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/debug-mem_stats.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/release.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/release-mem_stress_test.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/release-cp.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/release-cp_minimal.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/release-mem_stats.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/release-cp_minimal-mem_stats.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/unittests.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/unittests-mem_stress_test.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/unittests-cp.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/unittests-cp_minimal.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/unittests-mem_stats.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-libm/CMakeFiles/unittests-cp_minimal-mem_stats.jerry-libm.lib.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/debug.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/debug-mem_stress_test.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/debug-cp.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/debug-cp_minimal.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/debug-mem_stats.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/release.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/release-mem_stress_test.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/release-cp.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/release-cp_minimal.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/release-mem_stats.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/release-cp_minimal-mem_stats.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/unittests.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/unittests-mem_stress_test.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/unittests-cp.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/unittests-cp_minimal.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/unittests-mem_stats.jerry-core.dir/DependInfo.cmake"
+  "jerry-core/CMakeFiles/unittests-cp_minimal-mem_stats.jerry-core.dir/DependInfo.cmake"
+  )
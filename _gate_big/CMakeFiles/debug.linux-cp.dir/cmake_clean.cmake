@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/debug.linux-cp.dir/main-unix.c.o"
+  "CMakeFiles/debug.linux-cp.dir/main-unix.c.o.d"
+  "debug.linux-cp"
+  "debug.linux-cp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/debug.linux-cp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/main-unix.c" "CMakeFiles/debug.linux-cp_minimal-mem_stats.dir/main-unix.c.o" "gcc" "CMakeFiles/debug.linux-cp_minimal-mem_stats.dir/main-unix.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_big/jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/DependInfo.cmake"
+  "/root/repo/_gate_big/jerry-libc/CMakeFiles/debug.jerry-libc.linux.lib.dir/DependInfo.cmake"
+  "/root/repo/_gate_big/jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/debug.linux-cp_minimal-mem_stats.dir/main-unix.c.o"
+  "CMakeFiles/debug.linux-cp_minimal-mem_stats.dir/main-unix.c.o.d"
+  "debug.linux-cp_minimal-mem_stats"
+  "debug.linux-cp_minimal-mem_stats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/debug.linux-cp_minimal-mem_stats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/debug.linux-mem_stats.dir/main-unix.c.o"
+  "CMakeFiles/debug.linux-mem_stats.dir/main-unix.c.o.d"
+  "debug.linux-mem_stats"
+  "debug.linux-mem_stats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/debug.linux-mem_stats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
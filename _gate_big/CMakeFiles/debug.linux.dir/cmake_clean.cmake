@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/debug.linux.dir/main-unix.c.o"
+  "CMakeFiles/debug.linux.dir/main-unix.c.o.d"
+  "debug.linux"
+  "debug.linux.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/debug.linux.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
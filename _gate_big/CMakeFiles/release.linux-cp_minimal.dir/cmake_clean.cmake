@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/release.linux-cp_minimal.dir/main-unix.c.o"
+  "CMakeFiles/release.linux-cp_minimal.dir/main-unix.c.o.d"
+  "release.linux-cp_minimal"
+  "release.linux-cp_minimal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/release.linux-cp_minimal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/release.linux-mem_stats.dir/main-unix.c.o"
+  "CMakeFiles/release.linux-mem_stats.dir/main-unix.c.o.d"
+  "release.linux-mem_stats"
+  "release.linux-mem_stats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/release.linux-mem_stats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
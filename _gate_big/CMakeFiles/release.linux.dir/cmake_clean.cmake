@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/release.linux.dir/main-unix.c.o"
+  "CMakeFiles/release.linux.dir/main-unix.c.o.d"
+  "release.linux"
+  "release.linux.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/release.linux.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
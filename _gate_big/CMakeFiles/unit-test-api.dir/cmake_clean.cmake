@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-api.dir/tests/unit/test-api.c.o"
+  "CMakeFiles/unit-test-api.dir/tests/unit/test-api.c.o.d"
+  "unit-test-api"
+  "unit-test-api.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-api.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
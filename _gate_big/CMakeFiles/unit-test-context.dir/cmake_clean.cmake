@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-context.dir/tests/unit/test-context.c.o"
+  "CMakeFiles/unit-test-context.dir/tests/unit/test-context.c.o.d"
+  "unit-test-context"
+  "unit-test-context.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-context.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-date-helpers.dir/tests/unit/test-date-helpers.c.o"
+  "CMakeFiles/unit-test-date-helpers.dir/tests/unit/test-date-helpers.c.o.d"
+  "unit-test-date-helpers"
+  "unit-test-date-helpers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-date-helpers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
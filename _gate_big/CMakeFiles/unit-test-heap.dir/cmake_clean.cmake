@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-heap.dir/tests/unit/test-heap.c.o"
+  "CMakeFiles/unit-test-heap.dir/tests/unit/test-heap.c.o.d"
+  "unit-test-heap"
+  "unit-test-heap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-heap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
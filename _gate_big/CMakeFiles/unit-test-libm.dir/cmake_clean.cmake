@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-libm.dir/tests/unit/test-libm.c.o"
+  "CMakeFiles/unit-test-libm.dir/tests/unit/test-libm.c.o.d"
+  "unit-test-libm"
+  "unit-test-libm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-libm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
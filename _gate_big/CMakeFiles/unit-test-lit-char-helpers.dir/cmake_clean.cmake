@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-lit-char-helpers.dir/tests/unit/test-lit-char-helpers.c.o"
+  "CMakeFiles/unit-test-lit-char-helpers.dir/tests/unit/test-lit-char-helpers.c.o.d"
+  "unit-test-lit-char-helpers"
+  "unit-test-lit-char-helpers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-lit-char-helpers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
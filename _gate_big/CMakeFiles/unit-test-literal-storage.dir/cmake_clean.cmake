@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-literal-storage.dir/tests/unit/test-literal-storage.c.o"
+  "CMakeFiles/unit-test-literal-storage.dir/tests/unit/test-literal-storage.c.o.d"
+  "unit-test-literal-storage"
+  "unit-test-literal-storage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-literal-storage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
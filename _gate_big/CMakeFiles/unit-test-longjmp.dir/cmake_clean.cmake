@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-longjmp.dir/tests/unit/test-longjmp.c.o"
+  "CMakeFiles/unit-test-longjmp.dir/tests/unit/test-longjmp.c.o.d"
+  "unit-test-longjmp"
+  "unit-test-longjmp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-longjmp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-number-to-integer.dir/tests/unit/test-number-to-integer.c.o"
+  "CMakeFiles/unit-test-number-to-integer.dir/tests/unit/test-number-to-integer.c.o.d"
+  "unit-test-number-to-integer"
+  "unit-test-number-to-integer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-number-to-integer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-number-to-string.dir/tests/unit/test-number-to-string.c.o"
+  "CMakeFiles/unit-test-number-to-string.dir/tests/unit/test-number-to-string.c.o.d"
+  "unit-test-number-to-string"
+  "unit-test-number-to-string.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-number-to-string.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
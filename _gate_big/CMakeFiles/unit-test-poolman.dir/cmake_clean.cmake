@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-poolman.dir/tests/unit/test-poolman.c.o"
+  "CMakeFiles/unit-test-poolman.dir/tests/unit/test-poolman.c.o.d"
+  "unit-test-poolman"
+  "unit-test-poolman.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-poolman.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
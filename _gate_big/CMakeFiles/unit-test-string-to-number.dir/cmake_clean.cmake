@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-string-to-number.dir/tests/unit/test-string-to-number.c.o"
+  "CMakeFiles/unit-test-string-to-number.dir/tests/unit/test-string-to-number.c.o.d"
+  "unit-test-string-to-number"
+  "unit-test-string-to-number.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-string-to-number.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
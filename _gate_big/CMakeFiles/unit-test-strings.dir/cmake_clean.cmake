@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-strings.dir/tests/unit/test-strings.c.o"
+  "CMakeFiles/unit-test-strings.dir/tests/unit/test-strings.c.o.d"
+  "unit-test-strings"
+  "unit-test-strings.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-strings.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-test-vm-profile.dir/tests/unit/test-vm-profile.c.o"
+  "CMakeFiles/unit-test-vm-profile.dir/tests/unit/test-vm-profile.c.o.d"
+  "unit-test-vm-profile"
+  "unit-test-vm-profile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit-test-vm-profile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libdebug-cp.jerry-core.a"
+)
@@ -0,0 +1,128 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/targets/default/jerry-port-default-date.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-date.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-date.c.o.d"
+  "/root/repo/targets/default/jerry-port-default-fatal.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-fatal.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-fatal.c.o.d"
+  "/root/repo/targets/default/jerry-port-default-io.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-io.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-io.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-alloc.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-alloc.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-alloc.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-gc.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-gc.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-gc.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-heap-dump.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-heap-dump.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-heap-dump.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-helpers-conversion.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-conversion.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-conversion.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-helpers-errol.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-errol.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-errol.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-helpers-external-pointers.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-external-pointers.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-external-pointers.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-helpers-number.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-number.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-number.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-helpers-string.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-string.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-string.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-helpers-value.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-value.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-value.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-helpers-values-collection.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-values-collection.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-values-collection.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-helpers.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-helpers.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-init-finalize.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-init-finalize.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-init-finalize.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-inline-cache.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-inline-cache.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-inline-cache.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-lcache.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-lcache.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-lcache.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-property-hashmap.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-property-hashmap.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-property-hashmap.c.o.d"
+  "/root/repo/jerry-core/ecma/base/ecma-shape.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-shape.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/base/ecma-shape.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-array-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-array-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-array-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-array.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-array.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-array.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-boolean-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-boolean-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-boolean-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-boolean.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-boolean.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-boolean.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-compact-profile-error.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-compact-profile-error.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-compact-profile-error.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-date-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-date-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-date-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-date.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-date.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-date.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-error-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-error-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-error-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-error.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-error.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-error.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-evalerror-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-evalerror-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-evalerror-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-evalerror.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-evalerror.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-evalerror.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-function-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-function-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-function-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-function.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-function.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-function.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-global.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-global.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-global.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-helpers-date.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-date.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-date.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-helpers-error.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-error.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-error.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-helpers-json.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-json.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-json.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-helpers.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-json.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-json.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-json.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-math.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-math.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-math.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-number-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-number-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-number-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-number.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-number.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-number.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-object-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-object-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-object-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-object.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-object.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-object.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-rangeerror-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-rangeerror-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-rangeerror-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-rangeerror.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-rangeerror.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-rangeerror.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-referenceerror-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-referenceerror-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-referenceerror-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-referenceerror.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-referenceerror.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-referenceerror.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-regexp-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-regexp-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-regexp-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-regexp.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-regexp.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-regexp.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-string-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-string-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-string-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-string.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-string.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-string.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-syntaxerror-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-syntaxerror-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-syntaxerror-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-syntaxerror.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-syntaxerror.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-syntaxerror.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-type-error-thrower.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-type-error-thrower.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-type-error-thrower.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-typeerror-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-typeerror-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-typeerror-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-typeerror.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-typeerror.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-typeerror.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-urierror-prototype.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-urierror-prototype.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-urierror-prototype.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtin-urierror.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-urierror.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-urierror.c.o.d"
+  "/root/repo/jerry-core/ecma/builtin-objects/ecma-builtins.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtins.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtins.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-array-object.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-array-object.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-array-object.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-boolean-object.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-boolean-object.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-boolean-object.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-comparison.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-comparison.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-comparison.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-conversion.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-conversion.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-conversion.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-eval.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-eval.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-eval.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-exceptions.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-exceptions.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-exceptions.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-function-object.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-function-object.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-function-object.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-get-put-value.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-get-put-value.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-get-put-value.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-lex-env.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-lex-env.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-lex-env.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-number-arithmetic.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-number-arithmetic.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-number-arithmetic.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-number-object.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-number-object.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-number-object.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-objects-arguments.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-objects-arguments.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-objects-arguments.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-objects-general.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-objects-general.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-objects-general.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-objects.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-objects.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-objects.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-reference.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-reference.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-reference.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-regexp-object.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-regexp-object.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-regexp-object.c.o.d"
+  "/root/repo/jerry-core/ecma/operations/ecma-string-object.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-string-object.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/ecma/operations/ecma-string-object.c.o.d"
+  "/root/repo/jerry-core/jcontext/jcontext.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/jcontext/jcontext.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/jcontext/jcontext.c.o.d"
+  "/root/repo/jerry-core/jerry.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/jerry.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/jerry.c.o.d"
+  "/root/repo/jerry-core/jrt/jrt-fatals.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/jrt/jrt-fatals.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/jrt/jrt-fatals.c.o.d"
+  "/root/repo/jerry-core/jrt/jrt.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/jrt/jrt.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/jrt/jrt.c.o.d"
+  "/root/repo/jerry-core/lit/lit-char-helpers.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-char-helpers.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-char-helpers.c.o.d"
+  "/root/repo/jerry-core/lit/lit-cpointer.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-cpointer.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-cpointer.c.o.d"
+  "/root/repo/jerry-core/lit/lit-literal-storage.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-literal-storage.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-literal-storage.c.o.d"
+  "/root/repo/jerry-core/lit/lit-literal.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-literal.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-literal.c.o.d"
+  "/root/repo/jerry-core/lit/lit-magic-strings.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-magic-strings.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-magic-strings.c.o.d"
+  "/root/repo/jerry-core/lit/lit-snapshot.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-snapshot.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-snapshot.c.o.d"
+  "/root/repo/jerry-core/lit/lit-strings.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-strings.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/lit/lit-strings.c.o.d"
+  "/root/repo/jerry-core/mem/mem-allocator.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/mem/mem-allocator.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/mem/mem-allocator.c.o.d"
+  "/root/repo/jerry-core/mem/mem-heap.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/mem/mem-heap.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/mem/mem-heap.c.o.d"
+  "/root/repo/jerry-core/mem/mem-poolman.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/mem/mem-poolman.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/mem/mem-poolman.c.o.d"
+  "/root/repo/jerry-core/parser/js/byte-code.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/byte-code.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/byte-code.c.o.d"
+  "/root/repo/jerry-core/parser/js/common.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/common.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/common.c.o.d"
+  "/root/repo/jerry-core/parser/js/js-lexer.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-lexer.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-lexer.c.o.d"
+  "/root/repo/jerry-core/parser/js/js-parser-expr.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser-expr.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser-expr.c.o.d"
+  "/root/repo/jerry-core/parser/js/js-parser-mem.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser-mem.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser-mem.c.o.d"
+  "/root/repo/jerry-core/parser/js/js-parser-scanner.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser-scanner.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser-scanner.c.o.d"
+  "/root/repo/jerry-core/parser/js/js-parser-statm.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser-statm.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser-statm.c.o.d"
+  "/root/repo/jerry-core/parser/js/js-parser-util.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser-util.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser-util.c.o.d"
+  "/root/repo/jerry-core/parser/js/js-parser.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/js/js-parser.c.o.d"
+  "/root/repo/jerry-core/parser/regexp/re-bytecode.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/regexp/re-bytecode.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/regexp/re-bytecode.c.o.d"
+  "/root/repo/jerry-core/parser/regexp/re-compiler.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/regexp/re-compiler.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/regexp/re-compiler.c.o.d"
+  "/root/repo/jerry-core/parser/regexp/re-parser.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/regexp/re-parser.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/parser/regexp/re-parser.c.o.d"
+  "/root/repo/jerry-core/vm/opcodes-ecma-arithmetics.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/opcodes-ecma-arithmetics.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/opcodes-ecma-arithmetics.c.o.d"
+  "/root/repo/jerry-core/vm/opcodes-ecma-bitwise.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/opcodes-ecma-bitwise.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/opcodes-ecma-bitwise.c.o.d"
+  "/root/repo/jerry-core/vm/opcodes-ecma-equality.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/opcodes-ecma-equality.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/opcodes-ecma-equality.c.o.d"
+  "/root/repo/jerry-core/vm/opcodes-ecma-relational.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/opcodes-ecma-relational.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/opcodes-ecma-relational.c.o.d"
+  "/root/repo/jerry-core/vm/opcodes.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/opcodes.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/opcodes.c.o.d"
+  "/root/repo/jerry-core/vm/vm-stack.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/vm-stack.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/vm-stack.c.o.d"
+  "/root/repo/jerry-core/vm/vm-stats.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/vm-stats.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/vm-stats.c.o.d"
+  "/root/repo/jerry-core/vm/vm.c" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/vm.c.o" "gcc" "jerry-core/CMakeFiles/debug-cp_minimal-mem_stats.jerry-core.dir/vm/vm.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
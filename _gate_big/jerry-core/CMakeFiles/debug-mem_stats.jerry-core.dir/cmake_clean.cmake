@@ -0,0 +1,229 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-date.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-date.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-fatal.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-fatal.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-io.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/__/targets/default/jerry-port-default-io.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-alloc.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-alloc.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-gc.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-gc.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-heap-dump.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-heap-dump.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-conversion.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-conversion.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-errol.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-errol.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-external-pointers.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-external-pointers.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-number.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-number.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-string.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-string.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-value.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-value.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-values-collection.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers-values-collection.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-helpers.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-init-finalize.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-init-finalize.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-inline-cache.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-inline-cache.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-lcache.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-lcache.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-property-hashmap.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-property-hashmap.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-shape.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/base/ecma-shape.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-array-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-array-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-array.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-array.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-boolean-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-boolean-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-boolean.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-boolean.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-compact-profile-error.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-compact-profile-error.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-date-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-date-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-date.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-date.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-error-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-error-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-error.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-error.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-evalerror-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-evalerror-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-evalerror.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-evalerror.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-function-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-function-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-function.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-function.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-global.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-global.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-date.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-date.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-error.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-error.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-json.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers-json.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-helpers.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-json.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-json.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-math.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-math.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-number-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-number-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-number.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-number.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-object-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-object-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-object.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-object.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-rangeerror-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-rangeerror-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-rangeerror.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-rangeerror.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-referenceerror-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-referenceerror-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-referenceerror.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-referenceerror.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-regexp-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-regexp-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-regexp.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-regexp.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-string-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-string-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-string.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-string.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-syntaxerror-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-syntaxerror-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-syntaxerror.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-syntaxerror.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-type-error-thrower.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-type-error-thrower.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-typeerror-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-typeerror-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-typeerror.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-typeerror.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-urierror-prototype.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-urierror-prototype.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-urierror.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtin-urierror.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtins.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/builtin-objects/ecma-builtins.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-array-object.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-array-object.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-boolean-object.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-boolean-object.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-comparison.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-comparison.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-conversion.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-conversion.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-eval.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-eval.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-exceptions.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-exceptions.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-function-object.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-function-object.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-get-put-value.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-get-put-value.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-lex-env.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-lex-env.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-number-arithmetic.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-number-arithmetic.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-number-object.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-number-object.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-objects-arguments.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-objects-arguments.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-objects-general.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-objects-general.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-objects.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-objects.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-reference.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-reference.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-regexp-object.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-regexp-object.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-string-object.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/ecma/operations/ecma-string-object.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/jcontext/jcontext.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/jcontext/jcontext.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/jerry.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/jerry.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/jrt/jrt-fatals.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/jrt/jrt-fatals.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/jrt/jrt.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/jrt/jrt.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-char-helpers.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-char-helpers.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-cpointer.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-cpointer.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-literal-storage.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-literal-storage.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-literal.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-literal.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-magic-strings.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-magic-strings.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-snapshot.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-snapshot.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-strings.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/lit/lit-strings.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/mem/mem-allocator.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/mem/mem-allocator.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/mem/mem-heap.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/mem/mem-heap.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/mem/mem-poolman.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/mem/mem-poolman.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/byte-code.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/byte-code.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/common.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/common.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-lexer.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-lexer.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser-expr.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser-expr.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser-mem.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser-mem.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser-scanner.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser-scanner.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser-statm.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser-statm.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser-util.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser-util.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/js/js-parser.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/regexp/re-bytecode.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/regexp/re-bytecode.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/regexp/re-compiler.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/regexp/re-compiler.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/regexp/re-parser.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/parser/regexp/re-parser.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/opcodes-ecma-arithmetics.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/opcodes-ecma-arithmetics.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/opcodes-ecma-bitwise.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/opcodes-ecma-bitwise.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/opcodes-ecma-equality.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/opcodes-ecma-equality.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/opcodes-ecma-relational.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/opcodes-ecma-relational.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/opcodes.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/opcodes.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/vm-stack.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/vm-stack.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/vm-stats.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/vm-stats.c.o.d"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/vm.c.o"
+  "CMakeFiles/debug-mem_stats.jerry-core.dir/vm/vm.c.o.d"
+  "libdebug-mem_stats.jerry-core.a"
+  "libdebug-mem_stats.jerry-core.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/debug-mem_stats.jerry-core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
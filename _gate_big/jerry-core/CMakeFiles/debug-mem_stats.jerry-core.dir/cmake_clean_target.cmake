@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libdebug-mem_stats.jerry-core.a"
+)
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "librelease-mem_stats.jerry-core.a"
+)
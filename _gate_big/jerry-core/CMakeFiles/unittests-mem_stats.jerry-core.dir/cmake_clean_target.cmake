@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libunittests-mem_stats.jerry-core.a"
+)
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libdebug.jerry-libc.linux.lib.a"
+)
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "ASM"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_ASM
+  "/root/repo/jerry-libc/target/posix/jerry-asm.S" "/root/repo/_gate_big/jerry-libc/CMakeFiles/release.jerry-libc.linux.lib.dir/target/posix/jerry-asm.S.o"
+  )
+set(CMAKE_ASM_COMPILER_ID "GNU")
+
+# Preprocessor definitions for this target.
+set(CMAKE_TARGET_DEFINITIONS_ASM
+  "NDEBUG"
+  "__TARGET_HOST"
+  "__TARGET_HOST_x64"
+  )
+
+# The include file search paths:
+set(CMAKE_ASM_TARGET_INCLUDE_PATH
+  "/root/repo/jerry-libc"
+  "/root/repo/jerry-libc/include"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/jerry-libc/jerry-libc-printf.c" "jerry-libc/CMakeFiles/release.jerry-libc.linux.lib.dir/jerry-libc-printf.c.o" "gcc" "jerry-libc/CMakeFiles/release.jerry-libc.linux.lib.dir/jerry-libc-printf.c.o.d"
+  "/root/repo/jerry-libc/jerry-libc.c" "jerry-libc/CMakeFiles/release.jerry-libc.linux.lib.dir/jerry-libc.c.o" "gcc" "jerry-libc/CMakeFiles/release.jerry-libc.linux.lib.dir/jerry-libc.c.o.d"
+  "/root/repo/jerry-libc/target/posix/jerry-libc-target.c" "jerry-libc/CMakeFiles/release.jerry-libc.linux.lib.dir/target/posix/jerry-libc-target.c.o" "gcc" "jerry-libc/CMakeFiles/release.jerry-libc.linux.lib.dir/target/posix/jerry-libc-target.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/release.jerry-libc.linux.lib.dir/jerry-libc-printf.c.o"
+  "CMakeFiles/release.jerry-libc.linux.lib.dir/jerry-libc-printf.c.o.d"
+  "CMakeFiles/release.jerry-libc.linux.lib.dir/jerry-libc.c.o"
+  "CMakeFiles/release.jerry-libc.linux.lib.dir/jerry-libc.c.o.d"
+  "CMakeFiles/release.jerry-libc.linux.lib.dir/target/posix/jerry-asm.S.o"
+  "CMakeFiles/release.jerry-libc.linux.lib.dir/target/posix/jerry-libc-target.c.o"
+  "CMakeFiles/release.jerry-libc.linux.lib.dir/target/posix/jerry-libc-target.c.o.d"
+  "librelease.jerry-libc.linux.lib.a"
+  "librelease.jerry-libc.linux.lib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang ASM C)
+  include(CMakeFiles/release.jerry-libc.linux.lib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libunittests.jerry-libc.linux.lib.a"
+)
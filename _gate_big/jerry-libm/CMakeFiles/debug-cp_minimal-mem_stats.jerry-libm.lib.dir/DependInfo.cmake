@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/jerry-libm/acos.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/acos.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/acos.c.o.d"
+  "/root/repo/jerry-libm/asin.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/asin.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/asin.c.o.d"
+  "/root/repo/jerry-libm/atan.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/atan.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/atan.c.o.d"
+  "/root/repo/jerry-libm/atan2.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/atan2.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/atan2.c.o.d"
+  "/root/repo/jerry-libm/ceil.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/ceil.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/ceil.c.o.d"
+  "/root/repo/jerry-libm/copysign.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/copysign.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/copysign.c.o.d"
+  "/root/repo/jerry-libm/exp.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/exp.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/exp.c.o.d"
+  "/root/repo/jerry-libm/fabs.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/fabs.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/fabs.c.o.d"
+  "/root/repo/jerry-libm/finite.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/finite.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/finite.c.o.d"
+  "/root/repo/jerry-libm/floor.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/floor.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/floor.c.o.d"
+  "/root/repo/jerry-libm/fmod.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/fmod.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/fmod.c.o.d"
+  "/root/repo/jerry-libm/isnan.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/isnan.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/isnan.c.o.d"
+  "/root/repo/jerry-libm/log.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/log.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/log.c.o.d"
+  "/root/repo/jerry-libm/nextafter.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/nextafter.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/nextafter.c.o.d"
+  "/root/repo/jerry-libm/pow.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/pow.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/pow.c.o.d"
+  "/root/repo/jerry-libm/scalbn.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/scalbn.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/scalbn.c.o.d"
+  "/root/repo/jerry-libm/sqrt.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/sqrt.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/sqrt.c.o.d"
+  "/root/repo/jerry-libm/trig.c" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/trig.c.o" "gcc" "jerry-libm/CMakeFiles/debug-cp_minimal-mem_stats.jerry-libm.lib.dir/trig.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libdebug-cp_minimal-mem_stats.jerry-libm.lib.a"
+)
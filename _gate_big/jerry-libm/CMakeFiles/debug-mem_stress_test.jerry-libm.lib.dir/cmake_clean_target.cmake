@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libdebug-mem_stress_test.jerry-libm.lib.a"
+)
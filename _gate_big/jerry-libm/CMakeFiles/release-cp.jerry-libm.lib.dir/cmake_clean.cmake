@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/acos.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/acos.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/asin.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/asin.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/atan.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/atan.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/atan2.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/atan2.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/ceil.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/ceil.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/copysign.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/copysign.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/exp.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/exp.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/fabs.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/fabs.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/finite.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/finite.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/floor.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/floor.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/fmod.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/fmod.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/isnan.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/isnan.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/log.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/log.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/nextafter.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/nextafter.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/pow.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/pow.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/scalbn.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/scalbn.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/sqrt.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/sqrt.c.o.d"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/trig.c.o"
+  "CMakeFiles/release-cp.jerry-libm.lib.dir/trig.c.o.d"
+  "librelease-cp.jerry-libm.lib.a"
+  "librelease-cp.jerry-libm.lib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/release-cp.jerry-libm.lib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
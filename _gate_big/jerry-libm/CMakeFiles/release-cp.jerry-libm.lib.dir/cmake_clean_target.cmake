@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "librelease-cp.jerry-libm.lib.a"
+)
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "librelease-cp_minimal.jerry-libm.lib.a"
+)
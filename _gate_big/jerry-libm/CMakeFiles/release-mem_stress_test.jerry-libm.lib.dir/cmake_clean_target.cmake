@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "librelease-mem_stress_test.jerry-libm.lib.a"
+)
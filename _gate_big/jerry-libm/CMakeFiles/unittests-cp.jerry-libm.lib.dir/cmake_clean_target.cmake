@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libunittests-cp.jerry-libm.lib.a"
+)
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libunittests-mem_stress_test.jerry-libm.lib.a"
+)
@@ -32,15 +32,35 @@
  *
  * Should not be less than size of any of ECMA Object Model's data types.
  */
-#define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#ifndef JERRY_CPOINTER_32_BIT
+# define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#else /* JERRY_CPOINTER_32_BIT */
+# define CONFIG_MEM_POOL_CHUNK_SIZE (16)
+#endif /* !JERRY_CPOINTER_32_BIT */
+
+/**
+ * Maximum size of heap
+ *
+ * The 16 bit compressed pointers can address 512 kilobytes, the 32 bit compressed pointers
+ * (JERRY_CPOINTER_32_BIT) can address 2 gigabytes.
+ */
+#ifndef JERRY_CPOINTER_32_BIT
+# define CONFIG_MEM_HEAP_MAX_AREA_SIZE (512 * 1024)
+#else /* JERRY_CPOINTER_32_BIT */
+# define CONFIG_MEM_HEAP_MAX_AREA_SIZE (2u * 1024 * 1024 * 1024 - 1)
+#endif /* !JERRY_CPOINTER_32_BIT */
 
 /**
  * Size of heap
  */
 #ifndef CONFIG_MEM_HEAP_AREA_SIZE
 # define CONFIG_MEM_HEAP_AREA_SIZE (512 * 1024)
-#elif CONFIG_MEM_HEAP_AREA_SIZE > (512 * 1024)
-# error "Currently, maximum 512 kilobytes heap size is supported"
+#elif CONFIG_MEM_HEAP_AREA_SIZE > CONFIG_MEM_HEAP_MAX_AREA_SIZE
+# ifndef JERRY_CPOINTER_32_BIT
+#  error "Maximum 512 kilobytes heap size is supported with 16 bit compressed pointers (see JERRY_CPOINTER_32_BIT)"
+# else /* JERRY_CPOINTER_32_BIT */
+#  error "Maximum 2 gigabytes heap size is supported with 32 bit compressed pointers"
+# endif /* !JERRY_CPOINTER_32_BIT */
 #endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
 
 /**
@@ -63,12 +83,21 @@
  *
  * On the other hand, value 2 ^ CONFIG_MEM_HEAP_OFFSET_LOG should not be less than CONFIG_MEM_HEAP_AREA_SIZE.
  */
-#define CONFIG_MEM_HEAP_OFFSET_LOG (19)
+#ifndef JERRY_CPOINTER_32_BIT
+# define CONFIG_MEM_HEAP_OFFSET_LOG (19)
+#else /* JERRY_CPOINTER_32_BIT */
+# define CONFIG_MEM_HEAP_OFFSET_LOG (31)
+#endif /* !JERRY_CPOINTER_32_BIT */
 
 /**
  * Number of lower bits in key of literal hash table.
+ *
+ * The hash table of the literal storage starts with 2 ^ CONFIG_LITERAL_HASH_TABLE_KEY_BITS entries,
+ * and it is doubled whenever it becomes three quarters full.
  */
-#define CONFIG_LITERAL_HASH_TABLE_KEY_BITS (7)
+#ifndef CONFIG_LITERAL_HASH_TABLE_KEY_BITS
+# define CONFIG_LITERAL_HASH_TABLE_KEY_BITS (7)
+#endif /* !CONFIG_LITERAL_HASH_TABLE_KEY_BITS */
 
 /**
  * Width of fields used for holding counter of references to ecma-strings and ecma-objects
@@ -87,8 +116,38 @@
 
 /**
  * Maximum length of strings' concatenation
+ *
+ * The limit is raised with 32 bit compressed pointers, so strings can use the larger heaps.
+ */
+#ifndef JERRY_CPOINTER_32_BIT
+# define CONFIG_ECMA_STRING_MAX_CONCATENATION_LENGTH (1048576)
+#else /* JERRY_CPOINTER_32_BIT */
+# define CONFIG_ECMA_STRING_MAX_CONCATENATION_LENGTH (256u * 1024 * 1024)
+#endif /* !JERRY_CPOINTER_32_BIT */
+
+/**
+ * Concatenations of at least this many bytes are represented by rope strings, which reference
+ * the two halves instead of copying them. The last half of a rope is extended up to this size
+ * by copying, so repeated concatenations of short strings do not create a node for each piece.
+ */
+#ifndef CONFIG_ECMA_STRING_ROPE_MIN_SIZE
+# define CONFIG_ECMA_STRING_ROPE_MIN_SIZE (256)
+#endif /* !CONFIG_ECMA_STRING_ROPE_MIN_SIZE */
+
+/**
+ * Maximum depth of the rope strings (deeper ropes are flattened when they are created)
  */
-#define CONFIG_ECMA_STRING_MAX_CONCATENATION_LENGTH (1048576)
+#ifndef CONFIG_ECMA_STRING_ROPE_MAX_DEPTH
+# define CONFIG_ECMA_STRING_ROPE_MAX_DEPTH (32)
+#endif /* !CONFIG_ECMA_STRING_ROPE_MAX_DEPTH */
+
+/**
+ * Number of characters between the entries of the character index of the non-ascii heap strings.
+ * The index is built when a character after the first this many characters is requested.
+ */
+#ifndef CONFIG_ECMA_STRING_INDEX_STRIDE
+# define CONFIG_ECMA_STRING_INDEX_STRIDE (32)
+#endif /* !CONFIG_ECMA_STRING_INDEX_STRIDE */
 
 /**
  * Use 32-bit/64-bit float for ecma-numbers
@@ -141,6 +200,64 @@
  */
 #define CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC (16)
 
+/**
+ * Share of objects promoted to the old generation since the last major GC,
+ * after achieving which, a major GC is started instead of a minor GC.
+ *
+ * Share is calculated as the following:
+ *                1.0 / CONFIG_ECMA_GC_PROMOTED_OBJECTS_SHARE_TO_START_MAJOR_GC
+ */
+#ifndef CONFIG_ECMA_GC_PROMOTED_OBJECTS_SHARE_TO_START_MAJOR_GC
+# define CONFIG_ECMA_GC_PROMOTED_OBJECTS_SHARE_TO_START_MAJOR_GC (4)
+#endif /* !CONFIG_ECMA_GC_PROMOTED_OBJECTS_SHARE_TO_START_MAJOR_GC */
+
+/**
+ * Number of entries in the mark stack of the garbage collector
+ *
+ * When the stack overflows, the marked objects are traced again by scanning the object list.
+ */
+#ifndef CONFIG_ECMA_GC_MARK_STACK_SIZE
+# define CONFIG_ECMA_GC_MARK_STACK_SIZE (256)
+#endif /* !CONFIG_ECMA_GC_MARK_STACK_SIZE */
+
+/**
+ * Maximum amount of work done by a step of the incremental garbage collector
+ *
+ * The work is measured in objects (each traced, scanned or swept object is a unit),
+ * so the value bounds the pause caused by a step.
+ */
+#ifndef CONFIG_ECMA_GC_STEP_BUDGET
+# define CONFIG_ECMA_GC_STEP_BUDGET (256)
+#endif /* !CONFIG_ECMA_GC_STEP_BUDGET */
+
+/**
+ * Number of object allocations between two steps of an incremental garbage collection
+ *
+ * The collection advances by CONFIG_ECMA_GC_STEP_BUDGET / CONFIG_ECMA_GC_STEP_ALLOCATIONS
+ * units of work per allocated object, so it finishes before the heap grows too much.
+ */
+#ifndef CONFIG_ECMA_GC_STEP_ALLOCATIONS
+# define CONFIG_ECMA_GC_STEP_ALLOCATIONS (16)
+#endif /* !CONFIG_ECMA_GC_STEP_ALLOCATIONS */
+
+/**
+ * Fragmentation of the free heap space (in percent), above which the heap is compacted
+ * after a high severity 'try to give memory back' request.
+ *
+ * The fragmentation is the share of the free space which is not part of the largest free region.
+ */
+#ifndef CONFIG_ECMA_GC_COMPACT_FRAGMENTATION
+# define CONFIG_ECMA_GC_COMPACT_FRAGMENTATION (50)
+#endif /* !CONFIG_ECMA_GC_COMPACT_FRAGMENTATION */
+
+/**
+ * Number of byte code locations (must be a power of 2), whose allocations are accounted separately
+ * by the memory statistics. The allocations of the further locations are accounted together.
+ */
+#ifndef CONFIG_ECMA_ALLOC_SITE_TABLE_SIZE
+# define CONFIG_ECMA_ALLOC_SITE_TABLE_SIZE (256)
+#endif /* !CONFIG_ECMA_ALLOC_SITE_TABLE_SIZE */
+
 /**
  * Link Global Environment to an empty declarative lexical environment
  * instead of lexical environment bound to Global Object.
@@ -180,4 +297,18 @@
  */
 #define CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
 
+/**
+ * Size of the chunks of the parser arena, from which the temporary data of the parser is allocated
+ */
+#ifndef CONFIG_PARSER_ARENA_CHUNK_SIZE
+# define CONFIG_PARSER_ARENA_CHUNK_SIZE (1024)
+#endif /* !CONFIG_PARSER_ARENA_CHUNK_SIZE */
+
+/**
+ * Maximum size of the blocks allocated from the parser arena (the larger blocks are allocated from the heap)
+ */
+#ifndef CONFIG_PARSER_ARENA_MAX_BLOCK_SIZE
+# define CONFIG_PARSER_ARENA_MAX_BLOCK_SIZE (256)
+#endif /* !CONFIG_PARSER_ARENA_MAX_BLOCK_SIZE */
+
 #endif /* !CONFIG_H */
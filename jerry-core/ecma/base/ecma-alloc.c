@@ -18,6 +18,7 @@
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-lcache.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "mem-poolman.h"
 
@@ -25,20 +26,20 @@ JERRY_STATIC_ASSERT (sizeof (ecma_property_value_t) == sizeof (ecma_value_t),
                      size_of_ecma_property_value_t_must_be_equal_to_size_of_ecma_value_t);
 JERRY_STATIC_ASSERT (((sizeof (ecma_property_value_t) - 1) & sizeof (ecma_property_value_t)) == 0,
                      size_of_ecma_property_value_t_must_be_power_of_2);
-JERRY_STATIC_ASSERT (sizeof (ecma_property_pair_t) == sizeof (uint64_t) * 2,
-                     size_of_ecma_property_pair_t_must_be_equal_to_16_bytes);
+JERRY_STATIC_ASSERT (sizeof (ecma_property_pair_t) == sizeof (uint64_t) * 2 + 4 * (sizeof (mem_cpointer_t) - 2),
+                     size_of_ecma_property_pair_t_must_be_equal_to_16_bytes_with_16_bit_compressed_pointers);
 
-JERRY_STATIC_ASSERT (sizeof (ecma_object_t) <= sizeof (uint64_t),
-                     size_of_ecma_object_t_must_be_less_than_or_equal_to_8_bytes);
+JERRY_STATIC_ASSERT (sizeof (ecma_object_t) <= MEM_POOL_CHUNK_SIZE,
+                     size_of_ecma_object_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
 
-JERRY_STATIC_ASSERT (sizeof (ecma_collection_header_t) == sizeof (uint64_t),
-                     size_of_ecma_collection_header_t_must_be_less_than_or_equal_to_8_bytes);
-JERRY_STATIC_ASSERT (sizeof (ecma_collection_chunk_t) == sizeof (uint64_t),
-                     size_of_ecma_collection_chunk_t_must_be_less_than_or_equal_to_8_bytes);
-JERRY_STATIC_ASSERT (sizeof (ecma_string_t) == sizeof (uint64_t),
-                     size_of_ecma_string_t_must_be_less_than_or_equal_to_8_bytes);
-JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= sizeof (uint64_t),
-                     size_of_ecma_getter_setter_pointers_t_must_be_less_than_or_equal_to_8_bytes);
+JERRY_STATIC_ASSERT (sizeof (ecma_collection_header_t) <= MEM_POOL_CHUNK_SIZE,
+                     size_of_ecma_collection_header_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_collection_chunk_t) <= MEM_POOL_CHUNK_SIZE,
+                     size_of_ecma_collection_chunk_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_string_t) <= MEM_POOL_CHUNK_SIZE,
+                     size_of_ecma_string_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= MEM_POOL_CHUNK_SIZE,
+                     size_of_ecma_getter_setter_pointers_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
 
 /** \addtogroup ecma ECMA
  * @{
@@ -62,12 +63,13 @@ JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= sizeof (uint64_t)
 /**
  * Template of an allocation routine.
  */
-#define ALLOC(ecma_type) ecma_ ## ecma_type ## _t * \
+#define ALLOC(ecma_type, kind) ecma_ ## ecma_type ## _t * \
   ecma_alloc_ ## ecma_type (void) \
 { \
   ecma_ ## ecma_type ## _t *p ## ecma_type = (ecma_ ## ecma_type ## _t *) mem_pools_alloc (); \
   \
   JERRY_ASSERT (p ## ecma_type != NULL); \
+  ECMA_ALLOC_STATS_ADD (kind, MEM_POOL_CHUNK_SIZE); \
   \
   return p ## ecma_type; \
 }
@@ -75,35 +77,74 @@ JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= sizeof (uint64_t)
 /**
  * Deallocation routine template
  */
-#define DEALLOC(ecma_type) void \
+#define DEALLOC(ecma_type, kind) void \
   ecma_dealloc_ ## ecma_type (ecma_ ## ecma_type ## _t *p ## ecma_type) \
 { \
+  ECMA_ALLOC_STATS_REMOVE (kind, MEM_POOL_CHUNK_SIZE); \
   mem_pools_free ((uint8_t *) p ## ecma_type); \
 }
 
 /**
  * Declaration of alloc/free routine for specified ecma-type.
  */
-#define DECLARE_ROUTINES_FOR(ecma_type) \
-  ALLOC (ecma_type) \
-  DEALLOC (ecma_type)
+#define DECLARE_ROUTINES_FOR(ecma_type, kind) \
+  ALLOC (ecma_type, kind) \
+  DEALLOC (ecma_type, kind)
 
-DECLARE_ROUTINES_FOR (object)
-DECLARE_ROUTINES_FOR (number)
-DECLARE_ROUTINES_FOR (collection_header)
-DECLARE_ROUTINES_FOR (collection_chunk)
-DECLARE_ROUTINES_FOR (string)
-DECLARE_ROUTINES_FOR (getter_setter_pointers)
-DECLARE_ROUTINES_FOR (external_pointer)
+DECLARE_ROUTINES_FOR (object, ECMA_ALLOC_KIND_OBJECT)
+DECLARE_ROUTINES_FOR (number, ECMA_ALLOC_KIND_NUMBER)
+DECLARE_ROUTINES_FOR (collection_header, ECMA_ALLOC_KIND_COLLECTION)
+DECLARE_ROUTINES_FOR (collection_chunk, ECMA_ALLOC_KIND_COLLECTION)
+DECLARE_ROUTINES_FOR (string, ECMA_ALLOC_KIND_STRING)
+DECLARE_ROUTINES_FOR (getter_setter_pointers, ECMA_ALLOC_KIND_GETTER_SETTER)
+DECLARE_ROUTINES_FOR (external_pointer, ECMA_ALLOC_KIND_EXTERNAL_POINTER)
+
+/**
+ * Allocate memory for the characters of an ecma-string
+ *
+ * @return pointer to allocated memory
+ */
+void *
+ecma_alloc_string_buffer (size_t size) /**< size of the buffer */
+{
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_STRING_DATA, size);
+  return mem_heap_alloc_block (size);
+} /* ecma_alloc_string_buffer */
+
+/**
+ * Dealloc memory from the characters of an ecma-string
+ */
+void
+ecma_dealloc_string_buffer (void *buffer_p, /**< buffer to be freed */
+                            size_t size) /**< size of the buffer */
+{
+  ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_STRING_DATA, size);
+  mem_heap_free_block (buffer_p, size);
+} /* ecma_dealloc_string_buffer */
 
 /**
  * Allocate memory for ecma-property pair
  *
  * @return pointer to allocated memory
  */
+ecma_string_rope_t *
+ecma_alloc_string_rope (void)
+{
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_STRING, sizeof (ecma_string_rope_t));
+  return mem_heap_alloc_block (sizeof (ecma_string_rope_t));
+} /* ecma_alloc_string_rope */
+
+void
+ecma_dealloc_string_rope (ecma_string_rope_t *rope_p) /**< rope node to be freed */
+{
+  ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_STRING, sizeof (ecma_string_rope_t));
+  mem_heap_free_block (rope_p, sizeof (ecma_string_rope_t));
+} /* ecma_dealloc_string_rope */
+
 ecma_property_pair_t *
 ecma_alloc_property_pair (void)
 {
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_PROPERTY_PAIR, sizeof (ecma_property_pair_t));
   return mem_heap_alloc_block (sizeof (ecma_property_pair_t));
 } /* ecma_alloc_property_pair */
 
@@ -113,9 +154,278 @@ ecma_alloc_property_pair (void)
 extern void
 ecma_dealloc_property_pair (ecma_property_pair_t *property_pair_p) /**< property pair to be freed */
 {
+  ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_PROPERTY_PAIR, sizeof (ecma_property_pair_t));
   mem_heap_free_block (property_pair_p, sizeof (ecma_property_pair_t));
 } /* ecma_dealloc_property_pair */
 
+#ifdef MEM_STATS
+
+/**
+ * Names of the allocation kinds
+ */
+static const char * const ecma_alloc_kind_names[] =
+{
+  "objects",
+  "property pairs",
+  "property slots",
+  "property hashmaps",
+  "shapes",
+  "getter / setter pairs",
+  "external pointers",
+  "array elements",
+  "string descriptors",
+  "string data",
+  "numbers",
+  "collections",
+  "byte code",
+  "regexp byte code",
+  "inline caches",
+  "literal records"
+};
+
+JERRY_STATIC_ASSERT (sizeof (ecma_alloc_kind_names) / sizeof (ecma_alloc_kind_names[0]) == ECMA_ALLOC_KIND__COUNT,
+                     ecma_alloc_kind_names_must_have_an_entry_for_each_allocation_kind);
+
+/**
+ * Number of the allocation sites printed by ecma_alloc_stats_print
+ */
+#define ECMA_ALLOC_STATS_PRINTED_SITES 16
+
+/**
+ * Find or create the statistics of the byte code location which is currently executed
+ *
+ * @return statistics of the allocation site
+ */
+static ecma_alloc_site_stats_t *
+ecma_alloc_stats_find_site (void)
+{
+  const vm_frame_ctx_t *frame_ctx_p = JERRY_CONTEXT (vm_top_context_p);
+
+  if (frame_ctx_p == NULL)
+  {
+    return &JERRY_CONTEXT (ecma_alloc_stats).native_site;
+  }
+
+  const ecma_compiled_code_t *bytecode_p = frame_ctx_p->bytecode_header_p;
+  uint32_t offset = (uint32_t) (frame_ctx_p->current_instruction_p - (const uint8_t *) bytecode_p);
+  uint32_t index = (uint32_t) (((uintptr_t) bytecode_p >> MEM_ALIGNMENT_LOG) + offset);
+
+  for (uint32_t probes = 0; probes < CONFIG_ECMA_ALLOC_SITE_TABLE_SIZE; probes++)
+  {
+    index &= CONFIG_ECMA_ALLOC_SITE_TABLE_SIZE - 1;
+
+    ecma_alloc_site_stats_t *site_p = JERRY_CONTEXT (ecma_alloc_stats).sites + index;
+
+    if (site_p->bytecode_p == NULL)
+    {
+      site_p->bytecode_p = bytecode_p;
+      site_p->offset = offset;
+      return site_p;
+    }
+
+    if (site_p->bytecode_p == bytecode_p && site_p->offset == offset && !site_p->is_freed)
+    {
+      return site_p;
+    }
+
+    index++;
+  }
+
+  return &JERRY_CONTEXT (ecma_alloc_stats).other_sites;
+} /* ecma_alloc_stats_find_site */
+
+/**
+ * Account an allocation
+ */
+void
+ecma_alloc_stats_add (ecma_alloc_kind_t kind, /**< kind of the allocation */
+                      size_t size) /**< size of the allocation */
+{
+  JERRY_ASSERT (kind < ECMA_ALLOC_KIND__COUNT);
+
+  ecma_alloc_kind_stats_t *kind_stats_p = JERRY_CONTEXT (ecma_alloc_stats).kinds + kind;
+
+  kind_stats_p->count++;
+  kind_stats_p->bytes += size;
+  kind_stats_p->total_count++;
+  kind_stats_p->total_bytes += size;
+
+  if (kind_stats_p->bytes > kind_stats_p->peak_bytes)
+  {
+    kind_stats_p->peak_bytes = kind_stats_p->bytes;
+  }
+
+  ecma_alloc_site_stats_t *site_p = ecma_alloc_stats_find_site ();
+
+  site_p->count++;
+  site_p->bytes += size;
+} /* ecma_alloc_stats_add */
+
+/**
+ * Account a deallocation
+ */
+void
+ecma_alloc_stats_remove (ecma_alloc_kind_t kind, /**< kind of the allocation */
+                         size_t size) /**< size of the allocation */
+{
+  JERRY_ASSERT (kind < ECMA_ALLOC_KIND__COUNT);
+
+  ecma_alloc_kind_stats_t *kind_stats_p = JERRY_CONTEXT (ecma_alloc_stats).kinds + kind;
+
+  JERRY_ASSERT (kind_stats_p->count > 0 && kind_stats_p->bytes >= size);
+
+  kind_stats_p->count--;
+  kind_stats_p->bytes -= size;
+} /* ecma_alloc_stats_remove */
+
+/**
+ * Close the allocation sites of a compiled code, which is freed.
+ *
+ * The address of the compiled code might be reused later, so the allocations
+ * of the new compiled code are accounted to new sites.
+ */
+void
+ecma_alloc_stats_free_bytecode (const ecma_compiled_code_t *bytecode_p) /**< compiled code */
+{
+  ecma_alloc_site_stats_t *site_p = JERRY_CONTEXT (ecma_alloc_stats).sites;
+
+  for (uint32_t i = 0; i < CONFIG_ECMA_ALLOC_SITE_TABLE_SIZE; i++, site_p++)
+  {
+    if (site_p->bytecode_p == bytecode_p)
+    {
+      site_p->is_freed = true;
+    }
+  }
+} /* ecma_alloc_stats_free_bytecode */
+
+/**
+ * Get the statistics of an allocation kind
+ */
+void
+ecma_alloc_stats_get (ecma_alloc_kind_t kind, /**< kind of the allocation */
+                      ecma_alloc_kind_stats_t *out_stats_p) /**< [out] statistics */
+{
+  JERRY_ASSERT (kind < ECMA_ALLOC_KIND__COUNT);
+
+  *out_stats_p = JERRY_CONTEXT (ecma_alloc_stats).kinds[kind];
+} /* ecma_alloc_stats_get */
+
+/**
+ * Reset the peak values of the allocation kinds
+ */
+void
+ecma_alloc_stats_reset_peak (void)
+{
+  for (uint32_t kind = 0; kind < ECMA_ALLOC_KIND__COUNT; kind++)
+  {
+    ecma_alloc_kind_stats_t *kind_stats_p = JERRY_CONTEXT (ecma_alloc_stats).kinds + kind;
+
+    kind_stats_p->peak_bytes = kind_stats_p->bytes;
+  }
+} /* ecma_alloc_stats_reset_peak */
+
+/**
+ * Print the statistics of an allocation site
+ */
+static void
+ecma_alloc_stats_print_site (const ecma_alloc_site_stats_t *site_p) /**< allocation site */
+{
+  printf ("  %10zu %10zu  ", site_p->count, site_p->bytes);
+
+  if (site_p == &JERRY_CONTEXT (ecma_alloc_stats).native_site)
+  {
+    printf ("(outside of the byte code)\n");
+  }
+  else if (site_p == &JERRY_CONTEXT (ecma_alloc_stats).other_sites)
+  {
+    printf ("(other locations)\n");
+  }
+  else
+  {
+    printf ("byte code %p%s, offset %u\n",
+            (const void *) site_p->bytecode_p,
+            site_p->is_freed ? " (freed)" : "",
+            (unsigned int) site_p->offset);
+  }
+} /* ecma_alloc_stats_print_site */
+
+/**
+ * Print the statistics of the allocation kinds and the largest allocation sites
+ */
+void
+ecma_alloc_stats_print (void)
+{
+  const ecma_alloc_stats_t *stats_p = &JERRY_CONTEXT (ecma_alloc_stats);
+
+  printf ("Allocation stats:\n");
+  printf ("  %-22s %10s %10s %10s %10s %12s\n", "kind", "count", "bytes", "peak", "allocs", "alloc bytes");
+
+  for (uint32_t kind = 0; kind < ECMA_ALLOC_KIND__COUNT; kind++)
+  {
+    const ecma_alloc_kind_stats_t *kind_stats_p = stats_p->kinds + kind;
+
+    printf ("  %-22s %10zu %10zu %10zu %10zu %12zu\n",
+            ecma_alloc_kind_names[kind],
+            kind_stats_p->count,
+            kind_stats_p->bytes,
+            kind_stats_p->peak_bytes,
+            kind_stats_p->total_count,
+            kind_stats_p->total_bytes);
+  }
+
+  /* The largest sites are selected by repeated scans, which is fast enough for a small table. */
+  const ecma_alloc_site_stats_t *printed_sites[ECMA_ALLOC_STATS_PRINTED_SITES];
+  uint32_t printed_count = 0;
+
+  printf ("\nLargest allocation sites:\n");
+  printf ("  %10s %10s  %s\n", "allocs", "bytes", "location");
+
+  while (printed_count < ECMA_ALLOC_STATS_PRINTED_SITES)
+  {
+    const ecma_alloc_site_stats_t *largest_p = NULL;
+
+    for (uint32_t i = 0; i < CONFIG_ECMA_ALLOC_SITE_TABLE_SIZE + 2; i++)
+    {
+      const ecma_alloc_site_stats_t *site_p;
+
+      if (i < CONFIG_ECMA_ALLOC_SITE_TABLE_SIZE)
+      {
+        site_p = stats_p->sites + i;
+      }
+      else
+      {
+        site_p = (i == CONFIG_ECMA_ALLOC_SITE_TABLE_SIZE) ? &stats_p->native_site : &stats_p->other_sites;
+      }
+
+      bool is_printed = false;
+
+      for (uint32_t j = 0; j < printed_count; j++)
+      {
+        is_printed = is_printed || (printed_sites[j] == site_p);
+      }
+
+      if (!is_printed
+          && site_p->count > 0
+          && (largest_p == NULL || site_p->bytes > largest_p->bytes))
+      {
+        largest_p = site_p;
+      }
+    }
+
+    if (largest_p == NULL)
+    {
+      break;
+    }
+
+    printed_sites[printed_count++] = largest_p;
+    ecma_alloc_stats_print_site (largest_p);
+  }
+
+  printf ("\n");
+} /* ecma_alloc_stats_print */
+
+#endif /* MEM_STATS */
+
 /**
  * @}
  * @}
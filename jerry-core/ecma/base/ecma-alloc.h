@@ -25,6 +25,95 @@
  * @{
  */
 
+/**
+ * Kinds of the allocations, which are accounted separately by the memory statistics
+ */
+typedef enum
+{
+  ECMA_ALLOC_KIND_OBJECT, /**< object or lexical environment */
+  ECMA_ALLOC_KIND_PROPERTY_PAIR, /**< property pair */
+  ECMA_ALLOC_KIND_PROPERTY_SLOTS, /**< property slots of an object with a shape */
+  ECMA_ALLOC_KIND_PROPERTY_HASHMAP, /**< property hashmap */
+  ECMA_ALLOC_KIND_SHAPE, /**< shape */
+  ECMA_ALLOC_KIND_GETTER_SETTER, /**< getter-setter pointer pair */
+  ECMA_ALLOC_KIND_EXTERNAL_POINTER, /**< external pointer */
+  ECMA_ALLOC_KIND_ARRAY_ELEMENTS, /**< elements of a fast array */
+  ECMA_ALLOC_KIND_STRING, /**< string descriptor */
+  ECMA_ALLOC_KIND_STRING_DATA, /**< characters of a string */
+  ECMA_ALLOC_KIND_NUMBER, /**< number */
+  ECMA_ALLOC_KIND_COLLECTION, /**< collection header or chunk */
+  ECMA_ALLOC_KIND_BYTECODE, /**< byte code of a function, eval or global code */
+  ECMA_ALLOC_KIND_REGEXP_BYTECODE, /**< byte code of a regular expression */
+  ECMA_ALLOC_KIND_INLINE_CACHE, /**< inline cache table of a byte code */
+  ECMA_ALLOC_KIND_LITERAL, /**< literal storage record */
+  ECMA_ALLOC_KIND__COUNT /**< number of allocation kinds */
+} ecma_alloc_kind_t;
+
+#ifdef MEM_STATS
+/**
+ * Memory statistics of an allocation kind
+ */
+typedef struct
+{
+  size_t count; /**< number of the currently allocated blocks */
+  size_t bytes; /**< size of the currently allocated blocks */
+  size_t peak_bytes; /**< peak size of the allocated blocks */
+  size_t total_count; /**< number of all allocations */
+  size_t total_bytes; /**< size of all allocations */
+} ecma_alloc_kind_stats_t;
+
+/**
+ * Allocations made by the instructions at a byte code location
+ */
+typedef struct
+{
+  const ecma_compiled_code_t *bytecode_p; /**< compiled code, NULL for unused entries */
+  uint32_t offset; /**< offset of the instruction in the compiled code */
+  bool is_freed; /**< the compiled code is freed, so its address can be reused by another one */
+  size_t count; /**< number of allocations */
+  size_t bytes; /**< size of the allocations */
+} ecma_alloc_site_stats_t;
+
+/**
+ * Memory statistics of the allocation kinds and sites
+ */
+typedef struct
+{
+  ecma_alloc_kind_stats_t kinds[ECMA_ALLOC_KIND__COUNT]; /**< statistics of the allocation kinds */
+  ecma_alloc_site_stats_t sites[CONFIG_ECMA_ALLOC_SITE_TABLE_SIZE]; /**< hash table of the allocation sites */
+  ecma_alloc_site_stats_t other_sites; /**< allocations of the sites which do not fit into the table */
+  ecma_alloc_site_stats_t native_site; /**< allocations made outside of the byte code execution */
+} ecma_alloc_stats_t;
+
+extern void ecma_alloc_stats_add (ecma_alloc_kind_t, size_t);
+extern void ecma_alloc_stats_remove (ecma_alloc_kind_t, size_t);
+extern void ecma_alloc_stats_free_bytecode (const ecma_compiled_code_t *);
+extern void ecma_alloc_stats_get (ecma_alloc_kind_t, ecma_alloc_kind_stats_t *);
+extern void ecma_alloc_stats_reset_peak (void);
+extern void ecma_alloc_stats_print (void);
+
+/**
+ * Account an allocation of the specified kind and size
+ */
+#define ECMA_ALLOC_STATS_ADD(kind, size) ecma_alloc_stats_add ((kind), (size))
+
+/**
+ * Account a deallocation of the specified kind and size
+ */
+#define ECMA_ALLOC_STATS_REMOVE(kind, size) ecma_alloc_stats_remove ((kind), (size))
+#else /* !MEM_STATS */
+
+/**
+ * Allocations are not accounted
+ */
+#define ECMA_ALLOC_STATS_ADD(kind, size)
+
+/**
+ * Deallocations are not accounted
+ */
+#define ECMA_ALLOC_STATS_REMOVE(kind, size)
+#endif /* MEM_STATS */
+
 /**
  * Allocate memory for ecma-object
  *
@@ -85,6 +174,18 @@ extern ecma_string_t *ecma_alloc_string (void);
  */
 extern void ecma_dealloc_string (ecma_string_t *);
 
+/**
+ * Allocate memory for the node of a rope string
+ *
+ * @return pointer to allocated memory
+ */
+extern ecma_string_rope_t *ecma_alloc_string_rope (void);
+
+/**
+ * Dealloc memory from the node of a rope string
+ */
+extern void ecma_dealloc_string_rope (ecma_string_rope_t *);
+
 /**
  * Allocate memory for getter-setter pointer pair
  *
@@ -109,6 +210,18 @@ extern ecma_external_pointer_t *ecma_alloc_external_pointer (void);
 */
 extern void ecma_dealloc_external_pointer (ecma_external_pointer_t *);
 
+/**
+ * Allocate memory for the characters of an ecma-string
+ *
+ * @return pointer to allocated memory
+ */
+extern void *ecma_alloc_string_buffer (size_t);
+
+/**
+ * Dealloc memory from the characters of an ecma-string
+ */
+extern void ecma_dealloc_string_buffer (void *, size_t);
+
 /**
  * Allocate memory for ecma-property pair
  *
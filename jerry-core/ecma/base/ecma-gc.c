@@ -18,11 +18,14 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-array-object.h"
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "ecma-lcache.h"
 #include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "jrt-bit-fields.h"
@@ -42,46 +45,6 @@
  * @{
  */
 
-/**
- * An object's GC color
- *
- * Tri-color marking:
- *   WHITE_GRAY, unvisited -> WHITE // not referenced by a live object or the reference not found yet
- *   WHITE_GRAY, visited   -> GRAY  // referenced by some live object
- *   BLACK                 -> BLACK // all referenced objects are gray or black
- */
-typedef enum
-{
-  ECMA_GC_COLOR_WHITE_GRAY, /**< white or gray */
-  ECMA_GC_COLOR_BLACK, /**< black */
-  ECMA_GC_COLOR__COUNT /**< number of colors */
-} ecma_gc_color_t;
-
-/**
- * List of marked (visited during current GC session) and umarked objects
- */
-static ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT];
-
-/**
- * Current state of an object's visited flag that indicates whether the object is in visited state:
- *  visited_field | visited_flip_flag | real_value
- *         false  |            false  |     false
- *         false  |             true  |      true
- *          true  |            false  |      true
- *          true  |             true  |     false
- */
-static bool ecma_gc_visited_flip_flag = false;
-
-/**
- * Number of currently allocated objects
- */
-static size_t ecma_gc_objects_number = 0;
-
-/**
- * Number of newly allocated objects since last GC session
- */
-static size_t ecma_gc_new_objects_since_last_gc = 0;
-
 static void ecma_gc_mark (ecma_object_t *object_p);
 static void ecma_gc_sweep (ecma_object_t *object_p);
 
@@ -118,7 +81,7 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
 
   bool flag_value = (object_p->type_flags_refs & ECMA_OBJECT_FLAG_GC_VISITED) != 0;
 
-  return flag_value != ecma_gc_visited_flip_flag;
+  return flag_value != JERRY_CONTEXT (ecma_gc_visited_flip_flag);
 } /* ecma_gc_is_object_visited */
 
 /**
@@ -130,7 +93,7 @@ ecma_gc_set_object_visited (ecma_object_t *object_p, /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  if (is_visited != ecma_gc_visited_flip_flag)
+  if (is_visited != JERRY_CONTEXT (ecma_gc_visited_flip_flag))
   {
     object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs | ECMA_OBJECT_FLAG_GC_VISITED);
   }
@@ -140,29 +103,135 @@ ecma_gc_set_object_visited (ecma_object_t *object_p, /**< object */
   }
 } /* ecma_gc_set_object_visited */
 
+/**
+ * Mark an object which is referenced by a marked object
+ *
+ * The object is pushed onto the mark stack, so its references are traced later.
+ * If the stack is full, the overflow is recorded, and the object is traced when
+ * the object list is scanned again.
+ */
+static void
+ecma_gc_visit_object (ecma_object_t *object_p) /**< object */
+{
+  if (ecma_gc_is_object_visited (object_p))
+  {
+    return;
+  }
+
+  ecma_gc_set_object_visited (object_p, true);
+
+  if (likely (JERRY_CONTEXT (ecma_gc_mark_stack_top) < CONFIG_ECMA_GC_MARK_STACK_SIZE))
+  {
+    JERRY_CONTEXT (ecma_gc_mark_stack)[JERRY_CONTEXT (ecma_gc_mark_stack_top)++] = object_p;
+  }
+  else
+  {
+    JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = true;
+  }
+} /* ecma_gc_visit_object */
+
 /**
  * Initialize GC information for the object
  */
 inline void
 ecma_init_gc_info (ecma_object_t *object_p) /**< object */
 {
-  ecma_gc_objects_number++;
-  ecma_gc_new_objects_since_last_gc++;
+  JERRY_CONTEXT (ecma_gc_objects_number)++;
+  JERRY_CONTEXT (ecma_gc_new_objects_since_last_gc)++;
 
-  JERRY_ASSERT (ecma_gc_new_objects_since_last_gc <= ecma_gc_objects_number);
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_new_objects_since_last_gc) <= JERRY_CONTEXT (ecma_gc_objects_number));
 
   JERRY_ASSERT (object_p->type_flags_refs < ECMA_OBJECT_REF_ONE);
   object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs | ECMA_OBJECT_REF_ONE);
 
-  ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY]);
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = object_p;
+  switch (JERRY_CONTEXT (ecma_gc_phase))
+  {
+    case ECMA_GC_PHASE_IDLE:
+    {
+      /* Objects created between collections are young. */
+      ecma_gc_set_object_next (object_p, JERRY_CONTEXT (ecma_gc_young_objects_p));
+      JERRY_CONTEXT (ecma_gc_young_objects_p) = object_p;
+
+      ecma_gc_set_object_visited (object_p, false);
+      break;
+    }
+    case ECMA_GC_PHASE_MARK:
+    {
+      /* Objects created during the mark phase are gray: their references are traced later. */
+      ecma_gc_set_object_next (object_p, JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY]);
+      JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = object_p;
 
-  /* Should be set to false at the beginning of garbage collection */
-  ecma_gc_set_object_visited (object_p, false);
+      ecma_gc_set_object_visited (object_p, false);
+      ecma_gc_visit_object (object_p);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_SWEEP);
+
+      /* Objects created during the sweep phase are black. */
+      ecma_gc_set_object_next (object_p, JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK]);
+      JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] = object_p;
+
+      ecma_gc_set_object_visited (object_p, true);
+      break;
+    }
+  }
 } /* ecma_init_gc_info */
 
+/**
+ * Mark an object during the mark phase of an incremental major collection
+ */
+static inline void __attr_always_inline___
+ecma_gc_mark_phase_barrier (ecma_object_t *object_p) /**< object */
+{
+  if (unlikely (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK)
+      && !ecma_gc_is_object_visited (object_p))
+  {
+#ifdef MEM_STATS
+    JERRY_CONTEXT (ecma_gc_stats).barrier_marked_objects++;
+#endif /* MEM_STATS */
+
+    ecma_gc_visit_object (object_p);
+  }
+} /* ecma_gc_mark_phase_barrier */
+
+/**
+ * Write barrier of the garbage collector
+ *
+ * Must be called when a reference to an object is stored into another object.
+ *
+ * During the mark phase of a major collection the referenced object is marked, so a reference from
+ * an already traced (black) object to an unmarked (white) object is never created.
+ *
+ * Between collections a young object referenced by an old object is marked and pushed onto
+ * the mark stack, which is the remembered set of the next minor collection. Marked young objects
+ * are handled as old ones, so the objects stored into them are remembered as well.
+ */
+void
+ecma_gc_write_barrier (ecma_object_t *holder_p, /**< object which stores the reference
+                                                 *   (NULL, if the object is not known) */
+                       ecma_object_t *object_p) /**< referenced object */
+{
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE)
+  {
+    if (!ecma_gc_is_object_visited (object_p)
+        && (holder_p == NULL || ecma_gc_is_object_visited (holder_p)))
+    {
+      ecma_gc_visit_object (object_p);
+    }
+    return;
+  }
+
+  ecma_gc_mark_phase_barrier (object_p);
+} /* ecma_gc_write_barrier */
+
 /**
  * Increase reference counter of an object
+ *
+ * Note:
+ *      during the mark phase the object is marked, because it is a root,
+ *      which might not be found by the scan of the object list
  */
 void
 ecma_ref_object (ecma_object_t *object_p) /**< object */
@@ -175,16 +244,24 @@ ecma_ref_object (ecma_object_t *object_p) /**< object */
   {
     jerry_fatal (ERR_REF_COUNT_LIMIT);
   }
+
+  ecma_gc_mark_phase_barrier (object_p);
 } /* ecma_ref_object */
 
 /**
  * Decrease reference counter of an object
+ *
+ * Note:
+ *      during the mark phase the object is marked, because it was a root,
+ *      which might not be found by the scan of the object list
  */
 void
 ecma_deref_object (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE);
   object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs - ECMA_OBJECT_REF_ONE);
+
+  ecma_gc_mark_phase_barrier (object_p);
 } /* ecma_deref_object */
 
 /**
@@ -193,30 +270,64 @@ ecma_deref_object (ecma_object_t *object_p) /**< object */
 void
 ecma_gc_init (void)
 {
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = NULL;
-  ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
-  ecma_gc_visited_flip_flag = false;
-  ecma_gc_objects_number = 0;
-  ecma_gc_new_objects_since_last_gc = 0;
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = NULL;
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] = NULL;
+  JERRY_CONTEXT (ecma_gc_visited_flip_flag) = false;
+  JERRY_CONTEXT (ecma_gc_objects_number) = 0;
+  JERRY_CONTEXT (ecma_gc_new_objects_since_last_gc) = 0;
+  JERRY_CONTEXT (ecma_gc_promoted_objects_since_major_gc) = 0;
+  JERRY_CONTEXT (ecma_gc_young_objects_p) = NULL;
+  JERRY_CONTEXT (ecma_gc_mark_stack_top) = 0;
+  JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = false;
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_IDLE;
+  JERRY_CONTEXT (ecma_gc_compaction_requested) = false;
+  JERRY_CONTEXT (ecma_gc_scan_p) = NULL;
+  JERRY_CONTEXT (ecma_gc_is_rescan) = false;
+  JERRY_CONTEXT (ecma_gc_allocations_since_step) = 0;
+
+#ifdef MEM_STATS
+  memset (&JERRY_CONTEXT (ecma_gc_stats), 0, sizeof (ecma_gc_stats_t));
+#endif /* MEM_STATS */
 } /* ecma_gc_init */
 
 /**
- * Mark referenced object from property
+ * Report the references of a property to a callback
+ *
+ * Note:
+ *      the function is always inlined, so the callback of the mark phase is called directly
  */
-static void
-ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
+static inline void __attr_always_inline___
+ecma_gc_trace_property (ecma_property_t *property_p, /**< property */
+                        ecma_property_header_t *container_p, /**< property pair, slots or elements
+                                                              *   which hold the property */
+                        uint32_t index, /**< index of the property in its container */
+                        ecma_gc_reference_callback_t callback, /**< callback */
+                        void *data_p) /**< data passed to the callback */
 {
+  ecma_gc_reference_t reference;
+  reference.property_p = property_p;
+  reference.container_p = container_p;
+  reference.index = index;
+
   switch (ECMA_PROPERTY_GET_TYPE (property_p))
   {
     case ECMA_PROPERTY_TYPE_NAMEDDATA:
     {
       ecma_value_t value = ecma_get_named_data_property_value (property_p);
 
+      reference.edge_type = ECMA_GC_EDGE_VALUE;
+
       if (ecma_is_value_object (value))
       {
-        ecma_object_t *value_obj_p = ecma_get_object_from_value (value);
-
-        ecma_gc_set_object_visited (value_obj_p, true);
+        reference.target_type = ECMA_GC_TARGET_OBJECT;
+        reference.target_p = ecma_get_object_from_value (value);
+        callback (&reference, data_p);
+      }
+      else if (ecma_is_value_string (value))
+      {
+        reference.target_type = ECMA_GC_TARGET_STRING;
+        reference.target_p = ecma_get_string_from_value (value);
+        callback (&reference, data_p);
       }
       break;
     }
@@ -225,14 +336,20 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
       ecma_object_t *getter_obj_p = ecma_get_named_accessor_property_getter (property_p);
       ecma_object_t *setter_obj_p = ecma_get_named_accessor_property_setter (property_p);
 
+      reference.target_type = ECMA_GC_TARGET_OBJECT;
+
       if (getter_obj_p != NULL)
       {
-        ecma_gc_set_object_visited (getter_obj_p, true);
+        reference.edge_type = ECMA_GC_EDGE_GETTER;
+        reference.target_p = getter_obj_p;
+        callback (&reference, data_p);
       }
 
       if (setter_obj_p != NULL)
       {
-        ecma_gc_set_object_visited (setter_obj_p, true);
+        reference.edge_type = ECMA_GC_EDGE_SETTER;
+        reference.target_p = setter_obj_p;
+        callback (&reference, data_p);
       }
       break;
     }
@@ -240,13 +357,13 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
     {
       uint32_t property_value = ECMA_PROPERTY_VALUE_PTR (property_p)->value;
 
+      reference.edge_type = ECMA_GC_EDGE_INTERNAL;
+
       switch (ECMA_PROPERTY_GET_INTERNAL_PROPERTY_TYPE (property_p))
       {
-        case ECMA_INTERNAL_PROPERTY_PRIMITIVE_STRING_VALUE: /* compressed pointer to a ecma_string_t */
         case ECMA_INTERNAL_PROPERTY_PRIMITIVE_NUMBER_VALUE: /* compressed pointer to a ecma_number_t */
         case ECMA_INTERNAL_PROPERTY_PRIMITIVE_BOOLEAN_VALUE: /* a simple boolean value */
         case ECMA_INTERNAL_PROPERTY_CLASS: /* an enum */
-        case ECMA_INTERNAL_PROPERTY_CODE_BYTECODE: /* compressed pointer to a bytecode array */
         case ECMA_INTERNAL_PROPERTY_NATIVE_CODE: /* an external pointer */
         case ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE: /* an external pointer */
         case ECMA_INTERNAL_PROPERTY_FREE_CALLBACK: /* an object's native free callback */
@@ -254,18 +371,45 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
         case ECMA_INTERNAL_PROPERTY_BUILT_IN_ROUTINE_DESC: /* an integer */
         case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_0_31: /* an integer (bit-mask) */
         case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_32_63: /* an integer (bit-mask) */
-        case ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE:
         {
           break;
         }
 
+        case ECMA_INTERNAL_PROPERTY_PRIMITIVE_STRING_VALUE: /* compressed pointer to a ecma_string_t */
+        {
+          reference.target_type = ECMA_GC_TARGET_STRING;
+          reference.target_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, property_value);
+          callback (&reference, data_p);
+          break;
+        }
+
+        case ECMA_INTERNAL_PROPERTY_CODE_BYTECODE: /* compressed pointer to a bytecode array */
+        case ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE: /* compressed pointer to a regexp bytecode array */
+        {
+          ecma_compiled_code_t *bytecode_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t, property_value);
+
+          if (bytecode_p != NULL)
+          {
+            reference.target_type = ECMA_GC_TARGET_BYTECODE;
+            reference.target_p = bytecode_p;
+            callback (&reference, data_p);
+          }
+          break;
+        }
+
         case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_THIS: /* an ecma value */
         {
           if (ecma_is_value_object (property_value))
           {
-            ecma_object_t *obj_p = ecma_get_object_from_value (property_value);
-
-            ecma_gc_set_object_visited (obj_p, true);
+            reference.target_type = ECMA_GC_TARGET_OBJECT;
+            reference.target_p = ecma_get_object_from_value (property_value);
+            callback (&reference, data_p);
+          }
+          else if (ecma_is_value_string (property_value))
+          {
+            reference.target_type = ECMA_GC_TARGET_STRING;
+            reference.target_p = ecma_get_string_from_value (property_value);
+            callback (&reference, data_p);
           }
 
           break;
@@ -276,6 +420,10 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
           ecma_collection_header_t *bound_arg_list_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_collection_header_t,
                                                                                         property_value);
 
+          reference.target_type = ECMA_GC_TARGET_COLLECTION;
+          reference.target_p = bound_arg_list_p;
+          callback (&reference, data_p);
+
           ecma_collection_iterator_t bound_args_iterator;
           ecma_collection_iterator_init (&bound_args_iterator, bound_arg_list_p);
 
@@ -286,9 +434,9 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
 
             if (ecma_is_value_object (*bound_args_iterator.current_value_p))
             {
-              ecma_object_t *obj_p = ecma_get_object_from_value (*bound_args_iterator.current_value_p);
-
-              ecma_gc_set_object_visited (obj_p, true);
+              reference.target_type = ECMA_GC_TARGET_OBJECT;
+              reference.target_p = ecma_get_object_from_value (*bound_args_iterator.current_value_p);
+              callback (&reference, data_p);
             }
           }
 
@@ -299,10 +447,9 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
         case ECMA_INTERNAL_PROPERTY_SCOPE: /* a lexical environment */
         case ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP: /* an object */
         {
-          ecma_object_t *obj_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_object_t, property_value);
-
-          ecma_gc_set_object_visited (obj_p, true);
-
+          reference.target_type = ECMA_GC_TARGET_OBJECT;
+          reference.target_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_object_t, property_value);
+          callback (&reference, data_p);
           break;
         }
         case ECMA_INTERNAL_PROPERTY__COUNT: /* not a real internal property type,
@@ -320,16 +467,24 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
       break;
     }
   }
-} /* ecma_gc_mark_property */
+} /* ecma_gc_trace_property */
 
 /**
- * Mark objects as visited starting from specified object as root
+ * Report the references of an object to a callback
+ *
+ * Note:
+ *      the function is always inlined, so the callback of the mark phase is called directly
  */
-void
-ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
+static inline void __attr_always_inline___
+ecma_gc_trace_object (ecma_object_t *object_p, /**< object */
+                      ecma_gc_reference_callback_t callback, /**< callback */
+                      void *data_p) /**< data passed to the callback */
 {
-  JERRY_ASSERT (object_p != NULL);
-  JERRY_ASSERT (ecma_gc_is_object_visited (object_p));
+  ecma_gc_reference_t reference;
+  reference.target_type = ECMA_GC_TARGET_OBJECT;
+  reference.property_p = NULL;
+  reference.container_p = NULL;
+  reference.index = 0;
 
   bool traverse_properties = true;
 
@@ -338,13 +493,16 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
     ecma_object_t *lex_env_p = ecma_get_lex_env_outer_reference (object_p);
     if (lex_env_p != NULL)
     {
-      ecma_gc_set_object_visited (lex_env_p, true);
+      reference.edge_type = ECMA_GC_EDGE_OUTER_ENVIRONMENT;
+      reference.target_p = lex_env_p;
+      callback (&reference, data_p);
     }
 
     if (ecma_get_lex_env_type (object_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
     {
-      ecma_object_t *binding_object_p = ecma_get_lex_env_binding_object (object_p);
-      ecma_gc_set_object_visited (binding_object_p, true);
+      reference.edge_type = ECMA_GC_EDGE_BINDING_OBJECT;
+      reference.target_p = ecma_get_lex_env_binding_object (object_p);
+      callback (&reference, data_p);
 
       traverse_properties = false;
     }
@@ -354,7 +512,9 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
     ecma_object_t *proto_p = ecma_get_object_prototype (object_p);
     if (proto_p != NULL)
     {
-      ecma_gc_set_object_visited (proto_p, true);
+      reference.edge_type = ECMA_GC_EDGE_PROTOTYPE;
+      reference.target_p = proto_p;
+      callback (&reference, data_p);
     }
   }
 
@@ -369,26 +529,110 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
                                       prop_iter_p->next_property_cp);
     }
 
+    if (prop_iter_p != NULL
+        && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_SLOTS)
+    {
+      ecma_property_slots_t *slots_p = (ecma_property_slots_t *) prop_iter_p;
+      ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+
+      for (uint32_t i = 0; i < shape_p->slot_count; i++)
+      {
+        ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET (slots_p, i);
+
+        if (property_p->type_and_flags != ECMA_PROPERTY_TYPE_DELETED)
+        {
+          ecma_gc_trace_property (property_p, prop_iter_p, i, callback, data_p);
+        }
+      }
+
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                      prop_iter_p->next_property_cp);
+    }
+    else if (prop_iter_p != NULL
+             && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_ELEMENTS)
+    {
+      ecma_array_elements_t *elements_p = (ecma_array_elements_t *) prop_iter_p;
+
+      /* All allocated elements are visited, because the elements
+       * above the length are valid during array conversion. */
+      for (uint32_t i = 0; i < elements_p->capacity; i++)
+      {
+        ecma_property_t *property_p = ECMA_ARRAY_ELEMENTS_GET (elements_p, i);
+
+        if (property_p->type_and_flags != ECMA_PROPERTY_TYPE_DELETED)
+        {
+          ecma_gc_trace_property (property_p, prop_iter_p, i, callback, data_p);
+        }
+      }
+
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                      prop_iter_p->next_property_cp);
+    }
+
     while (prop_iter_p != NULL)
     {
       JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
 
       if (prop_iter_p->types[0].type_and_flags != ECMA_PROPERTY_TYPE_DELETED)
       {
-        ecma_gc_mark_property (prop_iter_p->types + 0);
+        ecma_gc_trace_property (prop_iter_p->types + 0, prop_iter_p, 0, callback, data_p);
       }
 
       if (prop_iter_p->types[1].type_and_flags != ECMA_PROPERTY_TYPE_DELETED)
       {
-        ecma_gc_mark_property (prop_iter_p->types + 1);
+        ecma_gc_trace_property (prop_iter_p->types + 1, prop_iter_p, 1, callback, data_p);
       }
 
       prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
                                       prop_iter_p->next_property_cp);
     }
   }
+} /* ecma_gc_trace_object */
+
+/**
+ * Mark the object of a reference
+ */
+static inline void __attr_always_inline___
+ecma_gc_mark_reference (const ecma_gc_reference_t *reference_p, /**< reference */
+                        void *data_p) /**< unused */
+{
+  (void) data_p;
+
+  if (reference_p->target_type == ECMA_GC_TARGET_OBJECT)
+  {
+    ecma_gc_visit_object ((ecma_object_t *) reference_p->target_p);
+  }
+} /* ecma_gc_mark_reference */
+
+/**
+ * Mark objects as visited starting from specified object as root
+ */
+void
+ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (ecma_gc_is_object_visited (object_p));
+
+#ifdef MEM_STATS
+  JERRY_CONTEXT (ecma_gc_stats).traced_objects++;
+#endif /* MEM_STATS */
+
+  ecma_gc_trace_object (object_p, ecma_gc_mark_reference, NULL);
 } /* ecma_gc_mark */
 
+/**
+ * Report the references of an object (the same references which are traced by the mark phase)
+ */
+void
+ecma_gc_trace_references (ecma_object_t *object_p, /**< object */
+                          ecma_gc_reference_callback_t callback, /**< callback */
+                          void *data_p) /**< data passed to the callback */
+{
+  JERRY_ASSERT (object_p != NULL && callback != NULL);
+
+  ecma_gc_trace_object (object_p, callback, data_p);
+} /* ecma_gc_trace_references */
+
 /**
  * Free specified object
  */
@@ -432,6 +676,19 @@ ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
       prop_iter_p = ecma_get_property_list (object_p);
     }
 
+    if (prop_iter_p != NULL
+        && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_SLOTS)
+    {
+      ecma_shape_free_property_slots (object_p);
+      prop_iter_p = ecma_get_property_list (object_p);
+    }
+    else if (prop_iter_p != NULL
+             && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_ELEMENTS)
+    {
+      ecma_op_array_free_elements (object_p);
+      prop_iter_p = ecma_get_property_list (object_p);
+    }
+
     while (prop_iter_p != NULL)
     {
       JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
@@ -468,99 +725,539 @@ ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
     }
   }
 
-  JERRY_ASSERT (ecma_gc_objects_number > 0);
-  ecma_gc_objects_number--;
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_objects_number) > 0);
+  JERRY_CONTEXT (ecma_gc_objects_number)--;
+
+#ifdef MEM_STATS
+  JERRY_CONTEXT (ecma_gc_stats).swept_objects++;
+#endif /* MEM_STATS */
 
   ecma_dealloc_object (object_p);
 } /* ecma_gc_sweep */
 
 /**
- * Run garbage collecting
+ * Trace the objects of the mark stack until the stack is empty
+ */
+static void
+ecma_gc_process_mark_stack (void)
+{
+  while (JERRY_CONTEXT (ecma_gc_mark_stack_top) > 0)
+  {
+    ecma_object_t *object_p = JERRY_CONTEXT (ecma_gc_mark_stack)[--JERRY_CONTEXT (ecma_gc_mark_stack_top)];
+
+    ecma_gc_mark (object_p);
+  }
+} /* ecma_gc_process_mark_stack */
+
+/**
+ * Run a minor garbage collection
+ *
+ * Only the young objects are traced: the roots are the young objects referenced from stack or globals,
+ * and the young objects of the remembered set (which are already marked and pushed onto the mark stack).
+ * Old objects are marked, so the tracing stops at them. Surviving young objects are promoted to the old
+ * generation (without moving them), and the others are freed.
  */
 void
-ecma_gc_run (void)
+ecma_gc_run_minor (void)
 {
-  ecma_gc_new_objects_since_last_gc = 0;
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE);
+
+#ifdef MEM_STATS
+  double start_time = jerry_port_get_current_time ();
+#endif /* MEM_STATS */
 
-  JERRY_ASSERT (ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] == NULL);
+  JERRY_CONTEXT (ecma_gc_new_objects_since_last_gc) = 0;
 
-  /* if some object is referenced from stack or globals (i.e. it is root), mark it */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
+  /* The remembered young objects are traced first, while the mark stack has free space for their references. */
+  ecma_gc_process_mark_stack ();
+
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_young_objects_p);
        obj_iter_p != NULL;
        obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
   {
-    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
-
     if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
     {
-      ecma_gc_set_object_visited (obj_iter_p, true);
+      ecma_gc_visit_object (obj_iter_p);
+      ecma_gc_process_mark_stack ();
     }
   }
 
-  bool marked_anything_during_current_iteration = false;
-
-  do
+  /* Overflows of the mark stack (or of the remembered set) are handled by tracing the marked young objects again. */
+  while (JERRY_CONTEXT (ecma_gc_mark_stack_overflow))
   {
-    marked_anything_during_current_iteration = false;
+    JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = false;
+
+#ifdef MEM_STATS
+    JERRY_CONTEXT (ecma_gc_stats).overflow_rescans++;
+#endif /* MEM_STATS */
 
-    for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_prev_p = NULL, *obj_next_p;
+    for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_young_objects_p);
          obj_iter_p != NULL;
-         obj_iter_p = obj_next_p)
+         obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
     {
-      obj_next_p = ecma_gc_get_object_next (obj_iter_p);
-
       if (ecma_gc_is_object_visited (obj_iter_p))
       {
-        /* Moving the object to list of marked objects */
-        ecma_gc_set_object_next (obj_iter_p, ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK]);
-        ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = obj_iter_p;
+        ecma_gc_mark (obj_iter_p);
+        ecma_gc_process_mark_stack ();
+      }
+    }
+  }
 
-        if (likely (obj_prev_p != NULL))
-        {
-          JERRY_ASSERT (ecma_gc_get_object_next (obj_prev_p) == obj_iter_p);
+  /* Promoting the marked young objects, and sweeping the others */
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_young_objects_p), *obj_next_p;
+       obj_iter_p != NULL;
+       obj_iter_p = obj_next_p)
+  {
+    obj_next_p = ecma_gc_get_object_next (obj_iter_p);
 
-          ecma_gc_set_object_next (obj_prev_p, obj_next_p);
-        }
-        else
-        {
-          ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = obj_next_p;
-        }
+    if (ecma_gc_is_object_visited (obj_iter_p))
+    {
+      ecma_gc_set_object_next (obj_iter_p, JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY]);
+      JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = obj_iter_p;
+      JERRY_CONTEXT (ecma_gc_promoted_objects_since_major_gc)++;
 
-        ecma_gc_mark (obj_iter_p);
-        marked_anything_during_current_iteration = true;
-      }
-      else
-      {
-        obj_prev_p = obj_iter_p;
-      }
+#ifdef MEM_STATS
+      JERRY_CONTEXT (ecma_gc_stats).promoted_objects++;
+#endif /* MEM_STATS */
+    }
+    else
+    {
+      ecma_gc_sweep (obj_iter_p);
     }
   }
-  while (marked_anything_during_current_iteration);
 
-  /* Sweeping objects that are currently unmarked */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_next_p;
+  JERRY_CONTEXT (ecma_gc_young_objects_p) = NULL;
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
+  /* Free RegExp bytecodes stored in cache */
+  re_cache_gc_run ();
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
+
+#ifdef MEM_STATS
+  ecma_gc_stats_t *stats_p = &JERRY_CONTEXT (ecma_gc_stats);
+  size_t pause_us = (size_t) ((jerry_port_get_current_time () - start_time) * 1000.0);
+
+  stats_p->minor_run_count++;
+  stats_p->total_pause_us += pause_us;
+  stats_p->max_minor_pause_us = JERRY_MAX (stats_p->max_minor_pause_us, pause_us);
+#endif /* MEM_STATS */
+} /* ecma_gc_run_minor */
+
+/**
+ * Start a major garbage collection
+ */
+static void
+ecma_gc_start (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE);
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] == NULL);
+
+  /* The young objects are promoted, so every object is marked before the marks are cleared by the flip. */
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_young_objects_p), *obj_next_p;
        obj_iter_p != NULL;
        obj_iter_p = obj_next_p)
   {
     obj_next_p = ecma_gc_get_object_next (obj_iter_p);
 
-    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+    ecma_gc_set_object_visited (obj_iter_p, true);
+    ecma_gc_set_object_next (obj_iter_p, JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY]);
+    JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = obj_iter_p;
+  }
+
+  JERRY_CONTEXT (ecma_gc_young_objects_p) = NULL;
+  JERRY_CONTEXT (ecma_gc_visited_flip_flag) = !JERRY_CONTEXT (ecma_gc_visited_flip_flag);
+
+  /* The remembered set is not needed anymore. */
+  JERRY_CONTEXT (ecma_gc_mark_stack_top) = 0;
+  JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = false;
+
+  JERRY_CONTEXT (ecma_gc_new_objects_since_last_gc) = 0;
+  JERRY_CONTEXT (ecma_gc_promoted_objects_since_major_gc) = 0;
+  JERRY_CONTEXT (ecma_gc_allocations_since_step) = 0;
+  JERRY_CONTEXT (ecma_gc_is_rescan) = false;
+  JERRY_CONTEXT (ecma_gc_scan_p) = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY];
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_MARK;
+} /* ecma_gc_start */
+
+/**
+ * Do marking work until the budget is exhausted or the mark phase is finished
+ *
+ * The objects of the mark stack are traced first. When the stack is empty, the scan of the object
+ * list is continued: in the first scan, the roots (objects referenced from stack or globals) are
+ * marked, and if the mark stack has overflowed, the marked objects are traced again by further scans
+ * (tracing an object twice has no effect). The objects created after the start of the collection
+ * are inserted before the scanned part of the list, but these objects are marked when they are created.
+ *
+ * @return remaining budget
+ */
+static uint32_t
+ecma_gc_mark_step (uint32_t budget) /**< maximum number of objects to process */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK);
+
+  while (budget > 0)
+  {
+    if (JERRY_CONTEXT (ecma_gc_mark_stack_top) > 0)
+    {
+      ecma_object_t *object_p = JERRY_CONTEXT (ecma_gc_mark_stack)[--JERRY_CONTEXT (ecma_gc_mark_stack_top)];
 
-    ecma_gc_sweep (obj_iter_p);
+      ecma_gc_mark (object_p);
+      budget--;
+    }
+    else if (JERRY_CONTEXT (ecma_gc_scan_p) != NULL)
+    {
+      ecma_object_t *object_p = JERRY_CONTEXT (ecma_gc_scan_p);
+      JERRY_CONTEXT (ecma_gc_scan_p) = ecma_gc_get_object_next (object_p);
+
+      if (JERRY_CONTEXT (ecma_gc_is_rescan))
+      {
+        if (ecma_gc_is_object_visited (object_p))
+        {
+          ecma_gc_mark (object_p);
+        }
+      }
+      else if (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+      {
+        ecma_gc_visit_object (object_p);
+      }
+
+      budget--;
+    }
+    else if (JERRY_CONTEXT (ecma_gc_mark_stack_overflow))
+    {
+      JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = false;
+      JERRY_CONTEXT (ecma_gc_is_rescan) = true;
+      JERRY_CONTEXT (ecma_gc_scan_p) = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY];
+
+#ifdef MEM_STATS
+      JERRY_CONTEXT (ecma_gc_stats).overflow_rescans++;
+#endif /* MEM_STATS */
+    }
+    else
+    {
+      /* All reachable objects are marked. */
+      JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_SWEEP;
+      break;
+    }
   }
 
-  /* Unmarking all objects */
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK];
-  ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
+  return budget;
+} /* ecma_gc_mark_step */
+
+/**
+ * Finish a garbage collection, after all objects are swept
+ */
+static void
+ecma_gc_finish (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_SWEEP);
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] == NULL);
+
+  /* The surviving objects are old, and they stay marked until the next major collection */
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] =
+    JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK];
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] = NULL;
 
-  ecma_gc_visited_flip_flag = !ecma_gc_visited_flip_flag;
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_IDLE;
 
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
   /* Free RegExp bytecodes stored in cache */
   re_cache_gc_run ();
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
+
+#ifdef MEM_STATS
+  JERRY_CONTEXT (ecma_gc_stats).run_count++;
+#endif /* MEM_STATS */
+} /* ecma_gc_finish */
+
+/**
+ * Do sweeping work until the budget is exhausted or the collection is finished
+ *
+ * The marked objects are moved to the list of marked objects, and the unmarked objects are freed.
+ * The unmarked objects are unreachable, so the mutator cannot access them between the steps.
+ *
+ * @return remaining budget
+ */
+static uint32_t
+ecma_gc_sweep_step (uint32_t budget) /**< maximum number of objects to process */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_SWEEP);
+
+  while (budget > 0)
+  {
+    ecma_object_t *object_p = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY];
+
+    if (object_p == NULL)
+    {
+      ecma_gc_finish ();
+      break;
+    }
+
+    JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = ecma_gc_get_object_next (object_p);
+
+    if (ecma_gc_is_object_visited (object_p))
+    {
+      ecma_gc_set_object_next (object_p, JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK]);
+      JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] = object_p;
+    }
+    else
+    {
+      ecma_gc_sweep (object_p);
+    }
+
+    budget--;
+  }
+
+  return budget;
+} /* ecma_gc_sweep_step */
+
+/**
+ * Complete the current garbage collection without interruption
+ */
+static void
+ecma_gc_complete (void)
+{
+  while (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE)
+  {
+    if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK)
+    {
+      ecma_gc_mark_step (UINT32_MAX);
+    }
+    else
+    {
+      ecma_gc_sweep_step (UINT32_MAX);
+    }
+  }
+} /* ecma_gc_complete */
+
+#ifdef MEM_STATS
+
+/**
+ * Register the length of a garbage collector pause
+ */
+static void
+ecma_gc_register_pause (double start_time, /**< start time of the pause */
+                        bool is_step) /**< the pause is an incremental step */
+{
+  ecma_gc_stats_t *stats_p = &JERRY_CONTEXT (ecma_gc_stats);
+  size_t pause_us = (size_t) ((jerry_port_get_current_time () - start_time) * 1000.0);
+
+  stats_p->total_pause_us += pause_us;
+
+  if (is_step)
+  {
+    stats_p->step_count++;
+    stats_p->max_step_pause_us = JERRY_MAX (stats_p->max_step_pause_us, pause_us);
+  }
+  else
+  {
+    stats_p->full_run_count++;
+    stats_p->max_pause_us = JERRY_MAX (stats_p->max_pause_us, pause_us);
+  }
+} /* ecma_gc_register_pause */
+
+#endif /* MEM_STATS */
+
+/**
+ * Run garbage collecting
+ *
+ * All objects which are unreachable when the function is called are freed.
+ */
+void
+ecma_gc_run (void)
+{
+#ifdef MEM_STATS
+  double start_time = jerry_port_get_current_time ();
+#endif /* MEM_STATS */
+
+  /*
+   * An interrupted collection is completed first. It keeps alive the objects
+   * which became unreachable after it was started, so a new collection follows.
+   */
+  if (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE)
+  {
+    ecma_gc_complete ();
+  }
+
+  ecma_gc_start ();
+  ecma_gc_complete ();
+
+#ifdef MEM_STATS
+  ecma_gc_register_pause (start_time, false);
+#endif /* MEM_STATS */
 } /* ecma_gc_run */
 
+/**
+ * Perform a step of an incremental garbage collection
+ *
+ * A new collection is started if no collection is in progress.
+ *
+ * @return true - if the collection is finished,
+ *         false - otherwise
+ */
+bool
+ecma_gc_step (uint32_t budget) /**< maximum number of objects to process */
+{
+#ifdef MEM_STATS
+  double start_time = jerry_port_get_current_time ();
+#endif /* MEM_STATS */
+
+  JERRY_CONTEXT (ecma_gc_allocations_since_step) = 0;
+
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE)
+  {
+    ecma_gc_start ();
+  }
+
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK)
+  {
+    budget = ecma_gc_mark_step (budget);
+  }
+
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_SWEEP)
+  {
+    ecma_gc_sweep_step (budget);
+  }
+
+#ifdef MEM_STATS
+  ecma_gc_register_pause (start_time, true);
+#endif /* MEM_STATS */
+
+  return JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE;
+} /* ecma_gc_step */
+
+/**
+ * Advance the current garbage collection before an object is allocated
+ *
+ * A step is performed after every CONFIG_ECMA_GC_STEP_ALLOCATIONS allocations,
+ * so the collection keeps up with the allocation rate of the mutator.
+ */
+void
+ecma_gc_allocation_step (void)
+{
+  if (unlikely (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE)
+      && ++JERRY_CONTEXT (ecma_gc_allocations_since_step) >= CONFIG_ECMA_GC_STEP_ALLOCATIONS)
+  {
+    ecma_gc_step (CONFIG_ECMA_GC_STEP_BUDGET);
+  }
+} /* ecma_gc_allocation_step */
+
+/**
+ * Move the property vectors of an object to lower heap addresses
+ *
+ * @return number of moved blocks
+ */
+static uint32_t
+ecma_gc_compact_object (ecma_object_t *object_p) /**< object */
+{
+  if (ecma_is_lexical_environment (object_p)
+      && ecma_get_lex_env_type (object_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  {
+    return 0;
+  }
+
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
+  size_t moved_size;
+  uint32_t moved_blocks = 0;
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    moved_size = ecma_property_hashmap_relocate (object_p);
+
+#ifdef MEM_STATS
+    JERRY_CONTEXT (ecma_gc_stats).relocated_bytes += moved_size;
+#endif /* MEM_STATS */
+
+    moved_blocks += (moved_size > 0) ? 1 : 0;
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    ecma_get_property_list (object_p)->next_property_cp);
+  }
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_SLOTS)
+  {
+    moved_size = ecma_shape_relocate_property_slots (object_p);
+  }
+  else if (prop_iter_p != NULL
+           && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_ELEMENTS)
+  {
+    moved_size = ecma_op_array_relocate_elements (object_p);
+  }
+  else
+  {
+    moved_size = 0;
+  }
+
+#ifdef MEM_STATS
+  JERRY_CONTEXT (ecma_gc_stats).relocated_bytes += moved_size;
+#endif /* MEM_STATS */
+
+  return moved_blocks + ((moved_size > 0) ? 1 : 0);
+} /* ecma_gc_compact_object */
+
+/**
+ * Compact the heap
+ *
+ * The objects and the other blocks referenced by raw pointers cannot be moved, but the property
+ * hashmaps, slot vectors and element vectors of the objects are referenced only by compressed
+ * pointers of their objects. These blocks are moved to the free regions with the lowest addresses,
+ * so the free space which is left between them is merged into larger free regions.
+ *
+ * Note:
+ *      the vectors can be reallocated whenever user code runs (e.g. when it adds properties),
+ *      so pointers to them are never kept while user code may run. The heap must only be
+ *      compacted at such points (e.g. by an API call or when a function is called).
+ */
+void
+ecma_gc_compact (void)
+{
+  JERRY_CONTEXT (ecma_gc_compaction_requested) = false;
+
+  /* The lookup cache refers to the properties stored in the vectors. */
+  ecma_lcache_invalidate_all ();
+  mem_pools_collect_empty ();
+
+#ifdef MEM_STATS
+  mem_heap_fragmentation_t fragmentation;
+  mem_heap_get_fragmentation (&fragmentation);
+
+  ecma_gc_stats_t *stats_p = &JERRY_CONTEXT (ecma_gc_stats);
+  stats_p->fragmentation_before_compaction = mem_heap_get_fragmentation_percent (&fragmentation);
+#endif /* MEM_STATS */
+
+  uint32_t moved_blocks = 0;
+
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_young_objects_p);
+       obj_iter_p != NULL;
+       obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
+  {
+    moved_blocks += ecma_gc_compact_object (obj_iter_p);
+  }
+
+  for (ecma_gc_color_t color = ECMA_GC_COLOR_WHITE_GRAY;
+       color < ECMA_GC_COLOR__COUNT;
+       color = (ecma_gc_color_t) (color + 1))
+  {
+    for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists)[color];
+         obj_iter_p != NULL;
+         obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
+    {
+      moved_blocks += ecma_gc_compact_object (obj_iter_p);
+    }
+  }
+
+#ifdef MEM_STATS
+  mem_heap_get_fragmentation (&fragmentation);
+
+  stats_p->compaction_count++;
+  stats_p->relocated_blocks += moved_blocks;
+  stats_p->fragmentation_after_compaction = mem_heap_get_fragmentation_percent (&fragmentation);
+#else /* !MEM_STATS */
+  (void) moved_blocks;
+#endif /* MEM_STATS */
+} /* ecma_gc_compact */
+
 /**
  * Try to free some memory (depending on severity).
  */
@@ -573,10 +1270,26 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
     /*
      * If there is enough newly allocated objects since last GC, probably it is worthwhile to start GC now.
      * Otherwise, probability to free sufficient space is considered to be low.
+     *
+     * Usually only the young objects are collected. A major collection is started, when many objects
+     * were promoted since the last one, and it is done incrementally: the request only advances it by a step.
      */
-    if (ecma_gc_new_objects_since_last_gc * CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC > ecma_gc_objects_number)
+    if (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE)
     {
-      ecma_gc_run ();
+      ecma_gc_step (CONFIG_ECMA_GC_STEP_BUDGET);
+    }
+    else if (JERRY_CONTEXT (ecma_gc_new_objects_since_last_gc) * CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC
+             > JERRY_CONTEXT (ecma_gc_objects_number))
+    {
+      if (JERRY_CONTEXT (ecma_gc_promoted_objects_since_major_gc)
+          * CONFIG_ECMA_GC_PROMOTED_OBJECTS_SHARE_TO_START_MAJOR_GC > JERRY_CONTEXT (ecma_gc_objects_number))
+      {
+        ecma_gc_step (CONFIG_ECMA_GC_STEP_BUDGET);
+      }
+      else
+      {
+        ecma_gc_run_minor ();
+      }
     }
   }
   else
@@ -587,9 +1300,77 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
     ecma_lcache_invalidate_all ();
 
     ecma_gc_run ();
+
+    ecma_shape_free_unused ();
+
+    /*
+     * The heap cannot be compacted here, because the allocating code may keep pointers to movable blocks,
+     * so a fragmented heap is compacted at the next safe point.
+     */
+    mem_heap_fragmentation_t fragmentation;
+
+    mem_pools_collect_empty ();
+    mem_heap_get_fragmentation (&fragmentation);
+
+    if (mem_heap_get_fragmentation_percent (&fragmentation) > CONFIG_ECMA_GC_COMPACT_FRAGMENTATION)
+    {
+      JERRY_CONTEXT (ecma_gc_compaction_requested) = true;
+    }
   }
 } /* ecma_try_to_give_back_some_memory */
 
+#ifdef MEM_STATS
+/**
+ * Print garbage collector statistics
+ */
+void
+ecma_gc_stats_print (void)
+{
+  const ecma_gc_stats_t *stats_p = &JERRY_CONTEXT (ecma_gc_stats);
+  size_t pause_count = stats_p->full_run_count + stats_p->step_count + stats_p->minor_run_count;
+
+  printf ("GC stats:\n"
+          "  Major collections: %zu\n"
+          "  Minor collections: %zu\n"
+          "  Promoted objects: %zu\n"
+          "  Uninterrupted collections: %zu\n"
+          "  Incremental steps: %zu\n"
+          "  Traced objects: %zu\n"
+          "  Swept objects: %zu\n"
+          "  Objects marked by barriers: %zu\n"
+          "  Mark stack overflow rescans: %zu\n"
+          "  Total pause: %zu us\n"
+          "  Average pause: %zu us\n"
+          "  Maximum uninterrupted collection pause: %zu us\n"
+          "  Maximum incremental step pause: %zu us (step budget: %u objects)\n"
+          "  Maximum minor collection pause: %zu us\n"
+          "  Heap compactions: %zu\n"
+          "  Relocated blocks: %zu (%zu bytes)\n"
+          "  Fragmentation before / after the last compaction: %u%% / %u%%\n"
+          "\n",
+          stats_p->run_count,
+          stats_p->minor_run_count,
+          stats_p->promoted_objects,
+          stats_p->full_run_count,
+          stats_p->step_count,
+          stats_p->traced_objects,
+          stats_p->swept_objects,
+          stats_p->barrier_marked_objects,
+          stats_p->overflow_rescans,
+          stats_p->total_pause_us,
+          pause_count > 0 ? stats_p->total_pause_us / pause_count : 0,
+          stats_p->max_pause_us,
+          stats_p->max_step_pause_us,
+          (unsigned int) CONFIG_ECMA_GC_STEP_BUDGET,
+          stats_p->max_minor_pause_us,
+          stats_p->compaction_count,
+          stats_p->relocated_blocks,
+          stats_p->relocated_bytes,
+          (unsigned int) stats_p->fragmentation_before_compaction,
+          (unsigned int) stats_p->fragmentation_after_compaction);
+} /* ecma_gc_stats_print */
+#endif /* MEM_STATS */
+
 /**
  * @}
  * @}
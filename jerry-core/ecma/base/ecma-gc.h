@@ -26,13 +26,129 @@
  * @{
  */
 
+/**
+ * An object's GC color
+ *
+ * Tri-color marking:
+ *   WHITE_GRAY, unvisited -> WHITE // not referenced by a live object or the reference not found yet
+ *   WHITE_GRAY, visited   -> GRAY  // referenced by some live object
+ *   BLACK                 -> BLACK // all referenced objects are gray or black
+ *
+ * Between major collections the visited flag of the old objects is kept set (sticky mark bits):
+ *   WHITE_GRAY, visited   -> OLD   // survived a collection
+ *   young list, unvisited -> YOUNG // created after the last collection
+ */
+typedef enum
+{
+  ECMA_GC_COLOR_WHITE_GRAY, /**< white or gray */
+  ECMA_GC_COLOR_BLACK, /**< black */
+  ECMA_GC_COLOR__COUNT /**< number of colors */
+} ecma_gc_color_t;
+
+/**
+ * Phases of a garbage collection
+ *
+ * A collection is done in bounded steps, and the mutator runs between the steps:
+ *   IDLE  -> MARK  // a collection is started
+ *   MARK  -> SWEEP // no gray object is left after the roots are scanned
+ *   SWEEP -> IDLE  // all objects of the white / gray list are swept or moved to the black list
+ */
+typedef enum
+{
+  ECMA_GC_PHASE_IDLE, /**< no collection is in progress */
+  ECMA_GC_PHASE_MARK, /**< roots are scanned and objects are traced */
+  ECMA_GC_PHASE_SWEEP /**< unmarked objects are freed */
+} ecma_gc_phase_t;
+
+/**
+ * Kinds of the heap entities referenced by an object
+ */
+typedef enum
+{
+  ECMA_GC_TARGET_OBJECT, /**< object or lexical environment */
+  ECMA_GC_TARGET_STRING, /**< string */
+  ECMA_GC_TARGET_BYTECODE, /**< byte code of a function or a regular expression */
+  ECMA_GC_TARGET_COLLECTION /**< collection of values */
+} ecma_gc_target_type_t;
+
+/**
+ * Kinds of the references of an object
+ */
+typedef enum
+{
+  ECMA_GC_EDGE_PROTOTYPE, /**< prototype of an object */
+  ECMA_GC_EDGE_OUTER_ENVIRONMENT, /**< outer reference of a lexical environment */
+  ECMA_GC_EDGE_BINDING_OBJECT, /**< binding object of an object-bound lexical environment */
+  ECMA_GC_EDGE_VALUE, /**< value of a named data property */
+  ECMA_GC_EDGE_GETTER, /**< getter of a named accessor property */
+  ECMA_GC_EDGE_SETTER, /**< setter of a named accessor property */
+  ECMA_GC_EDGE_INTERNAL /**< value of an internal property */
+} ecma_gc_edge_type_t;
+
+/**
+ * Reference of an object, as it is traced by the garbage collector
+ */
+typedef struct
+{
+  void *target_p; /**< referenced entity */
+  ecma_gc_target_type_t target_type; /**< kind of the referenced entity */
+  ecma_gc_edge_type_t edge_type; /**< kind of the reference */
+  ecma_property_t *property_p; /**< property which holds the reference (NULL, if the reference
+                                *   is not stored in a property) */
+  ecma_property_header_t *container_p; /**< property pair, property slots or array elements
+                                        *   which hold the property */
+  uint32_t index; /**< index of the property in its container */
+} ecma_gc_reference_t;
+
+/**
+ * Callback which receives the references of an object
+ */
+typedef void (*ecma_gc_reference_callback_t) (const ecma_gc_reference_t *, void *);
+
+#ifdef MEM_STATS
+/**
+ * Garbage collector statistics
+ */
+typedef struct
+{
+  size_t run_count; /**< number of completed major garbage collections */
+  size_t minor_run_count; /**< number of minor garbage collections */
+  size_t promoted_objects; /**< number of young objects which survived a minor collection */
+  size_t full_run_count; /**< number of collections which were run without interruption */
+  size_t step_count; /**< number of incremental steps */
+  size_t traced_objects; /**< number of objects traced by the mark phase */
+  size_t swept_objects; /**< number of freed objects */
+  size_t barrier_marked_objects; /**< number of objects marked by the barriers */
+  size_t overflow_rescans; /**< number of object list scans caused by mark stack overflows */
+  size_t total_pause_us; /**< total time spent in garbage collection, in microseconds */
+  size_t max_pause_us; /**< longest uninterrupted garbage collection, in microseconds */
+  size_t max_step_pause_us; /**< longest incremental step, in microseconds */
+  size_t max_minor_pause_us; /**< longest minor collection, in microseconds */
+  size_t compaction_count; /**< number of heap compactions */
+  size_t relocated_blocks; /**< number of blocks moved by heap compactions */
+  size_t relocated_bytes; /**< total size of the blocks moved by heap compactions */
+  uint32_t fragmentation_before_compaction; /**< fragmentation before the last compaction, in percent */
+  uint32_t fragmentation_after_compaction; /**< fragmentation after the last compaction, in percent */
+} ecma_gc_stats_t;
+#endif /* MEM_STATS */
+
 extern void ecma_gc_init (void);
 extern void ecma_init_gc_info (ecma_object_t *);
 extern void ecma_ref_object (ecma_object_t *);
 extern void ecma_deref_object (ecma_object_t *);
+extern void ecma_gc_write_barrier (ecma_object_t *, ecma_object_t *);
+extern void ecma_gc_trace_references (ecma_object_t *, ecma_gc_reference_callback_t, void *);
 extern void ecma_gc_run (void);
+extern void ecma_gc_run_minor (void);
+extern bool ecma_gc_step (uint32_t);
+extern void ecma_gc_allocation_step (void);
+extern void ecma_gc_compact (void);
 extern void ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t);
 
+#ifdef MEM_STATS
+extern void ecma_gc_stats_print (void);
+#endif /* MEM_STATS */
+
 /**
  * @}
  * @}
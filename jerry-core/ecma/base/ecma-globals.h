@@ -55,8 +55,8 @@
  */
 typedef enum
 {
-  ECMA_TYPE_SIMPLE, /**< simple value */
-  ECMA_TYPE_NUMBER, /**< 64-bit integer */
+  ECMA_TYPE_DIRECT, /**< directly encoded value: small integer number or simple value */
+  ECMA_TYPE_NUMBER, /**< pointer to a heap allocated floating point number */
   ECMA_TYPE_STRING, /**< pointer to description of a string */
   ECMA_TYPE_OBJECT, /**< pointer to description of an object */
   ECMA_TYPE___MAX = ECMA_TYPE_OBJECT /** highest value for ecma types */
@@ -87,6 +87,8 @@ typedef enum
  * Description of an ecma value
  *
  * Bit-field structure: type (2) | error (1) | value (29)
+ *
+ * Direct values: type (2) | error (1) | direct type (1) | value (28)
  */
 typedef uint32_t ecma_value_t;
 
@@ -114,6 +116,61 @@ typedef uint32_t ecma_value_t;
  */
 #define ECMA_VALUE_SHIFT 3
 
+/**
+ * Mask for the direct type of direct values
+ */
+#define ECMA_DIRECT_TYPE_MASK (1u << ECMA_VALUE_SHIFT)
+
+/**
+ * Direct type of small integer numbers
+ */
+#define ECMA_DIRECT_TYPE_INTEGER_VALUE (0u << ECMA_VALUE_SHIFT)
+
+/**
+ * Direct type of simple values
+ */
+#define ECMA_DIRECT_TYPE_SIMPLE_VALUE (1u << ECMA_VALUE_SHIFT)
+
+/**
+ * Shift for the value part of direct values
+ */
+#define ECMA_DIRECT_SHIFT (ECMA_VALUE_SHIFT + 1)
+
+/**
+ * Type of small integer numbers, which are stored directly in an ecma value
+ */
+typedef int32_t ecma_integer_value_t;
+
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
+
+/**
+ * Maximum value of small integer numbers
+ *
+ * Note:
+ *      limited to the integers which are exactly representable by 32 bit floating point numbers
+ */
+#define ECMA_INTEGER_NUMBER_MAX 0xffffff
+
+#else /* CONFIG_ECMA_NUMBER_TYPE != CONFIG_ECMA_NUMBER_FLOAT32 */
+
+/**
+ * Maximum value of small integer numbers
+ */
+#define ECMA_INTEGER_NUMBER_MAX 0x7ffffff
+
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32 */
+
+/**
+ * Minimum value of small integer numbers
+ */
+#define ECMA_INTEGER_NUMBER_MIN (-ECMA_INTEGER_NUMBER_MAX - 1)
+
+/**
+ * Checks whether the integer number is in the small integer range.
+ */
+#define ECMA_IS_INTEGER_NUMBER(num) \
+  (ECMA_INTEGER_NUMBER_MIN <= (num) && (num) <= ECMA_INTEGER_NUMBER_MAX)
+
 /**
  * Internal properties' identifiers.
  */
@@ -192,6 +249,9 @@ typedef enum
  *   first property pair, only property pair items are allowed.
  *
  *   Example for other items is property name hash map, or array of items.
+ *   The property hashmap is always the first item, followed by the slot
+ *   vector of the object (see ecma_property_slots_t) or the element vector
+ *   of a fast array (see ecma_array_elements_t) if it has one.
  */
 
 /**
@@ -208,8 +268,10 @@ typedef enum
                                                                              *   property pair types. */
 
   ECMA_PROPERTY_TYPE_HASHMAP, /**< hash map for fast property access */
+  ECMA_PROPERTY_TYPE_SLOTS, /**< slot vector of the properties described by the object's shape */
+  ECMA_PROPERTY_TYPE_ELEMENTS, /**< element vector of a fast array */
 
-  ECMA_PROPERTY_TYPE__MAX = ECMA_PROPERTY_TYPE_HASHMAP, /**< highest value for property types. */
+  ECMA_PROPERTY_TYPE__MAX = ECMA_PROPERTY_TYPE_ELEMENTS, /**< highest value for property types. */
 } ecma_property_types_t;
 
 /**
@@ -276,9 +338,17 @@ typedef struct
  */
 typedef struct
 {
+#ifndef JERRY_CPOINTER_32_BIT
   ecma_property_t types[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< two property type slot. The first represent
                                                          *   the type of this property (e.g. property pair) */
   mem_cpointer_t next_property_cp; /**< next cpointer */
+#else /* JERRY_CPOINTER_32_BIT */
+  /* The property values must follow the 32 bit word of the types (see ECMA_PROPERTY_VALUE_PTR). */
+  mem_cpointer_t next_property_cp; /**< next cpointer */
+  ecma_property_t types[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< two property type slot. The first represent
+                                                         *   the type of this property (e.g. property pair) */
+  uint16_t unused; /**< padding of the 32 bit word of the types */
+#endif /* !JERRY_CPOINTER_32_BIT */
 } ecma_property_header_t;
 
 /**
@@ -296,7 +366,12 @@ typedef struct
 typedef union
 {
   ecma_value_t value; /**< value of a property */
+#ifndef JERRY_CPOINTER_32_BIT
   ecma_getter_setter_pointers_t getter_setter_pair; /**< getter setter pair */
+#else /* JERRY_CPOINTER_32_BIT */
+  mem_cpointer_t getter_setter_pair_cp; /**< getter setter pair (two 32 bit compressed pointers
+                                         *   do not fit into a property value slot) */
+#endif /* !JERRY_CPOINTER_32_BIT */
 } ecma_property_value_t;
 
 /**
@@ -321,6 +396,13 @@ typedef struct
 #define ECMA_PROPERTY_IS_PROPERTY_PAIR(property_header_p) \
   (ECMA_PROPERTY_GET_TYPE ((property_header_p)->types + 0) <= ECMA_PROPERTY_TYPE_PROPERTY_PAIR__MAX)
 
+/**
+ * Returns true if the property list item is a property vector
+ * (a slot vector or an element vector).
+ */
+#define ECMA_PROPERTY_IS_PROPERTY_VECTOR(property_header_p) \
+  (ECMA_PROPERTY_GET_TYPE ((property_header_p)->types + 0) >= ECMA_PROPERTY_TYPE_SLOTS)
+
 /**
  * Returns the internal property type
  */
@@ -406,6 +488,12 @@ typedef enum
  */
 #define ECMA_OBJECT_FLAG_EXTENSIBLE 0x20
 
+/**
+ * The set of bindings of a declarative lexical environment is fixed
+ * when the environment is created (shares the bit of the extensible flag).
+ */
+#define ECMA_LEXICAL_ENVIRONMENT_FLAG_STATIC_BINDINGS ECMA_OBJECT_FLAG_EXTENSIBLE
+
 /**
  * Value for increasing or decreasing the object reference counter.
  */
@@ -426,7 +514,7 @@ typedef struct ecma_object_t
                      depending on ECMA_OBJECT_FLAG_BUILT_IN_OR_LEXICAL_ENV
       flags : 3 bit : ECMA_OBJECT_FLAG_BUILT_IN_OR_LEXICAL_ENV,
                       ECMA_OBJECT_FLAG_GC_VISITED,
-                      ECMA_OBJECT_FLAG_EXTENSIBLE
+                      ECMA_OBJECT_FLAG_EXTENSIBLE or ECMA_LEXICAL_ENVIRONMENT_FLAG_STATIC_BINDINGS
       refs : 10 bit (max 1023) */
   uint16_t type_flags_refs;
 
@@ -684,7 +772,7 @@ typedef struct
  */
 typedef struct
 {
-  /** Characters */
+  /** Characters (the for-in context expects a single value in each chunk) */
   lit_utf8_byte_t data[ sizeof (uint64_t) - sizeof (mem_cpointer_t) ];
 
   /** Compressed pointer to next chunk */
@@ -704,8 +792,10 @@ typedef enum
                                              stored locally in the string's descriptor */
   ECMA_STRING_CONTAINER_MAGIC_STRING, /**< the ecma-string is equal to one of ECMA magic strings */
   ECMA_STRING_CONTAINER_MAGIC_STRING_EX, /**< the ecma-string is equal to one of external magic strings */
+  ECMA_STRING_CONTAINER_HEAP_ROPE_STRING, /**< the ecma-string is the concatenation of two ecma-strings,
+                                           *   which is flattened when its characters are needed */
 
-  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_MAGIC_STRING_EX /**< maximum value */
+  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_HEAP_ROPE_STRING /**< maximum value */
 } ecma_string_container_t;
 
 /**
@@ -754,8 +844,16 @@ typedef struct ecma_string_t
     /** Index of string in literal table */
     mem_cpointer_t lit_cp;
 
-    /** Compressed pointer to an ecma_collection_header_t */
-    mem_cpointer_t utf8_collection_cp;
+    /**
+     * Actual data of an utf-8 string type
+     */
+    struct
+    {
+      /** Compressed pointer to a string header followed by the characters */
+      mem_cpointer_t utf8_collection_cp;
+      /** Compressed pointer to the character index of the string (built on the first indexed access) */
+      mem_cpointer_t index_cp;
+    } utf8_string;
 
     /**
     * Actual data of an ascii string type
@@ -771,6 +869,17 @@ typedef struct ecma_string_t
     /** Compressed pointer to an ecma_number_t */
     mem_cpointer_t number_cp;
 
+    /**
+     * Actual data of a rope string
+     */
+    struct
+    {
+      /** Compressed pointer to an ecma_string_rope_t */
+      mem_cpointer_t rope_cp;
+      /** Maximum number of rope nodes on a path from this node to a flat string */
+      uint16_t depth;
+    } rope_string;
+
     /** UInt32-represented number placed locally in the descriptor */
     uint32_t uint32_number;
 
@@ -785,6 +894,17 @@ typedef struct ecma_string_t
   } u;
 } ecma_string_t;
 
+/**
+ * Node of a rope string, which references the two halves of a concatenation
+ */
+typedef struct
+{
+  mem_cpointer_t left_cp; /**< compressed pointer to the first ecma-string */
+  mem_cpointer_t right_cp; /**< compressed pointer to the second ecma-string */
+  lit_utf8_size_t size; /**< size of the concatenation in bytes */
+  ecma_length_t length; /**< number of characters in the concatenation */
+} ecma_string_rope_t;
+
 /**
  * Representation for native external pointer
  */
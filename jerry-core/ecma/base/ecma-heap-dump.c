@@ -0,0 +1,643 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Heap dump of the live object graph
+ *
+ * The dump is a sequence of text lines, which are passed to the writer one by one:
+ *
+ *   jerry-heap-dump <version>
+ *   O <id> <type> <size> <refs> <built-in id> <class>   an object or a lexical environment
+ *   S <id> <size> <characters>                          a string
+ *   B <id> <size>                                       byte code of a function or a regular expression
+ *   C <id> <size>                                       a collection of values
+ *   E <from id> <to id> <kind> <name>                   a reference of an object
+ *
+ * Identifiers are hexadecimal addresses, sizes are in bytes. The objects referenced by native
+ * code have a non-zero reference counter (refs), these are the roots of the graph. Strings, byte
+ * code and collections can be shared, so they are listed before each of their references, and
+ * the readers must ignore the repeated lines. Names and characters are quoted, the bytes outside
+ * the printable ascii range, quotes and backslashes are written as \xHH, and the characters after
+ * the first ECMA_HEAP_DUMP_MAX_STRING_SIZE bytes are replaced by "...".
+ */
+
+#include "ecma-array-object.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-heap-dump.h"
+#include "ecma-helpers.h"
+#include "ecma-lcache.h"
+#include "ecma-objects.h"
+#include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
+#include "jcontext.h"
+#include "lit-magic-strings.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaheapdump Heap dump
+ * @{
+ */
+
+/**
+ * Maximum number of bytes of a string or name written to the dump
+ */
+#define ECMA_HEAP_DUMP_MAX_STRING_SIZE 64
+
+/**
+ * Size of the line buffer (an escaped string takes at most four times of its size)
+ */
+#define ECMA_HEAP_DUMP_LINE_SIZE (4 * ECMA_HEAP_DUMP_MAX_STRING_SIZE + 128)
+
+/**
+ * State of a heap dump
+ */
+typedef struct
+{
+  ecma_heap_dump_writer_t writer; /**< writer callback */
+  void *data_p; /**< data passed to the writer */
+  bool is_aborted; /**< the writer aborted the dump */
+  ecma_object_t *object_p; /**< object whose references are dumped */
+  lit_utf8_size_t length; /**< length of the current line */
+  lit_utf8_byte_t line[ECMA_HEAP_DUMP_LINE_SIZE]; /**< current line */
+} ecma_heap_dump_context_t;
+
+/**
+ * Names of the object types
+ */
+static const char * const ecma_heap_dump_object_type_names[] =
+{
+  "object",
+  "function",
+  "built-in-function",
+  "array",
+  "string",
+  "external-function",
+  "bound-function",
+  "arguments"
+};
+
+JERRY_STATIC_ASSERT (sizeof (ecma_heap_dump_object_type_names) / sizeof (const char *) == ECMA_OBJECT_TYPE__MAX + 1,
+                     ecma_heap_dump_object_type_names_must_have_a_name_for_each_object_type);
+
+/**
+ * Names of the lexical environment types
+ */
+static const char * const ecma_heap_dump_lex_env_type_names[] =
+{
+  "declarative-environment",
+  "object-environment",
+  "this-object-environment"
+};
+
+JERRY_STATIC_ASSERT (sizeof (ecma_heap_dump_lex_env_type_names) / sizeof (const char *)
+                     == ECMA_LEXICAL_ENVIRONMENT_TYPE__MAX - ECMA_LEXICAL_ENVIRONMENT_TYPE_START + 1,
+                     ecma_heap_dump_lex_env_type_names_must_have_a_name_for_each_lex_env_type);
+
+/**
+ * Names of the reference kinds
+ */
+static const char * const ecma_heap_dump_edge_names[] =
+{
+  "prototype",
+  "outer",
+  "binding",
+  "value",
+  "getter",
+  "setter",
+  "internal"
+};
+
+JERRY_STATIC_ASSERT (sizeof (ecma_heap_dump_edge_names) / sizeof (const char *) == ECMA_GC_EDGE_INTERNAL + 1,
+                     ecma_heap_dump_edge_names_must_have_a_name_for_each_edge_type);
+
+/**
+ * Names of the internal properties
+ */
+static const char * const ecma_heap_dump_internal_property_names[] =
+{
+  "[[Class]]",
+  "[[Scope]]",
+  "[[ParametersMap]]",
+  "[[Code]]",
+  "[[RegExpCode]]",
+  "[[NativeCode]]",
+  "[[NativeHandle]]",
+  "[[FreeCallback]]",
+  "[[PrimitiveValue]]",
+  "[[PrimitiveValue]]",
+  "[[PrimitiveValue]]",
+  "[[TargetFunction]]",
+  "[[BoundThis]]",
+  "[[BoundArgs]]",
+  "[[BuiltInId]]",
+  "[[BuiltInRoutine]]",
+  "[[NonInstantiatedMask0]]",
+  "[[NonInstantiatedMask1]]"
+};
+
+JERRY_STATIC_ASSERT (sizeof (ecma_heap_dump_internal_property_names) / sizeof (const char *)
+                     == ECMA_INTERNAL_PROPERTY__COUNT,
+                     ecma_heap_dump_internal_property_names_must_have_a_name_for_each_internal_property);
+
+/**
+ * Append a character to the current line
+ */
+static void
+ecma_heap_dump_append_char (ecma_heap_dump_context_t *context_p, /**< heap dump context */
+                            lit_utf8_byte_t chr) /**< character */
+{
+  JERRY_ASSERT (context_p->length < ECMA_HEAP_DUMP_LINE_SIZE);
+
+  context_p->line[context_p->length++] = chr;
+} /* ecma_heap_dump_append_char */
+
+/**
+ * Append a zero terminated string to the current line
+ */
+static void
+ecma_heap_dump_append_string (ecma_heap_dump_context_t *context_p, /**< heap dump context */
+                              const char *str_p) /**< string */
+{
+  while (*str_p != '\0')
+  {
+    ecma_heap_dump_append_char (context_p, (lit_utf8_byte_t) *str_p++);
+  }
+} /* ecma_heap_dump_append_string */
+
+/**
+ * Append a space and a decimal number to the current line
+ */
+static void
+ecma_heap_dump_append_uint32 (ecma_heap_dump_context_t *context_p, /**< heap dump context */
+                              uint32_t value) /**< number */
+{
+  lit_utf8_byte_t buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
+  lit_utf8_size_t size = ecma_uint32_to_utf8_string (value, buffer, sizeof (buffer));
+
+  ecma_heap_dump_append_string (context_p, " ");
+
+  for (lit_utf8_size_t i = 0; i < size; i++)
+  {
+    ecma_heap_dump_append_char (context_p, buffer[i]);
+  }
+} /* ecma_heap_dump_append_uint32 */
+
+/**
+ * Append a space and an identifier (the hexadecimal address of a heap entity) to the current line
+ */
+static void
+ecma_heap_dump_append_id (ecma_heap_dump_context_t *context_p, /**< heap dump context */
+                          const void *pointer_p) /**< address */
+{
+  uintptr_t address = (uintptr_t) pointer_p;
+  int shift = (int) (sizeof (uintptr_t) * JERRY_BITSINBYTE) - 4;
+
+  while (shift > 0 && ((address >> shift) & 0xf) == 0)
+  {
+    shift -= 4;
+  }
+
+  ecma_heap_dump_append_string (context_p, " ");
+
+  for (; shift >= 0; shift -= 4)
+  {
+    ecma_heap_dump_append_char (context_p, (lit_utf8_byte_t) "0123456789abcdef"[(address >> shift) & 0xf]);
+  }
+} /* ecma_heap_dump_append_id */
+
+/**
+ * Append a space and a quoted character sequence to the current line
+ */
+static void
+ecma_heap_dump_append_quoted (ecma_heap_dump_context_t *context_p, /**< heap dump context */
+                              const lit_utf8_byte_t *chars_p, /**< characters */
+                              lit_utf8_size_t size) /**< number of characters */
+{
+  ecma_heap_dump_append_string (context_p, " \"");
+
+  for (lit_utf8_size_t i = 0; i < size && i < ECMA_HEAP_DUMP_MAX_STRING_SIZE; i++)
+  {
+    lit_utf8_byte_t chr = chars_p[i];
+
+    if (chr <= (lit_utf8_byte_t) ' ' || chr >= LIT_UTF8_1_BYTE_CODE_POINT_MAX || chr == (lit_utf8_byte_t) '"'
+        || chr == (lit_utf8_byte_t) '\\')
+    {
+      ecma_heap_dump_append_string (context_p, "\\x");
+      ecma_heap_dump_append_char (context_p, (lit_utf8_byte_t) "0123456789abcdef"[chr >> 4]);
+      ecma_heap_dump_append_char (context_p, (lit_utf8_byte_t) "0123456789abcdef"[chr & 0xf]);
+    }
+    else
+    {
+      ecma_heap_dump_append_char (context_p, chr);
+    }
+  }
+
+  if (size > ECMA_HEAP_DUMP_MAX_STRING_SIZE)
+  {
+    ecma_heap_dump_append_string (context_p, "...");
+  }
+
+  ecma_heap_dump_append_string (context_p, "\"");
+} /* ecma_heap_dump_append_quoted */
+
+/**
+ * Append a space and the quoted characters of an ecma string to the current line
+ *
+ * Note:
+ *      the dump must not allocate memory, because an allocation may start a garbage collection
+ */
+static void
+ecma_heap_dump_append_ecma_string (ecma_heap_dump_context_t *context_p, /**< heap dump context */
+                                   const ecma_string_t *string_p) /**< string */
+{
+  lit_utf8_size_t size = ecma_string_get_size (string_p);
+
+  if (size <= ECMA_HEAP_DUMP_MAX_STRING_SIZE)
+  {
+    lit_utf8_byte_t buffer[ECMA_HEAP_DUMP_MAX_STRING_SIZE];
+    lit_utf8_size_t copied_size = ecma_string_to_utf8_string (string_p, buffer, sizeof (buffer));
+
+    ecma_heap_dump_append_quoted (context_p, buffer, copied_size);
+    return;
+  }
+
+  lit_utf8_size_t raw_size;
+  bool is_ascii;
+  const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (string_p, &raw_size, &is_ascii);
+
+  if (chars_p != NULL)
+  {
+    ecma_heap_dump_append_quoted (context_p, chars_p, raw_size);
+  }
+  else
+  {
+    ecma_heap_dump_append_string (context_p, " \"...\"");
+  }
+} /* ecma_heap_dump_append_ecma_string */
+
+/**
+ * Pass the current line to the writer
+ */
+static void
+ecma_heap_dump_flush_line (ecma_heap_dump_context_t *context_p) /**< heap dump context */
+{
+  ecma_heap_dump_append_string (context_p, "\n");
+
+  if (!context_p->is_aborted
+      && !context_p->writer (context_p->line, context_p->length, context_p->data_p))
+  {
+    context_p->is_aborted = true;
+  }
+
+  context_p->length = 0;
+} /* ecma_heap_dump_flush_line */
+
+/**
+ * Get the size of an object, including its property storage
+ *
+ * @return size in bytes
+ */
+static uint32_t
+ecma_heap_dump_get_object_size (ecma_object_t *object_p) /**< object */
+{
+  size_t size = sizeof (ecma_object_t);
+
+  if (ecma_is_lexical_environment (object_p)
+      && ecma_get_lex_env_type (object_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  {
+    return (uint32_t) size;
+  }
+
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    size += ecma_property_hashmap_get_size (prop_iter_p);
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_SLOTS)
+  {
+    size += ecma_shape_get_property_slots_block_size ((ecma_property_slots_t *) prop_iter_p);
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+  else if (prop_iter_p != NULL
+           && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_ELEMENTS)
+  {
+    size += ecma_op_array_get_elements_block_size ((ecma_array_elements_t *) prop_iter_p);
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  while (prop_iter_p != NULL)
+  {
+    size += sizeof (ecma_property_pair_t);
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  return (uint32_t) size;
+} /* ecma_heap_dump_get_object_size */
+
+/**
+ * Get the size of a string, including its characters
+ *
+ * @return size in bytes
+ */
+static uint32_t
+ecma_heap_dump_get_string_size (const ecma_string_t *string_p) /**< string */
+{
+  size_t size = sizeof (ecma_string_t);
+
+  switch (ECMA_STRING_GET_CONTAINER (string_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    {
+      size += ecma_string_get_size (string_p);
+      break;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_NUMBER:
+    {
+      size += sizeof (ecma_number_t);
+      break;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_ROPE_STRING:
+    {
+      size += sizeof (ecma_string_rope_t);
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  return (uint32_t) size;
+} /* ecma_heap_dump_get_string_size */
+
+/**
+ * Get the size of a collection, including its chunks
+ *
+ * @return size in bytes
+ */
+static uint32_t
+ecma_heap_dump_get_collection_size (const ecma_collection_header_t *collection_p) /**< collection */
+{
+  size_t size = sizeof (ecma_collection_header_t);
+  ecma_collection_chunk_t *chunk_p = ECMA_GET_POINTER (ecma_collection_chunk_t, collection_p->first_chunk_cp);
+
+  while (chunk_p != NULL)
+  {
+    size += sizeof (ecma_collection_chunk_t);
+    chunk_p = ECMA_GET_POINTER (ecma_collection_chunk_t, chunk_p->next_chunk_cp);
+  }
+
+  return (uint32_t) size;
+} /* ecma_heap_dump_get_collection_size */
+
+/**
+ * Append the name of the property which holds a reference to the current line
+ */
+static void
+ecma_heap_dump_append_reference_name (ecma_heap_dump_context_t *context_p, /**< heap dump context */
+                                      const ecma_gc_reference_t *reference_p) /**< reference */
+{
+  if (reference_p->property_p == NULL)
+  {
+    ecma_heap_dump_append_string (context_p, " \"\"");
+    return;
+  }
+
+  if (ECMA_PROPERTY_GET_TYPE (reference_p->property_p) == ECMA_PROPERTY_TYPE_INTERNAL)
+  {
+    ecma_internal_property_id_t id = ECMA_PROPERTY_GET_INTERNAL_PROPERTY_TYPE (reference_p->property_p);
+    const char *name_p = ecma_heap_dump_internal_property_names[id];
+
+    ecma_heap_dump_append_quoted (context_p, (const lit_utf8_byte_t *) name_p, (lit_utf8_size_t) strlen (name_p));
+    return;
+  }
+
+  switch (ECMA_PROPERTY_GET_TYPE (reference_p->container_p->types + 0))
+  {
+    case ECMA_PROPERTY_TYPE_SLOTS:
+    {
+      const ecma_property_slots_t *slots_p = (const ecma_property_slots_t *) reference_p->container_p;
+      ecma_heap_dump_append_ecma_string (context_p, ecma_shape_get_slot_name (slots_p, reference_p->index));
+      break;
+    }
+    case ECMA_PROPERTY_TYPE_ELEMENTS:
+    {
+      lit_utf8_byte_t buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
+      lit_utf8_size_t size = ecma_uint32_to_utf8_string (reference_p->index, buffer, sizeof (buffer));
+
+      ecma_heap_dump_append_quoted (context_p, buffer, size);
+      break;
+    }
+    default:
+    {
+      const ecma_property_pair_t *prop_pair_p = (const ecma_property_pair_t *) reference_p->container_p;
+      ecma_heap_dump_append_ecma_string (context_p,
+                                         ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                                    prop_pair_p->names_cp[reference_p->index]));
+      break;
+    }
+  }
+} /* ecma_heap_dump_append_reference_name */
+
+/**
+ * Dump a reference of an object, and the referenced entity if it is not an object
+ */
+static void
+ecma_heap_dump_reference (const ecma_gc_reference_t *reference_p, /**< reference */
+                          void *data_p) /**< heap dump context */
+{
+  ecma_heap_dump_context_t *context_p = (ecma_heap_dump_context_t *) data_p;
+
+  switch (reference_p->target_type)
+  {
+    case ECMA_GC_TARGET_OBJECT:
+    {
+      break;
+    }
+    case ECMA_GC_TARGET_STRING:
+    {
+      const ecma_string_t *string_p = (const ecma_string_t *) reference_p->target_p;
+
+      ecma_heap_dump_append_string (context_p, "S");
+      ecma_heap_dump_append_id (context_p, string_p);
+      ecma_heap_dump_append_uint32 (context_p, ecma_heap_dump_get_string_size (string_p));
+      ecma_heap_dump_append_ecma_string (context_p, string_p);
+      ecma_heap_dump_flush_line (context_p);
+      break;
+    }
+    case ECMA_GC_TARGET_BYTECODE:
+    {
+      const ecma_compiled_code_t *bytecode_p = (const ecma_compiled_code_t *) reference_p->target_p;
+
+      ecma_heap_dump_append_string (context_p, "B");
+      ecma_heap_dump_append_id (context_p, bytecode_p);
+      ecma_heap_dump_append_uint32 (context_p, (uint32_t) bytecode_p->size << MEM_ALIGNMENT_LOG);
+      ecma_heap_dump_flush_line (context_p);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (reference_p->target_type == ECMA_GC_TARGET_COLLECTION);
+
+      const ecma_collection_header_t *collection_p = (const ecma_collection_header_t *) reference_p->target_p;
+
+      ecma_heap_dump_append_string (context_p, "C");
+      ecma_heap_dump_append_id (context_p, collection_p);
+      ecma_heap_dump_append_uint32 (context_p, ecma_heap_dump_get_collection_size (collection_p));
+      ecma_heap_dump_flush_line (context_p);
+      break;
+    }
+  }
+
+  ecma_heap_dump_append_string (context_p, "E");
+  ecma_heap_dump_append_id (context_p, context_p->object_p);
+  ecma_heap_dump_append_id (context_p, reference_p->target_p);
+  ecma_heap_dump_append_string (context_p, " ");
+  ecma_heap_dump_append_string (context_p, ecma_heap_dump_edge_names[reference_p->edge_type]);
+  ecma_heap_dump_append_reference_name (context_p, reference_p);
+  ecma_heap_dump_flush_line (context_p);
+} /* ecma_heap_dump_reference */
+
+/**
+ * Dump an object and its references
+ */
+static void
+ecma_heap_dump_object (ecma_heap_dump_context_t *context_p, /**< heap dump context */
+                       ecma_object_t *object_p) /**< object */
+{
+  const char *type_name_p;
+  uint32_t builtin_id = UINT32_MAX;
+  lit_magic_string_id_t class_id = LIT_MAGIC_STRING__COUNT;
+
+  if (ecma_is_lexical_environment (object_p))
+  {
+    type_name_p = ecma_heap_dump_lex_env_type_names[ecma_get_lex_env_type (object_p)
+                                                    - ECMA_LEXICAL_ENVIRONMENT_TYPE_START];
+  }
+  else
+  {
+    type_name_p = ecma_heap_dump_object_type_names[ecma_get_object_type (object_p)];
+    class_id = ecma_object_get_class_name (object_p);
+
+    if (ecma_get_object_is_builtin (object_p))
+    {
+      ecma_property_t *built_in_id_prop_p = ecma_find_internal_property (object_p,
+                                                                         ECMA_INTERNAL_PROPERTY_BUILT_IN_ID);
+
+      if (built_in_id_prop_p != NULL)
+      {
+        builtin_id = (uint32_t) ecma_get_internal_property_value (built_in_id_prop_p);
+      }
+    }
+  }
+
+  ecma_heap_dump_append_string (context_p, "O");
+  ecma_heap_dump_append_id (context_p, object_p);
+  ecma_heap_dump_append_string (context_p, " ");
+  ecma_heap_dump_append_string (context_p, type_name_p);
+  ecma_heap_dump_append_uint32 (context_p, ecma_heap_dump_get_object_size (object_p));
+  ecma_heap_dump_append_uint32 (context_p, (uint32_t) (object_p->type_flags_refs / ECMA_OBJECT_REF_ONE));
+
+  if (builtin_id != UINT32_MAX)
+  {
+    ecma_heap_dump_append_uint32 (context_p, builtin_id);
+  }
+  else
+  {
+    ecma_heap_dump_append_string (context_p, " -");
+  }
+
+  if (class_id != LIT_MAGIC_STRING__COUNT)
+  {
+    ecma_heap_dump_append_quoted (context_p,
+                                  lit_get_magic_string_utf8 (class_id),
+                                  lit_get_magic_string_size (class_id));
+  }
+  else
+  {
+    ecma_heap_dump_append_string (context_p, " -");
+  }
+
+  ecma_heap_dump_flush_line (context_p);
+
+  context_p->object_p = object_p;
+  ecma_gc_trace_references (object_p, ecma_heap_dump_reference, context_p);
+} /* ecma_heap_dump_object */
+
+/**
+ * Dump the live objects of the heap, and the strings, byte code and collections referenced by them
+ *
+ * Note:
+ *      the lookup cache is emptied and a full garbage collection is done before the dump,
+ *      so only the live objects are dumped
+ *
+ * @return true - if the dump is completed,
+ *         false - if the writer aborted it
+ */
+bool
+ecma_heap_dump (ecma_heap_dump_writer_t writer, /**< writer callback */
+                void *data_p) /**< data passed to the writer */
+{
+  JERRY_ASSERT (writer != NULL);
+
+  /* The lookup cache holds references to objects, which are not roots of the object graph. */
+  ecma_lcache_invalidate_all ();
+  ecma_gc_run ();
+
+  ecma_heap_dump_context_t context;
+  context.writer = writer;
+  context.data_p = data_p;
+  context.is_aborted = false;
+  context.object_p = NULL;
+  context.length = 0;
+
+  ecma_heap_dump_append_string (&context, "jerry-heap-dump");
+  ecma_heap_dump_append_uint32 (&context, ECMA_HEAP_DUMP_VERSION);
+  ecma_heap_dump_flush_line (&context);
+
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_young_objects_p);
+       obj_iter_p != NULL && !context.is_aborted;
+       obj_iter_p = ECMA_GET_POINTER (ecma_object_t, obj_iter_p->gc_next_cp))
+  {
+    ecma_heap_dump_object (&context, obj_iter_p);
+  }
+
+  for (ecma_gc_color_t color = ECMA_GC_COLOR_WHITE_GRAY;
+       color < ECMA_GC_COLOR__COUNT;
+       color = (ecma_gc_color_t) (color + 1))
+  {
+    for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists)[color];
+         obj_iter_p != NULL && !context.is_aborted;
+         obj_iter_p = ECMA_GET_POINTER (ecma_object_t, obj_iter_p->gc_next_cp))
+    {
+      ecma_heap_dump_object (&context, obj_iter_p);
+    }
+  }
+
+  return !context.is_aborted;
+} /* ecma_heap_dump */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,48 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_HEAP_DUMP_H
+#define ECMA_HEAP_DUMP_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaheapdump Heap dump
+ * @{
+ */
+
+/**
+ * Version of the heap dump format
+ */
+#define ECMA_HEAP_DUMP_VERSION 1
+
+/**
+ * Callback which receives the heap dump
+ *
+ * @return true - to continue the dump,
+ *         false - to abort it
+ */
+typedef bool (*ecma_heap_dump_writer_t) (const lit_utf8_byte_t *, lit_utf8_size_t, void *);
+
+extern bool ecma_heap_dump (ecma_heap_dump_writer_t, void *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_HEAP_DUMP_H */
@@ -73,6 +73,143 @@ typedef struct
   uint16_t length; /* Number of characters in the string */
 } ecma_string_heap_header_t;
 
+/**
+ * Get the header of an utf-8 string
+ */
+#define ECMA_STRING_GET_UTF8_HEADER(string_p) \
+  ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t, (string_p)->u.utf8_string.utf8_collection_cp)
+
+/**
+ * String header of the strings, whose size does not fit into ecma_string_heap_header_t
+ */
+typedef struct
+{
+  ecma_string_heap_header_t header; /* Header, whose size is ECMA_STRING_LARGE_STRING_MARKER */
+  lit_utf8_size_t size; /* Size of string in bytes */
+  ecma_length_t length; /* Number of characters in the string */
+} ecma_string_large_heap_header_t;
+
+/**
+ * Size stored in the short header of the strings, which have a large header
+ */
+#define ECMA_STRING_LARGE_STRING_MARKER UINT16_MAX
+
+/**
+ * Checks whether a string of the given size needs a large header.
+ *
+ * Note:
+ *      large ascii strings are stored with a large header as well,
+ *      since the ascii string descriptors store the size in 16 bits
+ */
+#define ECMA_STRING_IS_LARGE(size) ((size) >= ECMA_STRING_LARGE_STRING_MARKER)
+
+/**
+ * Get the size of the header of an utf-8 string
+ */
+#define ECMA_STRING_HEAP_HEADER_SIZE(data_p) \
+  ((data_p)->size == ECMA_STRING_LARGE_STRING_MARKER ? sizeof (ecma_string_large_heap_header_t) \
+                                                     : sizeof (ecma_string_heap_header_t))
+
+/**
+ * Get the size of an utf-8 string from its header
+ *
+ * @return size in bytes
+ */
+static inline lit_utf8_size_t __attr_always_inline___
+ecma_string_heap_header_get_size (const ecma_string_heap_header_t *data_p) /**< string header */
+{
+  if (data_p->size == ECMA_STRING_LARGE_STRING_MARKER)
+  {
+    return ((const ecma_string_large_heap_header_t *) data_p)->size;
+  }
+
+  return data_p->size;
+} /* ecma_string_heap_header_get_size */
+
+/**
+ * Get the length of an utf-8 string from its header
+ *
+ * @return number of characters
+ */
+static inline ecma_length_t __attr_always_inline___
+ecma_string_heap_header_get_length (const ecma_string_heap_header_t *data_p) /**< string header */
+{
+  if (data_p->size == ECMA_STRING_LARGE_STRING_MARKER)
+  {
+    return ((const ecma_string_large_heap_header_t *) data_p)->length;
+  }
+
+  return data_p->length;
+} /* ecma_string_heap_header_get_length */
+
+/**
+ * Get the characters of an utf-8 string from its header
+ *
+ * @return pointer to the first character
+ */
+static inline lit_utf8_byte_t * __attr_always_inline___
+ecma_string_heap_header_get_chars (const ecma_string_heap_header_t *data_p) /**< string header */
+{
+  return (lit_utf8_byte_t *) data_p + ECMA_STRING_HEAP_HEADER_SIZE (data_p);
+} /* ecma_string_heap_header_get_chars */
+
+/**
+ * Get the size of the buffer of an utf-8 string
+ *
+ * @return size of the header and the characters in bytes
+ */
+static inline size_t __attr_always_inline___
+ecma_string_heap_header_get_buffer_size (const ecma_string_heap_header_t *data_p) /**< string header */
+{
+  return ECMA_STRING_HEAP_HEADER_SIZE (data_p) + ecma_string_heap_header_get_size (data_p);
+} /* ecma_string_heap_header_get_buffer_size */
+
+/**
+ * Allocate the buffer of an utf-8 string and initialize its header
+ *
+ * @return pointer to the header, which is followed by space for the characters
+ */
+static ecma_string_heap_header_t *
+ecma_string_alloc_heap_header (lit_utf8_size_t size, /**< size of string in bytes */
+                               ecma_length_t length) /**< number of characters in the string */
+{
+  JERRY_ASSERT (length <= size);
+
+  if (ECMA_STRING_IS_LARGE (size))
+  {
+    ecma_string_large_heap_header_t *data_p;
+    data_p = (ecma_string_large_heap_header_t *) ecma_alloc_string_buffer (sizeof (ecma_string_large_heap_header_t)
+                                                                           + size);
+    data_p->header.size = ECMA_STRING_LARGE_STRING_MARKER;
+    data_p->header.length = 0;
+    data_p->size = size;
+    data_p->length = length;
+    return &data_p->header;
+  }
+
+  ecma_string_heap_header_t *data_p;
+  data_p = (ecma_string_heap_header_t *) ecma_alloc_string_buffer (sizeof (ecma_string_heap_header_t) + size);
+  data_p->size = (uint16_t) size;
+  data_p->length = (uint16_t) length;
+  return data_p;
+} /* ecma_string_alloc_heap_header */
+
+/**
+ * Entry of the character index of an utf-8 string (byte offset of a character)
+ */
+typedef lit_utf8_size_t ecma_string_index_entry_t;
+
+/**
+ * Number of entries of the character index of an utf-8 string with the given length
+ *
+ * Note:
+ *      the i-th entry is the byte offset of the character (i + 1) * CONFIG_ECMA_STRING_INDEX_STRIDE
+ */
+#define ECMA_STRING_INDEX_GET_COUNT(length) (((length) - 1u) / CONFIG_ECMA_STRING_INDEX_STRIDE)
+
+static void
+ecma_string_flatten (const ecma_string_t *string_p);
+
 static void
 ecma_init_ecma_string_from_lit_cp (ecma_string_t *string_p,
                                    lit_cpointer_t lit_index);
@@ -173,7 +310,7 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
     return ecma_get_magic_string_ex (magic_string_ex_id);
   }
 
-  JERRY_ASSERT (string_size > 0 && string_size <= UINT16_MAX);
+  JERRY_ASSERT (string_size > 0);
 
   ecma_string_t *string_desc_p = ecma_alloc_string ();
   string_desc_p->hash = lit_utf8_string_calc_hash (string_p, string_size);
@@ -182,11 +319,11 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
 
   ecma_length_t string_length = lit_utf8_string_length (string_p, string_size);
 
-  if (string_size == string_length)
+  if (string_size == string_length && !ECMA_STRING_IS_LARGE (string_size))
   {
     string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_HEAP_ASCII_STRING | ECMA_STRING_REF_ONE;
     const size_t data_size = string_size;
-    lit_utf8_byte_t *data_p = (lit_utf8_byte_t *) mem_heap_alloc_block (data_size);
+    lit_utf8_byte_t *data_p = (lit_utf8_byte_t *) ecma_alloc_string_buffer (data_size);
     string_desc_p->u.ascii_string.size = (uint16_t) string_size;
     memcpy (data_p, string_p, string_size);
     ECMA_SET_NON_NULL_POINTER (string_desc_p->u.ascii_string.ascii_collection_cp, data_p);
@@ -194,15 +331,11 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
   else
   {
     string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_HEAP_UTF8_STRING | ECMA_STRING_REF_ONE;
-    const size_t data_size = string_size + sizeof (ecma_string_heap_header_t);
-    ecma_string_heap_header_t *data_p = (ecma_string_heap_header_t *) mem_heap_alloc_block (data_size);
+    ecma_string_heap_header_t *data_p = ecma_string_alloc_heap_header (string_size, string_length);
 
-    JERRY_ASSERT (string_length <= UINT16_MAX);
-
-    data_p->size = (uint16_t) string_size;
-    data_p->length = (uint16_t) string_length;
-    memcpy (data_p + 1, string_p, string_size);
-    ECMA_SET_NON_NULL_POINTER (string_desc_p->u.utf8_collection_cp, data_p);
+    memcpy (ecma_string_heap_header_get_chars (data_p), string_p, string_size);
+    ECMA_SET_NON_NULL_POINTER (string_desc_p->u.utf8_string.utf8_collection_cp, data_p);
+    ECMA_SET_POINTER (string_desc_p->u.utf8_string.index_cp, NULL);
   }
 
   return string_desc_p;
@@ -334,6 +467,139 @@ ecma_new_ecma_string_from_magic_string_ex_id (lit_magic_string_ex_id_t id) /**<
   return string_desc_p;
 } /* ecma_new_ecma_string_from_magic_string_ex_id */
 
+/**
+ * Get the depth of a string, which is zero for flat strings
+ *
+ * @return number of rope nodes on the longest path from the string to a flat string
+ */
+static inline uint16_t __attr_always_inline___
+ecma_string_get_rope_depth (const ecma_string_t *string_p) /**< ecma-string */
+{
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_ROPE_STRING)
+  {
+    return string_p->u.rope_string.depth;
+  }
+
+  return 0;
+} /* ecma_string_get_rope_depth */
+
+/**
+ * Combine the hash with the characters of an ecma-string
+ *
+ * Note:
+ *      the ropes are traversed instead of flattened,
+ *      the recursion is bounded by CONFIG_ECMA_STRING_ROPE_MAX_DEPTH
+ *
+ * @return combined hash
+ */
+static lit_string_hash_t
+ecma_string_hash_combine (lit_string_hash_t hash, /**< hash to be combined with */
+                          const ecma_string_t *string_p) /**< ecma-string */
+{
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_ROPE_STRING)
+  {
+    const ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t,
+                                                                  string_p->u.rope_string.rope_cp);
+
+    hash = ecma_string_hash_combine (hash, ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp));
+    return ecma_string_hash_combine (hash, ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp));
+  }
+
+  ECMA_STRING_TO_UTF8_STRING (string_p, utf8_str_p, utf8_str_size);
+
+  hash = lit_utf8_string_hash_combine (hash, utf8_str_p, utf8_str_size);
+
+  ECMA_FINALIZE_UTF8_STRING (utf8_str_p, utf8_str_size);
+
+  return hash;
+} /* ecma_string_hash_combine */
+
+/**
+ * Allocate new rope string, which references the two halves of a concatenation
+ *
+ * Note:
+ *      the references of the halves are taken over by the rope,
+ *      ropes deeper than CONFIG_ECMA_STRING_ROPE_MAX_DEPTH are flattened immediately
+ *
+ * @return pointer to ecma-string descriptor
+ */
+static ecma_string_t *
+ecma_new_ecma_rope_string (ecma_string_t *left_p, /**< first half */
+                           ecma_string_t *right_p, /**< second half */
+                           lit_string_hash_t hash) /**< hash of the concatenation */
+{
+  const lit_utf8_size_t size = ecma_string_get_size (left_p) + ecma_string_get_size (right_p);
+  const ecma_length_t length = ecma_string_get_length (left_p) + ecma_string_get_length (right_p);
+
+  JERRY_ASSERT (size <= ECMA_STRING_MAX_CONCATENATION_LENGTH && length <= size);
+
+  ecma_string_rope_t *rope_p = ecma_alloc_string_rope ();
+  ECMA_SET_NON_NULL_POINTER (rope_p->left_cp, left_p);
+  ECMA_SET_NON_NULL_POINTER (rope_p->right_cp, right_p);
+  rope_p->size = size;
+  rope_p->length = length;
+
+  uint16_t depth = JERRY_MAX (ecma_string_get_rope_depth (left_p), ecma_string_get_rope_depth (right_p));
+
+  ecma_string_t *string_desc_p = ecma_alloc_string ();
+  string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_HEAP_ROPE_STRING | ECMA_STRING_REF_ONE;
+  string_desc_p->hash = hash;
+  string_desc_p->u.common_field = 0;
+  ECMA_SET_NON_NULL_POINTER (string_desc_p->u.rope_string.rope_cp, rope_p);
+  string_desc_p->u.rope_string.depth = (uint16_t) (depth + 1);
+
+  if (depth >= CONFIG_ECMA_STRING_ROPE_MAX_DEPTH)
+  {
+    ecma_string_flatten (string_desc_p);
+  }
+
+  return string_desc_p;
+} /* ecma_new_ecma_rope_string */
+
+/**
+ * Concatenate ecma-strings into a rope string
+ *
+ * @return concatenation of two ecma-strings
+ */
+static ecma_string_t *
+ecma_concat_ecma_strings_to_rope (ecma_string_t *string1_p, /**< first ecma-string */
+                                  ecma_string_t *string2_p) /**< second ecma-string */
+{
+  if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_ROPE_STRING)
+  {
+    const ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t,
+                                                                  string1_p->u.rope_string.rope_cp);
+    ecma_string_t *left_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp);
+    ecma_string_t *right_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp);
+
+    const lit_utf8_size_t left_size = ecma_string_get_size (left_p);
+    const lit_utf8_size_t right_size = ecma_string_get_size (right_p);
+    const lit_utf8_size_t str2_size = ecma_string_get_size (string2_p);
+
+    /* Short pieces are appended to the last half of the rope, so the s += piece
+     * loops create a new rope node only after CONFIG_ECMA_STRING_ROPE_MIN_SIZE bytes.
+     *
+     * Furthermore the last half is merged with the appended string when it is not longer
+     * (and the first half remains the longer one), so the sizes of the halves along the
+     * right edge of a rope decrease like the digits of a binary counter. Otherwise each
+     * append would increase the depth of the rope, and the append loops would flatten
+     * the whole string after every few pieces. */
+    if (right_size + str2_size < CONFIG_ECMA_STRING_ROPE_MIN_SIZE
+        || (right_size <= str2_size && left_size >= right_size + str2_size))
+    {
+      ecma_string_t *last_half_p = ecma_concat_ecma_strings (right_p, string2_p);
+      ecma_string_t *result_p = ecma_concat_ecma_strings (left_p, last_half_p);
+
+      ecma_deref_ecma_string (last_half_p);
+      return result_p;
+    }
+  }
+
+  return ecma_new_ecma_rope_string (ecma_copy_or_ref_ecma_string (string1_p),
+                                    ecma_copy_or_ref_ecma_string (string2_p),
+                                    ecma_string_hash_combine (string1_p->hash, string2_p));
+} /* ecma_concat_ecma_strings_to_rope */
+
 /**
  * Concatenate ecma-strings
  *
@@ -360,7 +626,19 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
 
   const lit_utf8_size_t new_size = str1_size + str2_size;
 
-  JERRY_ASSERT (new_size <= UINT16_MAX);
+  if (new_size > ECMA_STRING_MAX_CONCATENATION_LENGTH)
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
+
+  if (new_size >= CONFIG_ECMA_STRING_ROPE_MIN_SIZE)
+  {
+    return ecma_concat_ecma_strings_to_rope (string1_p, string2_p);
+  }
+
+  /* Ropes are never shorter than CONFIG_ECMA_STRING_ROPE_MIN_SIZE. */
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string1_p) != ECMA_STRING_CONTAINER_HEAP_ROPE_STRING
+                && ECMA_STRING_GET_CONTAINER (string2_p) != ECMA_STRING_CONTAINER_HEAP_ROPE_STRING);
 
   ecma_string_t *string_desc_p = ecma_alloc_string ();
 
@@ -371,7 +649,7 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
   {
     string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_HEAP_ASCII_STRING | ECMA_STRING_REF_ONE;
     const size_t data_size = new_size;
-    lit_utf8_byte_t *data_p = (lit_utf8_byte_t *) mem_heap_alloc_block (data_size);
+    lit_utf8_byte_t *data_p = (lit_utf8_byte_t *) ecma_alloc_string_buffer (data_size);
     lit_utf8_size_t bytes_copied = ecma_string_to_utf8_string (string1_p, data_p, str1_size);
     JERRY_ASSERT (bytes_copied == str1_size);
     bytes_copied = ecma_string_to_utf8_string (string2_p, data_p + str1_size, str2_size);
@@ -386,27 +664,21 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
   else
   {
     string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_HEAP_UTF8_STRING | ECMA_STRING_REF_ONE;
-    const size_t data_size = new_size + sizeof (ecma_string_heap_header_t);
-    ecma_string_heap_header_t *data_p = (ecma_string_heap_header_t *) mem_heap_alloc_block (data_size);
-    lit_utf8_size_t bytes_copied = ecma_string_to_utf8_string (string1_p,
-                                                               (lit_utf8_byte_t *) (data_p + 1),
-                                                               str1_size);
+    ecma_string_heap_header_t *data_p = ecma_string_alloc_heap_header (new_size, string_length);
+    lit_utf8_byte_t *chars_p = ecma_string_heap_header_get_chars (data_p);
+
+    lit_utf8_size_t bytes_copied = ecma_string_to_utf8_string (string1_p, chars_p, str1_size);
     JERRY_ASSERT (bytes_copied == str1_size);
 
-    bytes_copied = ecma_string_to_utf8_string (string2_p,
-                                               (lit_utf8_byte_t *) (data_p + 1) + str1_size,
-                                               str2_size);
+    bytes_copied = ecma_string_to_utf8_string (string2_p, chars_p + str1_size, str2_size);
     JERRY_ASSERT (bytes_copied == str2_size);
-    JERRY_ASSERT (string_length <= UINT16_MAX);
-
-    data_p->size = (uint16_t) new_size;
-    data_p->length = (uint16_t) string_length;
 
     string_desc_p->hash = lit_utf8_string_hash_combine (string1_p->hash,
-                                                        (lit_utf8_byte_t *) (data_p + 1) + str1_size,
+                                                        chars_p + str1_size,
                                                         (lit_utf8_size_t) str2_size);
 
-    ECMA_SET_NON_NULL_POINTER (string_desc_p->u.utf8_collection_cp, data_p);
+    ECMA_SET_NON_NULL_POINTER (string_desc_p->u.utf8_string.utf8_collection_cp, data_p);
+    ECMA_SET_POINTER (string_desc_p->u.utf8_string.index_cp, NULL);
   }
 
   return string_desc_p;
@@ -423,6 +695,8 @@ ecma_copy_ecma_string (ecma_string_t *string_desc_p) /**< string descriptor */
   JERRY_ASSERT (string_desc_p != NULL);
   JERRY_ASSERT (string_desc_p->refs_and_container >= ECMA_STRING_REF_ONE);
 
+  ecma_string_flatten (string_desc_p);
+
   ecma_string_t *new_str_p;
 
   switch (ECMA_STRING_GET_CONTAINER (string_desc_p))
@@ -456,14 +730,14 @@ ecma_copy_ecma_string (ecma_string_t *string_desc_p) /**< string descriptor */
       *new_str_p = *string_desc_p;
       new_str_p->refs_and_container = ECMA_STRING_SET_REF_TO_ONE (new_str_p->refs_and_container);
 
-      const ecma_string_heap_header_t *data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                           string_desc_p->u.utf8_collection_cp);
+      const ecma_string_heap_header_t *data_p = ECMA_STRING_GET_UTF8_HEADER (string_desc_p);
       JERRY_ASSERT (data_p != NULL);
-      const size_t data_size = data_p->size + sizeof (ecma_string_heap_header_t);
-      ecma_string_heap_header_t *new_data_p = (ecma_string_heap_header_t *) mem_heap_alloc_block (data_size);
+      const size_t data_size = ecma_string_heap_header_get_buffer_size (data_p);
+      ecma_string_heap_header_t *new_data_p = (ecma_string_heap_header_t *) ecma_alloc_string_buffer (data_size);
       memcpy (new_data_p, data_p, data_size);
 
-      ECMA_SET_NON_NULL_POINTER (new_str_p->u.utf8_collection_cp, new_data_p);
+      ECMA_SET_NON_NULL_POINTER (new_str_p->u.utf8_string.utf8_collection_cp, new_data_p);
+      ECMA_SET_POINTER (new_str_p->u.utf8_string.index_cp, NULL);
 
       break;
     }
@@ -479,7 +753,7 @@ ecma_copy_ecma_string (ecma_string_t *string_desc_p) /**< string descriptor */
 
       JERRY_ASSERT (data_p != NULL);
       const size_t data_size = string_desc_p->u.ascii_string.size;
-      lit_utf8_byte_t *new_data_p = (lit_utf8_byte_t *) mem_heap_alloc_block (data_size);
+      lit_utf8_byte_t *new_data_p = (lit_utf8_byte_t *) ecma_alloc_string_buffer (data_size);
       memcpy (new_data_p, data_p, data_size);
 
       ECMA_SET_NON_NULL_POINTER (new_str_p->u.ascii_string.ascii_collection_cp, new_data_p);
@@ -550,10 +824,17 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
   {
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
     {
-      ecma_string_heap_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                           string_p->u.utf8_collection_cp);
+      ecma_string_heap_header_t *const data_p = ECMA_STRING_GET_UTF8_HEADER (string_p);
+      ecma_string_index_entry_t *const index_p = ECMA_GET_POINTER (ecma_string_index_entry_t,
+                                                                   string_p->u.utf8_string.index_cp);
 
-      mem_heap_free_block (data_p, data_p->size + sizeof (ecma_string_heap_header_t));
+      if (index_p != NULL)
+      {
+        const ecma_length_t count = ECMA_STRING_INDEX_GET_COUNT (ecma_string_heap_header_get_length (data_p));
+        ecma_dealloc_string_buffer (index_p, count * sizeof (ecma_string_index_entry_t));
+      }
+
+      ecma_dealloc_string_buffer (data_p, ecma_string_heap_header_get_buffer_size (data_p));
 
       break;
     }
@@ -562,7 +843,7 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       lit_utf8_byte_t *const data_p = ECMA_GET_NON_NULL_POINTER (lit_utf8_byte_t,
                                                                  string_p->u.ascii_string.ascii_collection_cp);
 
-      mem_heap_free_block (data_p, string_p->u.ascii_string.size);
+      ecma_dealloc_string_buffer (data_p, string_p->u.ascii_string.size);
 
       break;
     }
@@ -575,6 +856,17 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
 
       break;
     }
+    case ECMA_STRING_CONTAINER_HEAP_ROPE_STRING:
+    {
+      ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t,
+                                                              string_p->u.rope_string.rope_cp);
+
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp));
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp));
+      ecma_dealloc_string_rope (rope_p);
+
+      break;
+    }
     case ECMA_STRING_CONTAINER_LIT_TABLE:
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
@@ -618,6 +910,7 @@ ecma_string_to_number (const ecma_string_t *str_p) /**< ecma-string */
     case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
+    case ECMA_STRING_CONTAINER_HEAP_ROPE_STRING:
     {
       ecma_number_t num;
 
@@ -695,10 +988,9 @@ ecma_string_to_utf8_string (const ecma_string_t *string_desc_p, /**< ecma-string
   {
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
     {
-      const ecma_string_heap_header_t *data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                           string_desc_p->u.utf8_collection_cp);
-      size = data_p->size;
-      memcpy (buffer_p, data_p + 1, size);
+      const ecma_string_heap_header_t *data_p = ECMA_STRING_GET_UTF8_HEADER (string_desc_p);
+      size = ecma_string_heap_header_get_size (data_p);
+      memcpy (buffer_p, ecma_string_heap_header_get_chars (data_p), size);
       break;
     }
     case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
@@ -744,6 +1036,19 @@ ecma_string_to_utf8_string (const ecma_string_t *string_desc_p, /**< ecma-string
       memcpy (buffer_p, lit_get_magic_string_ex_utf8 (id), size);
       break;
     }
+    case ECMA_STRING_CONTAINER_HEAP_ROPE_STRING:
+    {
+      /* The halves are copied without flattening the rope. */
+      const ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t,
+                                                                    string_desc_p->u.rope_string.rope_cp);
+      size = ecma_string_to_utf8_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp),
+                                         buffer_p,
+                                         buffer_size);
+      size += ecma_string_to_utf8_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp),
+                                          buffer_p + size,
+                                          buffer_size - size);
+      break;
+    }
     default:
     {
       JERRY_UNREACHABLE ();
@@ -754,6 +1059,60 @@ ecma_string_to_utf8_string (const ecma_string_t *string_desc_p, /**< ecma-string
   return size;
 } /* ecma_string_to_utf8_string */
 
+/**
+ * Replace the rope of a rope string with a flat copy of its characters.
+ *
+ * Note:
+ *      the value of the string is not changed, only its representation,
+ *      so the descriptor is updated in place and all references see the flat string
+ */
+static void
+ecma_string_flatten (const ecma_string_t *string_p) /**< ecma-string */
+{
+  if (ECMA_STRING_GET_CONTAINER (string_p) != ECMA_STRING_CONTAINER_HEAP_ROPE_STRING)
+  {
+    return;
+  }
+
+  ecma_string_t *string_desc_p = (ecma_string_t *) string_p;
+  ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t,
+                                                          string_desc_p->u.rope_string.rope_cp);
+  const lit_utf8_size_t size = rope_p->size;
+  lit_utf8_size_t bytes_copied;
+
+  /* The allocation may run the garbage collector, which can change the reference counter,
+   * so the container is replaced only after the characters are copied. */
+
+  if (size == rope_p->length && !ECMA_STRING_IS_LARGE (size))
+  {
+    lit_utf8_byte_t *data_p = (lit_utf8_byte_t *) ecma_alloc_string_buffer (size);
+    bytes_copied = ecma_string_to_utf8_string (string_p, data_p, size);
+
+    string_desc_p->refs_and_container = (uint16_t) ((string_desc_p->refs_and_container & ~ECMA_STRING_CONTAINER_MASK)
+                                                    | ECMA_STRING_CONTAINER_HEAP_ASCII_STRING);
+    string_desc_p->u.common_field = 0;
+    string_desc_p->u.ascii_string.size = (uint16_t) size;
+    ECMA_SET_NON_NULL_POINTER (string_desc_p->u.ascii_string.ascii_collection_cp, data_p);
+  }
+  else
+  {
+    ecma_string_heap_header_t *data_p = ecma_string_alloc_heap_header (size, rope_p->length);
+    bytes_copied = ecma_string_to_utf8_string (string_p, ecma_string_heap_header_get_chars (data_p), size);
+
+    string_desc_p->refs_and_container = (uint16_t) ((string_desc_p->refs_and_container & ~ECMA_STRING_CONTAINER_MASK)
+                                                    | ECMA_STRING_CONTAINER_HEAP_UTF8_STRING);
+    string_desc_p->u.common_field = 0;
+    ECMA_SET_NON_NULL_POINTER (string_desc_p->u.utf8_string.utf8_collection_cp, data_p);
+    ECMA_SET_POINTER (string_desc_p->u.utf8_string.index_cp, NULL);
+  }
+
+  JERRY_ASSERT (bytes_copied == size);
+
+  ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp));
+  ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp));
+  ecma_dealloc_string_rope (rope_p);
+} /* ecma_string_flatten */
+
 /**
  * Lengths for numeric string values
  */
@@ -833,6 +1192,8 @@ ecma_string_raw_chars (const ecma_string_t *string_p, /**< ecma-string */
   lit_utf8_size_t size;
   const lit_utf8_byte_t *result_p;
 
+  ecma_string_flatten (string_p);
+
   switch (ECMA_STRING_GET_CONTAINER (string_p))
   {
     case ECMA_STRING_CONTAINER_LIT_TABLE:
@@ -847,11 +1208,10 @@ ecma_string_raw_chars (const ecma_string_t *string_p, /**< ecma-string */
     }
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
     {
-      const ecma_string_heap_header_t *data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                           string_p->u.utf8_collection_cp);
-      size = data_p->size;
-      length = data_p->length;
-      result_p = (const lit_utf8_byte_t *) (data_p + 1);
+      const ecma_string_heap_header_t *data_p = ECMA_STRING_GET_UTF8_HEADER (string_p);
+      size = ecma_string_heap_header_get_size (data_p);
+      length = ecma_string_heap_header_get_length (data_p);
+      result_p = ecma_string_heap_header_get_chars (data_p);
       break;
     }
     case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
@@ -928,6 +1288,9 @@ static bool __attr_noinline___
 ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-string */
                                     const ecma_string_t *string2_p) /* ecma-string */
 {
+  ecma_string_flatten (string1_p);
+  ecma_string_flatten (string2_p);
+
   if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_GET_CONTAINER (string2_p))
   {
     switch (ECMA_STRING_GET_CONTAINER (string1_p))
@@ -997,17 +1360,17 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
       }
       case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
       {
-        const ecma_string_heap_header_t *data1_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                              string1_p->u.utf8_collection_cp);
-        const ecma_string_heap_header_t *data2_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                              string2_p->u.utf8_collection_cp);
+        const ecma_string_heap_header_t *data1_p = ECMA_STRING_GET_UTF8_HEADER (string1_p);
+        const ecma_string_heap_header_t *data2_p = ECMA_STRING_GET_UTF8_HEADER (string2_p);
 
-        if (data1_p->length != data2_p->length)
+        if (ecma_string_heap_header_get_length (data1_p) != ecma_string_heap_header_get_length (data2_p))
         {
           return false;
         }
 
-        return !strncmp ((char *) (data1_p + 1), (char *) (data2_p + 1), strings_size);
+        return !strncmp ((char *) ecma_string_heap_header_get_chars (data1_p),
+                         (char *) ecma_string_heap_header_get_chars (data2_p),
+                         strings_size);
       }
       case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
       {
@@ -1032,10 +1395,9 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
 
   if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING)
   {
-    const ecma_string_heap_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                               string1_p->u.utf8_collection_cp);
+    const ecma_string_heap_header_t *const data_p = ECMA_STRING_GET_UTF8_HEADER (string1_p);
 
-    utf8_string1_p = (lit_utf8_byte_t *) (data_p + 1);
+    utf8_string1_p = ecma_string_heap_header_get_chars (data_p);
   }
   else if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_ASCII_STRING)
   {
@@ -1063,10 +1425,9 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
 
   if (ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING)
   {
-    const ecma_string_heap_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                               string2_p->u.utf8_collection_cp);
+    const ecma_string_heap_header_t *const data_p = ECMA_STRING_GET_UTF8_HEADER (string2_p);
 
-    utf8_string2_p = (lit_utf8_byte_t *) (data_p + 1);
+    utf8_string2_p = ecma_string_heap_header_get_chars (data_p);
   }
   else if (ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_HEAP_ASCII_STRING)
   {
@@ -1152,6 +1513,9 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
     return false;
   }
 
+  ecma_string_flatten (string1_p);
+  ecma_string_flatten (string2_p);
+
   lit_utf8_byte_t *utf8_string1_p, *utf8_string2_p;
   bool is_utf8_string1_on_heap = false, is_utf8_string2_on_heap = false;
   lit_utf8_byte_t utf8_string1_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
@@ -1161,11 +1525,10 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
 
   if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING)
   {
-    const ecma_string_heap_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                               string1_p->u.utf8_collection_cp);
+    const ecma_string_heap_header_t *const data_p = ECMA_STRING_GET_UTF8_HEADER (string1_p);
 
-    utf8_string1_p = (lit_utf8_byte_t *) (data_p + 1);
-    utf8_string1_size = (lit_utf8_size_t) data_p->size;
+    utf8_string1_p = ecma_string_heap_header_get_chars (data_p);
+    utf8_string1_size = ecma_string_heap_header_get_size (data_p);
   }
   else if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_ASCII_STRING)
   {
@@ -1203,11 +1566,10 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
 
   if (ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING)
   {
-    const ecma_string_heap_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                               string2_p->u.utf8_collection_cp);
+    const ecma_string_heap_header_t *const data_p = ECMA_STRING_GET_UTF8_HEADER (string2_p);
 
-    utf8_string2_p = (lit_utf8_byte_t *) (data_p + 1);
-    utf8_string2_size = (lit_utf8_size_t) data_p->size;
+    utf8_string2_p = ecma_string_heap_header_get_chars (data_p);
+    utf8_string2_size = ecma_string_heap_header_get_size (data_p);
   }
   if (ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_HEAP_ASCII_STRING)
   {
@@ -1301,13 +1663,19 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
     {
       return (ecma_length_t) (string_p->u.ascii_string.size);
     }
+    case ECMA_STRING_CONTAINER_HEAP_ROPE_STRING:
+    {
+      const ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t,
+                                                                    string_p->u.rope_string.rope_cp);
+
+      return (ecma_length_t) rope_p->length;
+    }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING);
-      const ecma_string_heap_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                                 string_p->u.utf8_collection_cp);
+      const ecma_string_heap_header_t *const data_p = ECMA_STRING_GET_UTF8_HEADER (string_p);
 
-      return (ecma_length_t) data_p->length;
+      return ecma_string_heap_header_get_length (data_p);
     }
   }
 } /* ecma_string_get_length */
@@ -1349,17 +1717,118 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
     {
       return (lit_utf8_size_t) string_p->u.ascii_string.size;
     }
+    case ECMA_STRING_CONTAINER_HEAP_ROPE_STRING:
+    {
+      const ecma_string_rope_t *rope_p = ECMA_GET_NON_NULL_POINTER (ecma_string_rope_t,
+                                                                    string_p->u.rope_string.rope_cp);
+
+      return (lit_utf8_size_t) rope_p->size;
+    }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING);
-      const ecma_string_heap_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
-                                                                                 string_p->u.utf8_collection_cp);
+      const ecma_string_heap_header_t *const data_p = ECMA_STRING_GET_UTF8_HEADER (string_p);
 
-      return (lit_utf8_size_t) data_p->size;
+      return ecma_string_heap_header_get_size (data_p);
     }
   }
 } /* ecma_string_get_size */
 
+/**
+ * Build the character index of an utf-8 string
+ *
+ * @return pointer to the first entry of the index
+ */
+static const ecma_string_index_entry_t *
+ecma_string_build_utf8_index (const ecma_string_t *string_p) /**< utf-8 string */
+{
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING);
+
+  const ecma_string_heap_header_t *data_p = ECMA_STRING_GET_UTF8_HEADER (string_p);
+  const ecma_length_t count = ECMA_STRING_INDEX_GET_COUNT (ecma_string_heap_header_get_length (data_p));
+  JERRY_ASSERT (count > 0);
+
+  ecma_string_index_entry_t *index_p;
+  index_p = (ecma_string_index_entry_t *) ecma_alloc_string_buffer (count * sizeof (ecma_string_index_entry_t));
+
+  const lit_utf8_byte_t *chars_p = ecma_string_heap_header_get_chars (data_p);
+  lit_utf8_size_t offset = 0;
+
+  for (ecma_length_t i = 0; i < count; i++)
+  {
+    for (uint32_t j = 0; j < CONFIG_ECMA_STRING_INDEX_STRIDE; j++)
+    {
+      offset += lit_get_unicode_char_size_by_utf8_first_byte (chars_p[offset]);
+    }
+
+    index_p[i] = (ecma_string_index_entry_t) offset;
+  }
+
+  /* The index does not change the value of the string, so it is stored in constant strings as well. */
+  ECMA_SET_NON_NULL_POINTER (((ecma_string_t *) string_p)->u.utf8_string.index_cp, index_p);
+  return index_p;
+} /* ecma_string_build_utf8_index */
+
+/**
+ * Get the offset of a character in the cesu-8 representation of the ecma-string.
+ *
+ * Note:
+ *      the offsets of the non-ascii heap strings are looked up in their character index,
+ *      so the cost does not depend on the position of the character
+ *
+ * @return offset in bytes
+ */
+lit_utf8_size_t
+ecma_string_get_char_offset (const ecma_string_t *string_p, /**< ecma-string */
+                             ecma_length_t index) /**< index of character, should be less or equal
+                                                   *   than string length */
+{
+  lit_utf8_size_t size;
+  bool is_ascii;
+  const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (string_p, &size, &is_ascii);
+
+  if (is_ascii)
+  {
+    JERRY_ASSERT (index <= size);
+    return (lit_utf8_size_t) index;
+  }
+
+  JERRY_ASSERT (chars_p != NULL);
+
+  lit_utf8_size_t offset = 0;
+
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING
+      && index >= CONFIG_ECMA_STRING_INDEX_STRIDE)
+  {
+    const ecma_length_t length = ecma_string_heap_header_get_length (ECMA_STRING_GET_UTF8_HEADER (string_p));
+    JERRY_ASSERT (index <= length);
+
+    if (index == length)
+    {
+      return size;
+    }
+
+    const ecma_string_index_entry_t *index_p = ECMA_GET_POINTER (ecma_string_index_entry_t,
+                                                                 string_p->u.utf8_string.index_cp);
+
+    if (index_p == NULL)
+    {
+      index_p = ecma_string_build_utf8_index (string_p);
+    }
+
+    offset = index_p[index / CONFIG_ECMA_STRING_INDEX_STRIDE - 1];
+    index %= CONFIG_ECMA_STRING_INDEX_STRIDE;
+  }
+
+  while (index--)
+  {
+    JERRY_ASSERT (offset < size);
+    offset += lit_get_unicode_char_size_by_utf8_first_byte (chars_p[offset]);
+  }
+
+  return offset;
+} /* ecma_string_get_char_offset */
+
 /**
  * Get character from specified position in the ecma-string.
  *
@@ -1376,32 +1845,28 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
   bool is_ascii;
   const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (string_p, &buffer_size, &is_ascii);
 
-  if (chars_p != NULL)
+  if (chars_p == NULL)
   {
-    if (is_ascii)
-    {
-      return chars_p[index];
-    }
-
-    return lit_utf8_string_code_unit_at (chars_p, buffer_size, index);
-  }
+    JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_NUMBER
+                  || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC);
+    /* Both above must be ascii strings. */
+    JERRY_ASSERT (is_ascii && buffer_size <= ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER);
 
-  ecma_char_t ch;
-
-  MEM_DEFINE_LOCAL_ARRAY (utf8_str_p, buffer_size, lit_utf8_byte_t);
+    lit_utf8_byte_t utf8_str[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
 
-  lit_utf8_size_t sz = ecma_string_to_utf8_string (string_p, utf8_str_p, buffer_size);
-  JERRY_ASSERT (sz == buffer_size);
-
-  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_NUMBER
-                || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC);
-  /* Both above must be ascii strings. */
-  JERRY_ASSERT (is_ascii);
+    lit_utf8_size_t sz = ecma_string_to_utf8_string (string_p, utf8_str, buffer_size);
+    JERRY_ASSERT (sz == buffer_size);
 
-  ch = utf8_str_p[index];
+    return utf8_str[index];
+  }
 
-  MEM_FINALIZE_LOCAL_ARRAY (utf8_str_p);
+  if (is_ascii)
+  {
+    return chars_p[index];
+  }
 
+  ecma_char_t ch;
+  lit_read_code_unit_from_utf8 (chars_p + ecma_string_get_char_offset (string_p, index), &ch);
   return ch;
 } /* ecma_string_get_char_at_pos */
 
@@ -1519,69 +1984,28 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
     bool is_ascii;
     const lit_utf8_byte_t *start_p = ecma_string_raw_chars (string_p, &buffer_size, &is_ascii);
 
-    end_pos -= start_pos;
-
-    if (start_p != NULL)
+    if (start_p == NULL)
     {
-      if (is_ascii)
-      {
-        return ecma_new_ecma_string_from_utf8 (start_p + start_pos,
-                                               (lit_utf8_size_t) end_pos);
-      }
+      /* Numbers are ascii strings. */
+      JERRY_ASSERT (is_ascii && buffer_size <= ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER);
 
-      while (start_pos--)
-      {
-        start_p += lit_get_unicode_char_size_by_utf8_first_byte (*start_p);
-      }
+      lit_utf8_byte_t utf8_str[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
 
-      const lit_utf8_byte_t *end_p = start_p;
-      while (end_pos--)
-      {
-        end_p += lit_get_unicode_char_size_by_utf8_first_byte (*end_p);
-      }
+      lit_utf8_size_t sz = ecma_string_to_utf8_string (string_p, utf8_str, buffer_size);
+      JERRY_ASSERT (sz == buffer_size);
 
-      return ecma_new_ecma_string_from_utf8 (start_p, (lit_utf8_size_t) (end_p - start_p));
+      return ecma_new_ecma_string_from_utf8 (utf8_str + start_pos, (lit_utf8_size_t) (end_pos - start_pos));
     }
 
-    /**
-     * I. Dump original string to plain buffer
-     */
-    ecma_string_t *ecma_string_p;
-
-    MEM_DEFINE_LOCAL_ARRAY (utf8_str_p, buffer_size, lit_utf8_byte_t);
-
-    lit_utf8_size_t sz = ecma_string_to_utf8_string (string_p, utf8_str_p, buffer_size);
-    JERRY_ASSERT (sz == buffer_size);
-
-    /**
-     * II. Extract substring
-     */
-    start_p = utf8_str_p;
-
     if (is_ascii)
     {
-      ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p + start_pos,
-                                                      (lit_utf8_size_t) end_pos);
-    }
-    else
-    {
-      while (start_pos--)
-      {
-        start_p += lit_get_unicode_char_size_by_utf8_first_byte (*start_p);
-      }
-
-      const lit_utf8_byte_t *end_p = start_p;
-      while (end_pos--)
-      {
-        end_p += lit_get_unicode_char_size_by_utf8_first_byte (*end_p);
-      }
-
-      ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p, (lit_utf8_size_t) (end_p - start_p));
+      return ecma_new_ecma_string_from_utf8 (start_p + start_pos, (lit_utf8_size_t) (end_pos - start_pos));
     }
 
-    MEM_FINALIZE_LOCAL_ARRAY (utf8_str_p);
+    const lit_utf8_size_t start_offset = ecma_string_get_char_offset (string_p, start_pos);
+    const lit_utf8_size_t end_offset = ecma_string_get_char_offset (string_p, end_pos);
 
-    return ecma_string_p;
+    return ecma_new_ecma_string_from_utf8 (start_p + start_offset, end_offset - start_offset);
   }
   else
   {
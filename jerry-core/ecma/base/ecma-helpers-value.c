@@ -40,11 +40,19 @@ JERRY_STATIC_ASSERT (ECMA_TYPE___MAX <= ECMA_VALUE_TYPE_MASK,
 JERRY_STATIC_ASSERT ((ECMA_VALUE_FULL_MASK + 1) == (1 << ECMA_VALUE_SHIFT),
                      ecma_value_part_must_start_after_flags);
 
+JERRY_STATIC_ASSERT (ECMA_TYPE_DIRECT == 0,
+                     ecma_type_direct_must_be_zero_for_integer_arithmetic);
+
+JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_INTEGER_VALUE == 0,
+                     ecma_direct_type_integer_value_must_be_zero_for_integer_arithmetic);
+
+JERRY_STATIC_ASSERT (((ECMA_INTEGER_NUMBER_MAX << ECMA_DIRECT_SHIFT) >> ECMA_DIRECT_SHIFT) == ECMA_INTEGER_NUMBER_MAX,
+                     ecma_integer_number_max_must_fit_in_the_value_part_of_direct_values);
+
 JERRY_STATIC_ASSERT (ECMA_VALUE_SHIFT <= MEM_ALIGNMENT_LOG,
                      ecma_value_shift_must_be_less_than_or_equal_than_mem_alignment_log);
 
-JERRY_STATIC_ASSERT ((sizeof (ecma_value_t) * JERRY_BITSINBYTE)
-                     >= (sizeof (mem_cpointer_t) * JERRY_BITSINBYTE + ECMA_VALUE_SHIFT),
+JERRY_STATIC_ASSERT ((sizeof (ecma_value_t) * JERRY_BITSINBYTE) >= (MEM_CP_WIDTH + ECMA_VALUE_SHIFT),
                      ecma_value_must_be_large_enough_to_store_compressed_pointers);
 
 #ifdef ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY
@@ -206,16 +214,60 @@ ecma_is_value_array_hole (ecma_value_t value) /**< ecma value */
   return ecma_is_value_equal_to_simple_value (value, ECMA_SIMPLE_VALUE_ARRAY_HOLE);
 } /* ecma_is_value_array_hole */
 
+/**
+ * Check if the value is a small integer number stored directly in the value.
+ *
+ * @return true - if the value contains a directly encoded integer number,
+ *         false - otherwise.
+ */
+inline bool __attr_const___ __attr_always_inline___
+ecma_is_value_integer_number (ecma_value_t value) /**< ecma value */
+{
+  return ((value & (ECMA_VALUE_TYPE_MASK | ECMA_DIRECT_TYPE_MASK))
+          == (ECMA_TYPE_DIRECT | ECMA_DIRECT_TYPE_INTEGER_VALUE));
+} /* ecma_is_value_integer_number */
+
+/**
+ * Check if both values are small integer numbers stored directly in the value.
+ *
+ * Note:
+ *      error values are not accepted
+ *
+ * @return true - if both values contain directly encoded integer numbers,
+ *         false - otherwise.
+ */
+inline bool __attr_const___ __attr_always_inline___
+ecma_are_values_integer_numbers (ecma_value_t first_value, /**< first ecma value */
+                                 ecma_value_t second_value) /**< second ecma value */
+{
+  const ecma_value_t mask = ECMA_VALUE_TYPE_MASK | ECMA_VALUE_ERROR_FLAG | ECMA_DIRECT_TYPE_MASK;
+
+  return ((first_value | second_value) & mask) == (ECMA_TYPE_DIRECT | ECMA_DIRECT_TYPE_INTEGER_VALUE);
+} /* ecma_are_values_integer_numbers */
+
+/**
+ * Check if the value is a heap allocated floating point number.
+ *
+ * @return true - if the value contains a pointer to a floating point number,
+ *         false - otherwise.
+ */
+inline bool __attr_const___ __attr_always_inline___
+ecma_is_value_float_number (ecma_value_t value) /**< ecma value */
+{
+  return (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER);
+} /* ecma_is_value_float_number */
+
 /**
  * Check if the value is ecma-number.
  *
  * @return true - if the value contains ecma-number value,
  *         false - otherwise.
  */
-inline bool __attr_pure___ __attr_always_inline___
+inline bool __attr_const___ __attr_always_inline___
 ecma_is_value_number (ecma_value_t value) /**< ecma value */
 {
-  return (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER);
+  return (ecma_is_value_integer_number (value)
+          || ecma_is_value_float_number (value));
 } /* ecma_is_value_number */
 
 /**
@@ -275,20 +327,132 @@ ecma_check_value_type_is_spec_defined (ecma_value_t value) /**< ecma value */
 inline ecma_value_t __attr_const___ __attr_always_inline___
 ecma_make_simple_value (const ecma_simple_value_t simple_value) /**< simple value */
 {
-  return (((ecma_value_t) (simple_value)) << ECMA_VALUE_SHIFT) | ECMA_TYPE_SIMPLE;
+  return ((((ecma_value_t) (simple_value)) << ECMA_DIRECT_SHIFT)
+          | ECMA_DIRECT_TYPE_SIMPLE_VALUE
+          | ECMA_TYPE_DIRECT);
 } /* ecma_make_simple_value */
 
 /**
- * Number value constructor
+ * Small integer number value constructor
+ *
+ * @return ecma value
  */
-ecma_value_t __attr_const___
-ecma_make_number_value (const ecma_number_t *ecma_num_p) /**< number to reference in value */
+inline ecma_value_t __attr_const___ __attr_always_inline___
+ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number in the small integer range */
+{
+  JERRY_ASSERT (ECMA_IS_INTEGER_NUMBER (integer_value));
+
+  return ((((ecma_value_t) integer_value) << ECMA_DIRECT_SHIFT)
+          | ECMA_DIRECT_TYPE_INTEGER_VALUE
+          | ECMA_TYPE_DIRECT);
+} /* ecma_make_integer_value */
+
+/**
+ * Allocate and initialize a new floating point number
+ *
+ * @return ecma value
+ */
+static ecma_value_t
+ecma_create_float_number (ecma_number_t ecma_number) /**< value of the float number */
 {
-  JERRY_ASSERT (ecma_num_p != NULL);
+  ecma_number_t *ecma_num_p = ecma_alloc_number ();
+
+  *ecma_num_p = ecma_number;
 
   return ecma_pointer_to_ecma_value (ecma_num_p) | ECMA_TYPE_NUMBER;
+} /* ecma_create_float_number */
+
+/**
+ * Create a new NaN value.
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_make_nan_value (void)
+{
+  return ecma_create_float_number (ecma_number_make_nan ());
+} /* ecma_make_nan_value */
+
+/**
+ * Check whether the number can be stored directly in an ecma value.
+ *
+ * @return true - if the number is in the small integer range and it is not negative zero,
+ *         false - otherwise.
+ */
+static inline bool __attr_always_inline___
+ecma_number_is_small_integer (ecma_number_t ecma_number, /**< number */
+                              ecma_integer_value_t *integer_value_p) /**< [out] integer value */
+{
+  if (ecma_number >= (ecma_number_t) ECMA_INTEGER_NUMBER_MIN
+      && ecma_number <= (ecma_number_t) ECMA_INTEGER_NUMBER_MAX)
+  {
+    ecma_integer_value_t integer_value = (ecma_integer_value_t) ecma_number;
+
+    if ((ecma_number_t) integer_value == ecma_number
+        && (integer_value != 0 || !ecma_number_is_negative (ecma_number)))
+    {
+      *integer_value_p = integer_value;
+      return true;
+    }
+  }
+
+  return false;
+} /* ecma_number_is_small_integer */
+
+/**
+ * Number value constructor
+ *
+ * Note:
+ *      numbers in the small integer range (except negative zero)
+ *      are stored directly in the value, others are allocated on the heap
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_make_number_value (ecma_number_t ecma_number) /**< number */
+{
+  ecma_integer_value_t integer_value;
+
+  if (ecma_number_is_small_integer (ecma_number, &integer_value))
+  {
+    return ecma_make_integer_value (integer_value);
+  }
+
+  return ecma_create_float_number (ecma_number);
 } /* ecma_make_number_value */
 
+/**
+ * Int32 number value constructor
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_make_int32_value (int32_t int32_number) /**< int32 number */
+{
+  if (ECMA_IS_INTEGER_NUMBER (int32_number))
+  {
+    return ecma_make_integer_value ((ecma_integer_value_t) int32_number);
+  }
+
+  return ecma_create_float_number ((ecma_number_t) int32_number);
+} /* ecma_make_int32_value */
+
+/**
+ * Uint32 number value constructor
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_make_uint32_value (uint32_t uint32_number) /**< uint32 number */
+{
+  if (uint32_number <= ECMA_INTEGER_NUMBER_MAX)
+  {
+    return ecma_make_integer_value ((ecma_integer_value_t) uint32_number);
+  }
+
+  return ecma_create_float_number ((ecma_number_t) uint32_number);
+} /* ecma_make_uint32_value */
+
 /**
  * String value constructor
  */
@@ -333,18 +497,65 @@ ecma_make_error_obj_value (const ecma_object_t *object_p) /**< object to referen
 } /* ecma_make_error_obj_value */
 
 /**
- * Get pointer to ecma-number from ecma value
+ * Get the small integer number stored directly in the ecma value
  *
- * @return the pointer
+ * @return integer number
+ */
+inline ecma_integer_value_t __attr_const___ __attr_always_inline___
+ecma_get_integer_from_value (ecma_value_t value) /**< ecma value */
+{
+  JERRY_ASSERT (ecma_is_value_integer_number (value));
+
+  /* The sign bit is kept by the arithmetic shift. */
+  return ((ecma_integer_value_t) value) >> ECMA_DIRECT_SHIFT;
+} /* ecma_get_integer_from_value */
+
+/**
+ * Get the number stored in the ecma value
+ *
+ * @return number
  */
-ecma_number_t *__attr_pure___
+ecma_number_t __attr_pure___
 ecma_get_number_from_value (ecma_value_t value) /**< ecma value */
 {
+  if (ecma_is_value_integer_number (value))
+  {
+    return (ecma_number_t) ecma_get_integer_from_value (value);
+  }
+
   JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER);
 
-  return (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
+  return *(ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 } /* ecma_get_number_from_value */
 
+/**
+ * Update the number stored in a heap allocated floating point number value
+ *
+ * Note:
+ *      the floating point number is released if the new number
+ *      can be stored directly in the value
+ *
+ * @return updated ecma value
+ */
+ecma_value_t
+ecma_update_float_number (ecma_value_t float_value, /**< floating point number value */
+                          ecma_number_t new_number) /**< new number */
+{
+  JERRY_ASSERT (ecma_is_value_float_number (float_value));
+
+  ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (float_value);
+  ecma_integer_value_t integer_value;
+
+  if (ecma_number_is_small_integer (new_number, &integer_value))
+  {
+    ecma_dealloc_number (number_p);
+    return ecma_make_integer_value (integer_value);
+  }
+
+  *number_p = new_number;
+  return float_value;
+} /* ecma_update_float_number */
+
 /**
  * Get pointer to ecma-string from ecma value
  *
@@ -398,18 +609,15 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
 {
   switch (ecma_get_value_type_field (value))
   {
-    case ECMA_TYPE_SIMPLE:
+    case ECMA_TYPE_DIRECT:
     {
       return value;
     }
     case ECMA_TYPE_NUMBER:
     {
-      ecma_number_t *num_p = ecma_get_number_from_value (value);
-
-      ecma_number_t *number_copy_p = ecma_alloc_number ();
-      *number_copy_p = *num_p;
+      ecma_number_t *num_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 
-      return ecma_make_number_value (number_copy_p);
+      return ecma_create_float_number (*num_p);
     }
     case ECMA_TYPE_STRING:
     {
@@ -449,7 +657,7 @@ ecma_free_value (ecma_value_t value) /**< value description */
 {
   switch (ecma_get_value_type_field (value))
   {
-    case ECMA_TYPE_SIMPLE:
+    case ECMA_TYPE_DIRECT:
     {
       /* doesn't hold additional memory */
       break;
@@ -457,7 +665,7 @@ ecma_free_value (ecma_value_t value) /**< value description */
 
     case ECMA_TYPE_NUMBER:
     {
-      ecma_number_t *number_p = ecma_get_number_from_value (value);
+      ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
       ecma_dealloc_number (number_p);
       break;
     }
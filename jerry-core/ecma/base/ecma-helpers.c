@@ -15,14 +15,18 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-array-object.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "ecma-inline-cache.h"
 #include "ecma-lcache.h"
 #include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
 #include "jrt-bit-fields.h"
 #include "byte-code.h"
 #include "re-compiler.h"
+#include "vm-stats.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -93,6 +97,8 @@ ecma_create_object (ecma_object_t *prototype_object_p, /**< pointer to prototybe
                     bool is_extensible, /**< value of extensible attribute */
                     ecma_object_type_t type) /**< object type */
 {
+  ecma_gc_allocation_step ();
+
   ecma_object_t *new_object_p = ecma_alloc_object ();
 
   uint16_t type_flags = (uint16_t) type;
@@ -127,6 +133,8 @@ ecma_create_object (ecma_object_t *prototype_object_p, /**< pointer to prototybe
 ecma_object_t *
 ecma_create_decl_lex_env (ecma_object_t *outer_lexical_environment_p) /**< outer lexical environment */
 {
+  ecma_gc_allocation_step ();
+
   ecma_object_t *new_lexical_environment_p = ecma_alloc_object ();
 
   uint16_t type = ECMA_OBJECT_FLAG_BUILT_IN_OR_LEXICAL_ENV | ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE;
@@ -160,6 +168,8 @@ ecma_create_object_lex_env (ecma_object_t *outer_lexical_environment_p, /**< out
   JERRY_ASSERT (binding_obj_p != NULL
                 && !ecma_is_lexical_environment (binding_obj_p));
 
+  ecma_gc_allocation_step ();
+
   ecma_object_t *new_lexical_environment_p = ecma_alloc_object ();
 
   uint16_t type;
@@ -308,6 +318,34 @@ ecma_get_lex_env_type (const ecma_object_t *object_p) /**< lexical environment *
   return (ecma_lexical_environment_type_t) (object_p->type_flags_refs & ECMA_OBJECT_TYPE_MASK);
 } /* ecma_get_lex_env_type */
 
+/**
+ * Check whether the set of bindings of a lexical environment is fixed.
+ *
+ * @return true - if the environment is a declarative environment whose bindings
+ *                are all created before any code is executed in it,
+ *         false - otherwise
+ */
+inline bool __attr_pure___
+ecma_get_lex_env_has_static_bindings (const ecma_object_t *object_p) /**< lexical environment */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (ecma_is_lexical_environment (object_p));
+
+  return (object_p->type_flags_refs & ECMA_LEXICAL_ENVIRONMENT_FLAG_STATIC_BINDINGS) != 0;
+} /* ecma_get_lex_env_has_static_bindings */
+
+/**
+ * Mark the set of bindings of a declarative lexical environment as fixed.
+ */
+inline void
+ecma_set_lex_env_has_static_bindings (ecma_object_t *object_p) /**< lexical environment */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
+
+  object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs | ECMA_LEXICAL_ENVIRONMENT_FLAG_STATIC_BINDINGS);
+} /* ecma_set_lex_env_has_static_bindings */
+
 /**
  * Get outer reference of lexical environment.
  */
@@ -398,6 +436,29 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
 {
   JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
 
+  if (name_p != NULL
+      && !ecma_is_lexical_environment (object_p)
+      && ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_ARRAY)
+  {
+    /* Array index properties of fast arrays are stored in the element vector. */
+    ecma_property_t *property_p = ecma_op_array_create_element (object_p, name_p, type_and_flags, value);
+
+    if (property_p != NULL)
+    {
+      return property_p;
+    }
+  }
+  else if (name_p != NULL)
+  {
+    /* Named properties are stored in the slot vector of the object when possible. */
+    ecma_property_t *property_p = ecma_shape_create_property (object_p, name_p, type_and_flags, value);
+
+    if (property_p != NULL)
+    {
+      return property_p;
+    }
+  }
+
   mem_cpointer_t *property_list_head_p = &object_p->property_list_or_bound_object_cp;
   bool has_hashmap = false;
 
@@ -414,6 +475,18 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
     }
   }
 
+  if (*property_list_head_p != ECMA_NULL_POINTER)
+  {
+    /* If the next entry is a slot or element vector, it is skipped as well. */
+    ecma_property_header_t *first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                          *property_list_head_p);
+
+    if (ECMA_PROPERTY_IS_PROPERTY_VECTOR (first_property_p))
+    {
+      property_list_head_p = &first_property_p->next_property_cp;
+    }
+  }
+
   if (*property_list_head_p != ECMA_NULL_POINTER)
   {
     /* If the first entry is free (deleted), it is reused. */
@@ -525,6 +598,14 @@ ecma_find_internal_property (ecma_object_t *object_p, /**< object descriptor */
                                     prop_iter_p->next_property_cp);
   }
 
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_IS_PROPERTY_VECTOR (prop_iter_p))
+  {
+    /* Internal properties are never stored in slots or elements. */
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
   while (prop_iter_p != NULL)
   {
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
@@ -637,9 +718,26 @@ ecma_create_named_accessor_property (ecma_object_t *object_p, /**< object */
 
   ecma_lcache_invalidate (object_p, name_p, NULL);
 
+  if (get_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, get_p);
+  }
+
+  if (set_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, set_p);
+  }
+
   ecma_property_value_t value;
+#ifndef JERRY_CPOINTER_32_BIT
   ECMA_SET_POINTER (value.getter_setter_pair.getter_p, get_p);
   ECMA_SET_POINTER (value.getter_setter_pair.setter_p, set_p);
+#else /* JERRY_CPOINTER_32_BIT */
+  ecma_getter_setter_pointers_t *getter_setter_pair_p = ecma_alloc_getter_setter_pointers ();
+  ECMA_SET_POINTER (getter_setter_pair_p->getter_p, get_p);
+  ECMA_SET_POINTER (getter_setter_pair_p->setter_p, set_p);
+  ECMA_SET_NON_NULL_POINTER (value.getter_setter_pair_cp, getter_setter_pair_p);
+#endif /* !JERRY_CPOINTER_32_BIT */
 
   return ecma_create_property (object_p, name_p, type_and_flags, value);
 } /* ecma_create_named_accessor_property */
@@ -665,6 +763,38 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
   }
 
   ecma_property_header_t *prop_iter_p = ecma_get_property_list (obj_p);
+  ecma_property_header_t *vector_p = prop_iter_p;
+
+  if (vector_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (vector_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    vector_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                 vector_p->next_property_cp);
+  }
+
+  if (vector_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (vector_p->types + 0) == ECMA_PROPERTY_TYPE_SLOTS)
+  {
+    property_p = ecma_shape_find_property ((ecma_property_slots_t *) vector_p, name_p);
+
+    if (property_p != NULL)
+    {
+      ecma_lcache_insert (obj_p, name_p, property_p);
+      return property_p;
+    }
+  }
+  else if (vector_p != NULL
+           && ECMA_PROPERTY_GET_TYPE (vector_p->types + 0) == ECMA_PROPERTY_TYPE_ELEMENTS)
+  {
+    uint32_t index;
+
+    /* All array index properties of fast arrays are stored in the element vector.
+     * Elements are not cached, since the vector is reallocated when it grows. */
+    if (ecma_string_get_array_index (name_p, &index))
+    {
+      return ecma_op_array_find_element ((ecma_array_elements_t *) vector_p, index);
+    }
+  }
 
 #ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
   if (prop_iter_p != NULL
@@ -677,6 +807,13 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
   }
 #endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
 
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_IS_PROPERTY_VECTOR (prop_iter_p))
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
   property_p = NULL;
 
   uint32_t steps = 0;
@@ -882,6 +1019,25 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
   }
 } /* ecma_free_internal_property */
 
+/**
+ * Get the getter and setter pair of named accessor property
+ *
+ * @return pointer to the getter and setter pair
+ */
+static ecma_getter_setter_pointers_t *
+ecma_get_named_accessor_property_pair (const ecma_property_t *prop_p) /**< named accessor property */
+{
+  JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+
+#ifndef JERRY_CPOINTER_32_BIT
+  return &ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair;
+#else /* JERRY_CPOINTER_32_BIT */
+  /* Two 32 bit compressed pointers do not fit into the property value, so the pair is allocated separately. */
+  return ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t,
+                                    ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair_cp);
+#endif /* !JERRY_CPOINTER_32_BIT */
+} /* ecma_get_named_accessor_property_pair */
+
 /**
  * Free property values and change their type to deleted.
  */
@@ -903,6 +1059,9 @@ ecma_free_property (ecma_object_t *object_p, /**< object the property belongs to
     case ECMA_PROPERTY_TYPE_NAMEDACCESSOR:
     {
       ecma_lcache_invalidate (object_p, name_p, property_p);
+#ifdef JERRY_CPOINTER_32_BIT
+      ecma_dealloc_getter_setter_pointers (ecma_get_named_accessor_property_pair (property_p));
+#endif /* JERRY_CPOINTER_32_BIT */
       break;
     }
     case ECMA_PROPERTY_TYPE_INTERNAL:
@@ -943,6 +1102,41 @@ ecma_delete_property (ecma_object_t *object_p, /**< object */
     has_hashmap = true;
   }
 
+  if (cur_prop_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (cur_prop_p->types + 0) == ECMA_PROPERTY_TYPE_SLOTS)
+  {
+    ecma_property_slots_t *slots_p = (ecma_property_slots_t *) cur_prop_p;
+
+    if (ecma_shape_is_slot (slots_p, prop_p))
+    {
+      uint32_t slot_index = ecma_shape_get_slot_index (slots_p, prop_p);
+
+      ecma_free_property (object_p, ecma_shape_get_slot_name (slots_p, slot_index), prop_p);
+
+      /* The slot is not reused and the shape is kept, so
+       * new properties are stored in property pairs. */
+      slots_p->is_closed = 1;
+      return;
+    }
+
+    prev_prop_p = cur_prop_p;
+    cur_prop_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                   cur_prop_p->next_property_cp);
+  }
+  else if (cur_prop_p != NULL
+           && ECMA_PROPERTY_GET_TYPE (cur_prop_p->types + 0) == ECMA_PROPERTY_TYPE_ELEMENTS)
+  {
+    if (ecma_op_array_is_element ((ecma_array_elements_t *) cur_prop_p, prop_p))
+    {
+      ecma_op_array_delete_element (object_p, prop_p);
+      return;
+    }
+
+    prev_prop_p = cur_prop_p;
+    cur_prop_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                   cur_prop_p->next_property_cp);
+  }
+
   while (true)
   {
     JERRY_ASSERT (cur_prop_p != NULL);
@@ -1020,6 +1214,29 @@ ecma_assert_object_contains_the_property (const ecma_object_t *object_p, /**< ec
                                     prop_iter_p->next_property_cp);
   }
 
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_SLOTS)
+  {
+    if (ecma_shape_is_slot ((ecma_property_slots_t *) prop_iter_p, prop_p))
+    {
+      return;
+    }
+
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+  else if (prop_iter_p != NULL
+           && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_ELEMENTS)
+  {
+    if (ecma_op_array_is_element ((ecma_array_elements_t *) prop_iter_p, (ecma_property_t *) prop_p))
+    {
+      return;
+    }
+
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
   while (prop_iter_p != NULL)
   {
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
@@ -1061,6 +1278,10 @@ ecma_get_named_data_property_value (const ecma_property_t *prop_p) /**< property
 
 /**
  * Set value field of named data property
+ *
+ * Note:
+ *      the function has no write barrier, so object values must be stored
+ *      with ecma_named_data_property_assign_value
  */
 inline void __attr_always_inline___
 ecma_set_named_data_property_value (ecma_property_t *prop_p, /**< property */
@@ -1110,19 +1331,24 @@ ecma_named_data_property_assign_value (ecma_object_t *obj_p, /**< object */
   JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
   ecma_assert_object_contains_the_property (obj_p, prop_p);
 
+  ecma_value_t v = ecma_get_named_data_property_value (prop_p);
+
   if (ecma_is_value_number (value)
-      && ecma_is_value_number (ecma_get_named_data_property_value (prop_p)))
+      && ecma_is_value_float_number (v))
   {
-    const ecma_number_t *num_src_p = ecma_get_number_from_value (value);
-    ecma_number_t *num_dst_p = ecma_get_number_from_value (ecma_get_named_data_property_value (prop_p));
-
-    *num_dst_p = *num_src_p;
+    /* The floating point number of the property is reused if possible. */
+    ecma_set_named_data_property_value (prop_p,
+                                        ecma_update_float_number (v, ecma_get_number_from_value (value)));
   }
   else
   {
-    ecma_value_t v = ecma_get_named_data_property_value (prop_p);
     ecma_free_value_if_not_object (v);
 
+    if (ecma_is_value_object (value))
+    {
+      ecma_gc_write_barrier (obj_p, ecma_get_object_from_value (value));
+    }
+
     ecma_set_named_data_property_value (prop_p, ecma_copy_value_if_not_object (value));
   }
 } /* ecma_named_data_property_assign_value */
@@ -1137,7 +1363,7 @@ ecma_get_named_accessor_property_getter (const ecma_property_t *prop_p) /**< nam
 {
   JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
 
-  return ECMA_GET_POINTER (ecma_object_t, ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair.getter_p);
+  return ECMA_GET_POINTER (ecma_object_t, ecma_get_named_accessor_property_pair (prop_p)->getter_p);
 } /* ecma_get_named_accessor_property_getter */
 
 /**
@@ -1150,7 +1376,7 @@ ecma_get_named_accessor_property_setter (const ecma_property_t *prop_p) /**< nam
 {
   JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
 
-  return ECMA_GET_POINTER (ecma_object_t, ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair.setter_p);
+  return ECMA_GET_POINTER (ecma_object_t, ecma_get_named_accessor_property_pair (prop_p)->setter_p);
 } /* ecma_get_named_accessor_property_setter */
 
 /**
@@ -1164,7 +1390,12 @@ ecma_set_named_accessor_property_getter (ecma_object_t *object_p, /**< the prope
   JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
   ecma_assert_object_contains_the_property (object_p, prop_p);
 
-  ECMA_SET_POINTER (ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair.getter_p, getter_p);
+  if (getter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, getter_p);
+  }
+
+  ECMA_SET_POINTER (ecma_get_named_accessor_property_pair (prop_p)->getter_p, getter_p);
 } /* ecma_set_named_accessor_property_getter */
 
 /**
@@ -1178,7 +1409,12 @@ ecma_set_named_accessor_property_setter (ecma_object_t *object_p, /**< the prope
   JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
   ecma_assert_object_contains_the_property (object_p, prop_p);
 
-  ECMA_SET_POINTER (ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair.setter_p, setter_p);
+  if (setter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, setter_p);
+  }
+
+  ECMA_SET_POINTER (ecma_get_named_accessor_property_pair (prop_p)->setter_p, setter_p);
 } /* ecma_set_named_accessor_property_setter */
 
 /**
@@ -1460,6 +1696,13 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
     uint32_t literal_end;
     uint32_t const_literal_end;
 
+#ifdef JERRY_VM_PROFILE
+    vm_stats_profile_free_function (bytecode_p);
+#endif /* JERRY_VM_PROFILE */
+#ifdef MEM_STATS
+    ecma_alloc_stats_free_bytecode (bytecode_p);
+#endif /* MEM_STATS */
+
     if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
     {
       uint8_t *byte_p = (uint8_t *) bytecode_p;
@@ -1468,6 +1711,10 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
       cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_p;
       literal_end = args_p->literal_end;
       const_literal_end = args_p->const_literal_end;
+
+      ecma_inline_cache_free_table (args_p->inline_cache_cp,
+                                    args_p->inline_cache_count,
+                                    CBC_SCOPE_CACHE_COUNT (bytecode_p, args_p));
     }
     else
     {
@@ -1477,6 +1724,10 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
       cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_p;
       literal_end = args_p->literal_end;
       const_literal_end = args_p->const_literal_end;
+
+      ecma_inline_cache_free_table (args_p->inline_cache_cp,
+                                    args_p->inline_cache_count,
+                                    CBC_SCOPE_CACHE_COUNT (bytecode_p, args_p));
     }
 
     for (uint32_t i = const_literal_end; i < literal_end; i++)
@@ -1501,6 +1752,9 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
   }
 
+  ECMA_ALLOC_STATS_REMOVE ((bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION) ? ECMA_ALLOC_KIND_BYTECODE
+                                                                               : ECMA_ALLOC_KIND_REGEXP_BYTECODE,
+                           ((size_t) bytecode_p->size) << MEM_ALIGNMENT_LOG);
   mem_heap_free_block (bytecode_p,
                        ((size_t) bytecode_p->size) << MEM_ALIGNMENT_LOG);
 } /* ecma_bytecode_deref */
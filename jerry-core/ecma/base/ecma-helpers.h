@@ -122,6 +122,9 @@ extern bool ecma_is_value_true (ecma_value_t);
 extern bool ecma_is_value_false (ecma_value_t);
 extern bool ecma_is_value_array_hole (ecma_value_t);
 
+extern bool ecma_is_value_integer_number (ecma_value_t);
+extern bool ecma_are_values_integer_numbers (ecma_value_t, ecma_value_t);
+extern bool ecma_is_value_float_number (ecma_value_t);
 extern bool ecma_is_value_number (ecma_value_t);
 extern bool ecma_is_value_string (ecma_value_t);
 extern bool ecma_is_value_object (ecma_value_t);
@@ -130,12 +133,18 @@ extern bool ecma_is_value_error (ecma_value_t);
 extern void ecma_check_value_type_is_spec_defined (ecma_value_t);
 
 extern ecma_value_t ecma_make_simple_value (const ecma_simple_value_t value);
-extern ecma_value_t ecma_make_number_value (const ecma_number_t *);
+extern ecma_value_t ecma_make_integer_value (ecma_integer_value_t);
+extern ecma_value_t ecma_make_nan_value (void);
+extern ecma_value_t ecma_make_number_value (ecma_number_t);
+extern ecma_value_t ecma_make_int32_value (int32_t);
+extern ecma_value_t ecma_make_uint32_value (uint32_t);
 extern ecma_value_t ecma_make_string_value (const ecma_string_t *);
 extern ecma_value_t ecma_make_object_value (const ecma_object_t *);
 extern ecma_value_t ecma_make_error_value (ecma_value_t);
 extern ecma_value_t ecma_make_error_obj_value (const ecma_object_t *);
-extern ecma_number_t *ecma_get_number_from_value (ecma_value_t) __attr_pure___;
+extern ecma_integer_value_t ecma_get_integer_from_value (ecma_value_t) __attr_const___;
+extern ecma_number_t ecma_get_number_from_value (ecma_value_t) __attr_pure___;
+extern ecma_value_t ecma_update_float_number (ecma_value_t, ecma_number_t);
 extern ecma_string_t *ecma_get_string_from_value (ecma_value_t) __attr_pure___;
 extern ecma_object_t *ecma_get_object_from_value (ecma_value_t) __attr_pure___;
 extern ecma_value_t ecma_get_value_from_error_value (ecma_value_t) __attr_pure___;
@@ -167,6 +176,7 @@ extern bool ecma_compare_ecma_strings (const ecma_string_t *, const ecma_string_
 extern bool ecma_compare_ecma_strings_relational (const ecma_string_t *, const ecma_string_t *);
 extern ecma_length_t ecma_string_get_length (const ecma_string_t *);
 extern lit_utf8_size_t ecma_string_get_size (const ecma_string_t *);
+extern lit_utf8_size_t ecma_string_get_char_offset (const ecma_string_t *, ecma_length_t);
 extern ecma_char_t ecma_string_get_char_at_pos (const ecma_string_t *, ecma_length_t);
 
 extern ecma_string_t *ecma_get_magic_string (lit_magic_string_id_t);
@@ -239,6 +249,8 @@ extern ecma_object_t *ecma_get_object_prototype (const ecma_object_t *) __attr_p
 extern bool ecma_get_object_is_builtin (const ecma_object_t *) __attr_pure___;
 extern void ecma_set_object_is_builtin (ecma_object_t *);
 extern ecma_lexical_environment_type_t ecma_get_lex_env_type (const ecma_object_t *) __attr_pure___;
+extern bool ecma_get_lex_env_has_static_bindings (const ecma_object_t *) __attr_pure___;
+extern void ecma_set_lex_env_has_static_bindings (ecma_object_t *);
 extern ecma_object_t *ecma_get_lex_env_outer_reference (const ecma_object_t *) __attr_pure___;
 extern ecma_property_header_t *ecma_get_property_list (const ecma_object_t *) __attr_pure___;
 extern ecma_object_t *ecma_get_lex_env_binding_object (const ecma_object_t *) __attr_pure___;
@@ -0,0 +1,234 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-inline-cache.h"
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmainlinecache Property access inline caches
+ * @{
+ */
+
+/**
+ * Inline caches of a compiled code.
+ *
+ * The inline caches of the property access sites are
+ * followed by the scope caches of the identifiers.
+ */
+typedef struct
+{
+  uint32_t epoch; /**< value of ecma_inline_cache_epoch when the entries were validated */
+  ecma_inline_cache_t caches[1]; /**< inline caches of the property access sites (variable length) */
+} ecma_inline_cache_table_t;
+
+/**
+ * Initialize inline caches
+ */
+void
+ecma_inline_cache_init (void)
+{
+  JERRY_CONTEXT (ecma_inline_cache_epoch) = 0;
+} /* ecma_inline_cache_init */
+
+/**
+ * Get the size of an inline cache table
+ *
+ * @return size in bytes
+ */
+static inline size_t __attr_always_inline___
+ecma_inline_cache_get_table_size (uint32_t caches_count, /**< number of inline caches */
+                                  uint32_t scope_caches_count) /**< number of scope caches */
+{
+  JERRY_ASSERT (caches_count > 0 || scope_caches_count > 0);
+
+  return (sizeof (ecma_inline_cache_table_t) - sizeof (ecma_inline_cache_t)
+          + caches_count * sizeof (ecma_inline_cache_t)
+          + scope_caches_count * sizeof (ecma_scope_cache_t));
+} /* ecma_inline_cache_get_table_size */
+
+/**
+ * Get the inline cache table of a compiled code. The table is allocated
+ * when a cache of the code is used first time.
+ *
+ * @return pointer to the inline cache table
+ */
+static ecma_inline_cache_table_t *
+ecma_inline_cache_get_table (mem_cpointer_t *table_cp_p, /**< [in, out] compressed pointer to
+                                                          *            the inline cache table */
+                             uint32_t caches_count, /**< number of inline caches */
+                             uint32_t scope_caches_count) /**< number of scope caches */
+{
+  ecma_inline_cache_table_t *table_p;
+
+  if (unlikely (*table_cp_p == ECMA_NULL_POINTER))
+  {
+    size_t size = ecma_inline_cache_get_table_size (caches_count, scope_caches_count);
+
+    ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_INLINE_CACHE, size);
+    table_p = (ecma_inline_cache_table_t *) mem_heap_alloc_block (size);
+    memset (table_p, 0, size);
+    table_p->epoch = JERRY_CONTEXT (ecma_inline_cache_epoch);
+
+    ECMA_SET_NON_NULL_POINTER (*table_cp_p, table_p);
+  }
+  else
+  {
+    table_p = ECMA_GET_NON_NULL_POINTER (ecma_inline_cache_table_t, *table_cp_p);
+
+    if (unlikely (table_p->epoch != JERRY_CONTEXT (ecma_inline_cache_epoch)))
+    {
+      memset (table_p->caches,
+              0,
+              caches_count * sizeof (ecma_inline_cache_t) + scope_caches_count * sizeof (ecma_scope_cache_t));
+      table_p->epoch = JERRY_CONTEXT (ecma_inline_cache_epoch);
+    }
+  }
+
+  return table_p;
+} /* ecma_inline_cache_get_table */
+
+/**
+ * Get an inline cache of a compiled code.
+ *
+ * @return pointer to the inline cache
+ */
+ecma_inline_cache_t *
+ecma_inline_cache_get (mem_cpointer_t *table_cp_p, /**< [in, out] compressed pointer to
+                                                    *            the inline cache table */
+                       uint32_t caches_count, /**< number of inline caches */
+                       uint32_t scope_caches_count, /**< number of scope caches */
+                       uint32_t cache_index) /**< index of the inline cache */
+{
+  JERRY_ASSERT (cache_index < caches_count);
+
+  ecma_inline_cache_table_t *table_p = ecma_inline_cache_get_table (table_cp_p, caches_count, scope_caches_count);
+
+  return table_p->caches + cache_index;
+} /* ecma_inline_cache_get */
+
+/**
+ * Get a scope cache of a compiled code.
+ *
+ * @return pointer to the scope cache
+ */
+ecma_scope_cache_t *
+ecma_inline_cache_get_scope_cache (mem_cpointer_t *table_cp_p, /**< [in, out] compressed pointer to
+                                                                *            the inline cache table */
+                                   uint32_t caches_count, /**< number of inline caches */
+                                   uint32_t scope_caches_count, /**< number of scope caches */
+                                   uint32_t scope_cache_index) /**< index of the scope cache */
+{
+  JERRY_ASSERT (scope_cache_index < scope_caches_count);
+
+  ecma_inline_cache_table_t *table_p = ecma_inline_cache_get_table (table_cp_p, caches_count, scope_caches_count);
+
+  return ((ecma_scope_cache_t *) (table_p->caches + caches_count)) + scope_cache_index;
+} /* ecma_inline_cache_get_scope_cache */
+
+/**
+ * Free the inline cache table of a compiled code
+ */
+void
+ecma_inline_cache_free_table (mem_cpointer_t table_cp, /**< compressed pointer to the table */
+                              uint32_t caches_count, /**< number of inline caches */
+                              uint32_t scope_caches_count) /**< number of scope caches */
+{
+  if (table_cp != ECMA_NULL_POINTER)
+  {
+    size_t size = ecma_inline_cache_get_table_size (caches_count, scope_caches_count);
+
+    ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_INLINE_CACHE, size);
+    mem_heap_free_block (ECMA_GET_NON_NULL_POINTER (ecma_inline_cache_table_t, table_cp), size);
+  }
+} /* ecma_inline_cache_free_table */
+
+/**
+ * Lookup a property in an inline cache
+ *
+ * Note:
+ *      names are compared by their descriptors only, so the lookup
+ *      may fail for equal strings which are stored in different places
+ *
+ * @return pointer to the slot of the property - if the (shape, property name) pair is cached,
+ *         NULL - otherwise
+ */
+inline ecma_property_t * __attr_always_inline___
+ecma_inline_cache_lookup (ecma_inline_cache_t *cache_p, /**< inline cache */
+                          ecma_property_slots_t *slots_p, /**< slot vector of the object */
+                          ecma_string_t *prop_name_p) /**< property's name */
+{
+  for (uint32_t i = 0; i < ECMA_INLINE_CACHE_LENGTH; i++)
+  {
+    if (cache_p->entries[i].shape_cp == slots_p->shape_cp)
+    {
+      ecma_string_t *entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                                    cache_p->entries[i].name_cp);
+
+      if (entry_prop_name_p == prop_name_p
+          || (ECMA_STRING_GET_CONTAINER (prop_name_p) == ECMA_STRING_GET_CONTAINER (entry_prop_name_p)
+              && prop_name_p->u.common_field == entry_prop_name_p->u.common_field))
+      {
+        JERRY_ASSERT (cache_p->entries[i].slot_index < slots_p->capacity);
+
+        return ECMA_PROPERTY_SLOTS_GET (slots_p, cache_p->entries[i].slot_index);
+      }
+    }
+  }
+
+  return NULL;
+} /* ecma_inline_cache_lookup */
+
+/**
+ * Insert a slot of an object into an inline cache
+ */
+void
+ecma_inline_cache_insert (ecma_inline_cache_t *cache_p, /**< inline cache */
+                          ecma_property_slots_t *slots_p, /**< slot vector of the object */
+                          ecma_property_t *prop_p) /**< slot of the vector */
+{
+  uint32_t slot_index = ecma_shape_get_slot_index (slots_p, prop_p);
+
+  for (uint32_t i = ECMA_INLINE_CACHE_LENGTH - 1; i > 0; i--)
+  {
+    cache_p->entries[i] = cache_p->entries[i - 1];
+  }
+
+  cache_p->entries[0].shape_cp = slots_p->shape_cp;
+  ECMA_SET_NON_NULL_POINTER (cache_p->entries[0].name_cp, ecma_shape_get_slot_name (slots_p, slot_index));
+  cache_p->entries[0].slot_index = (uint8_t) slot_index;
+} /* ecma_inline_cache_insert */
+
+/**
+ * Invalidate all inline caches
+ *
+ * Note:
+ *      must be called when a shape is freed
+ */
+void
+ecma_inline_cache_invalidate_all (void)
+{
+  JERRY_CONTEXT (ecma_inline_cache_epoch)++;
+} /* ecma_inline_cache_invalidate_all */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,92 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_INLINE_CACHE_H
+#define ECMA_INLINE_CACHE_H
+
+#include "ecma-globals.h"
+#include "ecma-shape.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmainlinecache Property access inline caches
+ * @{
+ */
+
+/**
+ * Number of entries of an inline cache.
+ */
+#define ECMA_INLINE_CACHE_LENGTH 2
+
+/**
+ * Entry of an inline cache.
+ */
+typedef struct
+{
+  /** Compressed pointer to the shape of the objects (ECMA_NULL_POINTER marks entry empty) */
+  mem_cpointer_t shape_cp;
+
+  /** Compressed pointer to the name of the slot */
+  mem_cpointer_t name_cp;
+
+  /** Index of the slot which stores the property */
+  uint8_t slot_index;
+} ecma_inline_cache_entry_t;
+
+/**
+ * Inline cache of a property access site of the byte code.
+ */
+typedef struct
+{
+  ecma_inline_cache_entry_t entries[ECMA_INLINE_CACHE_LENGTH]; /**< most recently used entry first */
+} ecma_inline_cache_t;
+
+/**
+ * Scope cache of an identifier of the byte code.
+ *
+ * The cache records where the binding of the identifier was found: the
+ * number of lexical environments between the environment of the frame
+ * and the environment which has the binding, and the slot of the binding.
+ * Only environments with static bindings can be skipped or hold a cached
+ * binding, so the entry remains valid while the shape of the target
+ * environment matches.
+ */
+typedef struct
+{
+  /** Compressed pointer to the shape of the environment (ECMA_NULL_POINTER marks entry empty) */
+  mem_cpointer_t shape_cp;
+
+  /** Number of outer references followed from the environment of the frame */
+  uint8_t depth;
+
+  /** Index of the slot which stores the binding */
+  uint8_t slot_index;
+} ecma_scope_cache_t;
+
+extern void ecma_inline_cache_init (void);
+extern ecma_inline_cache_t *ecma_inline_cache_get (mem_cpointer_t *, uint32_t, uint32_t, uint32_t);
+extern ecma_scope_cache_t *ecma_inline_cache_get_scope_cache (mem_cpointer_t *, uint32_t, uint32_t, uint32_t);
+extern void ecma_inline_cache_free_table (mem_cpointer_t, uint32_t, uint32_t);
+extern ecma_property_t *ecma_inline_cache_lookup (ecma_inline_cache_t *, ecma_property_slots_t *, ecma_string_t *);
+extern void ecma_inline_cache_insert (ecma_inline_cache_t *, ecma_property_slots_t *, ecma_property_t *);
+extern void ecma_inline_cache_invalidate_all (void);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_INLINE_CACHE_H */
@@ -18,6 +18,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
+#include "jcontext.h"
 #include "jrt-libc-includes.h"
 
 /** \addtogroup ecma ECMA
@@ -27,43 +28,6 @@
  * @{
  */
 
-#ifndef CONFIG_ECMA_LCACHE_DISABLE
-/**
- * Entry of LCache hash table
- */
-typedef struct
-{
-  /** Pointer to a property of the object */
-  ecma_property_t *prop_p;
-
-  /** Compressed pointer to object (ECMA_NULL_POINTER marks record empty) */
-  mem_cpointer_t object_cp;
-
-  /** Compressed pointer to property's name */
-  mem_cpointer_t prop_name_cp;
-} ecma_lcache_hash_entry_t;
-
-/**
- * LCache hash value length, in bits
- */
-#define ECMA_LCACHE_HASH_BITS (sizeof (lit_string_hash_t) * JERRY_BITSINBYTE)
-
-/**
- * Number of rows in LCache's hash table
- */
-#define ECMA_LCACHE_HASH_ROWS_COUNT (1ull << ECMA_LCACHE_HASH_BITS)
-
-/**
- * Number of entries in a row of LCache's hash table
- */
-#define ECMA_LCACHE_HASH_ROW_LENGTH (2)
-
-/**
- * LCache's hash table
- */
-static ecma_lcache_hash_entry_t ecma_lcache_hash_table[ ECMA_LCACHE_HASH_ROWS_COUNT ][ ECMA_LCACHE_HASH_ROW_LENGTH ];
-#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
-
 /**
  * Initialize LCache
  */
@@ -71,7 +35,7 @@ void
 ecma_lcache_init (void)
 {
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
-  memset (ecma_lcache_hash_table, 0, sizeof (ecma_lcache_hash_table));
+  memset (JERRY_CONTEXT (ecma_lcache_hash_table), 0, sizeof (JERRY_CONTEXT (ecma_lcache_hash_table)));
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 } /* ecma_lcache_init */
 
@@ -110,9 +74,9 @@ ecma_lcache_invalidate_all (void)
   {
     for (uint32_t entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
     {
-      if (ecma_lcache_hash_table[ row_index ][ entry_index ].object_cp != ECMA_NULL_POINTER)
+      if (JERRY_CONTEXT (ecma_lcache_hash_table)[ row_index ][ entry_index ].object_cp != ECMA_NULL_POINTER)
       {
-        ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[ row_index ][ entry_index ]);
+        ecma_lcache_invalidate_entry (&JERRY_CONTEXT (ecma_lcache_hash_table)[ row_index ][ entry_index ]);
       }
     }
   }
@@ -132,10 +96,10 @@ ecma_lcache_invalidate_row_for_object_property_pair (uint32_t row_index, /**< in
 {
   for (uint32_t entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
   {
-    if (ecma_lcache_hash_table[ row_index ][ entry_index ].object_cp == object_cp
-        && ecma_lcache_hash_table[ row_index ][ entry_index ].prop_p == property_p)
+    if (JERRY_CONTEXT (ecma_lcache_hash_table)[ row_index ][ entry_index ].object_cp == object_cp
+        && JERRY_CONTEXT (ecma_lcache_hash_table)[ row_index ][ entry_index ].prop_p == property_p)
     {
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[ row_index ][ entry_index ]);
+      ecma_lcache_invalidate_entry (&JERRY_CONTEXT (ecma_lcache_hash_table)[ row_index ][ entry_index ]);
     }
   }
 } /* ecma_lcache_invalidate_row_for_object_property_pair */
@@ -166,13 +130,13 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
       int32_t entry_index;
       for (entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
       {
-        if (ecma_lcache_hash_table[hash_key][entry_index].object_cp != ECMA_NULL_POINTER
-            && ecma_lcache_hash_table[hash_key][entry_index].prop_p == prop_p)
+        if (JERRY_CONTEXT (ecma_lcache_hash_table)[hash_key][entry_index].object_cp != ECMA_NULL_POINTER
+            && JERRY_CONTEXT (ecma_lcache_hash_table)[hash_key][entry_index].prop_p == prop_p)
         {
 #ifndef JERRY_NDEBUG
           ecma_object_t *obj_in_entry_p;
-          obj_in_entry_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
-                                                      ecma_lcache_hash_table[hash_key][entry_index].object_cp);
+          mem_cpointer_t entry_object_cp = JERRY_CONTEXT (ecma_lcache_hash_table)[hash_key][entry_index].object_cp;
+          obj_in_entry_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, entry_object_cp);
           JERRY_ASSERT (obj_in_entry_p == object_p);
 #endif /* !JERRY_NDEBUG */
           break;
@@ -180,7 +144,7 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
       }
 
       JERRY_ASSERT (entry_index != ECMA_LCACHE_HASH_ROW_LENGTH);
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[hash_key][entry_index]);
+      ecma_lcache_invalidate_entry (&JERRY_CONTEXT (ecma_lcache_hash_table)[hash_key][entry_index]);
     }
 
     JERRY_ASSERT (!ecma_is_property_lcached (prop_p));
@@ -190,7 +154,7 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
   int32_t entry_index;
   for (entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
   {
-    if (ecma_lcache_hash_table[hash_key][entry_index].object_cp == ECMA_NULL_POINTER)
+    if (JERRY_CONTEXT (ecma_lcache_hash_table)[hash_key][entry_index].object_cp == ECMA_NULL_POINTER)
     {
       break;
     }
@@ -201,16 +165,18 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
     /* No empty entry was found, invalidating the whole row */
     for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
     {
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[hash_key][i]);
+      ecma_lcache_invalidate_entry (&JERRY_CONTEXT (ecma_lcache_hash_table)[hash_key][i]);
     }
 
     entry_index = 0;
   }
 
   ecma_ref_object (object_p);
-  ECMA_SET_NON_NULL_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].object_cp, object_p);
-  ECMA_SET_NON_NULL_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].prop_name_cp, prop_name_p);
-  ecma_lcache_hash_table[ hash_key ][ entry_index ].prop_p = prop_p;
+  ecma_lcache_hash_entry_t *entry_p = &JERRY_CONTEXT (ecma_lcache_hash_table)[ hash_key ][ entry_index ];
+
+  ECMA_SET_NON_NULL_POINTER (entry_p->object_cp, object_p);
+  ECMA_SET_NON_NULL_POINTER (entry_p->prop_name_cp, prop_name_p);
+  entry_p->prop_p = prop_p;
 #else /* CONFIG_ECMA_LCACHE_DISABLE */
   (void) prop_p;
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
@@ -240,17 +206,17 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
 
   for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
   {
-    if (ecma_lcache_hash_table[hash_key][i].object_cp == object_cp)
+    if (JERRY_CONTEXT (ecma_lcache_hash_table)[hash_key][i].object_cp == object_cp)
     {
-      ecma_string_t *entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
-                                                                    ecma_lcache_hash_table[hash_key][i].prop_name_cp);
+      mem_cpointer_t entry_prop_name_cp = JERRY_CONTEXT (ecma_lcache_hash_table)[hash_key][i].prop_name_cp;
+      ecma_string_t *entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, entry_prop_name_cp);
 
       JERRY_ASSERT (prop_name_p->hash == entry_prop_name_p->hash);
 
       if (ECMA_STRING_GET_CONTAINER (prop_name_p) == ECMA_STRING_GET_CONTAINER (entry_prop_name_p)
           && prop_name_p->u.common_field == entry_prop_name_p->u.common_field)
       {
-        ecma_property_t *prop_p = ecma_lcache_hash_table[hash_key][i].prop_p;
+        ecma_property_t *prop_p = JERRY_CONTEXT (ecma_lcache_hash_table)[hash_key][i].prop_p;
         JERRY_ASSERT (prop_p == NULL || ecma_is_property_lcached (prop_p));
 
         *prop_p_p = prop_p;
@@ -16,6 +16,8 @@
 #ifndef ECMA_LCACHE_H
 #define ECMA_LCACHE_H
 
+#include "ecma-globals.h"
+
 /** \addtogroup ecma ECMA
  * @{
  *
@@ -23,6 +25,38 @@
  * @{
  */
 
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+/**
+ * Entry of LCache hash table
+ */
+typedef struct
+{
+  /** Pointer to a property of the object */
+  ecma_property_t *prop_p;
+
+  /** Compressed pointer to object (ECMA_NULL_POINTER marks record empty) */
+  mem_cpointer_t object_cp;
+
+  /** Compressed pointer to property's name */
+  mem_cpointer_t prop_name_cp;
+} ecma_lcache_hash_entry_t;
+
+/**
+ * LCache hash value length, in bits
+ */
+#define ECMA_LCACHE_HASH_BITS (sizeof (lit_string_hash_t) * JERRY_BITSINBYTE)
+
+/**
+ * Number of rows in LCache's hash table
+ */
+#define ECMA_LCACHE_HASH_ROWS_COUNT (1ull << ECMA_LCACHE_HASH_BITS)
+
+/**
+ * Number of entries in a row of LCache's hash table
+ */
+#define ECMA_LCACHE_HASH_ROW_LENGTH (2)
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+
 extern void ecma_lcache_init (void);
 extern void ecma_lcache_invalidate_all (void);
 extern void ecma_lcache_insert (ecma_object_t *, ecma_string_t *, ecma_property_t *);
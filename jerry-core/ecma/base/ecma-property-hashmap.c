@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "ecma-alloc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-property-hashmap.h"
@@ -76,12 +77,20 @@ ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
 {
 #ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
   JERRY_ASSERT (ecma_get_property_list (object_p) != NULL);
-  JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (ecma_get_property_list (object_p)));
+  JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (ecma_get_property_list (object_p))
+                || ECMA_PROPERTY_IS_PROPERTY_VECTOR (ecma_get_property_list (object_p)));
 
   uint32_t named_property_count = 0;
 
   ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
 
+  /* Properties stored in slot or element vectors are not part of the hashmap. */
+  if (ECMA_PROPERTY_IS_PROPERTY_VECTOR (prop_iter_p))
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
   while (prop_iter_p != NULL)
   {
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
@@ -110,6 +119,7 @@ ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
 
   size_t total_size = ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (max_property_count);
 
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_PROPERTY_HASHMAP, total_size);
   ecma_property_hashmap_t *hashmap_p = (ecma_property_hashmap_t *) mem_heap_alloc_block (total_size);
   memset (hashmap_p, 0, total_size);
 
@@ -142,6 +152,12 @@ ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
   prop_iter_p = ecma_get_property_list (object_p);
   ECMA_SET_POINTER (object_p->property_list_or_bound_object_cp, hashmap_p);
 
+  if (ECMA_PROPERTY_IS_PROPERTY_VECTOR (prop_iter_p))
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
   while (prop_iter_p != NULL)
   {
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
@@ -225,6 +241,8 @@ ecma_property_hashmap_free (ecma_object_t *object_p) /**< object */
 
   object_p->property_list_or_bound_object_cp = property_p->next_property_cp;
 
+  ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_PROPERTY_HASHMAP,
+                           ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (hashmap_p->max_property_count));
   mem_heap_free_block (hashmap_p,
                        ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (hashmap_p->max_property_count));
 #else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
@@ -232,6 +250,57 @@ ecma_property_hashmap_free (ecma_object_t *object_p) /**< object */
 #endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
 } /* ecma_property_hashmap_free */
 
+/**
+ * Move the hashmap of the object to a lower heap address (see mem_heap_relocate_block).
+ * The object must have a property hashmap.
+ *
+ * @return size of the hashmap - if it is moved,
+ *         0 - otherwise
+ */
+size_t
+ecma_property_hashmap_relocate (ecma_object_t *object_p) /**< object */
+{
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  ecma_property_header_t *property_p = ecma_get_property_list (object_p);
+
+  JERRY_ASSERT (property_p != NULL
+                && ECMA_PROPERTY_GET_TYPE (property_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP);
+
+  ecma_property_hashmap_t *hashmap_p = (ecma_property_hashmap_t *) property_p;
+  size_t size = ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (hashmap_p->max_property_count);
+  void *new_hashmap_p = mem_heap_relocate_block (hashmap_p, size);
+
+  if (new_hashmap_p == hashmap_p)
+  {
+    return 0;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (object_p->property_list_or_bound_object_cp, new_hashmap_p);
+  return size;
+#else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+  (void) object_p;
+  return 0;
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+} /* ecma_property_hashmap_relocate */
+
+/**
+ * Get the size of a property hashmap
+ *
+ * @return size in bytes
+ */
+size_t
+ecma_property_hashmap_get_size (const ecma_property_header_t *hashmap_p) /**< hashmap */
+{
+  JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (hashmap_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP);
+
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  return ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (((const ecma_property_hashmap_t *) hashmap_p)->max_property_count);
+#else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+  JERRY_UNREACHABLE ();
+  return 0;
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+} /* ecma_property_hashmap_get_size */
+
 /**
  * Insert named property into the hashmap.
  */
@@ -413,6 +482,13 @@ ecma_property_hashmap_find (ecma_property_hashmap_t *hashmap_p, /**< hashmap */
   ecma_property_header_t *prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
                                                           hashmap_p->header.next_property_cp);
 
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_IS_PROPERTY_VECTOR (prop_iter_p))
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
   while (prop_iter_p != NULL && !property_found)
   {
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
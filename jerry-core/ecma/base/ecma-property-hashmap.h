@@ -55,6 +55,8 @@ typedef struct
 
 extern void ecma_property_hashmap_create (ecma_object_t *);
 extern void ecma_property_hashmap_free (ecma_object_t *);
+extern size_t ecma_property_hashmap_relocate (ecma_object_t *);
+extern size_t ecma_property_hashmap_get_size (const ecma_property_header_t *);
 extern void ecma_property_hashmap_insert (ecma_object_t *, ecma_string_t *, ecma_property_pair_t *, int);
 extern void ecma_property_hashmap_delete (ecma_object_t *, ecma_string_t *, ecma_property_t *);
 
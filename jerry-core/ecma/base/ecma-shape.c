@@ -0,0 +1,648 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-inline-cache.h"
+#include "ecma-shape.h"
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Object shapes
+ * @{
+ */
+
+JERRY_STATIC_ASSERT (sizeof (ecma_property_slots_t) == sizeof (uint64_t) * (sizeof (mem_cpointer_t) / 2),
+                     size_of_ecma_property_slots_t_must_be_equal_to_8_bytes_or_16_bytes_with_32_bit_cpointers);
+
+JERRY_STATIC_ASSERT (ECMA_PROPERTY_SLOTS_GROUP_LENGTH == sizeof (ecma_property_value_t),
+                     slot_group_length_must_be_equal_to_the_number_of_type_bytes_in_a_value);
+
+JERRY_STATIC_ASSERT (ECMA_PROPERTY_SLOTS_MAXIMUM_CAPACITY <= UINT8_MAX,
+                     maximum_capacity_of_slot_vectors_must_fit_into_a_byte);
+
+/**
+ * Initialize the shape transition tree
+ */
+void
+ecma_shape_init (void)
+{
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_SHAPE, sizeof (ecma_shape_t));
+  JERRY_CONTEXT (ecma_shape_root_p) = (ecma_shape_t *) mem_heap_alloc_block (sizeof (ecma_shape_t));
+  memset (JERRY_CONTEXT (ecma_shape_root_p), 0, sizeof (ecma_shape_t));
+
+  /* The root shape is never freed. */
+  JERRY_CONTEXT (ecma_shape_root_p)->refs = 1;
+} /* ecma_shape_init */
+
+/**
+ * Free the shape transition tree
+ */
+void
+ecma_shape_finalize (void)
+{
+  ecma_shape_free_unused ();
+
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_shape_root_p)->first_child_cp == ECMA_NULL_POINTER);
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_shape_root_p)->refs == 1);
+
+  ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_SHAPE, sizeof (ecma_shape_t));
+  mem_heap_free_block (JERRY_CONTEXT (ecma_shape_root_p), sizeof (ecma_shape_t));
+  JERRY_CONTEXT (ecma_shape_root_p) = NULL;
+} /* ecma_shape_finalize */
+
+/**
+ * Free the unreferenced descendants of a shape
+ *
+ * @return true - if any shape is freed,
+ *         false - otherwise
+ */
+static bool
+ecma_shape_free_unused_children (ecma_shape_t *shape_p) /**< shape */
+{
+  bool is_freed = false;
+  mem_cpointer_t *child_cp_p = &shape_p->first_child_cp;
+
+  while (*child_cp_p != ECMA_NULL_POINTER)
+  {
+    ecma_shape_t *child_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *child_cp_p);
+
+    /* The depth of the recursion is limited by ECMA_PROPERTY_SLOTS_MAXIMUM_CAPACITY. */
+    if (ecma_shape_free_unused_children (child_p))
+    {
+      is_freed = true;
+    }
+
+    if (child_p->refs > 0)
+    {
+      child_cp_p = &child_p->next_sibling_cp;
+      continue;
+    }
+
+    JERRY_ASSERT (child_p->first_child_cp == ECMA_NULL_POINTER);
+
+    *child_cp_p = child_p->next_sibling_cp;
+
+    ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, child_p->name_cp));
+    ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_SHAPE, sizeof (ecma_shape_t));
+    mem_heap_free_block (child_p, sizeof (ecma_shape_t));
+
+    JERRY_ASSERT (shape_p->refs > 0);
+    shape_p->refs--;
+    is_freed = true;
+  }
+
+  return is_freed;
+} /* ecma_shape_free_unused_children */
+
+/**
+ * Free the shapes which are not referenced by any object
+ */
+void
+ecma_shape_free_unused (void)
+{
+  if (ecma_shape_free_unused_children (JERRY_CONTEXT (ecma_shape_root_p)))
+  {
+    ecma_inline_cache_invalidate_all ();
+  }
+} /* ecma_shape_free_unused */
+
+/**
+ * Decrease the reference counter of a shape
+ */
+static inline void __attr_always_inline___
+ecma_shape_deref (ecma_shape_t *shape_p) /**< shape */
+{
+  JERRY_ASSERT (shape_p->refs > 0);
+  shape_p->refs--;
+} /* ecma_shape_deref */
+
+/**
+ * Get the shape which has one more slot than the given shape.
+ * A new shape is created if the transition does not exist yet.
+ *
+ * Note:
+ *      the reference of the name is taken over by the transition tree
+ *
+ * @return referenced shape
+ */
+static ecma_shape_t *
+ecma_shape_add_slot (ecma_shape_t *shape_p, /**< shape */
+                     ecma_string_t *name_p) /**< name of the new slot */
+{
+  JERRY_ASSERT (shape_p->slot_count < ECMA_PROPERTY_SLOTS_MAXIMUM_CAPACITY);
+
+  mem_cpointer_t *child_cp_p = &shape_p->first_child_cp;
+
+  while (*child_cp_p != ECMA_NULL_POINTER)
+  {
+    ecma_shape_t *child_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *child_cp_p);
+    ecma_string_t *child_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, child_p->name_cp);
+
+    if (child_name_p == name_p || ecma_compare_ecma_strings (child_name_p, name_p))
+    {
+      if (child_cp_p != &shape_p->first_child_cp)
+      {
+        /* Move the transition to the front of the list. */
+        *child_cp_p = child_p->next_sibling_cp;
+        child_p->next_sibling_cp = shape_p->first_child_cp;
+        ECMA_SET_NON_NULL_POINTER (shape_p->first_child_cp, child_p);
+      }
+
+      ecma_deref_ecma_string (name_p);
+
+      JERRY_ASSERT (child_p->refs < UINT32_MAX);
+      child_p->refs++;
+      return child_p;
+    }
+
+    child_cp_p = &child_p->next_sibling_cp;
+  }
+
+  /* The allocation may trigger a garbage collection, but it cannot
+   * free the shape, because it is referenced by an object. */
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_SHAPE, sizeof (ecma_shape_t));
+  ecma_shape_t *child_p = (ecma_shape_t *) mem_heap_alloc_block (sizeof (ecma_shape_t));
+
+  ECMA_SET_NON_NULL_POINTER (child_p->parent_cp, shape_p);
+  ECMA_SET_NON_NULL_POINTER (child_p->name_cp, name_p);
+  child_p->first_child_cp = ECMA_NULL_POINTER;
+  child_p->next_sibling_cp = shape_p->first_child_cp;
+  child_p->refs = 1;
+  child_p->slot_count = (uint8_t) (shape_p->slot_count + 1);
+  child_p->expected_slot_count = 0;
+
+  ECMA_SET_NON_NULL_POINTER (shape_p->first_child_cp, child_p);
+
+  JERRY_ASSERT (shape_p->refs < UINT32_MAX);
+  shape_p->refs++;
+
+  return child_p;
+} /* ecma_shape_add_slot */
+
+/**
+ * Get the size of a slot vector
+ *
+ * @return size in bytes
+ */
+static size_t
+ecma_shape_get_property_slots_size (uint32_t capacity) /**< number of slots */
+{
+  size_t size = sizeof (ecma_property_slots_t);
+
+  size += (capacity / ECMA_PROPERTY_SLOTS_GROUP_LENGTH) * ECMA_PROPERTY_SLOTS_GROUP_SIZE;
+
+  if (capacity % ECMA_PROPERTY_SLOTS_GROUP_LENGTH != 0)
+  {
+    size += sizeof (ecma_property_value_t) * (1 + capacity % ECMA_PROPERTY_SLOTS_GROUP_LENGTH);
+  }
+
+  return size;
+} /* ecma_shape_get_property_slots_size */
+
+/**
+ * Get the capacity of a slot vector which can store the
+ * given number of slots. The capacity is increased while
+ * the additional slots fit into the alignment gap.
+ *
+ * @return number of slots
+ */
+static uint32_t
+ecma_shape_get_property_slots_capacity (uint32_t slot_count) /**< minimum number of slots */
+{
+  JERRY_ASSERT (slot_count > 0 && slot_count <= ECMA_PROPERTY_SLOTS_MAXIMUM_CAPACITY);
+
+  size_t size = JERRY_ALIGNUP (ecma_shape_get_property_slots_size (slot_count), MEM_ALIGNMENT);
+
+  while (slot_count < ECMA_PROPERTY_SLOTS_MAXIMUM_CAPACITY
+         && ecma_shape_get_property_slots_size (slot_count + 1) <= size)
+  {
+    slot_count++;
+  }
+
+  return slot_count;
+} /* ecma_shape_get_property_slots_capacity */
+
+/**
+ * Get the slot vector of an object.
+ *
+ * @return pointer to the slot vector - if the object has one,
+ *         NULL - otherwise
+ */
+ecma_property_slots_t *
+ecma_shape_get_property_slots (const ecma_object_t *object_p) /**< object */
+{
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_SLOTS)
+  {
+    return (ecma_property_slots_t *) prop_iter_p;
+  }
+
+  return NULL;
+} /* ecma_shape_get_property_slots */
+
+/**
+ * Check whether the property is stored in the slot vector.
+ *
+ * @return true - if the property is a slot of the vector,
+ *         false - otherwise
+ */
+bool
+ecma_shape_is_slot (const ecma_property_slots_t *slots_p, /**< slot vector */
+                    const ecma_property_t *property_p) /**< property */
+{
+  const uint8_t *start_p = (const uint8_t *) (slots_p + 1);
+  const uint8_t *end_p = ((const uint8_t *) slots_p) + ecma_shape_get_property_slots_size (slots_p->capacity);
+
+  return ((const uint8_t *) property_p >= start_p && (const uint8_t *) property_p < end_p);
+} /* ecma_shape_is_slot */
+
+/**
+ * Get the index of a slot.
+ *
+ * @return slot index
+ */
+uint32_t
+ecma_shape_get_slot_index (const ecma_property_slots_t *slots_p, /**< slot vector */
+                           const ecma_property_t *property_p) /**< slot of the vector */
+{
+  JERRY_ASSERT (ecma_shape_is_slot (slots_p, property_p));
+
+  size_t offset = (size_t) ((const uint8_t *) property_p - (const uint8_t *) (slots_p + 1));
+
+  JERRY_ASSERT (offset % ECMA_PROPERTY_SLOTS_GROUP_SIZE < ECMA_PROPERTY_SLOTS_GROUP_LENGTH);
+
+  return (uint32_t) ((offset / ECMA_PROPERTY_SLOTS_GROUP_SIZE) * ECMA_PROPERTY_SLOTS_GROUP_LENGTH
+                     + (offset % ECMA_PROPERTY_SLOTS_GROUP_SIZE));
+} /* ecma_shape_get_slot_index */
+
+/**
+ * Get the name of a slot.
+ *
+ * @return name of the slot (the reference counter is not increased)
+ */
+ecma_string_t *
+ecma_shape_get_slot_name (const ecma_property_slots_t *slots_p, /**< slot vector */
+                          uint32_t slot_index) /**< slot index */
+{
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+
+  JERRY_ASSERT (slot_index < shape_p->slot_count);
+
+  while (shape_p->slot_count > slot_index + 1)
+  {
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp);
+} /* ecma_shape_get_slot_name */
+
+/**
+ * Find a named property in a slot vector.
+ *
+ * @return pointer to the property - if the shape has a slot with the given
+ *                                   name and the property is not deleted,
+ *         NULL - otherwise
+ */
+ecma_property_t *
+ecma_shape_find_property (ecma_property_slots_t *slots_p, /**< slot vector */
+                          ecma_string_t *name_p) /**< property name */
+{
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+
+  while (shape_p->slot_count > 0)
+  {
+    ecma_string_t *slot_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp);
+
+    if (slot_name_p == name_p || ecma_compare_ecma_strings (slot_name_p, name_p))
+    {
+      ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET (slots_p, shape_p->slot_count - 1u);
+
+      if (property_p->type_and_flags == ECMA_PROPERTY_TYPE_DELETED)
+      {
+        /* Deleted slots are not reused, the property might be re-created in a property pair. */
+        return NULL;
+      }
+
+      return property_p;
+    }
+
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+  }
+
+  return NULL;
+} /* ecma_shape_find_property */
+
+/**
+ * Record that an object needs more slots than the capacity of its
+ * slot vector, so the next objects with the same first property name
+ * allocate larger slot vectors.
+ */
+static void
+ecma_shape_increase_expected_slot_count (ecma_shape_t *shape_p, /**< shape of the object */
+                                         uint32_t capacity) /**< capacity of the slot vector */
+{
+  JERRY_ASSERT (shape_p->slot_count > 0);
+
+  while (shape_p->slot_count > 1)
+  {
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+  }
+
+  uint32_t expected_slot_count = JERRY_MAX (shape_p->expected_slot_count, capacity) + 1u;
+
+  if (expected_slot_count <= ECMA_PROPERTY_SLOTS_MAXIMUM_CAPACITY)
+  {
+    shape_p->expected_slot_count = (uint8_t) expected_slot_count;
+  }
+} /* ecma_shape_increase_expected_slot_count */
+
+/**
+ * Check whether the named properties of an object are stored in slots.
+ *
+ * Arrays, arguments and string objects are excluded, because their
+ * index properties would create a different shape for each length.
+ * The bindings of declarative lexical environments are stored in
+ * slots as well, so they can be accessed by their slot index.
+ *
+ * @return true - if the object can have a slot vector,
+ *         false - otherwise
+ */
+static bool
+ecma_shape_is_object_shaped (ecma_object_t *object_p) /**< object */
+{
+  if (ecma_is_lexical_environment (object_p))
+  {
+    return ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE;
+  }
+
+  ecma_object_type_t type = ecma_get_object_type (object_p);
+
+  return (type != ECMA_OBJECT_TYPE_ARRAY
+          && type != ECMA_OBJECT_TYPE_ARGUMENTS
+          && type != ECMA_OBJECT_TYPE_STRING);
+} /* ecma_shape_is_object_shaped */
+
+/**
+ * Allocate a slot vector for an object and insert it into the property list of the object.
+ *
+ * Note:
+ *      the reference of the shape is taken over by the slot vector
+ *
+ * @return pointer to the slot vector
+ */
+static ecma_property_slots_t *
+ecma_shape_alloc_property_slots (ecma_object_t *object_p, /**< the object */
+                                 ecma_shape_t *shape_p, /**< shape of the object */
+                                 uint32_t capacity) /**< number of slots */
+{
+  size_t size = ecma_shape_get_property_slots_size (capacity);
+
+  /* The allocation may trigger a garbage collection, so the
+   * slot vector is initialized before it is linked to the object. */
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_PROPERTY_SLOTS, size);
+  ecma_property_slots_t *slots_p = (ecma_property_slots_t *) mem_heap_alloc_block (size);
+
+  slots_p->header.types[0].type_and_flags = ECMA_PROPERTY_TYPE_SLOTS;
+  slots_p->header.types[1].type_and_flags = 0;
+  ECMA_SET_NON_NULL_POINTER (slots_p->shape_cp, shape_p);
+  slots_p->capacity = (uint8_t) capacity;
+  slots_p->is_closed = 0;
+
+  for (uint32_t i = 0; i < capacity; i++)
+  {
+    ECMA_PROPERTY_SLOTS_GET (slots_p, i)->type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+  }
+
+  /* Insert the slot vector after the property hashmap. */
+  mem_cpointer_t *property_list_head_p = &object_p->property_list_or_bound_object_cp;
+
+  if (*property_list_head_p != ECMA_NULL_POINTER)
+  {
+    ecma_property_header_t *first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                          *property_list_head_p);
+
+    if (ECMA_PROPERTY_GET_TYPE (first_property_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+    {
+      property_list_head_p = &first_property_p->next_property_cp;
+    }
+  }
+
+  slots_p->header.next_property_cp = *property_list_head_p;
+  ECMA_SET_NON_NULL_POINTER (*property_list_head_p, slots_p);
+
+  return slots_p;
+} /* ecma_shape_alloc_property_slots */
+
+/**
+ * Create an empty slot vector for an object whose number of named properties
+ * is known in advance, so all of them are stored in slots.
+ *
+ * Note:
+ *      the object must not have named properties yet
+ */
+void
+ecma_shape_create_property_slots (ecma_object_t *object_p, /**< the object */
+                                  uint32_t slot_count) /**< expected number of named properties */
+{
+  JERRY_ASSERT (ecma_shape_is_object_shaped (object_p));
+  JERRY_ASSERT (ecma_shape_get_property_slots (object_p) == NULL);
+  JERRY_ASSERT (slot_count > 0);
+
+  slot_count = JERRY_MIN (slot_count, ECMA_PROPERTY_SLOTS_MAXIMUM_CAPACITY);
+
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_shape_root_p)->refs < UINT32_MAX);
+  JERRY_CONTEXT (ecma_shape_root_p)->refs++;
+
+  ecma_shape_alloc_property_slots (object_p,
+                                   JERRY_CONTEXT (ecma_shape_root_p),
+                                   ecma_shape_get_property_slots_capacity (slot_count));
+} /* ecma_shape_create_property_slots */
+
+/**
+ * Create a named property in the next free slot of an object.
+ *
+ * Note:
+ *      if the property is stored in a slot, the reference of
+ *      the name is taken over by the shape of the object
+ *
+ * @return pointer to the newly created property - if a slot is assigned to the property,
+ *         NULL - otherwise (the property must be stored in a property pair)
+ */
+ecma_property_t *
+ecma_shape_create_property (ecma_object_t *object_p, /**< the object */
+                            ecma_string_t *name_p, /**< property name */
+                            uint8_t type_and_flags, /**< type and flags, see ecma_property_info_t */
+                            ecma_property_value_t value) /**< property value */
+{
+  JERRY_ASSERT (name_p != NULL);
+
+  if (!ecma_shape_is_object_shaped (object_p))
+  {
+    return NULL;
+  }
+
+  ecma_property_slots_t *slots_p = ecma_shape_get_property_slots (object_p);
+
+  if (slots_p == NULL)
+  {
+    ecma_shape_t *shape_p = ecma_shape_add_slot (JERRY_CONTEXT (ecma_shape_root_p), name_p);
+
+    uint32_t capacity = ecma_shape_get_property_slots_capacity (JERRY_MAX (shape_p->expected_slot_count, 1u));
+
+    slots_p = ecma_shape_alloc_property_slots (object_p, shape_p, capacity);
+
+    ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET (slots_p, 0);
+    property_p->type_and_flags = type_and_flags;
+    *ECMA_PROPERTY_VALUE_PTR (property_p) = value;
+
+    return property_p;
+  }
+
+  if (slots_p->is_closed)
+  {
+    return NULL;
+  }
+
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+
+  if (shape_p->slot_count >= slots_p->capacity)
+  {
+    ecma_shape_increase_expected_slot_count (shape_p, slots_p->capacity);
+    return NULL;
+  }
+
+  ecma_shape_t *new_shape_p = ecma_shape_add_slot (shape_p, name_p);
+
+  ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET (slots_p, shape_p->slot_count);
+
+  JERRY_ASSERT (property_p->type_and_flags == ECMA_PROPERTY_TYPE_DELETED);
+
+  property_p->type_and_flags = type_and_flags;
+  *ECMA_PROPERTY_VALUE_PTR (property_p) = value;
+
+  ECMA_SET_NON_NULL_POINTER (slots_p->shape_cp, new_shape_p);
+  ecma_shape_deref (shape_p);
+
+  return property_p;
+} /* ecma_shape_create_property */
+
+/**
+ * Free the slot vector of an object and the properties stored in it.
+ */
+void
+ecma_shape_free_property_slots (ecma_object_t *object_p) /**< object */
+{
+  ecma_property_slots_t *slots_p = ecma_shape_get_property_slots (object_p);
+
+  JERRY_ASSERT (slots_p != NULL);
+
+  ecma_shape_t *object_shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+  ecma_shape_t *shape_p = object_shape_p;
+
+  while (shape_p->slot_count > 0)
+  {
+    ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET (slots_p, shape_p->slot_count - 1u);
+
+    if (property_p->type_and_flags != ECMA_PROPERTY_TYPE_DELETED)
+    {
+      ecma_free_property (object_p,
+                          ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp),
+                          property_p);
+    }
+
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+  }
+
+  /* Unlink the slot vector. */
+  mem_cpointer_t *property_list_head_p = &object_p->property_list_or_bound_object_cp;
+  ecma_property_header_t *first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                        *property_list_head_p);
+
+  if (ECMA_PROPERTY_GET_TYPE (first_property_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    property_list_head_p = &first_property_p->next_property_cp;
+  }
+
+  *property_list_head_p = slots_p->header.next_property_cp;
+
+  ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_PROPERTY_SLOTS, ecma_shape_get_property_slots_size (slots_p->capacity));
+  mem_heap_free_block (slots_p, ecma_shape_get_property_slots_size (slots_p->capacity));
+
+  ecma_shape_deref (object_shape_p);
+} /* ecma_shape_free_property_slots */
+
+/**
+ * Get the size of an allocated slot vector
+ *
+ * @return size in bytes
+ */
+size_t
+ecma_shape_get_property_slots_block_size (const ecma_property_slots_t *slots_p) /**< slot vector */
+{
+  return ecma_shape_get_property_slots_size (slots_p->capacity);
+} /* ecma_shape_get_property_slots_block_size */
+
+/**
+ * Move the slot vector of an object to a lower heap address (see mem_heap_relocate_block).
+ *
+ * @return size of the slot vector - if it is moved,
+ *         0 - otherwise
+ */
+size_t
+ecma_shape_relocate_property_slots (ecma_object_t *object_p) /**< object */
+{
+  mem_cpointer_t *property_list_head_p = &object_p->property_list_or_bound_object_cp;
+  ecma_property_header_t *first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                        *property_list_head_p);
+
+  if (ECMA_PROPERTY_GET_TYPE (first_property_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    property_list_head_p = &first_property_p->next_property_cp;
+  }
+
+  ecma_property_slots_t *slots_p = ECMA_GET_NON_NULL_POINTER (ecma_property_slots_t, *property_list_head_p);
+
+  JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (slots_p->header.types + 0) == ECMA_PROPERTY_TYPE_SLOTS);
+
+  size_t size = ecma_shape_get_property_slots_size (slots_p->capacity);
+  void *new_slots_p = mem_heap_relocate_block (slots_p, size);
+
+  if (new_slots_p == slots_p)
+  {
+    return 0;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (*property_list_head_p, new_slots_p);
+  return size;
+} /* ecma_shape_relocate_property_slots */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,121 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_SHAPE_H
+#define ECMA_SHAPE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Object shapes
+ * @{
+ */
+
+/**
+ * Maximum number of slots of a property slot vector.
+ */
+#define ECMA_PROPERTY_SLOTS_MAXIMUM_CAPACITY 16
+
+/**
+ * Number of slots of a slot group (see ecma_property_t).
+ */
+#define ECMA_PROPERTY_SLOTS_GROUP_LENGTH 4
+
+/**
+ * Size of a slot group: a type word followed by the values.
+ */
+#define ECMA_PROPERTY_SLOTS_GROUP_SIZE \
+  (sizeof (ecma_property_value_t) * (ECMA_PROPERTY_SLOTS_GROUP_LENGTH + 1))
+
+/**
+ * Shape of an object.
+ *
+ * A shape is an immutable sequence of property names, where the
+ * position of a name is the index of the slot which stores the
+ * property. Shapes form a transition tree: the parent of a shape
+ * is the same sequence without its last name, and objects which
+ * receive the same property names in the same order share the
+ * same shape.
+ */
+typedef struct
+{
+  mem_cpointer_t parent_cp; /**< shape without the last slot (ECMA_NULL_POINTER for the root shape) */
+  mem_cpointer_t name_cp; /**< name of the last slot */
+  mem_cpointer_t first_child_cp; /**< first transition of the shape */
+  mem_cpointer_t next_sibling_cp; /**< next transition of the parent shape */
+  uint32_t refs; /**< number of objects and child shapes referencing the shape (the objects
+                  *   of a shape are limited only by the heap size, so 16 bits are not enough) */
+  uint8_t slot_count; /**< number of slots */
+  uint8_t expected_slot_count; /**< number of slots reached by the objects whose
+                                *   slot vector was allocated with this shape */
+} ecma_shape_t;
+
+/**
+ * Property slot vector.
+ *
+ * The slot vector stores those named properties of an object which are
+ * described by the shape of the object. It is always the first item of
+ * the property list after the optional property hashmap. Slots are never
+ * moved or reused, so property pointers remain valid during the lifetime
+ * of the object. When all slots are used or a slot property is deleted,
+ * new properties are stored in property pairs.
+ *
+ * The header is followed by groups of ECMA_PROPERTY_SLOTS_GROUP_LENGTH
+ * slots, each using the following layout:
+ *
+ *  [type 1, type 2, type 3, type 4][value 1][value 2][value 3][value 4]
+ *
+ * The last group may contain less than ECMA_PROPERTY_SLOTS_GROUP_LENGTH
+ * values.
+ */
+typedef struct
+{
+  ecma_property_header_t header; /**< header of the property */
+  mem_cpointer_t shape_cp; /**< shape of the object */
+  uint8_t capacity; /**< number of allocated slots */
+  uint8_t is_closed; /**< no more slots can be assigned to properties */
+} ecma_property_slots_t;
+
+/**
+ * Get a slot of a property slot vector.
+ */
+#define ECMA_PROPERTY_SLOTS_GET(slots_p, slot_index) \
+  ((ecma_property_t *) (((uint8_t *) ((slots_p) + 1)) \
+                        + ((slot_index) / ECMA_PROPERTY_SLOTS_GROUP_LENGTH) * ECMA_PROPERTY_SLOTS_GROUP_SIZE \
+                        + ((slot_index) % ECMA_PROPERTY_SLOTS_GROUP_LENGTH)))
+
+extern void ecma_shape_init (void);
+extern void ecma_shape_finalize (void);
+extern void ecma_shape_free_unused (void);
+extern ecma_property_slots_t *ecma_shape_get_property_slots (const ecma_object_t *);
+extern bool ecma_shape_is_slot (const ecma_property_slots_t *, const ecma_property_t *);
+extern uint32_t ecma_shape_get_slot_index (const ecma_property_slots_t *, const ecma_property_t *);
+extern ecma_string_t *ecma_shape_get_slot_name (const ecma_property_slots_t *, uint32_t);
+extern ecma_property_t *ecma_shape_find_property (ecma_property_slots_t *, ecma_string_t *);
+extern ecma_property_t *ecma_shape_create_property (ecma_object_t *, ecma_string_t *, uint8_t,
+                                                    ecma_property_value_t);
+extern void ecma_shape_create_property_slots (ecma_object_t *, uint32_t);
+extern void ecma_shape_free_property_slots (ecma_object_t *);
+extern size_t ecma_shape_relocate_property_slots (ecma_object_t *);
+extern size_t ecma_shape_get_property_slots_block_size (const ecma_property_slots_t *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_SHAPE_H */
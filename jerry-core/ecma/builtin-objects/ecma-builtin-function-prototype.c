@@ -247,6 +247,7 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
                                                             ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_TARGET_FUNCTION);
 
     ecma_object_t *this_arg_obj_p = ecma_get_object_from_value (this_arg);
+    ecma_gc_write_barrier (function_p, this_arg_obj_p);
     ECMA_SET_INTERNAL_VALUE_POINTER (ECMA_PROPERTY_VALUE_PTR (target_function_prop_p)->value, this_arg_obj_p);
 
     /* 8. */
@@ -256,6 +257,11 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
 
     if (arg_count > 0)
     {
+      if (ecma_is_value_object (arguments_list_p[0]))
+      {
+        ecma_gc_write_barrier (function_p, ecma_get_object_from_value (arguments_list_p[0]));
+      }
+
       ecma_set_internal_property_value (bound_this_prop_p,
                                         ecma_copy_value_if_not_object (arguments_list_p[0]));
     }
@@ -281,7 +287,7 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
      * See also: ecma_object_get_class_name
      */
 
-    ecma_number_t *length_p = ecma_alloc_number ();
+    ecma_number_t length = ECMA_NUMBER_ZERO;
     ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
 
     /* 15. */
@@ -294,25 +300,26 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
       const ecma_length_t bound_arg_count = arg_count > 1 ? arg_count - 1 : 0;
 
       /* 15.a */
-      *length_p = *ecma_get_number_from_value (get_len_value) - ((ecma_number_t) bound_arg_count);
+      length = ecma_get_number_from_value (get_len_value) - ((ecma_number_t) bound_arg_count);
       ecma_free_value (get_len_value);
 
       /* 15.b */
-      if (ecma_number_is_negative (*length_p))
+      if (ecma_number_is_negative (length))
       {
-        *length_p = ECMA_NUMBER_ZERO;
+        length = ECMA_NUMBER_ZERO;
       }
     }
     else
     {
       /* 16. */
-      *length_p = ECMA_NUMBER_ZERO;
+      length = ECMA_NUMBER_ZERO;
     }
 
     /* 17. */
+    ecma_value_t length_value = ecma_make_number_value (length);
     ecma_value_t completion = ecma_builtin_helper_def_prop (function_p,
                                                             magic_string_length_p,
-                                                            ecma_make_number_value (length_p),
+                                                            length_value,
                                                             false, /* Writable */
                                                             false, /* Enumerable */
                                                             false, /* Configurable */
@@ -321,7 +328,7 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
     JERRY_ASSERT (ecma_is_value_boolean (completion));
 
     ecma_deref_ecma_string (magic_string_length_p);
-    ecma_dealloc_number (length_p);
+    ecma_free_value (length_value);
 
     /* 19-21. */
     ecma_object_t *thrower_p = ecma_builtin_get (ECMA_BUILTIN_ID_TYPE_ERROR_THROWER);
@@ -451,9 +451,7 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
   {
     case number_token:
     {
-      ecma_number_t *number_p = ecma_alloc_number ();
-      *number_p = token_p->u.number;
-      return ecma_make_number_value (number_p);
+      return ecma_make_number_value (token_p->u.number);
     }
     case string_token:
     {
@@ -709,8 +707,14 @@ ecma_builtin_json_parse (ecma_value_t this_arg __attr_unused___, /**< 'this' arg
                   ret_value);
 
   ecma_string_t *string_p = ecma_get_string_from_value (string);
+  lit_utf8_size_t str_start_size = ecma_string_get_size (string_p);
 
-  ECMA_STRING_TO_UTF8_STRING (string_p, str_start_p, str_start_size);
+  /* The parser expects a zero terminated string and unescapes the string tokens in place. */
+  MEM_DEFINE_LOCAL_ARRAY (str_start_p, str_start_size + 1, lit_utf8_byte_t);
+
+  lit_utf8_size_t sz = ecma_string_to_utf8_string (string_p, str_start_p, str_start_size);
+  JERRY_ASSERT (sz == str_start_size);
+  str_start_p[str_start_size] = LIT_CHAR_NULL;
 
   ecma_json_token_t token;
   token.current_p = (lit_utf8_byte_t *) str_start_p;
@@ -760,7 +764,7 @@ ecma_builtin_json_parse (ecma_value_t this_arg __attr_unused___, /**< 'this' arg
     }
   }
 
-  ECMA_FINALIZE_UTF8_STRING (str_start_p, str_start_size);
+  MEM_FINALIZE_LOCAL_ARRAY (str_start_p);
 
   ECMA_FINALIZE (string);
   return ret_value;
@@ -1040,6 +1044,30 @@ ecma_builtin_json_stringify (ecma_value_t this_arg __attr_unused___, /**< 'this'
   return ret_value;
 } /* ecma_builtin_json_stringify */
 
+/**
+ * Append a buffer of characters to a string
+ *
+ * @return concatenation of the string and the characters
+ *         (the reference of the original string is released)
+ */
+static ecma_string_t *
+ecma_builtin_json_append_chars (ecma_string_t *string_p, /**< string */
+                                const lit_utf8_byte_t *chars_p, /**< characters */
+                                lit_utf8_size_t chars_size) /**< size of the characters in bytes */
+{
+  if (chars_size == 0)
+  {
+    return string_p;
+  }
+
+  ecma_string_t *chars_str_p = ecma_new_ecma_string_from_utf8 (chars_p, chars_size);
+  ecma_string_t *result_p = ecma_concat_ecma_strings (string_p, chars_str_p);
+
+  ecma_deref_ecma_string (string_p);
+  ecma_deref_ecma_string (chars_str_p);
+  return result_p;
+} /* ecma_builtin_json_append_chars */
+
 /**
  * Abstract operation 'Quote' defined in 15.12.3
  *
@@ -1062,10 +1090,27 @@ ecma_builtin_json_quote (ecma_string_t *string_p) /**< string that should be quo
   const lit_utf8_byte_t *str_p = string_buff;
   const lit_utf8_byte_t *str_end_p = string_buff + string_buff_size;
 
+  /* The characters, which are not escaped, are appended in runs. */
+  const lit_utf8_byte_t *regular_str_start_p = str_p;
+
   while (str_p < str_end_p)
   {
+    const lit_utf8_byte_t *current_char_p = str_p;
     ecma_char_t current_char = lit_utf8_read_next (&str_p);
 
+    /* 2.d */
+    if (current_char >= LIT_CHAR_SP
+        && current_char != LIT_CHAR_BACKSLASH
+        && current_char != LIT_CHAR_DOUBLE_QUOTE)
+    {
+      continue;
+    }
+
+    product_str_p = ecma_builtin_json_append_chars (product_str_p,
+                                                    regular_str_start_p,
+                                                    (lit_utf8_size_t) (current_char_p - regular_str_start_p));
+    regular_str_start_p = str_p;
+
     /* 2.a */
     if (current_char == LIT_CHAR_BACKSLASH || current_char == LIT_CHAR_DOUBLE_QUOTE)
     {
@@ -1141,7 +1186,7 @@ ecma_builtin_json_quote (ecma_string_t *string_p) /**< string that should be quo
       product_str_p = tmp_str_p;
     }
     /* 2.c */
-    else if (current_char < LIT_CHAR_SP)
+    else
     {
       ecma_string_t *backslash_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_BACKSLASH_CHAR);
 
@@ -1169,18 +1214,12 @@ ecma_builtin_json_quote (ecma_string_t *string_p) /**< string that should be quo
       ecma_deref_ecma_string (hex_str_p);
       product_str_p = tmp_str_p;
     }
-    /* 2.d */
-    else
-    {
-      ecma_string_t *current_char_str_p = ecma_new_ecma_string_from_code_unit (current_char);
-
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, current_char_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (current_char_str_p);
-      product_str_p = tmp_str_p;
-    }
   }
 
+  product_str_p = ecma_builtin_json_append_chars (product_str_p,
+                                                  regular_str_start_p,
+                                                  (lit_utf8_size_t) (str_end_p - regular_str_start_p));
+
   ECMA_FINALIZE_UTF8_STRING (string_buff, string_buff_size);
 
   /* 3. */
@@ -1327,7 +1366,7 @@ ecma_builtin_json_str (ecma_string_t *key_p, /**< property key*/
     /* 9. */
     else if (ecma_is_value_number (my_val))
     {
-      ecma_number_t num_value_p = *ecma_get_number_from_value (my_val);
+      ecma_number_t num_value_p = ecma_get_number_from_value (my_val);
 
       /* 9.a */
       if (!ecma_number_is_nan (num_value_p) && !ecma_number_is_infinity (num_value_p))
@@ -20,6 +20,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-objects.h"
+#include "jcontext.h"
 #include "jrt-bit-fields.h"
 
 #define ECMA_BUILTINS_INTERNAL
@@ -40,11 +41,6 @@ ecma_builtin_dispatch_routine (ecma_builtin_id_t builtin_object_id,
                                ecma_length_t arguments_number);
 static void ecma_instantiate_builtin (ecma_builtin_id_t id);
 
-/**
- * Pointer to instances of built-in objects
- */
-static ecma_object_t *ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT];
-
 /**
  * Check if passed object is the instance of specified built-in.
  */
@@ -55,7 +51,7 @@ ecma_builtin_is (ecma_object_t *obj_p, /**< pointer to an object */
   JERRY_ASSERT (obj_p != NULL && !ecma_is_lexical_environment (obj_p));
   JERRY_ASSERT (builtin_id < ECMA_BUILTIN_ID__COUNT);
 
-  if (ecma_builtin_objects[builtin_id] == NULL)
+  if (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] == NULL)
   {
     /* If a built-in object is not instantiated,
      * the specified object cannot be the built-in object */
@@ -63,7 +59,7 @@ ecma_builtin_is (ecma_object_t *obj_p, /**< pointer to an object */
   }
   else
   {
-    return (obj_p == ecma_builtin_objects[builtin_id]);
+    return (obj_p == JERRY_CONTEXT (ecma_builtin_objects)[builtin_id]);
   }
 } /* ecma_builtin_is */
 
@@ -77,14 +73,14 @@ ecma_builtin_get (ecma_builtin_id_t builtin_id) /**< id of built-in to check on
 {
   JERRY_ASSERT (builtin_id < ECMA_BUILTIN_ID__COUNT);
 
-  if (unlikely (ecma_builtin_objects[builtin_id] == NULL))
+  if (unlikely (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] == NULL))
   {
     ecma_instantiate_builtin (builtin_id);
   }
 
-  ecma_ref_object (ecma_builtin_objects[builtin_id]);
+  ecma_ref_object (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id]);
 
-  return ecma_builtin_objects[builtin_id];
+  return JERRY_CONTEXT (ecma_builtin_objects)[builtin_id];
 } /* ecma_builtin_get */
 
 /**
@@ -199,7 +195,7 @@ ecma_init_builtins (void)
        id < ECMA_BUILTIN_ID__COUNT;
        id = (ecma_builtin_id_t) (id + 1))
   {
-    ecma_builtin_objects[id] = NULL;
+    JERRY_CONTEXT (ecma_builtin_objects)[id] = NULL;
   }
 } /* ecma_init_builtins */
 
@@ -219,7 +215,7 @@ ecma_instantiate_builtin (ecma_builtin_id_t id) /**< built-in id */
                 lowercase_name) \
     case builtin_id: \
     { \
-      JERRY_ASSERT (ecma_builtin_objects[builtin_id] == NULL); \
+      JERRY_ASSERT (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] == NULL); \
       \
       ecma_object_t *prototype_obj_p; \
       if (object_prototype_builtin_id == ECMA_BUILTIN_ID__COUNT) \
@@ -228,11 +224,11 @@ ecma_instantiate_builtin (ecma_builtin_id_t id) /**< built-in id */
       } \
       else \
       { \
-        if (ecma_builtin_objects[object_prototype_builtin_id] == NULL) \
+        if (JERRY_CONTEXT (ecma_builtin_objects)[object_prototype_builtin_id] == NULL) \
         { \
           ecma_instantiate_builtin (object_prototype_builtin_id); \
         } \
-        prototype_obj_p = ecma_builtin_objects[object_prototype_builtin_id]; \
+        prototype_obj_p = JERRY_CONTEXT (ecma_builtin_objects)[object_prototype_builtin_id]; \
         JERRY_ASSERT (prototype_obj_p != NULL); \
       } \
       \
@@ -240,7 +236,7 @@ ecma_instantiate_builtin (ecma_builtin_id_t id) /**< built-in id */
                                                                prototype_obj_p, \
                                                                object_type, \
                                                                is_extensible); \
-      ecma_builtin_objects[builtin_id] = builtin_obj_p; \
+      JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] = builtin_obj_p; \
       \
       break; \
     }
@@ -265,10 +261,10 @@ ecma_finalize_builtins (void)
        id < ECMA_BUILTIN_ID__COUNT;
        id = (ecma_builtin_id_t) (id + 1))
   {
-    if (ecma_builtin_objects[id] != NULL)
+    if (JERRY_CONTEXT (ecma_builtin_objects)[id] != NULL)
     {
-      ecma_deref_object (ecma_builtin_objects[id]);
-      ecma_builtin_objects[id] = NULL;
+      ecma_deref_object (JERRY_CONTEXT (ecma_builtin_objects)[id]);
+      JERRY_CONTEXT (ecma_builtin_objects)[id] = NULL;
     }
   }
 } /* ecma_finalize_builtins */
@@ -322,10 +318,7 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
                                                                      false, false, false);
 
 
-      ecma_number_t *len_p = ecma_alloc_number ();
-      *len_p = length_prop_value;
-
-      ecma_set_named_data_property_value (len_prop_p, ecma_make_number_value (len_p));
+      ecma_set_named_data_property_value (len_prop_p, ecma_make_number_value (length_prop_value));
 
       JERRY_ASSERT (!ecma_is_property_configurable (len_prop_p));
       return len_prop_p;
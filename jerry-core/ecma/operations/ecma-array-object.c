@@ -33,6 +33,645 @@
  * @{
  */
 
+/**
+ * Type and flags of the elements of fast arrays.
+ */
+#define ECMA_ARRAY_ELEMENT_TYPE_AND_FLAGS \
+  (ECMA_PROPERTY_TYPE_NAMEDDATA \
+   | ECMA_PROPERTY_FLAG_CONFIGURABLE \
+   | ECMA_PROPERTY_FLAG_ENUMERABLE \
+   | ECMA_PROPERTY_FLAG_WRITABLE)
+
+/**
+ * A fast array is converted to a normal array when the number of its
+ * holes exceeds this limit and half of its elements are holes.
+ */
+#define ECMA_FAST_ARRAY_HOLE_LIMIT 32
+
+JERRY_STATIC_ASSERT (sizeof (ecma_array_elements_t) % sizeof (ecma_property_value_t) == 0,
+                     size_of_ecma_array_elements_t_must_be_multiple_of_property_value_size);
+
+/**
+ * Get the size of an element vector
+ *
+ * @return size in bytes
+ */
+static inline size_t __attr_always_inline___
+ecma_op_array_get_elements_size (uint32_t capacity) /**< number of elements */
+{
+  JERRY_ASSERT (capacity % ECMA_PROPERTY_SLOTS_GROUP_LENGTH == 0);
+
+  size_t group_count = capacity / ECMA_PROPERTY_SLOTS_GROUP_LENGTH;
+
+  return sizeof (ecma_array_elements_t) + group_count * ECMA_PROPERTY_SLOTS_GROUP_SIZE;
+} /* ecma_op_array_get_elements_size */
+
+/**
+ * Get the compressed pointer, which refers to the element vector of a fast array.
+ *
+ * @return pointer to the compressed pointer
+ */
+static mem_cpointer_t *
+ecma_op_array_get_elements_cp (ecma_object_t *obj_p) /**< fast array object */
+{
+  mem_cpointer_t *elements_cp_p = &obj_p->property_list_or_bound_object_cp;
+  ecma_property_header_t *first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, *elements_cp_p);
+
+  if (ECMA_PROPERTY_GET_TYPE (first_property_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    elements_cp_p = &first_property_p->next_property_cp;
+  }
+
+  JERRY_ASSERT (*elements_cp_p != ECMA_NULL_POINTER);
+  JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, *elements_cp_p)->types + 0)
+                == ECMA_PROPERTY_TYPE_ELEMENTS);
+
+  return elements_cp_p;
+} /* ecma_op_array_get_elements_cp */
+
+/**
+ * Allocate a new element vector and link it into the property list of an array.
+ *
+ * Note:
+ *      the elements of the previous vector are moved to the new vector
+ *
+ * @return pointer to the new element vector
+ */
+static ecma_array_elements_t *
+ecma_op_array_alloc_elements (ecma_object_t *obj_p, /**< array object */
+                              ecma_array_elements_t *old_elements_p, /**< current element vector or NULL */
+                              uint32_t capacity) /**< number of elements */
+{
+  capacity = JERRY_ALIGNUP (capacity, (uint32_t) ECMA_PROPERTY_SLOTS_GROUP_LENGTH);
+
+  JERRY_ASSERT (old_elements_p == NULL || capacity > old_elements_p->capacity);
+
+  /* The allocation may trigger a garbage collection,
+   * which visits the elements of the current vector. */
+  size_t size = ecma_op_array_get_elements_size (capacity);
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_ARRAY_ELEMENTS, size);
+  ecma_array_elements_t *elements_p = (ecma_array_elements_t *) mem_heap_alloc_block (size);
+  uint32_t old_capacity = 0;
+
+  if (old_elements_p != NULL)
+  {
+    old_capacity = old_elements_p->capacity;
+    memcpy (elements_p, old_elements_p, ecma_op_array_get_elements_size (old_capacity));
+  }
+  else
+  {
+    elements_p->header.types[0].type_and_flags = ECMA_PROPERTY_TYPE_ELEMENTS;
+    elements_p->header.types[1].type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+    elements_p->header.next_property_cp = obj_p->property_list_or_bound_object_cp;
+    elements_p->length = 0;
+    elements_p->hole_count = 0;
+    elements_p->is_converting = false;
+  }
+
+  elements_p->capacity = capacity;
+
+  for (uint32_t index = old_capacity; index < capacity; index++)
+  {
+    ECMA_ARRAY_ELEMENTS_GET (elements_p, index)->type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+  }
+
+  if (old_elements_p != NULL)
+  {
+    ECMA_SET_NON_NULL_POINTER (*ecma_op_array_get_elements_cp (obj_p), elements_p);
+    ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_ARRAY_ELEMENTS, ecma_op_array_get_elements_size (old_capacity));
+    mem_heap_free_block (old_elements_p, ecma_op_array_get_elements_size (old_capacity));
+  }
+  else
+  {
+    ECMA_SET_NON_NULL_POINTER (obj_p->property_list_or_bound_object_cp, elements_p);
+  }
+
+  return elements_p;
+} /* ecma_op_array_alloc_elements */
+
+/**
+ * Get the element vector of an array.
+ *
+ * @return pointer to the element vector - if the array is a fast array,
+ *         NULL - otherwise
+ */
+ecma_array_elements_t *
+ecma_op_array_get_elements (ecma_object_t *obj_p) /**< array object */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY);
+
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (obj_p);
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_ELEMENTS)
+  {
+    return (ecma_array_elements_t *) prop_iter_p;
+  }
+
+  return NULL;
+} /* ecma_op_array_get_elements */
+
+/**
+ * Find an element of a fast array.
+ *
+ * @return pointer to the element - if the element exists,
+ *         NULL - otherwise
+ */
+ecma_property_t *
+ecma_op_array_find_element (ecma_array_elements_t *elements_p, /**< element vector */
+                            uint32_t index) /**< array index */
+{
+  if (index < elements_p->length)
+  {
+    ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET (elements_p, index);
+
+    if (element_p->type_and_flags != ECMA_PROPERTY_TYPE_DELETED)
+    {
+      JERRY_ASSERT (element_p->type_and_flags == ECMA_ARRAY_ELEMENT_TYPE_AND_FLAGS);
+      return element_p;
+    }
+  }
+
+  return NULL;
+} /* ecma_op_array_find_element */
+
+/**
+ * Check whether the property is an element of the element vector.
+ *
+ * @return true - if the property is an element of the vector,
+ *         false - otherwise
+ */
+bool
+ecma_op_array_is_element (ecma_array_elements_t *elements_p, /**< element vector */
+                          ecma_property_t *property_p) /**< property */
+{
+  uint8_t *start_p = (uint8_t *) (elements_p + 1);
+  uint8_t *end_p = (uint8_t *) elements_p + ecma_op_array_get_elements_size (elements_p->capacity);
+
+  return ((uint8_t *) property_p >= start_p && (uint8_t *) property_p < end_p);
+} /* ecma_op_array_is_element */
+
+/**
+ * Get the index of an element of the element vector.
+ *
+ * @return array index
+ */
+static uint32_t
+ecma_op_array_get_element_index (ecma_array_elements_t *elements_p, /**< element vector */
+                                 ecma_property_t *element_p) /**< element */
+{
+  JERRY_ASSERT (ecma_op_array_is_element (elements_p, element_p));
+
+  size_t offset = (size_t) ((uint8_t *) element_p - (uint8_t *) (elements_p + 1));
+
+  JERRY_ASSERT (offset % ECMA_PROPERTY_SLOTS_GROUP_SIZE < ECMA_PROPERTY_SLOTS_GROUP_LENGTH);
+
+  return (uint32_t) ((offset / ECMA_PROPERTY_SLOTS_GROUP_SIZE) * ECMA_PROPERTY_SLOTS_GROUP_LENGTH
+                     + (offset % ECMA_PROPERTY_SLOTS_GROUP_SIZE));
+} /* ecma_op_array_get_element_index */
+
+/**
+ * Check whether a fast array has too many holes.
+ *
+ * @return true - if the array should be converted to a normal array,
+ *         false - otherwise
+ */
+static inline bool __attr_always_inline___
+ecma_op_array_has_too_many_holes (uint32_t hole_count, /**< number of holes */
+                                  uint32_t length) /**< number of elements including the holes */
+{
+  return (hole_count > ECMA_FAST_ARRAY_HOLE_LIMIT && hole_count > length / 2);
+} /* ecma_op_array_has_too_many_holes */
+
+/**
+ * Store a new element in the element vector of a fast array.
+ *
+ * @return pointer to the new element - if the element is stored in the vector,
+ *         NULL - if the array would become too sparse
+ */
+static ecma_property_t *
+ecma_op_array_store_element (ecma_object_t *obj_p, /**< fast array object */
+                             ecma_array_elements_t *elements_p, /**< element vector */
+                             uint32_t index, /**< array index */
+                             ecma_value_t value) /**< element value */
+{
+  JERRY_ASSERT (!elements_p->is_converting);
+  JERRY_ASSERT (index != ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX);
+
+  ecma_property_t *element_p;
+
+  if (index < elements_p->length)
+  {
+    element_p = ECMA_ARRAY_ELEMENTS_GET (elements_p, index);
+
+    JERRY_ASSERT (element_p->type_and_flags == ECMA_PROPERTY_TYPE_DELETED);
+    JERRY_ASSERT (elements_p->hole_count > 0);
+
+    elements_p->hole_count--;
+  }
+  else
+  {
+    uint32_t hole_count = elements_p->hole_count + (index - elements_p->length);
+
+    if (ecma_op_array_has_too_many_holes (hole_count, index + 1))
+    {
+      return NULL;
+    }
+
+    if (index >= elements_p->capacity)
+    {
+      uint32_t capacity = index + 1;
+      elements_p = ecma_op_array_alloc_elements (obj_p, elements_p, capacity + (capacity >> 1));
+    }
+
+    elements_p->length = index + 1;
+    elements_p->hole_count = hole_count;
+    element_p = ECMA_ARRAY_ELEMENTS_GET (elements_p, index);
+  }
+
+  if (ecma_is_value_object (value))
+  {
+    ecma_gc_write_barrier (obj_p, ecma_get_object_from_value (value));
+  }
+
+  element_p->type_and_flags = ECMA_ARRAY_ELEMENT_TYPE_AND_FLAGS;
+  ECMA_PROPERTY_VALUE_PTR (element_p)->value = value;
+  return element_p;
+} /* ecma_op_array_store_element */
+
+/**
+ * Create an array index property in the element vector of a fast array.
+ *
+ * Note:
+ *      the array is converted to a normal array if the property
+ *      cannot be stored in the element vector
+ *
+ * @return pointer to the new element - if the property is stored in the element vector
+ *                                      (the reference of the name is released),
+ *         NULL - otherwise (the property must be stored in a property pair)
+ */
+ecma_property_t *
+ecma_op_array_create_element (ecma_object_t *obj_p, /**< array object */
+                              ecma_string_t *name_p, /**< property name */
+                              uint8_t type_and_flags, /**< type and flags, see ecma_property_info_t */
+                              ecma_property_value_t value) /**< property value */
+{
+  ecma_array_elements_t *elements_p = ecma_op_array_get_elements (obj_p);
+  uint32_t index;
+
+  if (elements_p == NULL
+      || elements_p->is_converting
+      || !ecma_string_get_array_index (name_p, &index))
+  {
+    return NULL;
+  }
+
+  if (type_and_flags == ECMA_ARRAY_ELEMENT_TYPE_AND_FLAGS)
+  {
+    ecma_property_t *element_p = ecma_op_array_store_element (obj_p, elements_p, index, value.value);
+
+    if (element_p != NULL)
+    {
+      ecma_deref_ecma_string (name_p);
+      return element_p;
+    }
+  }
+
+  ecma_op_array_convert_to_normal (obj_p);
+  return NULL;
+} /* ecma_op_array_create_element */
+
+/**
+ * Create a new element of a fast array without creating a property name.
+ *
+ * Note:
+ *      the length property of the array is not updated
+ *
+ * @return true - if the element is stored in the element vector (the value is copied),
+ *         false - otherwise (the array is converted to a normal array if it was a fast array)
+ */
+bool
+ecma_op_array_create_fast_element (ecma_object_t *obj_p, /**< array object */
+                                   uint32_t index, /**< array index of a non-existing element */
+                                   ecma_value_t value) /**< element value */
+{
+  ecma_array_elements_t *elements_p = ecma_op_array_get_elements (obj_p);
+
+  if (elements_p == NULL || index == ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX)
+  {
+    return false;
+  }
+
+  JERRY_ASSERT (ecma_op_array_find_element (elements_p, index) == NULL);
+
+  if (ecma_op_array_store_element (obj_p, elements_p, index, ecma_copy_value_if_not_object (value)) == NULL)
+  {
+    ecma_op_array_convert_to_normal (obj_p);
+    return false;
+  }
+
+  return true;
+} /* ecma_op_array_create_fast_element */
+
+/**
+ * Delete an element of a fast array.
+ */
+void
+ecma_op_array_delete_element (ecma_object_t *obj_p, /**< fast array object */
+                              ecma_property_t *element_p) /**< element */
+{
+  ecma_array_elements_t *elements_p = ecma_op_array_get_elements (obj_p);
+  uint32_t index = ecma_op_array_get_element_index (elements_p, element_p);
+
+  JERRY_ASSERT (index < elements_p->length && element_p->type_and_flags == ECMA_ARRAY_ELEMENT_TYPE_AND_FLAGS);
+
+  ecma_free_value_if_not_object (ECMA_PROPERTY_VALUE_PTR (element_p)->value);
+  element_p->type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+
+  if (index + 1 < elements_p->length)
+  {
+    elements_p->hole_count++;
+
+    if (ecma_op_array_has_too_many_holes (elements_p->hole_count, elements_p->length))
+    {
+      ecma_op_array_convert_to_normal (obj_p);
+    }
+    return;
+  }
+
+  /* Trailing holes are removed. */
+  elements_p->length = index;
+
+  while (elements_p->length > 0
+         && ECMA_ARRAY_ELEMENTS_GET (elements_p, elements_p->length - 1)->type_and_flags == ECMA_PROPERTY_TYPE_DELETED)
+  {
+    JERRY_ASSERT (elements_p->hole_count > 0);
+
+    elements_p->length--;
+    elements_p->hole_count--;
+  }
+} /* ecma_op_array_delete_element */
+
+/**
+ * Get the length property of a fast array, if it is writable
+ * and it is equal to the length of the element vector.
+ *
+ * @return pointer to the length property - if the conditions are met,
+ *         NULL - otherwise
+ */
+static ecma_property_t *
+ecma_op_array_get_fast_length_property (ecma_object_t *obj_p, /**< fast array object */
+                                        ecma_array_elements_t *elements_p) /**< element vector */
+{
+  ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+  ecma_property_t *length_prop_p = ecma_get_named_property (obj_p, magic_string_length_p);
+  ecma_deref_ecma_string (magic_string_length_p);
+
+  if (!ecma_is_property_writable (length_prop_p))
+  {
+    return NULL;
+  }
+
+  ecma_number_t length = ecma_get_number_from_value (ecma_get_named_data_property_value (length_prop_p));
+
+  if (length != ((ecma_number_t) elements_p->length))
+  {
+    return NULL;
+  }
+
+  return length_prop_p;
+} /* ecma_op_array_get_fast_length_property */
+
+/**
+ * Append an element to the end of a fast array.
+ *
+ * Note:
+ *      the element is appended only if the [[Put]] operation would create
+ *      a new own data property: the array is extensible, its length is
+ *      writable and no prototype has a property with the same name
+ *
+ * @return true - if the element is appended (the value is copied and the length is updated),
+ *         false - otherwise (the array is not changed)
+ */
+bool
+ecma_op_array_append_element (ecma_object_t *obj_p, /**< array object */
+                              ecma_value_t value) /**< element value */
+{
+  ecma_array_elements_t *elements_p = ecma_op_array_get_elements (obj_p);
+
+  if (elements_p == NULL
+      || !ecma_get_object_extensible (obj_p)
+      || elements_p->length >= ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX - 1)
+  {
+    return false;
+  }
+
+  ecma_property_t *length_prop_p = ecma_op_array_get_fast_length_property (obj_p, elements_p);
+
+  if (length_prop_p == NULL)
+  {
+    return false;
+  }
+
+  uint32_t index = elements_p->length;
+  ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+  bool is_inherited = false;
+
+  for (ecma_object_t *proto_p = ecma_get_object_prototype (obj_p);
+       proto_p != NULL && !is_inherited;
+       proto_p = ecma_get_object_prototype (proto_p))
+  {
+    is_inherited = (ecma_op_object_get_own_property (proto_p, index_str_p) != NULL);
+  }
+
+  ecma_deref_ecma_string (index_str_p);
+
+  if (is_inherited
+      || !ecma_op_array_create_fast_element (obj_p, index, value))
+  {
+    return false;
+  }
+
+  ecma_named_data_property_assign_value (obj_p,
+                                         length_prop_p,
+                                         ecma_make_uint32_value (index + 1));
+  return true;
+} /* ecma_op_array_append_element */
+
+/**
+ * Remove the last element of a fast array.
+ *
+ * @return true - if the last element is removed (its value is returned in value_p
+ *                and must be freed with ecma_free_value),
+ *         false - otherwise (the array is not changed)
+ */
+bool
+ecma_op_array_pop_element (ecma_object_t *obj_p, /**< array object */
+                           ecma_value_t *value_p) /**< [out] value of the element */
+{
+  ecma_array_elements_t *elements_p = ecma_op_array_get_elements (obj_p);
+
+  if (elements_p == NULL || elements_p->length == 0)
+  {
+    return false;
+  }
+
+  ecma_property_t *length_prop_p = ecma_op_array_get_fast_length_property (obj_p, elements_p);
+
+  if (length_prop_p == NULL)
+  {
+    return false;
+  }
+
+  uint32_t index = elements_p->length - 1;
+  ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET (elements_p, index);
+
+  /* Trailing holes are never stored. */
+  JERRY_ASSERT (element_p->type_and_flags == ECMA_ARRAY_ELEMENT_TYPE_AND_FLAGS);
+
+  *value_p = ecma_copy_value (ECMA_PROPERTY_VALUE_PTR (element_p)->value);
+  ecma_op_array_delete_element (obj_p, element_p);
+
+  ecma_named_data_property_assign_value (obj_p,
+                                         length_prop_p,
+                                         ecma_make_uint32_value (index));
+  return true;
+} /* ecma_op_array_pop_element */
+
+/**
+ * Delete the elements of a fast array starting from an index.
+ */
+static void
+ecma_op_array_truncate_elements (ecma_array_elements_t *elements_p, /**< element vector */
+                                 uint32_t new_length) /**< new length */
+{
+  while (elements_p->length > new_length)
+  {
+    ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET (elements_p, elements_p->length - 1);
+
+    if (element_p->type_and_flags == ECMA_PROPERTY_TYPE_DELETED)
+    {
+      JERRY_ASSERT (elements_p->hole_count > 0);
+      elements_p->hole_count--;
+    }
+    else
+    {
+      ecma_free_value_if_not_object (ECMA_PROPERTY_VALUE_PTR (element_p)->value);
+      element_p->type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+    }
+
+    elements_p->length--;
+  }
+} /* ecma_op_array_truncate_elements */
+
+/**
+ * Convert a fast array to a normal array, which stores
+ * all of its array index properties in property pairs.
+ */
+void
+ecma_op_array_convert_to_normal (ecma_object_t *obj_p) /**< fast array object */
+{
+  ecma_array_elements_t *elements_p = ecma_op_array_get_elements (obj_p);
+
+  JERRY_ASSERT (elements_p != NULL && !elements_p->is_converting);
+
+  elements_p->is_converting = true;
+
+  /* The elements are moved from the end of the vector, so the element which is
+   * moved is never found by property lookups. The garbage collector visits all
+   * allocated elements, so the value of the element is marked until it is moved. */
+  while (elements_p->length > 0)
+  {
+    uint32_t index = --elements_p->length;
+    ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET (elements_p, index);
+
+    if (element_p->type_and_flags == ECMA_PROPERTY_TYPE_DELETED)
+    {
+      continue;
+    }
+
+    ecma_string_t *name_p = ecma_new_ecma_string_from_uint32 (index);
+    ecma_property_t *property_p = ecma_create_named_data_property (obj_p, name_p, true, true, true);
+    ecma_deref_ecma_string (name_p);
+
+    ECMA_PROPERTY_VALUE_PTR (property_p)->value = ECMA_PROPERTY_VALUE_PTR (element_p)->value;
+    element_p->type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+  }
+
+  mem_cpointer_t *elements_cp_p = ecma_op_array_get_elements_cp (obj_p);
+  *elements_cp_p = elements_p->header.next_property_cp;
+
+  ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_ARRAY_ELEMENTS, ecma_op_array_get_elements_size (elements_p->capacity));
+  mem_heap_free_block (elements_p, ecma_op_array_get_elements_size (elements_p->capacity));
+} /* ecma_op_array_convert_to_normal */
+
+/**
+ * Free the element vector of a fast array.
+ */
+void
+ecma_op_array_free_elements (ecma_object_t *obj_p) /**< fast array object */
+{
+  ecma_array_elements_t *elements_p = ecma_op_array_get_elements (obj_p);
+
+  for (uint32_t index = 0; index < elements_p->length; index++)
+  {
+    ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET (elements_p, index);
+
+    if (element_p->type_and_flags != ECMA_PROPERTY_TYPE_DELETED)
+    {
+      ecma_free_value_if_not_object (ECMA_PROPERTY_VALUE_PTR (element_p)->value);
+    }
+  }
+
+  mem_cpointer_t *elements_cp_p = ecma_op_array_get_elements_cp (obj_p);
+  *elements_cp_p = elements_p->header.next_property_cp;
+
+  ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_ARRAY_ELEMENTS, ecma_op_array_get_elements_size (elements_p->capacity));
+  mem_heap_free_block (elements_p, ecma_op_array_get_elements_size (elements_p->capacity));
+} /* ecma_op_array_free_elements */
+
+/**
+ * Get the size of an allocated element vector
+ *
+ * @return size in bytes
+ */
+size_t
+ecma_op_array_get_elements_block_size (const ecma_array_elements_t *elements_p) /**< element vector */
+{
+  return ecma_op_array_get_elements_size (elements_p->capacity);
+} /* ecma_op_array_get_elements_block_size */
+
+/**
+ * Move the element vector of a fast array to a lower heap address (see mem_heap_relocate_block).
+ *
+ * @return size of the element vector - if it is moved,
+ *         0 - otherwise
+ */
+size_t
+ecma_op_array_relocate_elements (ecma_object_t *obj_p) /**< fast array object */
+{
+  mem_cpointer_t *elements_cp_p = ecma_op_array_get_elements_cp (obj_p);
+  ecma_array_elements_t *elements_p = ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t, *elements_cp_p);
+
+  size_t size = ecma_op_array_get_elements_size (elements_p->capacity);
+  void *new_elements_p = mem_heap_relocate_block (elements_p, size);
+
+  if (new_elements_p == elements_p)
+  {
+    return 0;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (*elements_cp_p, new_elements_p);
+  return size;
+} /* ecma_op_array_relocate_elements */
+
 /**
  * Array object creation operation.
  *
@@ -64,9 +703,9 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
       && arguments_list_len == 1
       && ecma_is_value_number (arguments_list_p[0]))
   {
-    ecma_number_t *num_p = ecma_get_number_from_value (arguments_list_p[0]);
-    uint32_t num_uint32 = ecma_number_to_uint32 (*num_p);
-    if (*num_p != ((ecma_number_t) num_uint32))
+    ecma_number_t num = ecma_get_number_from_value (arguments_list_p[0]);
+    uint32_t num_uint32 = ecma_number_to_uint32 (num);
+    if (num != ((ecma_number_t) num_uint32))
     {
       return ecma_raise_range_error (ECMA_ERR_MSG (""));
     }
@@ -100,21 +739,23 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
    */
 
   ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
-  ecma_number_t *length_num_p = ecma_alloc_number ();
-  *length_num_p = ((ecma_number_t) length);
 
   ecma_property_t *length_prop_p = ecma_create_named_data_property (obj_p,
                                                                     length_magic_string_p,
                                                                     true, false, false);
-  ecma_set_named_data_property_value (length_prop_p, ecma_make_number_value (length_num_p));
+  ecma_set_named_data_property_value (length_prop_p, ecma_make_uint32_value (length));
 
   ecma_deref_ecma_string (length_magic_string_p);
 
+  /* New arrays are fast arrays. */
+  ecma_op_array_alloc_elements (obj_p, NULL, array_items_count);
+
   for (uint32_t index = 0;
        index < array_items_count;
        index++)
   {
-    if (ecma_is_value_array_hole (array_items_p[index]))
+    if (ecma_is_value_array_hole (array_items_p[index])
+        || ecma_op_array_create_fast_element (obj_p, index, array_items_p[index]))
     {
       continue;
     }
@@ -162,8 +803,8 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
   // 2.
   ecma_value_t old_len_value = ecma_get_named_data_property_value (len_prop_p);
 
-  ecma_number_t *num_p = ecma_get_number_from_value (old_len_value);
-  uint32_t old_len_uint32 = ecma_number_to_uint32 (*num_p);
+  ecma_number_t num = ecma_get_number_from_value (old_len_value);
+  uint32_t old_len_uint32 = ecma_number_to_uint32 (num);
 
   // 3.
   bool is_property_name_equal_length = ecma_compare_ecma_strings (property_name_p,
@@ -190,7 +831,7 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
     JERRY_ASSERT (!ecma_is_value_error (completion)
                   && ecma_is_value_number (completion));
 
-    ecma_number_t new_len_num = *ecma_get_number_from_value (completion);
+    ecma_number_t new_len_num = ecma_get_number_from_value (completion);
 
     ecma_free_value (completion);
 
@@ -204,11 +845,8 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
     else
     {
       // b., e.
-      ecma_number_t *new_len_num_p = ecma_alloc_number ();
-      *new_len_num_p = new_len_num;
-
       ecma_property_descriptor_t new_len_property_desc = *property_desc_p;
-      new_len_property_desc.value = ecma_make_number_value (new_len_num_p);
+      new_len_property_desc.value = ecma_make_number_value (new_len_num);
 
       ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
@@ -271,85 +909,94 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
             // l
             JERRY_ASSERT (new_len_uint32 < old_len_uint32);
 
-            /*
-             * Item i. is replaced with faster iteration: only indices that actually exist in the array, are iterated
-             */
             bool is_reduce_succeeded = true;
+            ecma_array_elements_t *elements_p = ecma_op_array_get_elements (obj_p);
 
-            ecma_collection_header_t *array_index_props_p = ecma_op_object_get_property_names (obj_p,
-                                                                                               true,
-                                                                                               false,
-                                                                                               false);
-
-            ecma_length_t array_index_props_num = array_index_props_p->unit_number;
+            if (elements_p != NULL)
+            {
+              /* The elements of fast arrays are configurable, so all of them can be deleted. */
+              ecma_op_array_truncate_elements (elements_p, new_len_uint32);
+            }
+            else
+            {
+              /*
+               * Item i. is replaced with faster iteration: only indices that actually exist in the array, are iterated
+               */
 
-            MEM_DEFINE_LOCAL_ARRAY (array_index_values_p, array_index_props_num, uint32_t);
+              ecma_collection_header_t *array_index_props_p = ecma_op_object_get_property_names (obj_p,
+                                                                                                 true,
+                                                                                                 false,
+                                                                                                 false);
 
-            ecma_collection_iterator_t iter;
-            ecma_collection_iterator_init (&iter, array_index_props_p);
+              ecma_length_t array_index_props_num = array_index_props_p->unit_number;
 
-            uint32_t array_index_values_pos = 0;
+              MEM_DEFINE_LOCAL_ARRAY (array_index_values_p, array_index_props_num, uint32_t);
 
-            while (ecma_collection_iterator_next (&iter))
-            {
-              ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+              ecma_collection_iterator_t iter;
+              ecma_collection_iterator_init (&iter, array_index_props_p);
 
-              uint32_t index;
-              bool is_index = ecma_string_get_array_index (property_name_p, &index);
-              JERRY_ASSERT (is_index);
-              JERRY_ASSERT (index < old_len_uint32);
+              uint32_t array_index_values_pos = 0;
 
-              array_index_values_p[array_index_values_pos++] = index;
-            }
+              while (ecma_collection_iterator_next (&iter))
+              {
+                ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
 
-            JERRY_ASSERT (array_index_values_pos == array_index_props_num);
+                uint32_t index;
+                bool is_index = ecma_string_get_array_index (property_name_p, &index);
+                JERRY_ASSERT (is_index);
+                JERRY_ASSERT (index < old_len_uint32);
 
-            while (array_index_values_pos != 0
-                   && array_index_values_p[--array_index_values_pos] >= new_len_uint32)
-            {
-              uint32_t index = array_index_values_p[array_index_values_pos];
+                array_index_values_p[array_index_values_pos++] = index;
+              }
 
-              // ii.
-              ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
-              ecma_value_t delete_succeeded = ecma_op_object_delete (obj_p, index_string_p, false);
-              ecma_deref_ecma_string (index_string_p);
+              JERRY_ASSERT (array_index_values_pos == array_index_props_num);
 
-              if (ecma_is_value_false (delete_succeeded))
+              while (array_index_values_pos != 0
+                     && array_index_values_p[--array_index_values_pos] >= new_len_uint32)
               {
-                // iii.
-                new_len_uint32 = (index + 1u);
-
-                ecma_number_t *new_len_num_p = ecma_get_number_from_value (new_len_property_desc.value);
+                uint32_t index = array_index_values_p[array_index_values_pos];
 
-                // 1.
-                *new_len_num_p = ((ecma_number_t) index + 1u);
+                // ii.
+                ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+                ecma_value_t delete_succeeded = ecma_op_object_delete (obj_p, index_string_p, false);
+                ecma_deref_ecma_string (index_string_p);
 
-                // 2.
-                if (!new_writable)
+                if (ecma_is_value_false (delete_succeeded))
                 {
-                  new_len_property_desc.is_writable_defined = true;
-                  new_len_property_desc.is_writable = false;
-                }
+                  // iii.
+                  new_len_uint32 = (index + 1u);
 
-                // 3.
-                ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
-                ecma_value_t completion = ecma_op_general_object_define_own_property (obj_p,
-                                                                                      magic_string_length_p,
-                                                                                      &new_len_property_desc,
-                                                                                      false);
-                ecma_deref_ecma_string (magic_string_length_p);
+                  // 1.
+                  ecma_free_value (new_len_property_desc.value);
+                  new_len_property_desc.value = ecma_make_uint32_value (new_len_uint32);
 
-                JERRY_ASSERT (ecma_is_value_boolean (completion));
+                  // 2.
+                  if (!new_writable)
+                  {
+                    new_len_property_desc.is_writable_defined = true;
+                    new_len_property_desc.is_writable = false;
+                  }
 
-                is_reduce_succeeded = false;
+                  // 3.
+                  ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+                  ecma_value_t completion = ecma_op_general_object_define_own_property (obj_p,
+                                                                                        magic_string_length_p,
+                                                                                        &new_len_property_desc,
+                                                                                        false);
+                  ecma_deref_ecma_string (magic_string_length_p);
 
-                break;
+                  JERRY_ASSERT (ecma_is_value_boolean (completion));
+
+                  is_reduce_succeeded = false;
+
+                  break;
+                }
               }
-            }
 
-            MEM_FINALIZE_LOCAL_ARRAY (array_index_values_p);
+              MEM_FINALIZE_LOCAL_ARRAY (array_index_values_p);
 
-            ecma_free_values_collection (array_index_props_p, true);
+              ecma_free_values_collection (array_index_props_p, true);
+            }
 
             if (!is_reduce_succeeded)
             {
@@ -381,7 +1028,7 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
         }
       }
 
-      ecma_dealloc_number (new_len_num_p);
+      ecma_free_value (new_len_property_desc.value);
 
       return ret_value;
     }
@@ -404,6 +1051,19 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
 
     // 4.
 
+    ecma_array_elements_t *elements_p = ecma_op_array_get_elements (obj_p);
+
+    if (elements_p != NULL
+        && (property_desc_p->is_get_defined
+            || property_desc_p->is_set_defined
+            || (property_desc_p->is_writable_defined && !property_desc_p->is_writable)
+            || (property_desc_p->is_enumerable_defined && !property_desc_p->is_enumerable)
+            || (property_desc_p->is_configurable_defined && !property_desc_p->is_configurable)))
+    {
+      /* Elements with non-default attributes are stored in property pairs. */
+      ecma_op_array_convert_to_normal (obj_p);
+    }
+
     // b.
     if (index >= old_len_uint32
         && !ecma_is_property_writable (len_prop_p))
@@ -428,12 +1088,11 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
     if (index >= old_len_uint32)
     {
       // i., ii.
-      ecma_number_t *num_p = ecma_alloc_number ();
-      *num_p = ecma_number_add (((ecma_number_t) index), ECMA_NUMBER_ONE);
+      ecma_value_t new_len_value = ecma_make_number_value (ecma_number_add (((ecma_number_t) index), ECMA_NUMBER_ONE));
 
-      ecma_named_data_property_assign_value (obj_p, len_prop_p, ecma_make_number_value (num_p));
+      ecma_named_data_property_assign_value (obj_p, len_prop_p, new_len_value);
 
-      ecma_dealloc_number (num_p);
+      ecma_free_value (new_len_value);
     }
 
     // f.
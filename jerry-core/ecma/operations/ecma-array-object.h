@@ -17,6 +17,7 @@
 #define ECMA_ARRAY_OBJECT_H
 
 #include "ecma-globals.h"
+#include "ecma-shape.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -25,12 +26,57 @@
  * @{
  */
 
+/**
+ * Element vector of a fast array.
+ *
+ * While an array is dense and all of its elements are writable, enumerable
+ * and configurable data properties, its array index properties are stored
+ * in the element vector instead of property pairs. The element vector is
+ * the first item of the property list after the optional property hashmap.
+ * The header is followed by groups of elements, which use the layout of
+ * the slot groups (see ecma_property_slots_t), so an element is a regular
+ * ecma_property_t without a name.
+ *
+ * Note:
+ *      the elements are reallocated when the vector grows, so element
+ *      pointers must not be kept while the array is modified
+ */
+typedef struct
+{
+  ecma_property_header_t header; /**< header of the property */
+  uint32_t length; /**< number of elements including the holes */
+  uint32_t capacity; /**< number of allocated elements */
+  uint32_t hole_count; /**< number of holes below length */
+  uint32_t is_converting; /**< the elements are moved to property pairs */
+} ecma_array_elements_t;
+
+/**
+ * Get an element of an element vector.
+ */
+#define ECMA_ARRAY_ELEMENTS_GET(elements_p, index) \
+  ((ecma_property_t *) (((uint8_t *) ((elements_p) + 1)) \
+                        + ((index) / ECMA_PROPERTY_SLOTS_GROUP_LENGTH) * ECMA_PROPERTY_SLOTS_GROUP_SIZE \
+                        + ((index) % ECMA_PROPERTY_SLOTS_GROUP_LENGTH)))
+
 extern ecma_value_t
 ecma_op_create_array_object (const ecma_value_t *, ecma_length_t, bool);
 
 extern ecma_value_t
 ecma_op_array_object_define_own_property (ecma_object_t *, ecma_string_t *, const ecma_property_descriptor_t *, bool);
 
+extern ecma_array_elements_t *ecma_op_array_get_elements (ecma_object_t *);
+extern ecma_property_t *ecma_op_array_find_element (ecma_array_elements_t *, uint32_t);
+extern bool ecma_op_array_is_element (ecma_array_elements_t *, ecma_property_t *);
+extern ecma_property_t *ecma_op_array_create_element (ecma_object_t *, ecma_string_t *, uint8_t, ecma_property_value_t);
+extern void ecma_op_array_delete_element (ecma_object_t *, ecma_property_t *);
+extern void ecma_op_array_convert_to_normal (ecma_object_t *);
+extern void ecma_op_array_free_elements (ecma_object_t *);
+extern size_t ecma_op_array_relocate_elements (ecma_object_t *);
+extern size_t ecma_op_array_get_elements_block_size (const ecma_array_elements_t *);
+extern bool ecma_op_array_create_fast_element (ecma_object_t *, uint32_t, ecma_value_t);
+extern bool ecma_op_array_append_element (ecma_object_t *, ecma_value_t);
+extern bool ecma_op_array_pop_element (ecma_object_t *, ecma_value_t *);
+
 /**
  * @}
  * @}
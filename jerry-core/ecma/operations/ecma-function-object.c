@@ -25,7 +25,9 @@
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects-arguments.h"
+#include "ecma-shape.h"
 #include "ecma-try-catch-macro.h"
+#include "jcontext.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -168,6 +170,7 @@ ecma_op_create_function_object (ecma_object_t *scope_p, /**< function's scope */
 
   // 9.
   ecma_property_t *scope_prop_p = ecma_create_internal_property (f, ECMA_INTERNAL_PROPERTY_SCOPE);
+  ecma_gc_write_barrier (f, scope_p);
   ECMA_SET_INTERNAL_VALUE_POINTER (ECMA_PROPERTY_VALUE_PTR (scope_prop_p)->value, scope_p);
 
   // 10., 11., 12.
@@ -289,7 +292,7 @@ ecma_op_function_try_lazy_instantiate_property (ecma_object_t *obj_p, /**< the f
     /* ECMA-262 v5, 13.2, 14-15 */
 
     // 14
-    ecma_number_t *len_p = ecma_alloc_number ();
+    ecma_integer_value_t len;
 
     ecma_property_t *bytecode_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
 
@@ -300,12 +303,12 @@ ecma_op_function_try_lazy_instantiate_property (ecma_object_t *obj_p, /**< the f
     if (bytecode_data_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
     {
       cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_data_p;
-      *len_p = args_p->argument_end;
+      len = args_p->argument_end;
     }
     else
     {
       cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_data_p;
-      *len_p = args_p->argument_end;
+      len = args_p->argument_end;
     }
 
     // 15
@@ -315,9 +318,7 @@ ecma_op_function_try_lazy_instantiate_property (ecma_object_t *obj_p, /**< the f
                                                                       false,
                                                                       false);
 
-    ecma_named_data_property_assign_value (obj_p, length_prop_p, ecma_make_number_value (len_p));
-
-    ecma_dealloc_number (len_p);
+    ecma_named_data_property_assign_value (obj_p, length_prop_p, ecma_make_integer_value (len));
 
     JERRY_ASSERT (!ecma_is_property_configurable (length_prop_p));
     return length_prop_p;
@@ -559,6 +560,12 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
                 && !ecma_is_lexical_environment (func_obj_p));
   JERRY_ASSERT (ecma_op_is_callable (ecma_make_object_value (func_obj_p)));
 
+  /* The called function may run user code, so the heap can be compacted here (see ecma_gc_compact). */
+  if (unlikely (JERRY_CONTEXT (ecma_gc_compaction_requested)))
+  {
+    ecma_gc_compact ();
+  }
+
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   if (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_FUNCTION)
@@ -619,6 +626,29 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
       else
       {
         local_env_p = ecma_create_decl_lex_env (scope_p);
+
+        if (bytecode_data_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE)
+        {
+          uint32_t binding_count;
+
+          if (bytecode_data_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+          {
+            binding_count = ((cbc_uint16_arguments_t *) bytecode_data_p)->binding_count;
+          }
+          else
+          {
+            binding_count = ((cbc_uint8_arguments_t *) bytecode_data_p)->binding_count;
+          }
+
+          /* All bindings are stored in slots, so they can be found by the scope caches. */
+          if (binding_count > 0)
+          {
+            ecma_shape_create_property_slots (local_env_p, binding_count);
+          }
+
+          ecma_set_lex_env_has_static_bindings (local_env_p);
+        }
+
 #ifndef CONFIG_ECMA_COMPACT_PROFILE
         if (bytecode_data_p->status_flags & CBC_CODE_FLAGS_ARGUMENTS_NEEDED)
         {
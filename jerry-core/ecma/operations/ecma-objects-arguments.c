@@ -79,8 +79,7 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
   bool is_strict = (bytecode_data_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0;
 
   // 1.
-  ecma_number_t *len_p = ecma_alloc_number ();
-  *len_p = ((ecma_number_t) arguments_number);
+  ecma_value_t len_value = ecma_make_uint32_value (arguments_number);
 
   // 4.
   ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
@@ -90,7 +89,7 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
   ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
   ecma_value_t completion = ecma_builtin_helper_def_prop (obj_p,
                                                           length_magic_string_p,
-                                                          ecma_make_number_value (len_p),
+                                                          len_value,
                                                           true, /* Writable */
                                                           false, /* Enumerable */
                                                           true, /* Configurable */
@@ -99,7 +98,7 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
   JERRY_ASSERT (ecma_is_value_true (completion));
   ecma_deref_ecma_string (length_magic_string_p);
 
-  ecma_dealloc_number (len_p);
+  ecma_free_value (len_value);
 
   ecma_property_descriptor_t prop_desc = ecma_make_empty_property_descriptor ();
 
@@ -174,10 +173,12 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
 
       ecma_property_t *parameters_map_prop_p = ecma_create_internal_property (obj_p,
                                                                               ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP);
+      ecma_gc_write_barrier (obj_p, map_p);
       ECMA_SET_INTERNAL_VALUE_POINTER (ECMA_PROPERTY_VALUE_PTR (parameters_map_prop_p)->value, map_p);
 
       ecma_property_t *scope_prop_p = ecma_create_internal_property (map_p,
                                                                      ECMA_INTERNAL_PROPERTY_SCOPE);
+      ecma_gc_write_barrier (map_p, lex_env_p);
       ECMA_SET_INTERNAL_VALUE_POINTER (ECMA_PROPERTY_VALUE_PTR (scope_prop_p)->value, lex_env_p);
 
       ecma_deref_object (map_p);
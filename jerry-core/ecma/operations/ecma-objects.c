@@ -23,6 +23,7 @@
 #include "ecma-objects-arguments.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
+#include "ecma-shape.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -518,6 +519,72 @@ ecma_op_object_is_prototype_of (ecma_object_t *base_p, /**< base object */
   } while (true);
 } /* ecma_op_object_is_prototype_of */
 
+/**
+ * Append the name of an own property to the collection of property names,
+ * or to the collection of skipped names if the property is not enumerable
+ * (helper for ecma_op_object_get_property_names)
+ */
+static void
+ecma_op_object_add_property_name (ecma_string_t *name_p, /**< property name */
+                                  ecma_property_t *property_p, /**< named property */
+                                  bool is_enumerable_only, /**< true - exclude non-enumerable properties */
+                                  ecma_collection_header_t *prop_names_p, /**< own property names */
+                                  ecma_collection_header_t *skipped_non_enumerable_p, /**< skipped property
+                                                                                       *   names */
+                                  uint32_t *own_names_hashes_bitmap, /**< hash bitmap of own property names */
+                                  uint32_t *names_hashes_bitmap) /**< hash bitmap of skipped property names */
+{
+  const size_t bitmap_row_size = sizeof (uint32_t) * JERRY_BITSINBYTE;
+
+  lit_string_hash_t hash = name_p->hash;
+  uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
+  uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
+
+  if (!(is_enumerable_only && !ecma_is_property_enumerable (property_p)))
+  {
+    bool is_add = true;
+
+    if ((own_names_hashes_bitmap[bitmap_row] & (1u << bitmap_column)) != 0)
+    {
+      ecma_collection_iterator_t iter;
+      ecma_collection_iterator_init (&iter, prop_names_p);
+
+      while (ecma_collection_iterator_next (&iter))
+      {
+        ecma_string_t *name2_p = ecma_get_string_from_value (*iter.current_value_p);
+
+        if (ecma_compare_ecma_strings (name_p, name2_p))
+        {
+          is_add = false;
+          break;
+        }
+      }
+    }
+
+    if (is_add)
+    {
+      own_names_hashes_bitmap[bitmap_row] |= (1u << bitmap_column);
+
+      ecma_append_to_values_collection (prop_names_p,
+                                        ecma_make_string_value (name_p),
+                                        true);
+    }
+  }
+  else
+  {
+    JERRY_ASSERT (is_enumerable_only && !ecma_is_property_enumerable (property_p));
+
+    ecma_append_to_values_collection (skipped_non_enumerable_p,
+                                      ecma_make_string_value (name_p),
+                                      true);
+
+    if ((names_hashes_bitmap[bitmap_row] & (1u << bitmap_column)) == 0)
+    {
+      names_hashes_bitmap[bitmap_row] |= (1u << bitmap_column);
+    }
+  }
+} /* ecma_op_object_add_property_name */
+
 /**
  * Get collection of property names
  *
@@ -625,6 +692,8 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
     }
 
     ecma_property_header_t *prop_iter_p = ecma_get_property_list (prototype_chain_iter_p);
+    ecma_property_slots_t *slots_p = NULL;
+    ecma_array_elements_t *elements_p = NULL;
 
     if (prop_iter_p != NULL
         && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
@@ -633,6 +702,21 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
                                       prop_iter_p->next_property_cp);
     }
 
+    if (prop_iter_p != NULL
+        && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_SLOTS)
+    {
+      slots_p = (ecma_property_slots_t *) prop_iter_p;
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                      prop_iter_p->next_property_cp);
+    }
+    else if (prop_iter_p != NULL
+             && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + 0) == ECMA_PROPERTY_TYPE_ELEMENTS)
+    {
+      elements_p = (ecma_array_elements_t *) prop_iter_p;
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                      prop_iter_p->next_property_cp);
+    }
+
     while (prop_iter_p != NULL)
     {
       JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
@@ -647,61 +731,71 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
           ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
           ecma_string_t *name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_pair_p->names_cp[i]);
 
-          if (!(is_enumerable_only && !ecma_is_property_enumerable (property_p)))
-          {
-            lit_string_hash_t hash = name_p->hash;
-            uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
-            uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
-
-            bool is_add = true;
-
-            if ((own_names_hashes_bitmap[bitmap_row] & (1u << bitmap_column)) != 0)
-            {
-              ecma_collection_iterator_init (&iter, prop_names_p);
-
-              while (ecma_collection_iterator_next (&iter))
-              {
-                ecma_string_t *name2_p = ecma_get_string_from_value (*iter.current_value_p);
-
-                if (ecma_compare_ecma_strings (name_p, name2_p))
-                {
-                  is_add = false;
-                  break;
-                }
-              }
-            }
-
-            if (is_add)
-            {
-              own_names_hashes_bitmap[bitmap_row] |= (1u << bitmap_column);
-
-              ecma_append_to_values_collection (prop_names_p,
-                                                ecma_make_string_value (name_p),
-                                                true);
-            }
-          }
-          else
-          {
-            JERRY_ASSERT (is_enumerable_only && !ecma_is_property_enumerable (property_p));
+          ecma_op_object_add_property_name (name_p,
+                                            property_p,
+                                            is_enumerable_only,
+                                            prop_names_p,
+                                            skipped_non_enumerable_p,
+                                            own_names_hashes_bitmap,
+                                            names_hashes_bitmap);
+        }
+      }
 
-            ecma_append_to_values_collection (skipped_non_enumerable_p,
-                                              ecma_make_string_value (name_p),
-                                              true);
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                      prop_iter_p->next_property_cp);
+    }
 
-            lit_string_hash_t hash = name_p->hash;
-            uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
-            uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
+    if (slots_p != NULL)
+    {
+      /* Property pairs are created after the slots are used up, so the
+       * slots are listed last, starting from the most recent one. */
+      ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
 
-            if ((names_hashes_bitmap[bitmap_row] & (1u << bitmap_column)) == 0)
-            {
-              names_hashes_bitmap[bitmap_row] |= (1u << bitmap_column);
-            }
-          }
+      while (shape_p->slot_count > 0)
+      {
+        ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET (slots_p, shape_p->slot_count - 1u);
+
+        if (ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+            || ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
+        {
+          ecma_op_object_add_property_name (ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp),
+                                            property_p,
+                                            is_enumerable_only,
+                                            prop_names_p,
+                                            skipped_non_enumerable_p,
+                                            own_names_hashes_bitmap,
+                                            names_hashes_bitmap);
         }
+
+        shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
       }
+    }
 
-      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
-                                      prop_iter_p->next_property_cp);
+    if (elements_p != NULL)
+    {
+      uint32_t index = elements_p->length;
+
+      while (index > 0)
+      {
+        index--;
+
+        ecma_property_t *property_p = ECMA_ARRAY_ELEMENTS_GET (elements_p, index);
+
+        if (property_p->type_and_flags != ECMA_PROPERTY_TYPE_DELETED)
+        {
+          ecma_string_t *name_p = ecma_new_ecma_string_from_uint32 (index);
+
+          ecma_op_object_add_property_name (name_p,
+                                            property_p,
+                                            is_enumerable_only,
+                                            prop_names_p,
+                                            skipped_non_enumerable_p,
+                                            own_names_hashes_bitmap,
+                                            names_hashes_bitmap);
+
+          ecma_deref_ecma_string (name_p);
+        }
+      }
     }
 
     ecma_collection_iterator_init (&iter, prop_names_p);
@@ -0,0 +1,108 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup context Engine context
+ * @{
+ */
+
+/**
+ * Check size of heap is corresponding to configuration
+ */
+JERRY_STATIC_ASSERT (sizeof (mem_heap_t) <= MEM_HEAP_SIZE,
+                     size_of_mem_heap_must_be_less_than_or_equal_to_MEM_HEAP_SIZE);
+
+/**
+ * Global context
+ */
+jerry_context_t jerry_global_context;
+
+#ifndef JERRY_ENABLE_MULTIPLE_CONTEXTS
+
+/**
+ * Global heap
+ */
+#ifndef JERRY_HEAP_SECTION_ATTR
+mem_heap_t jerry_global_heap;
+#else /* JERRY_HEAP_SECTION_ATTR */
+mem_heap_t jerry_global_heap __attribute__ ((section (JERRY_HEAP_SECTION_ATTR)));
+#endif /* !JERRY_HEAP_SECTION_ATTR */
+
+#else /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
+/**
+ * Context of the current thread, the global context by default
+ */
+__thread jerry_context_t *jerry_current_context_p = &jerry_global_context;
+
+/**
+ * Get the size of an engine context
+ *
+ * @return size in bytes
+ */
+size_t
+jerry_get_context_size (void)
+{
+  return sizeof (jerry_context_t);
+} /* jerry_get_context_size */
+
+/**
+ * Select the engine context of the current thread
+ *
+ * Note:
+ *      the context must be aligned to at least MEM_ALIGNMENT bytes,
+ *      and it is initialized by the next jerry_init call
+ */
+void
+jerry_set_current_context (jerry_context_t *context_p) /**< context buffer of
+                                                        *   jerry_get_context_size () bytes */
+{
+  JERRY_ASSERT (context_p != NULL);
+  JERRY_ASSERT (((uintptr_t) context_p) % MEM_ALIGNMENT == 0);
+
+  jerry_current_context_p = context_p;
+} /* jerry_set_current_context */
+
+/**
+ * Get the engine context of the current thread
+ *
+ * @return current context
+ */
+jerry_context_t *
+jerry_get_current_context (void)
+{
+  return jerry_current_context_p;
+} /* jerry_get_current_context */
+
+#endif /* !JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
+/**
+ * Reset all members of the current context (except the heap)
+ */
+void
+jcontext_init (void)
+{
+#ifndef JERRY_ENABLE_MULTIPLE_CONTEXTS
+  memset (&jerry_global_context, 0, sizeof (jerry_context_t));
+#else /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+  memset (jerry_current_context_p, 0, offsetof (jerry_context_t, mem_heap));
+#endif /* !JERRY_ENABLE_MULTIPLE_CONTEXTS */
+} /* jcontext_init */
+
+/**
+ * @}
+ */
@@ -0,0 +1,244 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JCONTEXT_H
+#define JCONTEXT_H
+
+#include "ecma-alloc.h"
+#include "ecma-builtins.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-lcache.h"
+#include "ecma-shape.h"
+#include "jerry.h"
+#include "jrt.h"
+#include "lit-cpointer.h"
+#include "lit-literal-storage.h"
+#include "lit-magic-strings.h"
+#include "mem-allocator.h"
+#include "mem-config.h"
+#include "mem-heap.h"
+#include "mem-poolman.h"
+#include "re-bytecode.h"
+#include "vm-defines.h"
+
+/** \addtogroup context Engine context
+ * @{
+ */
+
+/**
+ * Number of small free lists
+ */
+#define MEM_HEAP_SMALL_LIST_COUNT 32
+
+/**
+ * Size of the largest block which is stored in a small free list
+ */
+#define MEM_HEAP_SMALL_BLOCK_LIMIT (MEM_HEAP_SMALL_LIST_COUNT * MEM_ALIGNMENT)
+
+/**
+ * Logarithm of MEM_HEAP_SMALL_BLOCK_LIMIT
+ */
+#define MEM_HEAP_SMALL_BLOCK_LIMIT_LOG (5 + MEM_ALIGNMENT_LOG)
+
+/**
+ * Number of large free lists
+ */
+#define MEM_HEAP_LARGE_LIST_COUNT (MEM_HEAP_OFFSET_LOG - MEM_HEAP_SMALL_BLOCK_LIMIT_LOG)
+
+/**
+ * Number of words in the bit map of free units
+ */
+#define MEM_HEAP_FREE_MAP_WORDS (MEM_HEAP_SIZE / (MEM_ALIGNMENT * 32))
+
+/* Calculate heap area size, leaving space for the free lists and the bit map of free units */
+#define MEM_HEAP_AREA_SIZE (MEM_HEAP_SIZE \
+                            - JERRY_ALIGNUP ((MEM_HEAP_SMALL_LIST_COUNT + MEM_HEAP_LARGE_LIST_COUNT + 2) \
+                                             * sizeof (uint32_t), MEM_ALIGNMENT) \
+                            - MEM_HEAP_FREE_MAP_WORDS * sizeof (uint32_t))
+
+/**
+ * Heap structure
+ */
+typedef struct
+{
+  /** First free region of each list, MEM_HEAP_END_OF_LIST if the list is empty */
+  uint32_t list_first_offset[MEM_HEAP_SMALL_LIST_COUNT + MEM_HEAP_LARGE_LIST_COUNT];
+
+  /** Bit map of the non-empty small lists */
+  uint32_t small_list_map;
+
+  /** Bit map of the non-empty large lists */
+  uint32_t large_list_map;
+
+  /**
+   * Heap area
+   */
+  uint8_t area[MEM_HEAP_AREA_SIZE] __attribute__ ((aligned (MEM_ALIGNMENT)));
+
+  /** Bit map of the free units of the heap area */
+  uint32_t free_map[MEM_HEAP_FREE_MAP_WORDS];
+} mem_heap_t;
+
+/**
+ * Engine context
+ *
+ * All variables which describe the state of an engine instance are members of
+ * this structure. When multiple contexts are enabled, each thread selects its
+ * own context with jerry_set_current_context, otherwise a single statically
+ * allocated context is used and the members are accessed without indirection.
+ */
+struct jerry_context_t
+{
+  /* Memory allocator */
+  size_t mem_heap_allocated_size; /**< size of allocated regions */
+  size_t mem_heap_limit; /**< current limit of heap usage, that is upon being reached,
+                          *   causes call of "try give memory back" callbacks */
+  mem_pools_chunk_t *mem_free_chunk_p; /**< list of free pool chunks */
+  mem_try_give_memory_back_callback_t mem_try_give_memory_back_callback; /**< callback for freeing
+                                                                           *   up memory */
+#ifdef MEM_STATS
+  mem_heap_stats_t mem_heap_stats; /**< heap's memory usage statistics */
+  mem_pools_stats_t mem_pools_stats; /**< pools' memory usage statistics */
+#endif /* MEM_STATS */
+
+  /* ECMA */
+  ecma_object_t *ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT]; /**< instances of built-in objects */
+  ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT]; /**< list of marked (visited during
+                                                               *   current GC session) and umarked objects */
+  bool ecma_gc_visited_flip_flag; /**< current state of an object's visited flag */
+  size_t ecma_gc_objects_number; /**< number of currently allocated objects */
+  size_t ecma_gc_new_objects_since_last_gc; /**< number of newly allocated objects since last GC session */
+  size_t ecma_gc_promoted_objects_since_major_gc; /**< number of objects promoted since the last major GC */
+  ecma_object_t *ecma_gc_young_objects_p; /**< list of objects created since the last GC session */
+  ecma_object_t *ecma_gc_mark_stack[CONFIG_ECMA_GC_MARK_STACK_SIZE]; /**< marked objects waiting to be traced */
+  uint32_t ecma_gc_mark_stack_top; /**< number of objects in the mark stack */
+  bool ecma_gc_mark_stack_overflow; /**< a marked object could not be pushed onto the mark stack */
+  ecma_gc_phase_t ecma_gc_phase; /**< phase of the current garbage collection */
+  ecma_object_t *ecma_gc_scan_p; /**< next object of the object list scanned by the mark phase */
+  bool ecma_gc_is_rescan; /**< the object list is scanned for marked objects (instead of roots) */
+  uint32_t ecma_gc_allocations_since_step; /**< number of objects allocated since the last incremental step */
+  bool ecma_gc_compaction_requested; /**< the heap is compacted at the next safe point */
+#ifdef MEM_STATS
+  ecma_gc_stats_t ecma_gc_stats; /**< garbage collector statistics */
+  ecma_alloc_stats_t ecma_alloc_stats; /**< statistics of the allocation kinds and sites */
+#endif /* MEM_STATS */
+  uint32_t ecma_inline_cache_epoch; /**< current epoch of the inline caches */
+  ecma_object_t *ecma_global_lex_env_p; /**< global lexical environment */
+  ecma_shape_t *ecma_shape_root_p; /**< root of the shape transition tree */
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  /** LCache's hash table */
+  ecma_lcache_hash_entry_t ecma_lcache_hash_table[ECMA_LCACHE_HASH_ROWS_COUNT][ECMA_LCACHE_HASH_ROW_LENGTH];
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+
+  /* Literals */
+  lit_record_t *lit_storage; /**< head pointer to literal storage */
+  lit_cpointer_t *lit_hash_table_p; /**< hash table of the literal records (open addressing) */
+  uint32_t lit_hash_table_mask; /**< number of the entries of the hash table minus one */
+  uint32_t lit_hash_table_count; /**< number of the records in the hash table */
+  const lit_utf8_byte_t **lit_magic_string_ex_array; /**< external magic strings */
+  uint32_t lit_magic_string_ex_count; /**< number of external magic strings */
+  const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< sizes of the external magic strings */
+  lit_magic_string_ex_id_t *lit_magic_string_ex_sorted_ids_p; /**< identifiers of the external magic strings
+                                                               *   sorted by their sizes and characters */
+
+  /* Parsers and interpreter */
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
+  const re_compiled_code_t *re_cache[RE_CACHE_SIZE]; /**< RegExp byte code cache */
+  uint8_t re_cache_idx; /**< index of the next RegExp cache entry to be replaced */
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
+  int parser_show_instrs; /**< dump the byte code after parsing */
+  uint8_t *parser_arena_chunk_p; /**< last chunk of the parser arena */
+  uint8_t *parser_arena_free_p; /**< start of the unused area of the last chunk */
+  uint8_t *parser_arena_end_p; /**< end of the last chunk */
+  /** free blocks of the parser arena, listed by their aligned size */
+  void *parser_arena_free_blocks[CONFIG_PARSER_ARENA_MAX_BLOCK_SIZE / MEM_ALIGNMENT];
+  vm_frame_ctx_t *vm_top_context_p; /**< top (current) interpreter context */
+  bool is_direct_eval_form_call; /**< direct call from eval */
+  bool is_arguments_list_moved; /**< the arguments passed to the next vm_execute
+                                 *   call are owned by the callee */
+  ecma_compiled_code_t *vm_program_p; /**< program bytecode pointer */
+
+  /* API */
+  jerry_flag_t jerry_flags; /**< flags passed to jerry_init */
+  bool jerry_api_available; /**< the API functions can be called */
+  bool snapshot_error_occured; /**< an error occured while taking a snapshot */
+  size_t snapshot_buffer_write_offset; /**< current write offset of the snapshot buffer */
+  uint8_t *snapshot_buffer_p; /**< snapshot buffer */
+  size_t snapshot_buffer_size; /**< size of the snapshot buffer */
+
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+  mem_heap_t mem_heap; /**< heap of the context */
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+};
+
+#ifndef JERRY_ENABLE_MULTIPLE_CONTEXTS
+
+/**
+ * Global context
+ */
+extern jerry_context_t jerry_global_context;
+
+/**
+ * Global heap
+ */
+extern mem_heap_t jerry_global_heap;
+
+/**
+ * Provides a reference to a field in the current context
+ */
+#define JERRY_CONTEXT(field) (jerry_global_context.field)
+
+/**
+ * Provides a reference to a field of the heap
+ */
+#define JERRY_HEAP_CONTEXT(field) (jerry_global_heap.field)
+
+/**
+ * Address of the heap
+ */
+#define JERRY_HEAP_CONTEXT_ADDR (&jerry_global_heap)
+
+#else /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
+/**
+ * Context of the current thread
+ */
+extern __thread jerry_context_t *jerry_current_context_p;
+
+/**
+ * Provides a reference to a field in the current context
+ */
+#define JERRY_CONTEXT(field) (jerry_current_context_p->field)
+
+/**
+ * Provides a reference to a field of the heap
+ */
+#define JERRY_HEAP_CONTEXT(field) (jerry_current_context_p->mem_heap.field)
+
+/**
+ * Address of the heap
+ */
+#define JERRY_HEAP_CONTEXT_ADDR (&jerry_current_context_p->mem_heap)
+
+#endif /* !JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
+extern void jcontext_init (void);
+
+/**
+ * @}
+ */
+
+#endif /* !JCONTEXT_H */
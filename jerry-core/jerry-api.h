@@ -124,6 +124,52 @@ typedef struct jerry_api_value_t
   } u;
 } jerry_api_value_t;
 
+/**
+ * Fragmentation of the free space of the engine's heap
+ */
+typedef struct
+{
+  jerry_api_size_t free_bytes; /**< total size of the free regions */
+  jerry_api_size_t largest_free_region_size; /**< size of the largest free region */
+  jerry_api_size_t free_region_count; /**< number of free regions */
+} jerry_api_heap_fragmentation_t;
+
+/**
+ * Kinds of the engine's allocations (see jerry_api_get_memory_stats)
+ */
+typedef enum
+{
+  JERRY_API_MEMORY_KIND_OBJECT, /**< objects and lexical environments */
+  JERRY_API_MEMORY_KIND_PROPERTY_PAIR, /**< property pairs */
+  JERRY_API_MEMORY_KIND_PROPERTY_SLOTS, /**< property slots of objects with shapes */
+  JERRY_API_MEMORY_KIND_PROPERTY_HASHMAP, /**< property hashmaps */
+  JERRY_API_MEMORY_KIND_SHAPE, /**< shapes */
+  JERRY_API_MEMORY_KIND_GETTER_SETTER, /**< getter-setter pointer pairs */
+  JERRY_API_MEMORY_KIND_EXTERNAL_POINTER, /**< external pointers */
+  JERRY_API_MEMORY_KIND_ARRAY_ELEMENTS, /**< elements of fast arrays */
+  JERRY_API_MEMORY_KIND_STRING, /**< string descriptors */
+  JERRY_API_MEMORY_KIND_STRING_DATA, /**< characters of strings */
+  JERRY_API_MEMORY_KIND_NUMBER, /**< numbers */
+  JERRY_API_MEMORY_KIND_COLLECTION, /**< collection headers and chunks */
+  JERRY_API_MEMORY_KIND_BYTECODE, /**< byte code of functions, eval and global code */
+  JERRY_API_MEMORY_KIND_REGEXP_BYTECODE, /**< byte code of regular expressions */
+  JERRY_API_MEMORY_KIND_INLINE_CACHE, /**< inline cache tables of byte code */
+  JERRY_API_MEMORY_KIND_LITERAL, /**< literal storage records */
+  JERRY_API_MEMORY_KIND__COUNT /**< number of allocation kinds */
+} jerry_api_memory_kind_t;
+
+/**
+ * Memory statistics of an allocation kind
+ */
+typedef struct
+{
+  jerry_api_size_t count; /**< number of the currently allocated blocks */
+  jerry_api_size_t bytes; /**< size of the currently allocated blocks */
+  jerry_api_size_t peak_bytes; /**< peak size of the allocated blocks */
+  jerry_api_size_t total_count; /**< number of all allocations */
+  jerry_api_size_t total_bytes; /**< size of all allocations */
+} jerry_api_memory_stats_t;
+
 /**
  * Jerry external function handler type
  */
@@ -144,6 +190,16 @@ typedef void (*jerry_object_free_callback_t) (const uintptr_t native_p);
 typedef bool (*jerry_object_field_foreach_t) (const jerry_api_string_t *field_name_p,
                                               const jerry_api_value_t *field_value_p,
                                               void *user_data_p);
+
+/**
+ * Writer of the heap dump, which receives the dump line by line
+ *
+ * @return true - to continue the dump,
+ *         false - to abort it
+ */
+typedef bool (*jerry_api_heap_dump_writer_t) (const jerry_api_char_t *buffer_p,
+                                              jerry_api_size_t size,
+                                              void *user_data_p);
 /**
  * Returns whether the given jerry_api_value_t is void.
  */
@@ -315,6 +371,10 @@ jerry_completion_code_t jerry_api_eval (const jerry_api_char_t *, size_t, bool,
 jerry_api_object_t *jerry_api_get_global (void);
 
 void jerry_api_gc (void);
+bool jerry_api_gc_step (uint32_t);
+void jerry_api_heap_compact (jerry_api_heap_fragmentation_t *, jerry_api_heap_fragmentation_t *);
+bool jerry_api_heap_dump (jerry_api_heap_dump_writer_t, void *);
+bool jerry_api_get_memory_stats (jerry_api_memory_kind_t, jerry_api_memory_stats_t *);
 void jerry_register_external_magic_strings (const jerry_api_char_ptr_t *, uint32_t, const jerry_api_length_t *);
 
 size_t jerry_parse_and_save_snapshot (const jerry_api_char_t *, size_t, bool, uint8_t *, size_t);
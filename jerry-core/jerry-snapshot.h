@@ -36,7 +36,20 @@ typedef struct
 
 /**
  * Jerry snapshot format version
+ *
+ * Note:
+ *      literal tables store offsets with the width of the compressed pointers,
+ *      so the snapshots of 16 and 32 bit compressed pointer builds are not compatible
+ */
+#ifndef JERRY_CPOINTER_32_BIT
+#define JERRY_SNAPSHOT_VERSION (10u)
+#else /* JERRY_CPOINTER_32_BIT */
+#define JERRY_SNAPSHOT_VERSION (10u | JERRY_SNAPSHOT_CPOINTER_32_BIT_FLAG)
+#endif /* !JERRY_CPOINTER_32_BIT */
+
+/**
+ * Version flag of snapshots saved by builds with 32 bit compressed pointers
  */
-#define JERRY_SNAPSHOT_VERSION (4u)
+#define JERRY_SNAPSHOT_CPOINTER_32_BIT_FLAG (1u << 31)
 
 #endif /* !JERRY_SNAPSHOT_H */
@@ -23,17 +23,20 @@
 #include "ecma-eval.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
+#include "ecma-heap-dump.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-try-catch-macro.h"
 #include "jerry-snapshot.h"
+#include "jcontext.h"
 #include "lit-literal.h"
 #include "lit-magic-strings.h"
 #include "lit-snapshot.h"
 #include "js-parser.h"
 #include "re-compiler.h"
+#include "vm-stats.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -53,16 +56,6 @@ const char * const jerry_commit_hash = JERRY_COMMIT_HASH;
  */
 const char * const jerry_branch_name = JERRY_BRANCH_NAME;
 
-/**
- * Jerry run-time configuration flags
- */
-static jerry_flag_t jerry_flags;
-
-/**
- * Jerry API availability flag
- */
-static bool jerry_api_available;
-
 /** \addtogroup jerry_extension Jerry engine extension interface
  * @{
  */
@@ -81,6 +74,13 @@ int jerry_debug_level = 0;
 FILE *jerry_log_file = NULL;
 #endif /* JERRY_ENABLE_LOG */
 
+#ifdef JERRY_VM_PROFILE
+/**
+ * File, used for the JSON output of the opcode profile
+ */
+const char *jerry_vm_profile_file_name = NULL;
+#endif /* JERRY_VM_PROFILE */
+
 /**
  * Assert that it is correct to call API in current state.
  *
@@ -100,7 +100,7 @@ FILE *jerry_log_file = NULL;
 static void
 jerry_assert_api_available (void)
 {
-  if (!jerry_api_available)
+  if (!JERRY_CONTEXT (jerry_api_available))
   {
     JERRY_UNREACHABLE ();
   }
@@ -112,7 +112,7 @@ jerry_assert_api_available (void)
 static void
 jerry_make_api_available (void)
 {
-  jerry_api_available = true;
+  JERRY_CONTEXT (jerry_api_available) = true;
 } /* jerry_make_api_available */
 
 /**
@@ -121,7 +121,7 @@ jerry_make_api_available (void)
 static void
 jerry_make_api_unavailable (void)
 {
-  jerry_api_available = false;
+  JERRY_CONTEXT (jerry_api_available) = false;
 } /* jerry_make_api_unavailable */
 
 /**
@@ -397,14 +397,14 @@ jerry_api_convert_ecma_value_to_api_value (jerry_api_value_t *out_value_p, /**<
   }
   else if (ecma_is_value_number (value))
   {
-    ecma_number_t *num = ecma_get_number_from_value (value);
+    ecma_number_t num_val = ecma_get_number_from_value (value);
 
 #if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
     out_value_p->type = JERRY_API_DATA_TYPE_FLOAT32;
-    out_value_p->u.v_float32 = *num;
+    out_value_p->u.v_float32 = num_val;
 #elif CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
     out_value_p->type = JERRY_API_DATA_TYPE_FLOAT64;
-    out_value_p->u.v_float64 = *num;
+    out_value_p->u.v_float64 = num_val;
 #endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32 */
   }
   else if (ecma_is_value_string (value))
@@ -461,28 +461,19 @@ jerry_api_convert_api_value_to_ecma_value (ecma_value_t *out_value_p, /**< [out]
     }
     case JERRY_API_DATA_TYPE_FLOAT32:
     {
-      ecma_number_t *num = ecma_alloc_number ();
-      *num = (ecma_number_t) (api_value_p->u.v_float32);
-
-      *out_value_p = ecma_make_number_value (num);
+      *out_value_p = ecma_make_number_value ((ecma_number_t) (api_value_p->u.v_float32));
 
       break;
     }
     case JERRY_API_DATA_TYPE_FLOAT64:
     {
-      ecma_number_t *num = ecma_alloc_number ();
-      *num = (ecma_number_t) (api_value_p->u.v_float64);
-
-      *out_value_p = ecma_make_number_value (num);
+      *out_value_p = ecma_make_number_value ((ecma_number_t) (api_value_p->u.v_float64));
 
       break;
     }
     case JERRY_API_DATA_TYPE_UINT32:
     {
-      ecma_number_t *num = ecma_alloc_number ();
-      *num = (ecma_number_t) (api_value_p->u.v_uint32);
-
-      *out_value_p = ecma_make_number_value (num);
+      *out_value_p = ecma_make_number_value ((ecma_number_t) (api_value_p->u.v_uint32));
 
       break;
     }
@@ -734,9 +725,7 @@ jerry_api_create_array_object (jerry_api_size_t size) /* size of array */
 {
   JERRY_ASSERT (size > 0);
 
-  ecma_number_t *length_num_p = ecma_alloc_number ();
-  *length_num_p = ((ecma_number_t) size);
-  ecma_value_t array_length = ecma_make_number_value (length_num_p);
+  ecma_value_t array_length = ecma_make_number_value (((ecma_number_t) size));
 
   jerry_api_length_t argument_size = 1;
   ecma_value_t new_array_completion = ecma_op_create_array_object (&array_length, argument_size, true);
@@ -1629,6 +1618,124 @@ jerry_api_gc (void)
   ecma_gc_run ();
 } /* jerry_api_gc */
 
+/**
+ * Perform a step of an incremental garbage collection
+ *
+ * A new collection is started if no collection is in progress. The host can call
+ * this function in idle time, so less work is left for the steps done during allocations.
+ *
+ * @return true - if the collection is finished,
+ *         false - otherwise
+ */
+bool
+jerry_api_gc_step (uint32_t budget) /**< maximum number of objects to trace, scan or sweep */
+{
+  jerry_assert_api_available ();
+
+  return ecma_gc_step (budget);
+} /* jerry_api_gc_step */
+
+/**
+ * Convert the heap fragmentation to its API representation
+ */
+static void
+jerry_api_get_heap_fragmentation (jerry_api_heap_fragmentation_t *out_fragmentation_p) /**< [out] fragmentation */
+{
+  mem_heap_fragmentation_t fragmentation;
+  mem_heap_get_fragmentation (&fragmentation);
+
+  out_fragmentation_p->free_bytes = (jerry_api_size_t) fragmentation.free_bytes;
+  out_fragmentation_p->largest_free_region_size = (jerry_api_size_t) fragmentation.largest_free_region_size;
+  out_fragmentation_p->free_region_count = (jerry_api_size_t) fragmentation.free_region_count;
+} /* jerry_api_get_heap_fragmentation */
+
+/**
+ * Compact the heap
+ *
+ * The property tables of the objects are moved to the lower end of the heap,
+ * so the free space is merged into larger regions.
+ */
+void
+jerry_api_heap_compact (jerry_api_heap_fragmentation_t *before_p, /**< [out] fragmentation before the compaction
+                                                                   *   (can be NULL) */
+                        jerry_api_heap_fragmentation_t *after_p) /**< [out] fragmentation after the compaction
+                                                                  *   (can be NULL) */
+{
+  jerry_assert_api_available ();
+
+  /* The lookup cache holds references to property names, so it is emptied before the measurement. */
+  ecma_lcache_invalidate_all ();
+  mem_pools_collect_empty ();
+
+  if (before_p != NULL)
+  {
+    jerry_api_get_heap_fragmentation (before_p);
+  }
+
+  ecma_gc_compact ();
+
+  if (after_p != NULL)
+  {
+    jerry_api_get_heap_fragmentation (after_p);
+  }
+} /* jerry_api_heap_compact */
+
+/**
+ * Dump the live object graph of the heap (see ecma-heap-dump.c for the format)
+ *
+ * Note:
+ *      a full garbage collection is done before the dump
+ *
+ * @return true - if the dump is completed,
+ *         false - if the writer aborted it
+ */
+bool
+jerry_api_heap_dump (jerry_api_heap_dump_writer_t writer, /**< writer callback */
+                     void *user_data_p) /**< data passed to the writer */
+{
+  jerry_assert_api_available ();
+
+  return ecma_heap_dump (writer, user_data_p);
+} /* jerry_api_heap_dump */
+
+JERRY_STATIC_ASSERT ((int) JERRY_API_MEMORY_KIND__COUNT == (int) ECMA_ALLOC_KIND__COUNT,
+                     jerry_api_memory_kind_t_must_have_the_same_entries_as_ecma_alloc_kind_t);
+
+/**
+ * Get the memory statistics of an allocation kind
+ *
+ * Note:
+ *      the statistics are only collected by the MEM_STATS builds
+ *
+ * @return true - if the statistics are collected,
+ *         false - otherwise
+ */
+bool
+jerry_api_get_memory_stats (jerry_api_memory_kind_t kind, /**< kind of the allocations */
+                            jerry_api_memory_stats_t *out_stats_p) /**< [out] statistics */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (kind < JERRY_API_MEMORY_KIND__COUNT);
+
+#ifdef MEM_STATS
+  ecma_alloc_kind_stats_t kind_stats;
+
+  /* The two enumerations list the kinds in the same order. */
+  ecma_alloc_stats_get ((ecma_alloc_kind_t) kind, &kind_stats);
+
+  out_stats_p->count = (jerry_api_size_t) kind_stats.count;
+  out_stats_p->bytes = (jerry_api_size_t) kind_stats.bytes;
+  out_stats_p->peak_bytes = (jerry_api_size_t) kind_stats.peak_bytes;
+  out_stats_p->total_count = (jerry_api_size_t) kind_stats.total_count;
+  out_stats_p->total_bytes = (jerry_api_size_t) kind_stats.total_bytes;
+  return true;
+#else /* !MEM_STATS */
+  (void) out_stats_p;
+  return false;
+#endif /* MEM_STATS */
+} /* jerry_api_get_memory_stats */
+
 /**
  * Jerry engine initialization
  */
@@ -1656,7 +1763,28 @@ jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
 #endif /* !MEM_STATS */
   }
 
-  jerry_flags = flags;
+  if (flags & JERRY_FLAG_VM_SEQUENCE_STATS)
+  {
+#ifndef JERRY_VM_SEQUENCE_STATS
+    flags &= (jerry_flag_t) ~JERRY_FLAG_VM_SEQUENCE_STATS;
+
+    JERRY_WARNING_MSG ("Ignoring byte code sequence statistics option because of '!JERRY_VM_SEQUENCE_STATS' "
+                       "build configuration.\n");
+#endif /* !JERRY_VM_SEQUENCE_STATS */
+  }
+
+  if (flags & JERRY_FLAG_VM_PROFILE)
+  {
+#ifndef JERRY_VM_PROFILE
+    flags &= (jerry_flag_t) ~JERRY_FLAG_VM_PROFILE;
+
+    JERRY_WARNING_MSG ("Ignoring opcode profile option because of '!JERRY_VM_PROFILE' build configuration.\n");
+#endif /* !JERRY_VM_PROFILE */
+  }
+
+  jcontext_init ();
+
+  JERRY_CONTEXT (jerry_flags) = flags;
 
   jerry_make_api_available ();
 
@@ -1673,10 +1801,39 @@ jerry_cleanup (void)
 {
   jerry_assert_api_available ();
 
-  bool is_show_mem_stats = ((jerry_flags & JERRY_FLAG_MEM_STATS) != 0);
+  bool is_show_mem_stats = ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_MEM_STATS) != 0);
+
+#ifdef JERRY_VM_SEQUENCE_STATS
+  if (JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_VM_SEQUENCE_STATS)
+  {
+    vm_stats_print ();
+  }
+#endif /* JERRY_VM_SEQUENCE_STATS */
+
+#ifdef JERRY_VM_PROFILE
+  if ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_VM_PROFILE) && jerry_vm_profile_file_name != NULL)
+  {
+    vm_stats_profile_dump (jerry_vm_profile_file_name);
+  }
+#endif /* JERRY_VM_PROFILE */
+
+#ifdef MEM_STATS
+  if (is_show_mem_stats)
+  {
+    ecma_alloc_stats_print ();
+  }
+#endif /* MEM_STATS */
 
   vm_finalize ();
   ecma_finalize ();
+
+#ifdef MEM_STATS
+  if (is_show_mem_stats)
+  {
+    ecma_gc_stats_print ();
+  }
+#endif /* MEM_STATS */
+
   lit_finalize ();
   mem_finalize (is_show_mem_stats);
 } /* jerry_cleanup */
@@ -1709,7 +1866,7 @@ jerry_parse (const jerry_api_char_t *source_p, /**< script source */
 {
   jerry_assert_api_available ();
 
-  int is_show_instructions = ((jerry_flags & JERRY_FLAG_SHOW_OPCODES) != 0);
+  int is_show_instructions = ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_SHOW_OPCODES) != 0);
 
   parser_set_show_instrs (is_show_instructions);
 
@@ -1729,10 +1886,12 @@ jerry_parse (const jerry_api_char_t *source_p, /**< script source */
   }
 
 #ifdef MEM_STATS
-  if (jerry_flags & JERRY_FLAG_MEM_STATS_SEPARATE)
+  if (JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_MEM_STATS_SEPARATE)
   {
     mem_stats_print ();
     mem_stats_reset_peak ();
+    ecma_alloc_stats_print ();
+    ecma_alloc_stats_reset_peak ();
   }
 #endif /* MEM_STATS */
 
@@ -1812,51 +1971,45 @@ jerry_register_external_magic_strings (const jerry_api_char_ptr_t *ex_str_items,
 
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
 
-/*
- * Variables required to take a snapshot.
- */
-static bool snapshot_error_occured;
-static size_t snapshot_buffer_write_offset;
-static uint8_t *snapshot_buffer_p;
-static size_t snapshot_buffer_size;
-
 /**
  * Snapshot callback for byte codes.
  *
  * @return start offset
  */
-static uint16_t
+static lit_cpointer_t
 snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p) /**< compiled code */
 {
-  if (snapshot_error_occured)
+  if (JERRY_CONTEXT (snapshot_error_occured))
   {
     return 0;
   }
 
-  JERRY_ASSERT ((snapshot_buffer_write_offset & (MEM_ALIGNMENT - 1)) == 0);
+  JERRY_ASSERT ((JERRY_CONTEXT (snapshot_buffer_write_offset) & (MEM_ALIGNMENT - 1)) == 0);
 
-  if ((snapshot_buffer_write_offset >> MEM_ALIGNMENT_LOG) > 0xffffu)
+  if ((JERRY_CONTEXT (snapshot_buffer_write_offset) >> MEM_ALIGNMENT_LOG) > MEM_CP_MASK)
   {
-    snapshot_error_occured = true;
+    JERRY_CONTEXT (snapshot_error_occured) = true;
     return 0;
   }
 
-  uint16_t start_offset = (uint16_t) (snapshot_buffer_write_offset >> MEM_ALIGNMENT_LOG);
+  lit_cpointer_t start_offset = (lit_cpointer_t) (JERRY_CONTEXT (snapshot_buffer_write_offset) >> MEM_ALIGNMENT_LOG);
   ecma_compiled_code_t *copied_compiled_code_p;
 
-  copied_compiled_code_p = (ecma_compiled_code_t *) (snapshot_buffer_p + snapshot_buffer_write_offset);
+  copied_compiled_code_p = (ecma_compiled_code_t *) (JERRY_CONTEXT (snapshot_buffer_p)
+                                                     + JERRY_CONTEXT (snapshot_buffer_write_offset));
 
   if (!(compiled_code_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
   {
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
     /* Regular expression. */
-    if (snapshot_buffer_write_offset + sizeof (ecma_compiled_code_t) > snapshot_buffer_size)
+    if (JERRY_CONTEXT (snapshot_buffer_write_offset) + sizeof (ecma_compiled_code_t)
+        > JERRY_CONTEXT (snapshot_buffer_size))
     {
-      snapshot_error_occured = true;
+      JERRY_CONTEXT (snapshot_error_occured) = true;
       return 0;
     }
 
-    snapshot_buffer_write_offset += sizeof (ecma_compiled_code_t);
+    JERRY_CONTEXT (snapshot_buffer_write_offset) += sizeof (ecma_compiled_code_t);
 
     mem_cpointer_t pattern_cp = ((re_compiled_code_t *) compiled_code_p)->pattern_cp;
     ecma_string_t *pattern_string_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
@@ -1868,18 +2021,19 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p) /**< compiled
 
     pattern_size = buffer_size;
 
-    if (!jrt_write_to_buffer_by_offset (snapshot_buffer_p,
-                                        snapshot_buffer_size,
-                                        &snapshot_buffer_write_offset,
+    if (!jrt_write_to_buffer_by_offset (JERRY_CONTEXT (snapshot_buffer_p),
+                                        JERRY_CONTEXT (snapshot_buffer_size),
+                                        &JERRY_CONTEXT (snapshot_buffer_write_offset),
                                         buffer_p,
                                         buffer_size))
     {
-      snapshot_error_occured = true;
+      JERRY_CONTEXT (snapshot_error_occured) = true;
     }
 
     ECMA_FINALIZE_UTF8_STRING (buffer_p, buffer_size);
 
-    snapshot_buffer_write_offset = JERRY_ALIGNUP (snapshot_buffer_write_offset, MEM_ALIGNMENT);
+    JERRY_CONTEXT (snapshot_buffer_write_offset) = JERRY_ALIGNUP (JERRY_CONTEXT (snapshot_buffer_write_offset),
+                                                                  MEM_ALIGNMENT);
 
     /* Regexp character size is stored in refs. */
     copied_compiled_code_p->refs = (uint16_t) pattern_size;
@@ -1895,13 +2049,13 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p) /**< compiled
     return start_offset;
   }
 
-  if (!jrt_write_to_buffer_by_offset (snapshot_buffer_p,
-                                      snapshot_buffer_size,
-                                      &snapshot_buffer_write_offset,
+  if (!jrt_write_to_buffer_by_offset (JERRY_CONTEXT (snapshot_buffer_p),
+                                      JERRY_CONTEXT (snapshot_buffer_size),
+                                      &JERRY_CONTEXT (snapshot_buffer_write_offset),
                                       compiled_code_p,
                                       ((size_t) compiled_code_p->size) << MEM_ALIGNMENT_LOG))
   {
-    snapshot_error_occured = true;
+    JERRY_CONTEXT (snapshot_error_occured) = true;
     return 0;
   }
 
@@ -1909,27 +2063,33 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p) /**< compiled
   uint8_t *src_buffer_p = (uint8_t *) compiled_code_p;
   uint8_t *dst_buffer_p = (uint8_t *) copied_compiled_code_p;
   lit_cpointer_t *src_literal_start_p;
-  uint16_t *dst_literal_start_p;
+  lit_cpointer_t *dst_literal_start_p;
   uint32_t const_literal_end;
   uint32_t literal_end;
 
   if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
   {
     src_literal_start_p = (lit_cpointer_t *) (src_buffer_p + sizeof (cbc_uint16_arguments_t));
-    dst_literal_start_p = (uint16_t *) (dst_buffer_p + sizeof (cbc_uint16_arguments_t));
+    dst_literal_start_p = (lit_cpointer_t *) (dst_buffer_p + sizeof (cbc_uint16_arguments_t));
 
     cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) src_buffer_p;
     literal_end = args_p->literal_end;
     const_literal_end = args_p->const_literal_end;
+
+    /* Inline caches are allocated again after the snapshot is loaded. */
+    ((cbc_uint16_arguments_t *) dst_buffer_p)->inline_cache_cp = ECMA_NULL_POINTER;
   }
   else
   {
     src_literal_start_p = (lit_cpointer_t *) (src_buffer_p + sizeof (cbc_uint8_arguments_t));
-    dst_literal_start_p = (uint16_t *) (dst_buffer_p + sizeof (cbc_uint8_arguments_t));
+    dst_literal_start_p = (lit_cpointer_t *) (dst_buffer_p + sizeof (cbc_uint8_arguments_t));
 
     cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) src_buffer_p;
     literal_end = args_p->literal_end;
     const_literal_end = args_p->const_literal_end;
+
+    /* Inline caches are allocated again after the snapshot is loaded. */
+    ((cbc_uint8_arguments_t *) dst_buffer_p)->inline_cache_cp = ECMA_NULL_POINTER;
   }
 
   for (uint32_t i = const_literal_end; i < literal_end; i++)
@@ -1951,7 +2111,7 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p) /**< compiled
 } /* snapshot_add_compiled_code */
 
 /**
- * Set the uint16_t offsets in the code area.
+ * Set the literal offsets in the code area.
  */
 static void
 jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
@@ -2010,7 +2170,7 @@ jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
               current_p++;
             }
 
-            literal_start_p[i] = (uint16_t) current_p->literal_offset;
+            literal_start_p[i] = (lit_cpointer_t) current_p->literal_offset;
           }
         }
       }
@@ -2026,7 +2186,7 @@ jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
             current_p++;
           }
 
-          literal_start_p[i] = (uint16_t) current_p->literal_offset;
+          literal_start_p[i] = (lit_cpointer_t) current_p->literal_offset;
         }
       }
 
@@ -2062,11 +2222,11 @@ jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p, /**< script sou
   jsp_status_t parse_status;
   ecma_compiled_code_t *bytecode_data_p;
 
-  snapshot_buffer_write_offset = JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t),
+  JERRY_CONTEXT (snapshot_buffer_write_offset) = JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t),
                                                 MEM_ALIGNMENT);
-  snapshot_error_occured = false;
-  snapshot_buffer_p = buffer_p;
-  snapshot_buffer_size = buffer_size;
+  JERRY_CONTEXT (snapshot_error_occured) = false;
+  JERRY_CONTEXT (snapshot_buffer_p) = buffer_p;
+  JERRY_CONTEXT (snapshot_buffer_size) = buffer_size;
   jerry_api_object_t *error_obj_p = NULL;
 
   if (is_for_global)
@@ -2098,14 +2258,14 @@ jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p, /**< script sou
 
   snapshot_add_compiled_code (bytecode_data_p);
 
-  if (snapshot_error_occured)
+  if (JERRY_CONTEXT (snapshot_error_occured))
   {
     return 0;
   }
 
   jerry_snapshot_header_t header;
   header.version = JERRY_SNAPSHOT_VERSION;
-  header.lit_table_offset = (uint32_t) snapshot_buffer_write_offset;
+  header.lit_table_offset = (uint32_t) JERRY_CONTEXT (snapshot_buffer_write_offset);
   header.is_run_global = is_for_global;
 
   lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
@@ -2113,7 +2273,7 @@ jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p, /**< script sou
 
   if (!lit_save_literals_for_snapshot (buffer_p,
                                        buffer_size,
-                                       &snapshot_buffer_write_offset,
+                                       &JERRY_CONTEXT (snapshot_buffer_write_offset),
                                        &lit_map_p,
                                        &literals_num,
                                        &header.lit_table_size))
@@ -2141,7 +2301,7 @@ jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p, /**< script sou
 
   ecma_bytecode_deref (bytecode_data_p);
 
-  return snapshot_buffer_write_offset;
+  return JERRY_CONTEXT (snapshot_buffer_write_offset);
 #else /* !JERRY_ENABLE_SNAPSHOT_SAVE */
   (void) source_p;
   (void) source_size;
@@ -2221,7 +2381,7 @@ snapshot_load_compiled_code (const uint8_t *snapshot_data_p, /**< snapshot data
   }
 
   if (copy_bytecode
-      || (header_size + (literal_end * sizeof (uint16_t)) + BYTECODE_NO_COPY_TRESHOLD > code_size))
+      || (header_size + (literal_end * sizeof (lit_cpointer_t)) + BYTECODE_NO_COPY_TRESHOLD > code_size))
   {
     bytecode_p = (ecma_compiled_code_t *) mem_heap_alloc_block (code_size);
 
@@ -2247,6 +2407,7 @@ snapshot_load_compiled_code (const uint8_t *snapshot_data_p, /**< snapshot data
   }
 
   JERRY_ASSERT (bytecode_p->refs == 1);
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_BYTECODE, ((size_t) bytecode_p->size) << MEM_ALIGNMENT_LOG);
 
   lit_cpointer_t *literal_start_p = (lit_cpointer_t *) (((uint8_t *) bytecode_p) + header_size);
 
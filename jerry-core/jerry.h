@@ -44,8 +44,15 @@ typedef enum
   JERRY_FLAG_PARSE_ONLY         = (1u << 3), /**< parse only, prevents script execution (only for testing)
                                               *   TODO: Remove. */
   JERRY_FLAG_ENABLE_LOG         = (1u << 4), /**< enable logging */
+  JERRY_FLAG_VM_SEQUENCE_STATS  = (1u << 5), /**< dump byte code sequence statistics of the interpreter */
+  JERRY_FLAG_VM_PROFILE         = (1u << 6), /**< dump the opcode profile of the interpreter */
 } jerry_flag_t;
 
+/**
+ * Engine context
+ */
+typedef struct jerry_context_t jerry_context_t;
+
 /**
  * Jerry engine build date
  */
@@ -66,6 +73,10 @@ extern int jerry_debug_level;
 extern FILE *jerry_log_file;
 #endif /* JERRY_ENABLE_LOG */
 
+#ifdef JERRY_VM_PROFILE
+extern const char *jerry_vm_profile_file_name;
+#endif /* JERRY_VM_PROFILE */
+
 void jerry_init (jerry_flag_t);
 void jerry_cleanup (void);
 
@@ -75,6 +86,12 @@ bool jerry_parse (const jerry_api_char_t *, size_t, jerry_api_object_t **);
 jerry_completion_code_t jerry_run (jerry_api_value_t *);
 jerry_completion_code_t jerry_run_simple (const jerry_api_char_t *, size_t, jerry_flag_t);
 
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+size_t jerry_get_context_size (void);
+void jerry_set_current_context (jerry_context_t *);
+jerry_context_t *jerry_get_current_context (void);
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
 /**
  * @}
  */
@@ -17,9 +17,219 @@
 #include "lit-literal-storage.h"
 #include "lit-cpointer.h"
 
+#include "ecma-alloc.h"
 #include "ecma-helpers.h"
+#include "jcontext.h"
 
-lit_record_t *lit_storage = NULL;
+/**
+ * Calculate the hash table key of a byte sequence (32 bit FNV-1a hash)
+ *
+ * @return hash table key
+ */
+static uint32_t
+lit_hash_table_calc_key (const uint8_t *data_p, /**< bytes */
+                         size_t size) /**< number of the bytes */
+{
+  /* 32 bit offset_basis for FNV = 2166136261 */
+  uint32_t key = 2166136261u;
+
+  for (size_t i = 0; i < size; i++)
+  {
+    /* 32 bit FNV_prime = 2^24 + 2^8 + 0x93 = 16777619 */
+    key = (key ^ data_p[i]) * 16777619u;
+  }
+
+  return key;
+} /* lit_hash_table_calc_key */
+
+/**
+ * Get the hash table key of a string
+ *
+ * @return hash table key
+ */
+uint32_t
+lit_hash_table_get_string_key (const lit_utf8_byte_t *str_p, /**< characters of the string */
+                               lit_utf8_size_t str_size) /**< size of the string in bytes */
+{
+  return lit_hash_table_calc_key (str_p, str_size);
+} /* lit_hash_table_get_string_key */
+
+/**
+ * Get the hash table key of a number (the key is calculated from the bit pattern of the number)
+ *
+ * @return hash table key
+ */
+uint32_t
+lit_hash_table_get_number_key (ecma_number_t num) /**< number */
+{
+  return lit_hash_table_calc_key ((const uint8_t *) &num, sizeof (ecma_number_t));
+} /* lit_hash_table_get_number_key */
+
+/**
+ * Get the hash table key of a literal record
+ *
+ * @return hash table key
+ */
+static uint32_t
+lit_hash_table_get_record_key (const lit_record_t *lit_p) /**< literal record */
+{
+  switch (lit_p->type)
+  {
+    case LIT_RECORD_TYPE_CHARSET:
+    {
+      const lit_charset_record_t *const rec_p = (const lit_charset_record_t *) lit_p;
+      return lit_hash_table_get_string_key ((const lit_utf8_byte_t *) (rec_p + 1), rec_p->size);
+    }
+    case LIT_RECORD_TYPE_MAGIC_STR:
+    {
+      lit_magic_string_id_t id = (lit_magic_string_id_t) ((const lit_magic_record_t *) lit_p)->magic_id;
+      return lit_hash_table_get_string_key (lit_get_magic_string_utf8 (id), lit_get_magic_string_size (id));
+    }
+    case LIT_RECORD_TYPE_MAGIC_STR_EX:
+    {
+      lit_magic_string_ex_id_t id = ((const lit_magic_record_t *) lit_p)->magic_id;
+      return lit_hash_table_get_string_key (lit_get_magic_string_ex_utf8 (id), lit_get_magic_string_ex_size (id));
+    }
+    default:
+    {
+      JERRY_ASSERT (lit_p->type == LIT_RECORD_TYPE_NUMBER);
+      return lit_hash_table_get_number_key (((const lit_number_record_t *) lit_p)->number);
+    }
+  }
+} /* lit_hash_table_get_record_key */
+
+/**
+ * Insert a literal record into the hash table, which has a free entry for it
+ */
+static void
+lit_hash_table_insert (lit_record_t *lit_p) /**< literal record */
+{
+  lit_cpointer_t *table_p = JERRY_CONTEXT (lit_hash_table_p);
+  const uint32_t mask = JERRY_CONTEXT (lit_hash_table_mask);
+  uint32_t position = lit_hash_table_get_record_key (lit_p) & mask;
+
+  while (table_p[position] != MEM_CP_NULL)
+  {
+    position = (position + 1) & mask;
+  }
+
+  table_p[position] = lit_cpointer_compress (lit_p);
+} /* lit_hash_table_insert */
+
+/**
+ * Make sure that the hash table can hold the specified number of literal records.
+ *
+ * Note:
+ *      the hash table is rebuilt from the literal storage, if it is resized
+ */
+void
+lit_hash_table_reserve (uint32_t count) /**< number of the literal records */
+{
+  const uint32_t old_size = (JERRY_CONTEXT (lit_hash_table_p) != NULL ? JERRY_CONTEXT (lit_hash_table_mask) + 1 : 0);
+  uint32_t size = JERRY_MAX (old_size, 1u << CONFIG_LITERAL_HASH_TABLE_KEY_BITS);
+
+  /* The table is kept at most three quarters full, so the probe sequences remain short. */
+  while (count * 4 > size * 3)
+  {
+    size *= 2;
+  }
+
+  if (size == old_size)
+  {
+    return;
+  }
+
+  lit_cpointer_t *table_p = (lit_cpointer_t *) mem_heap_alloc_block (size * sizeof (lit_cpointer_t));
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_LITERAL, size * sizeof (lit_cpointer_t));
+  memset (table_p, 0, size * sizeof (lit_cpointer_t));
+
+  lit_hash_table_free ();
+
+  JERRY_CONTEXT (lit_hash_table_p) = table_p;
+  JERRY_CONTEXT (lit_hash_table_mask) = size - 1;
+
+  for (lit_record_t *rec_p = JERRY_CONTEXT (lit_storage);
+       rec_p != NULL;
+       rec_p = lit_cpointer_decompress (rec_p->next))
+  {
+    lit_hash_table_insert (rec_p);
+    JERRY_CONTEXT (lit_hash_table_count)++;
+  }
+} /* lit_hash_table_reserve */
+
+/**
+ * Add a new literal record, which is already linked into the literal storage, to the hash table
+ */
+static void
+lit_hash_table_add (lit_record_t *lit_p) /**< literal record */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (lit_storage) == lit_p);
+
+  const uint32_t count = JERRY_CONTEXT (lit_hash_table_count) + 1;
+
+  if (JERRY_CONTEXT (lit_hash_table_p) == NULL
+      || count * 4 > (JERRY_CONTEXT (lit_hash_table_mask) + 1) * 3)
+  {
+    lit_hash_table_reserve (count);
+    JERRY_ASSERT (JERRY_CONTEXT (lit_hash_table_count) == count);
+    return;
+  }
+
+  lit_hash_table_insert (lit_p);
+  JERRY_CONTEXT (lit_hash_table_count) = count;
+} /* lit_hash_table_add */
+
+/**
+ * Free the hash table of the literal storage
+ */
+void
+lit_hash_table_free (void)
+{
+  if (JERRY_CONTEXT (lit_hash_table_p) != NULL)
+  {
+    const size_t size = (JERRY_CONTEXT (lit_hash_table_mask) + 1) * sizeof (lit_cpointer_t);
+
+    ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_LITERAL, size);
+    mem_heap_free_block (JERRY_CONTEXT (lit_hash_table_p), size);
+
+    JERRY_CONTEXT (lit_hash_table_p) = NULL;
+    JERRY_CONTEXT (lit_hash_table_mask) = 0;
+    JERRY_CONTEXT (lit_hash_table_count) = 0;
+  }
+} /* lit_hash_table_free */
+
+/**
+ * Get the first literal record of a probe sequence of the hash table
+ *
+ * @return literal record - if the entry at the position is not empty,
+ *         NULL - otherwise (end of the probe sequence)
+ */
+lit_record_t *
+lit_hash_table_get_first (uint32_t *position_p) /**< [in] hash table key, [out] position of the entry */
+{
+  if (JERRY_CONTEXT (lit_hash_table_p) == NULL)
+  {
+    return NULL;
+  }
+
+  *position_p &= JERRY_CONTEXT (lit_hash_table_mask);
+  return lit_cpointer_decompress (JERRY_CONTEXT (lit_hash_table_p)[*position_p]);
+} /* lit_hash_table_get_first */
+
+/**
+ * Get the next literal record of a probe sequence of the hash table
+ *
+ * @return literal record - if the next entry is not empty,
+ *         NULL - otherwise (end of the probe sequence)
+ */
+lit_record_t *
+lit_hash_table_get_next (uint32_t *position_p) /**< [in, out] position of the entry */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (lit_hash_table_p) != NULL);
+
+  *position_p = (*position_p + 1) & JERRY_CONTEXT (lit_hash_table_mask);
+  return lit_cpointer_decompress (JERRY_CONTEXT (lit_hash_table_p)[*position_p]);
+} /* lit_hash_table_get_next */
 
 /**
  * Create charset record in the literal storage
@@ -30,17 +240,19 @@ lit_record_t *
 lit_create_charset_literal (const lit_utf8_byte_t *str_p, /**< string to be placed into the record */
                             const lit_utf8_size_t buf_size) /**< size in bytes of the buffer which holds the string */
 {
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_LITERAL, buf_size + LIT_CHARSET_HEADER_SIZE);
   lit_charset_record_t *rec_p = (lit_charset_record_t *) mem_heap_alloc_block (buf_size + LIT_CHARSET_HEADER_SIZE);
 
   rec_p->type = LIT_RECORD_TYPE_CHARSET;
-  rec_p->next = (uint16_t) lit_cpointer_compress (lit_storage);
-  lit_storage = (lit_record_t *) rec_p;
+  rec_p->next = lit_cpointer_compress (JERRY_CONTEXT (lit_storage));
+  JERRY_CONTEXT (lit_storage) = (lit_record_t *) rec_p;
 
   rec_p->hash = (uint8_t) lit_utf8_string_calc_hash (str_p, buf_size);
   rec_p->size = (uint16_t) buf_size;
   rec_p->length = (uint16_t) lit_utf8_string_length (str_p, buf_size);
   memcpy (rec_p + 1, str_p, buf_size);
 
+  lit_hash_table_add ((lit_record_t *) rec_p);
   return (lit_record_t *) rec_p;
 } /* lit_create_charset_literal */
 
@@ -52,13 +264,15 @@ lit_create_charset_literal (const lit_utf8_byte_t *str_p, /**< string to be plac
 lit_record_t *
 lit_create_magic_literal (const lit_magic_string_id_t id) /**< id of magic string */
 {
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_LITERAL, sizeof (lit_magic_record_t));
   lit_magic_record_t *rec_p = (lit_magic_record_t *) mem_heap_alloc_block (sizeof (lit_magic_record_t));
   rec_p->type = LIT_RECORD_TYPE_MAGIC_STR;
-  rec_p->next = (uint16_t) lit_cpointer_compress (lit_storage);
-  lit_storage = (lit_record_t *) rec_p;
+  rec_p->next = lit_cpointer_compress (JERRY_CONTEXT (lit_storage));
+  JERRY_CONTEXT (lit_storage) = (lit_record_t *) rec_p;
 
   rec_p->magic_id = (uint32_t) id;
 
+  lit_hash_table_add ((lit_record_t *) rec_p);
   return (lit_record_t *) rec_p;
 } /* lit_create_magic_literal */
 
@@ -70,13 +284,15 @@ lit_create_magic_literal (const lit_magic_string_id_t id) /**< id of magic strin
 lit_record_t *
 lit_create_magic_literal_ex (const lit_magic_string_ex_id_t id) /**< id of magic string */
 {
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_LITERAL, sizeof (lit_magic_record_t));
   lit_magic_record_t *rec_p = (lit_magic_record_t *) mem_heap_alloc_block (sizeof (lit_magic_record_t));
   rec_p->type = LIT_RECORD_TYPE_MAGIC_STR_EX;
-  rec_p->next = (uint16_t) lit_cpointer_compress (lit_storage);
-  lit_storage = (lit_record_t *) rec_p;
+  rec_p->next = lit_cpointer_compress (JERRY_CONTEXT (lit_storage));
+  JERRY_CONTEXT (lit_storage) = (lit_record_t *) rec_p;
 
   rec_p->magic_id = (uint32_t) id;
 
+  lit_hash_table_add ((lit_record_t *) rec_p);
   return (lit_record_t *) rec_p;
 } /* lit_create_magic_literal_ex */
 
@@ -88,14 +304,16 @@ lit_create_magic_literal_ex (const lit_magic_string_ex_id_t id) /**< id of magic
 lit_record_t *
 lit_create_number_literal (const ecma_number_t num) /**< numeric value */
 {
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_LITERAL, sizeof (lit_number_record_t));
   lit_number_record_t *rec_p = (lit_number_record_t *) mem_heap_alloc_block (sizeof (lit_number_record_t));
 
   rec_p->type = (uint8_t) LIT_RECORD_TYPE_NUMBER;
-  rec_p->next = (uint16_t) lit_cpointer_compress (lit_storage);
-  lit_storage = (lit_record_t *) rec_p;
+  rec_p->next = lit_cpointer_compress (JERRY_CONTEXT (lit_storage));
+  JERRY_CONTEXT (lit_storage) = (lit_record_t *) rec_p;
 
   rec_p->number = num;
 
+  lit_hash_table_add ((lit_record_t *) rec_p);
   return (lit_record_t *) rec_p;
 } /* lit_create_number_literal */
 
@@ -150,6 +368,7 @@ lit_record_t *
 lit_free_literal (lit_record_t *lit_p) /**< literal record */
 {
   lit_record_t *const ret_p = lit_cpointer_decompress (lit_p->next);
+  ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_LITERAL, lit_get_literal_size (lit_p));
   mem_heap_free_block (lit_p, lit_get_literal_size (lit_p));
   return ret_p;
 } /* lit_free_literal */
@@ -165,7 +384,7 @@ lit_count_literals ()
   uint32_t num = 0;
   lit_record_t *rec_p;
 
-  for (rec_p = lit_storage;
+  for (rec_p = JERRY_CONTEXT (lit_storage);
        rec_p != NULL;
        rec_p = lit_cpointer_decompress (rec_p->next))
   {
@@ -190,7 +409,7 @@ lit_dump_literals ()
 
   JERRY_DLOG ("LITERALS:\n");
 
-  for (rec_p = lit_storage;
+  for (rec_p = JERRY_CONTEXT (lit_storage);
        rec_p != NULL;
        rec_p = lit_cpointer_decompress (rec_p->next))
   {
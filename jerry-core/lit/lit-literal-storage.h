@@ -38,15 +38,10 @@ typedef enum
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  mem_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
 } lit_record_t;
 
-/**
- * Head pointer to literal storage
- */
-extern lit_record_t *lit_storage;
-
 typedef lit_record_t *lit_literal_t;
 
 /**
@@ -56,7 +51,7 @@ typedef lit_record_t *lit_literal_t;
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  mem_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
   uint8_t hash; /* Hash of the string */
   uint16_t size; /* Size of the string in bytes */
@@ -68,7 +63,7 @@ typedef struct
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  mem_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
   ecma_number_t number; /* Number stored in the record */
 } lit_number_record_t;
@@ -78,7 +73,7 @@ typedef struct
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  mem_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
   uint32_t magic_id; /* Magic ID stored in the record */
 } lit_magic_record_t;
@@ -90,6 +85,13 @@ extern lit_record_t *lit_create_magic_literal (const lit_magic_string_id_t);
 extern lit_record_t *lit_create_magic_literal_ex (const lit_magic_string_ex_id_t);
 extern lit_record_t *lit_create_number_literal (const ecma_number_t);
 extern lit_record_t *lit_free_literal (lit_record_t *);
+
+extern uint32_t lit_hash_table_get_string_key (const lit_utf8_byte_t *, lit_utf8_size_t);
+extern uint32_t lit_hash_table_get_number_key (ecma_number_t);
+extern void lit_hash_table_reserve (uint32_t);
+extern void lit_hash_table_free (void);
+extern lit_record_t *lit_hash_table_get_first (uint32_t *);
+extern lit_record_t *lit_hash_table_get_next (uint32_t *);
 extern size_t lit_get_literal_size (const lit_record_t *);
 
 extern uint32_t lit_count_literals ();
@@ -17,6 +17,7 @@
 #include "lit-literal.h"
 
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "lit-cpointer.h"
 #include "lit-magic-strings.h"
 #include "lit-literal-storage.h"
@@ -28,6 +29,19 @@
 void
 lit_init (void)
 {
+#ifndef JERRY_NDEBUG
+  /* The magic strings must be sorted by their sizes and characters, otherwise the binary search misses them. */
+  for (lit_magic_string_id_t id = (lit_magic_string_id_t) 0;
+       id < LIT_MAGIC_STRING__COUNT;
+       id = (lit_magic_string_id_t) (id + 1))
+  {
+    lit_magic_string_id_t found_id;
+
+    JERRY_ASSERT (lit_is_utf8_string_magic (lit_get_magic_string_utf8 (id), lit_get_magic_string_size (id), &found_id)
+                  && found_id == id);
+  }
+#endif /* !JERRY_NDEBUG */
+
   lit_magic_strings_ex_init ();
 } /* lit_init */
 
@@ -41,9 +55,12 @@ lit_finalize (void)
   lit_dump_literals ();
 #endif /* JERRY_ENABLE_LOG */
 
-  while (lit_storage)
+  lit_hash_table_free ();
+  lit_magic_strings_ex_finalize ();
+
+  while (JERRY_CONTEXT (lit_storage))
   {
-    lit_storage = lit_free_literal (lit_storage);
+    JERRY_CONTEXT (lit_storage) = lit_free_literal (JERRY_CONTEXT (lit_storage));
   }
 } /* lit_finalize */
 
@@ -61,35 +78,15 @@ lit_create_literal_from_utf8_string (const lit_utf8_byte_t *str_p, /**< string t
   JERRY_ASSERT (str_p || !str_size);
 
   lit_magic_string_id_t m_str_id;
-  for (m_str_id = (lit_magic_string_id_t) 0;
-       m_str_id < LIT_MAGIC_STRING__COUNT;
-       m_str_id = (lit_magic_string_id_t) (m_str_id + 1))
+  if (lit_is_utf8_string_magic (str_p, str_size, &m_str_id))
   {
-    if (lit_get_magic_string_size (m_str_id) != str_size)
-    {
-      continue;
-    }
-
-    if (!strncmp ((const char *) str_p, (const char *) lit_get_magic_string_utf8 (m_str_id), str_size))
-    {
-      return lit_create_magic_literal (m_str_id);
-    }
+    return lit_create_magic_literal (m_str_id);
   }
 
   lit_magic_string_ex_id_t m_str_ex_id;
-  for (m_str_ex_id = (lit_magic_string_ex_id_t) 0;
-       m_str_ex_id < lit_get_magic_string_ex_count ();
-       m_str_ex_id = (lit_magic_string_ex_id_t) (m_str_ex_id + 1))
+  if (lit_is_ex_utf8_string_magic (str_p, str_size, &m_str_ex_id))
   {
-    if (lit_get_magic_string_ex_size (m_str_ex_id) != str_size)
-    {
-      continue;
-    }
-
-    if (!strncmp ((const char *) str_p, (const char *) lit_get_magic_string_ex_utf8 (m_str_ex_id), str_size))
-    {
-      return lit_create_magic_literal_ex (m_str_ex_id);
-    }
+    return lit_create_magic_literal_ex (m_str_ex_id);
   }
 
   return lit_create_charset_literal (str_p, str_size);
@@ -108,12 +105,13 @@ lit_find_literal_by_utf8_string (const lit_utf8_byte_t *str_p, /**< a string to
   JERRY_ASSERT (str_p || !str_size);
 
   lit_string_hash_t str_hash = lit_utf8_string_calc_hash (str_p, str_size);
+  uint32_t position = lit_hash_table_get_string_key (str_p, str_size);
 
   lit_literal_t lit;
 
-  for (lit = lit_storage;
+  for (lit = lit_hash_table_get_first (&position);
        lit != NULL;
-       lit = lit_cpointer_decompress (lit->next))
+       lit = lit_hash_table_get_next (&position))
   {
     const lit_record_type_t type = (lit_record_type_t) lit->type;
 
@@ -243,10 +241,12 @@ lit_find_or_create_literal_from_num (ecma_number_t num) /**< number which a lite
 lit_literal_t
 lit_find_literal_by_num (const ecma_number_t num) /**< a number to search for */
 {
+  uint32_t position = lit_hash_table_get_number_key (num);
+
   lit_literal_t lit;
-  for (lit = lit_storage;
+  for (lit = lit_hash_table_get_first (&position);
        lit != NULL;
-       lit = lit_cpointer_decompress (lit->next))
+       lit = lit_hash_table_get_next (&position))
   {
     const lit_record_type_t type = (lit_record_type_t) lit->type;
 
@@ -257,7 +257,8 @@ lit_find_literal_by_num (const ecma_number_t num) /**< a number to search for */
 
     const ecma_number_t lit_num = lit_number_literal_get_number (lit);
 
-    if (lit_num == num)
+    /* The numbers are compared by their bit patterns, as the hash table keys are calculated from them. */
+    if (!memcmp (&lit_num, &num, sizeof (ecma_number_t)))
     {
       return lit;
     }
@@ -277,7 +278,7 @@ lit_literal_exists (lit_literal_t lit) /**< literal to check for existence */
 {
   lit_literal_t current_lit;
 
-  for (current_lit = lit_storage;
+  for (current_lit = JERRY_CONTEXT (lit_storage);
        current_lit != NULL;
        current_lit = lit_cpointer_decompress (current_lit->next))
   {
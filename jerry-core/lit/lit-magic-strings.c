@@ -15,26 +15,66 @@
 
 #include "lit-magic-strings.h"
 
+#include "ecma-alloc.h"
+#include "jcontext.h"
 #include "lit-strings.h"
 
-/**
- * External magic strings data array, count and lengths
- */
-static const lit_utf8_byte_t **lit_magic_string_ex_array = NULL;
-static uint32_t lit_magic_string_ex_count = 0;
-static const lit_utf8_size_t *lit_magic_string_ex_sizes = NULL;
-
 /**
  * Initialize external magic strings
  */
 void
 lit_magic_strings_ex_init (void)
 {
-  lit_magic_string_ex_array = NULL;
-  lit_magic_string_ex_count = 0;
-  lit_magic_string_ex_sizes = NULL;
+  JERRY_CONTEXT (lit_magic_string_ex_array) = NULL;
+  JERRY_CONTEXT (lit_magic_string_ex_count) = 0;
+  JERRY_CONTEXT (lit_magic_string_ex_sizes) = NULL;
+  JERRY_CONTEXT (lit_magic_string_ex_sorted_ids_p) = NULL;
 } /* lit_magic_strings_ex_init */
 
+/**
+ * Free the index of the external magic strings
+ */
+void
+lit_magic_strings_ex_finalize (void)
+{
+  if (JERRY_CONTEXT (lit_magic_string_ex_sorted_ids_p) != NULL)
+  {
+    const size_t size = JERRY_CONTEXT (lit_magic_string_ex_count) * sizeof (lit_magic_string_ex_id_t);
+
+    ECMA_ALLOC_STATS_REMOVE (ECMA_ALLOC_KIND_LITERAL, size);
+    mem_heap_free_block (JERRY_CONTEXT (lit_magic_string_ex_sorted_ids_p), size);
+  }
+
+  lit_magic_strings_ex_init ();
+} /* lit_magic_strings_ex_finalize */
+
+/**
+ * Compare an utf-8 string with a magic string in the order of the magic strings,
+ * i.e. by their sizes first and by their characters second
+ *
+ * @return a negative value - if the utf-8 string precedes the magic string,
+ *         zero - if the strings are equal,
+ *         a positive value - otherwise
+ */
+static int
+lit_magic_string_compare (const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                          lit_utf8_size_t string_size, /**< string size in bytes */
+                          const lit_utf8_byte_t *magic_string_p, /**< magic string */
+                          lit_utf8_size_t magic_string_size) /**< magic string size in bytes */
+{
+  if (string_size != magic_string_size)
+  {
+    return (string_size < magic_string_size) ? -1 : 1;
+  }
+
+  if (string_size == 0)
+  {
+    return 0;
+  }
+
+  return memcmp (string_p, magic_string_p, string_size);
+} /* lit_magic_string_compare */
+
 /**
  * Get number of external magic strings
  *
@@ -44,7 +84,7 @@ lit_magic_strings_ex_init (void)
 uint32_t
 lit_get_magic_string_ex_count (void)
 {
-  return lit_magic_string_ex_count;
+  return JERRY_CONTEXT (lit_magic_string_ex_count);
 } /* lit_get_magic_string_ex_count */
 
 /**
@@ -97,9 +137,9 @@ lit_get_magic_string_size (lit_magic_string_id_t id) /**< magic string id */
 const lit_utf8_byte_t *
 lit_get_magic_string_ex_utf8 (lit_magic_string_ex_id_t id) /**< extern magic string id */
 {
-  if (lit_magic_string_ex_array && id < lit_magic_string_ex_count)
+  if (JERRY_CONTEXT (lit_magic_string_ex_array) && id < JERRY_CONTEXT (lit_magic_string_ex_count))
   {
-    return lit_magic_string_ex_array[id];
+    return JERRY_CONTEXT (lit_magic_string_ex_array)[id];
   }
 
   JERRY_UNREACHABLE ();
@@ -113,7 +153,7 @@ lit_get_magic_string_ex_utf8 (lit_magic_string_ex_id_t id) /**< extern magic str
 lit_utf8_size_t
 lit_get_magic_string_ex_size (lit_magic_string_ex_id_t id) /**< external magic string id */
 {
-  return lit_magic_string_ex_sizes[id];
+  return JERRY_CONTEXT (lit_magic_string_ex_sizes)[id];
 } /* lit_get_magic_string_ex_size */
 
 /**
@@ -129,22 +169,49 @@ lit_magic_strings_ex_set (const lit_utf8_byte_t **ex_str_items, /**< character a
   JERRY_ASSERT (count > 0);
   JERRY_ASSERT (ex_str_sizes != NULL);
 
-  JERRY_ASSERT (lit_magic_string_ex_array == NULL);
-  JERRY_ASSERT (lit_magic_string_ex_count == 0);
-  JERRY_ASSERT (lit_magic_string_ex_sizes == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_array) == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_count) == 0);
+  JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_sizes) == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_sorted_ids_p) == NULL);
 
   /* Set external magic strings information */
-  lit_magic_string_ex_array = ex_str_items;
-  lit_magic_string_ex_count = count;
-  lit_magic_string_ex_sizes = ex_str_sizes;
+  JERRY_CONTEXT (lit_magic_string_ex_array) = ex_str_items;
+  JERRY_CONTEXT (lit_magic_string_ex_count) = count;
+  JERRY_CONTEXT (lit_magic_string_ex_sizes) = ex_str_sizes;
+
+  /* The identifiers are sorted in the order of the built-in magic strings, so
+   * the external magic strings can be looked up by binary search as well. */
+  const size_t sorted_ids_size = count * sizeof (lit_magic_string_ex_id_t);
+  lit_magic_string_ex_id_t *sorted_ids_p = (lit_magic_string_ex_id_t *) mem_heap_alloc_block (sorted_ids_size);
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_LITERAL, sorted_ids_size);
+
+  for (lit_magic_string_ex_id_t id = (lit_magic_string_ex_id_t) 0; id < count; id++)
+  {
+    uint32_t position = id;
+
+    while (position > 0
+           && lit_magic_string_compare (ex_str_items[id],
+                                        ex_str_sizes[id],
+                                        ex_str_items[sorted_ids_p[position - 1]],
+                                        ex_str_sizes[sorted_ids_p[position - 1]]) < 0)
+    {
+      sorted_ids_p[position] = sorted_ids_p[position - 1];
+      position--;
+    }
+
+    sorted_ids_p[position] = id;
+  }
+
+  JERRY_CONTEXT (lit_magic_string_ex_sorted_ids_p) = sorted_ids_p;
 
 #ifndef JERRY_NDEBUG
   for (lit_magic_string_ex_id_t id = (lit_magic_string_ex_id_t) 0;
-       id < lit_magic_string_ex_count;
+       id < JERRY_CONTEXT (lit_magic_string_ex_count);
        id = (lit_magic_string_ex_id_t) (id + 1))
   {
-    JERRY_ASSERT (lit_magic_string_ex_sizes[id] == lit_zt_utf8_string_size (lit_get_magic_string_ex_utf8 (id)));
-    JERRY_ASSERT (lit_magic_string_ex_sizes[id] <= LIT_MAGIC_STRING_LENGTH_LIMIT);
+    JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_sizes)[id]
+                  == lit_zt_utf8_string_size (lit_get_magic_string_ex_utf8 (id)));
+    JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_sizes)[id] <= LIT_MAGIC_STRING_LENGTH_LIMIT);
   }
 #endif /* !JERRY_NDEBUG */
 } /* lit_magic_strings_ex_set */
@@ -162,21 +229,41 @@ lit_is_utf8_string_magic (const lit_utf8_byte_t *string_p, /**< utf-8 string */
                           lit_utf8_size_t string_size, /**< string size in bytes */
                           lit_magic_string_id_t *out_id_p) /**< [out] magic string's id */
 {
-  /* TODO: Improve performance of search */
+  *out_id_p = LIT_MAGIC_STRING__COUNT;
 
-  for (lit_magic_string_id_t id = (lit_magic_string_id_t) 0;
-       id < LIT_MAGIC_STRING__COUNT;
-       id = (lit_magic_string_id_t) (id + 1))
+  if (string_size > LIT_MAGIC_STRING_LENGTH_LIMIT)
   {
-    if (lit_compare_utf8_string_and_magic_string (string_p, string_size, id))
+    return false;
+  }
+
+  /* The magic strings are sorted by their sizes and characters (see lit-magic-strings.inc.h). */
+  uint32_t lower = 0;
+  uint32_t upper = LIT_MAGIC_STRING__COUNT;
+
+  while (lower < upper)
+  {
+    const lit_magic_string_id_t id = (lit_magic_string_id_t) ((lower + upper) / 2);
+    const int order = lit_magic_string_compare (string_p,
+                                                string_size,
+                                                lit_get_magic_string_utf8 (id),
+                                                lit_get_magic_string_size (id));
+
+    if (order == 0)
     {
       *out_id_p = id;
 
       return true;
     }
-  }
 
-  *out_id_p = LIT_MAGIC_STRING__COUNT;
+    if (order < 0)
+    {
+      upper = id;
+    }
+    else
+    {
+      lower = (uint32_t) id + 1;
+    }
+  }
 
   return false;
 } /* lit_is_utf8_string_magic */
@@ -192,21 +279,42 @@ bool lit_is_ex_utf8_string_magic (const lit_utf8_byte_t *string_p, /**< utf-8 st
                                   lit_utf8_size_t string_size, /**< string size in bytes */
                                   lit_magic_string_ex_id_t *out_id_p) /**< [out] magic string's id */
 {
-  /* TODO: Improve performance of search */
+  *out_id_p = JERRY_CONTEXT (lit_magic_string_ex_count);
 
-  for (lit_magic_string_ex_id_t id = (lit_magic_string_ex_id_t) 0;
-       id < lit_magic_string_ex_count;
-       id = (lit_magic_string_ex_id_t) (id + 1))
+  if (string_size > LIT_MAGIC_STRING_LENGTH_LIMIT)
+  {
+    return false;
+  }
+
+  const lit_magic_string_ex_id_t *sorted_ids_p = JERRY_CONTEXT (lit_magic_string_ex_sorted_ids_p);
+  uint32_t lower = 0;
+  uint32_t upper = JERRY_CONTEXT (lit_magic_string_ex_count);
+
+  while (lower < upper)
   {
-    if (lit_compare_utf8_string_and_magic_string_ex (string_p, string_size, id))
+    const uint32_t middle = (lower + upper) / 2;
+    const lit_magic_string_ex_id_t id = sorted_ids_p[middle];
+    const int order = lit_magic_string_compare (string_p,
+                                                string_size,
+                                                lit_get_magic_string_ex_utf8 (id),
+                                                lit_get_magic_string_ex_size (id));
+
+    if (order == 0)
     {
       *out_id_p = id;
 
       return true;
     }
-  }
 
-  *out_id_p = lit_magic_string_ex_count;
+    if (order < 0)
+    {
+      upper = middle;
+    }
+    else
+    {
+      lower = middle + 1;
+    }
+  }
 
   return false;
 } /* lit_is_ex_utf8_string_magic */
@@ -16,6 +16,7 @@
 
 #include "lit-snapshot.h"
 
+#include "jcontext.h"
 #include "lit-literal.h"
 #include "lit-literal-storage.h"
 
@@ -165,7 +166,7 @@ lit_save_literals_for_snapshot (uint8_t *buffer_p, /**< [out] output snapshot bu
     uint32_t literal_index = 0;
     lit_literal_t lit;
 
-    for (lit = lit_storage;
+    for (lit = JERRY_CONTEXT (lit_storage);
          lit != NULL;
          lit = lit_cpointer_decompress (lit->next))
     {
@@ -282,6 +283,14 @@ lit_load_literals_from_snapshot (const uint8_t *lit_table_p, /**< buffer with li
     return true;
   }
 
+  /* Each literal record occupies at least one byte of the literal table. */
+  if (literals_num > lit_table_size)
+  {
+    return false;
+  }
+
+  lit_hash_table_reserve (JERRY_CONTEXT (lit_hash_table_count) + literals_num);
+
   size_t id_map_size = sizeof (lit_mem_to_snapshot_id_map_entry_t) * literals_num;
   lit_mem_to_snapshot_id_map_entry_t *id_map_p;
   id_map_p = (lit_mem_to_snapshot_id_map_entry_t *) mem_heap_alloc_block_store_size (id_map_size);
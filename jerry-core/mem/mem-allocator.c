@@ -20,6 +20,7 @@
 
 #include "jrt.h"
 #include "jrt-libc-includes.h"
+#include "jcontext.h"
 #include "mem-allocator.h"
 #include "mem-heap.h"
 #include "mem-poolman.h"
@@ -27,11 +28,6 @@
 #define MEM_ALLOCATOR_INTERNAL
 #include "mem-allocator-internal.h"
 
-/**
- * The 'try to give memory back' callback
- */
-static mem_try_give_memory_back_callback_t mem_try_give_memory_back_callback = NULL;
-
 /**
  * Initialize memory allocators.
  */
@@ -94,9 +90,9 @@ void
 mem_register_a_try_give_memory_back_callback (mem_try_give_memory_back_callback_t callback) /* callback routine */
 {
   /* Currently only one callback is supported */
-  JERRY_ASSERT (mem_try_give_memory_back_callback == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_try_give_memory_back_callback) == NULL);
 
-  mem_try_give_memory_back_callback = callback;
+  JERRY_CONTEXT (mem_try_give_memory_back_callback) = callback;
 } /* mem_register_a_try_give_memory_back_callback */
 
 /**
@@ -106,9 +102,9 @@ void
 mem_unregister_a_try_give_memory_back_callback (mem_try_give_memory_back_callback_t callback) /* callback routine */
 {
   /* Currently only one callback is supported */
-  JERRY_ASSERT (mem_try_give_memory_back_callback == callback);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_try_give_memory_back_callback) == callback);
 
-  mem_try_give_memory_back_callback = NULL;
+  JERRY_CONTEXT (mem_try_give_memory_back_callback) = NULL;
 } /* mem_unregister_a_try_give_memory_back_callback */
 
 /**
@@ -118,9 +114,9 @@ void
 mem_run_try_to_give_memory_back_callbacks (mem_try_give_memory_back_severity_t severity) /**< severity of
                                                                                               the request */
 {
-  if (mem_try_give_memory_back_callback != NULL)
+  if (JERRY_CONTEXT (mem_try_give_memory_back_callback) != NULL)
   {
-    mem_try_give_memory_back_callback (severity);
+    JERRY_CONTEXT (mem_try_give_memory_back_callback) (severity);
   }
 
   mem_pools_collect_empty ();
@@ -24,6 +24,7 @@
 #include "mem-allocator.h"
 #include "mem-config.h"
 #include "mem-heap.h"
+#include "jcontext.h"
 
 #define MEM_ALLOCATOR_INTERNAL
 #include "mem-allocator-internal.h"
@@ -89,133 +90,508 @@ void mem_heap_valgrind_freya_mempool_request (void)
 # define VALGRIND_FREYA_FREELIKE_SPACE(p)
 #endif /* JERRY_VALGRIND_FREYA */
 
-/* Calculate heap area size, leaving space for a pointer to the free list */
-#define MEM_HEAP_AREA_SIZE (MEM_HEAP_SIZE - MEM_ALIGNMENT)
-#define MEM_HEAP_END_OF_LIST ((mem_heap_free_t *const) ~((uint32_t) 0x0))
-
-/**
- *  Free region node
- */
-typedef struct
-{
-  uint32_t next_offset; /* Offset of next region in list */
-  uint32_t size; /* Size of region */
-} mem_heap_free_t;
-
-#if UINTPTR_MAX > UINT32_MAX
-#define MEM_HEAP_GET_OFFSET_FROM_ADDR(p) ((uint32_t) ((uint8_t *) (p) - (uint8_t *) mem_heap.area))
-#define MEM_HEAP_GET_ADDR_FROM_OFFSET(u) ((mem_heap_free_t *) &mem_heap.area[u])
-#else /* UINTPTR_MAX <= UINT32_MAX */
-/* In this case we simply store the pointer, since it fits anyway. */
-#define MEM_HEAP_GET_OFFSET_FROM_ADDR(p) ((uint32_t) (p))
-#define MEM_HEAP_GET_ADDR_FROM_OFFSET(u) ((mem_heap_free_t *)(u))
-#endif /* UINTPTR_MAX > UINT32_MAX */
-
-/**
- * Get end of region
+/*
+ * The free blocks are kept in segregated free lists:
+ *
+ *  - small lists: one list for each size between MEM_ALIGNMENT and MEM_HEAP_SMALL_BLOCK_LIMIT
+ *    (every block of a small list has the same size, so the first one always fits),
+ *  - large lists: one list for each power of two range above MEM_HEAP_SMALL_BLOCK_LIMIT.
+ *
+ * The lists are doubly linked, so blocks can be removed from any position, and a bit
+ * map of the non-empty lists locates the smallest suitable list with one bit search.
+ *
+ * Neighbouring free blocks are always merged. A bit map with one bit for each
+ * MEM_ALIGNMENT sized unit of the heap area tells which units are free, so the
+ * neighbours of a freed block are found without walking the lists. Since the
+ * allocated blocks have no headers, the size of a free block is stored after
+ * its list links and also in its last unit:
+ *
+ *   block size == MEM_ALIGNMENT: | next_offset prev_offset |
+ *   block size >  MEM_ALIGNMENT: | next_offset prev_offset | size . | ... | size . |
+ *
+ * The size of a block which occupies a single unit is not stored: the unit after
+ * it is never free, because otherwise it would have been merged with the block.
  */
-static inline mem_heap_free_t *  __attr_always_inline___ __attr_pure___
-mem_heap_get_region_end (mem_heap_free_t *curr_p) /**< current region */
-{
-  return (mem_heap_free_t *)((uint8_t *) curr_p + curr_p->size);
-} /* mem_heap_get_region_end */
 
-/**
- * Heap structure
- */
-typedef struct
-{
-  /** First node in free region list */
-  mem_heap_free_t first;
+JERRY_STATIC_ASSERT ((1u << MEM_HEAP_SMALL_BLOCK_LIMIT_LOG) == MEM_HEAP_SMALL_BLOCK_LIMIT,
+                     mem_heap_small_block_limit_log_must_be_the_logarithm_of_small_block_limit);
 
-  /**
-   * Heap area
-   */
-  uint8_t area[MEM_HEAP_AREA_SIZE] __attribute__ ((aligned (MEM_ALIGNMENT)));
-} mem_heap_t;
+JERRY_STATIC_ASSERT (MEM_HEAP_LARGE_LIST_COUNT <= 32,
+                     mem_heap_large_lists_must_fit_into_a_32_bit_map);
 
 /**
- * Heap
+ * Number of MEM_ALIGNMENT sized units in the heap area
  */
-#ifndef JERRY_HEAP_SECTION_ATTR
-mem_heap_t mem_heap;
-#else /* JERRY_HEAP_SECTION_ATTR */
-mem_heap_t mem_heap __attribute__ ((section (JERRY_HEAP_SECTION_ATTR)));
-#endif /* !JERRY_HEAP_SECTION_ATTR */
+#define MEM_HEAP_UNIT_COUNT ((uint32_t) (MEM_HEAP_AREA_SIZE / MEM_ALIGNMENT))
 
 /**
- * Check size of heap is corresponding to configuration
+ * Offset which marks the end of a free list
  */
-JERRY_STATIC_ASSERT (sizeof (mem_heap) <= MEM_HEAP_SIZE,
-                     size_of_mem_heap_must_be_less_than_or_equal_to_MEM_HEAP_SIZE);
+#define MEM_HEAP_END_OF_LIST (~((uint32_t) 0x0))
 
 /**
- * Size of allocated regions
+ *  Free region node
  */
-size_t mem_heap_allocated_size;
+typedef struct
+{
+  uint32_t next_offset; /* Offset of next region in list */
+  uint32_t prev_offset; /* Offset of previous region in list */
+} mem_heap_free_t;
 
 /**
- * Current limit of heap usage, that is upon being reached, causes call of "try give memory back" callbacks
+ * Header of a block allocated by mem_heap_alloc_block_store_size
  */
-size_t mem_heap_limit;
+typedef struct
+{
+  uint32_t size; /**< size of the block including the header */
+  uint32_t unused; /**< keeps the data aligned to MEM_ALIGNMENT */
+} mem_heap_size_header_t;
 
-/* This is used to speed up deallocation. */
-mem_heap_free_t *mem_heap_list_skip_p;
+#define MEM_HEAP_GET_OFFSET_FROM_ADDR(p) ((uint32_t) ((uint8_t *) (p) - (uint8_t *) JERRY_HEAP_CONTEXT (area)))
+#define MEM_HEAP_GET_ADDR_FROM_OFFSET(u) ((mem_heap_free_t *) &JERRY_HEAP_CONTEXT (area)[u])
 
 #ifdef MEM_STATS
-/**
- * Heap's memory usage statistics
- */
-static mem_heap_stats_t mem_heap_stats;
-
 static void mem_heap_stat_init (void);
 static void mem_heap_stat_alloc (size_t num);
 static void mem_heap_stat_free (size_t num);
-static void mem_heap_stat_skip ();
-static void mem_heap_stat_nonskip ();
 static void mem_heap_stat_alloc_iter ();
 static void mem_heap_stat_free_iter ();
 
 #  define MEM_HEAP_STAT_INIT() mem_heap_stat_init ()
 #  define MEM_HEAP_STAT_ALLOC(v1) mem_heap_stat_alloc (v1)
 #  define MEM_HEAP_STAT_FREE(v1) mem_heap_stat_free (v1)
-#  define MEM_HEAP_STAT_SKIP() mem_heap_stat_skip ()
-#  define MEM_HEAP_STAT_NONSKIP() mem_heap_stat_nonskip ()
 #  define MEM_HEAP_STAT_ALLOC_ITER() mem_heap_stat_alloc_iter ()
 #  define MEM_HEAP_STAT_FREE_ITER() mem_heap_stat_free_iter ()
 #else /* !MEM_STATS */
 #  define MEM_HEAP_STAT_INIT()
 #  define MEM_HEAP_STAT_ALLOC(v1)
 #  define MEM_HEAP_STAT_FREE(v1)
-#  define MEM_HEAP_STAT_SKIP()
-#  define MEM_HEAP_STAT_NONSKIP()
 #  define MEM_HEAP_STAT_ALLOC_ITER()
 #  define MEM_HEAP_STAT_FREE_ITER()
 #endif /* MEM_STATS */
 
+/**
+ * Get the index of the first unit of a region
+ *
+ * @return unit index
+ */
+static inline uint32_t __attr_always_inline___ __attr_pure___
+mem_heap_get_unit_index (const void *region_p) /**< region */
+{
+  return (uint32_t) (((const uint8_t *) region_p - JERRY_HEAP_CONTEXT (area)) >> MEM_ALIGNMENT_LOG);
+} /* mem_heap_get_unit_index */
+
+/**
+ * Get the region which starts at a unit
+ *
+ * @return region
+ */
+static inline mem_heap_free_t * __attr_always_inline___ __attr_pure___
+mem_heap_get_unit_region (uint32_t unit_index) /**< unit index */
+{
+  return (mem_heap_free_t *) (JERRY_HEAP_CONTEXT (area) + ((size_t) unit_index << MEM_ALIGNMENT_LOG));
+} /* mem_heap_get_unit_region */
+
+/**
+ * Check whether a unit of the heap area is free
+ *
+ * @return true - if the unit is part of a free region,
+ *         false - otherwise
+ */
+static inline bool __attr_always_inline___
+mem_heap_is_free_unit (uint32_t unit_index) /**< unit index */
+{
+  JERRY_ASSERT (unit_index < MEM_HEAP_UNIT_COUNT);
+
+  return (JERRY_HEAP_CONTEXT (free_map)[unit_index >> 5] & (1u << (unit_index & 0x1f))) != 0;
+} /* mem_heap_is_free_unit */
+
+/**
+ * Mark a range of units as free or allocated
+ */
+static void
+mem_heap_mark_units (uint32_t unit_index, /**< index of the first unit */
+                     uint32_t unit_count, /**< number of units */
+                     bool is_free) /**< true - if the units are free,
+                                    *   false - if they are allocated */
+{
+  JERRY_ASSERT (unit_count > 0 && unit_index + unit_count <= MEM_HEAP_UNIT_COUNT);
+
+  uint32_t end_index = unit_index + unit_count;
+
+  while (unit_index < end_index)
+  {
+    uint32_t bit_index = unit_index & 0x1f;
+    uint32_t bit_count = JERRY_MIN (32 - bit_index, end_index - unit_index);
+    uint32_t mask = ((bit_count == 32) ? ~((uint32_t) 0x0) : ((1u << bit_count) - 1)) << bit_index;
+
+    if (is_free)
+    {
+      JERRY_HEAP_CONTEXT (free_map)[unit_index >> 5] |= mask;
+    }
+    else
+    {
+      JERRY_HEAP_CONTEXT (free_map)[unit_index >> 5] &= ~mask;
+    }
+
+    unit_index += bit_count;
+  }
+} /* mem_heap_mark_units */
+
+/**
+ * Get the size of a free region
+ *
+ * @return size of the region
+ */
+static uint32_t
+mem_heap_get_region_size (const mem_heap_free_t *region_p) /**< free region */
+{
+  uint32_t unit_index = mem_heap_get_unit_index (region_p);
+
+  JERRY_ASSERT (mem_heap_is_free_unit (unit_index));
+
+  if (unit_index + 1 == MEM_HEAP_UNIT_COUNT || !mem_heap_is_free_unit (unit_index + 1))
+  {
+    return MEM_ALIGNMENT;
+  }
+
+  const uint32_t *size_p = (const uint32_t *) (region_p + 1);
+
+  VALGRIND_DEFINED_SPACE (size_p, sizeof (uint32_t));
+  uint32_t size = *size_p;
+  VALGRIND_NOACCESS_SPACE (size_p, sizeof (uint32_t));
+
+  JERRY_ASSERT (size > MEM_ALIGNMENT && size % MEM_ALIGNMENT == 0);
+  return size;
+} /* mem_heap_get_region_size */
+
+/**
+ * Get the free region which ends at a unit
+ *
+ * @return free region
+ */
+static mem_heap_free_t *
+mem_heap_get_region_from_last_unit (uint32_t unit_index) /**< index of the last unit of the region */
+{
+  JERRY_ASSERT (mem_heap_is_free_unit (unit_index));
+
+  if (unit_index == 0 || !mem_heap_is_free_unit (unit_index - 1))
+  {
+    return mem_heap_get_unit_region (unit_index);
+  }
+
+  const uint32_t *size_p = (const uint32_t *) mem_heap_get_unit_region (unit_index);
+
+  VALGRIND_DEFINED_SPACE (size_p, sizeof (uint32_t));
+  uint32_t size = *size_p;
+  VALGRIND_NOACCESS_SPACE (size_p, sizeof (uint32_t));
+
+  JERRY_ASSERT (size > MEM_ALIGNMENT && size % MEM_ALIGNMENT == 0);
+  return mem_heap_get_unit_region (unit_index + 1 - (size >> MEM_ALIGNMENT_LOG));
+} /* mem_heap_get_region_from_last_unit */
+
+/**
+ * Get the index of the free list which contains the regions of the given size
+ *
+ * @return list index
+ */
+static inline uint32_t __attr_always_inline___ __attr_const___
+mem_heap_get_list_index (uint32_t size) /**< region size */
+{
+  JERRY_ASSERT (size >= MEM_ALIGNMENT && size % MEM_ALIGNMENT == 0);
+
+  if (size <= MEM_HEAP_SMALL_BLOCK_LIMIT)
+  {
+    return (size >> MEM_ALIGNMENT_LOG) - 1;
+  }
+
+  /* Index of the highest set bit. */
+  uint32_t size_log = 31 - (uint32_t) __builtin_clz (size);
+
+  JERRY_ASSERT (size_log >= MEM_HEAP_SMALL_BLOCK_LIMIT_LOG
+                && size_log - MEM_HEAP_SMALL_BLOCK_LIMIT_LOG < MEM_HEAP_LARGE_LIST_COUNT);
+
+  return MEM_HEAP_SMALL_LIST_COUNT + size_log - MEM_HEAP_SMALL_BLOCK_LIMIT_LOG;
+} /* mem_heap_get_list_index */
+
+/**
+ * Set or clear the bit of a free list in the map of non-empty lists
+ */
+static inline void __attr_always_inline___
+mem_heap_update_list_map (uint32_t list_index) /**< list index */
+{
+  bool is_empty = (JERRY_HEAP_CONTEXT (list_first_offset)[list_index] == MEM_HEAP_END_OF_LIST);
+  uint32_t *map_p = &JERRY_HEAP_CONTEXT (small_list_map);
+
+  if (list_index >= MEM_HEAP_SMALL_LIST_COUNT)
+  {
+    map_p = &JERRY_HEAP_CONTEXT (large_list_map);
+    list_index -= MEM_HEAP_SMALL_LIST_COUNT;
+  }
+
+  if (is_empty)
+  {
+    *map_p &= ~(1u << list_index);
+  }
+  else
+  {
+    *map_p |= 1u << list_index;
+  }
+} /* mem_heap_update_list_map */
+
+/**
+ * Insert a free region into its free list and store its size
+ *
+ * Note:
+ *      the units of the region must be marked as free
+ */
+static void
+mem_heap_insert_region (mem_heap_free_t *region_p, /**< free region */
+                        uint32_t size) /**< size of the region */
+{
+  const uint32_t list_index = mem_heap_get_list_index (size);
+  const uint32_t next_offset = JERRY_HEAP_CONTEXT (list_first_offset)[list_index];
+  const uint32_t region_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (region_p);
+
+  JERRY_ASSERT (mem_is_heap_pointer (region_p));
+
+  VALGRIND_DEFINED_SPACE (region_p, sizeof (mem_heap_free_t));
+  region_p->next_offset = next_offset;
+  region_p->prev_offset = MEM_HEAP_END_OF_LIST;
+  VALGRIND_NOACCESS_SPACE (region_p, sizeof (mem_heap_free_t));
+
+  if (size > MEM_ALIGNMENT)
+  {
+    uint32_t *first_size_p = (uint32_t *) (region_p + 1);
+    uint32_t *last_size_p = (uint32_t *) ((uint8_t *) region_p + size - MEM_ALIGNMENT);
+
+    VALGRIND_DEFINED_SPACE (first_size_p, sizeof (uint32_t));
+    VALGRIND_DEFINED_SPACE (last_size_p, sizeof (uint32_t));
+    *first_size_p = size;
+    *last_size_p = size;
+    VALGRIND_NOACCESS_SPACE (first_size_p, sizeof (uint32_t));
+    VALGRIND_NOACCESS_SPACE (last_size_p, sizeof (uint32_t));
+  }
+
+  if (next_offset != MEM_HEAP_END_OF_LIST)
+  {
+    mem_heap_free_t *const next_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset);
+
+    VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
+    next_p->prev_offset = region_offset;
+    VALGRIND_NOACCESS_SPACE (next_p, sizeof (mem_heap_free_t));
+  }
+
+  JERRY_HEAP_CONTEXT (list_first_offset)[list_index] = region_offset;
+  mem_heap_update_list_map (list_index);
+} /* mem_heap_insert_region */
+
+/**
+ * Remove a free region from its free list
+ */
+static void
+mem_heap_remove_region (mem_heap_free_t *region_p, /**< free region */
+                        uint32_t size) /**< size of the region */
+{
+  const uint32_t list_index = mem_heap_get_list_index (size);
+
+  VALGRIND_DEFINED_SPACE (region_p, sizeof (mem_heap_free_t));
+  const uint32_t next_offset = region_p->next_offset;
+  const uint32_t prev_offset = region_p->prev_offset;
+  VALGRIND_NOACCESS_SPACE (region_p, sizeof (mem_heap_free_t));
+
+  if (prev_offset == MEM_HEAP_END_OF_LIST)
+  {
+    JERRY_ASSERT (JERRY_HEAP_CONTEXT (list_first_offset)[list_index] == MEM_HEAP_GET_OFFSET_FROM_ADDR (region_p));
+
+    JERRY_HEAP_CONTEXT (list_first_offset)[list_index] = next_offset;
+    mem_heap_update_list_map (list_index);
+  }
+  else
+  {
+    mem_heap_free_t *const prev_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (prev_offset);
+
+    VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
+    prev_p->next_offset = next_offset;
+    VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
+  }
+
+  if (next_offset != MEM_HEAP_END_OF_LIST)
+  {
+    mem_heap_free_t *const next_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset);
+
+    VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
+    next_p->prev_offset = prev_offset;
+    VALGRIND_NOACCESS_SPACE (next_p, sizeof (mem_heap_free_t));
+  }
+} /* mem_heap_remove_region */
+
+/**
+ * Get the first region of the smallest non-empty list after the given list
+ *
+ * @return region - if there is a non-empty list after the given one,
+ *         NULL - otherwise
+ */
+static mem_heap_free_t *
+mem_heap_find_larger_region (uint32_t list_index) /**< list index */
+{
+  uint32_t found_index;
+
+  if (list_index + 1 < MEM_HEAP_SMALL_LIST_COUNT
+      && (JERRY_HEAP_CONTEXT (small_list_map) >> (list_index + 1)) != 0)
+  {
+    found_index = list_index + 1 + (uint32_t) __builtin_ctz (JERRY_HEAP_CONTEXT (small_list_map) >> (list_index + 1));
+  }
+  else
+  {
+    uint32_t large_index = 0;
+
+    if (list_index + 1 > MEM_HEAP_SMALL_LIST_COUNT)
+    {
+      large_index = list_index + 1 - MEM_HEAP_SMALL_LIST_COUNT;
+    }
+
+    if (large_index >= MEM_HEAP_LARGE_LIST_COUNT
+        || (JERRY_HEAP_CONTEXT (large_list_map) >> large_index) == 0)
+    {
+      return NULL;
+    }
+
+    found_index = (MEM_HEAP_SMALL_LIST_COUNT + large_index
+                   + (uint32_t) __builtin_ctz (JERRY_HEAP_CONTEXT (large_list_map) >> large_index));
+  }
+
+  JERRY_ASSERT (JERRY_HEAP_CONTEXT (list_first_offset)[found_index] != MEM_HEAP_END_OF_LIST);
+  return MEM_HEAP_GET_ADDR_FROM_OFFSET (JERRY_HEAP_CONTEXT (list_first_offset)[found_index]);
+} /* mem_heap_find_larger_region */
+
+/**
+ * Allocate the first units of a free region
+ *
+ * The remaining units of the region are inserted into a free list.
+ */
+static void
+mem_heap_take_region (mem_heap_free_t *region_p, /**< free region */
+                      uint32_t region_size, /**< size of the region */
+                      uint32_t required_size) /**< number of bytes to allocate */
+{
+  JERRY_ASSERT (region_size >= required_size);
+
+  mem_heap_remove_region (region_p, region_size);
+
+  // Region was larger than necessary
+  if (region_size > required_size)
+  {
+    mem_heap_insert_region ((mem_heap_free_t *) ((uint8_t *) region_p + required_size),
+                            region_size - required_size);
+  }
+
+  mem_heap_mark_units (mem_heap_get_unit_index (region_p), required_size >> MEM_ALIGNMENT_LOG, false);
+} /* mem_heap_take_region */
+
+/**
+ * Free the units of an allocated block, and merge them with the neighbouring free regions
+ */
+static void
+mem_heap_release_units (mem_heap_free_t *block_p, /**< first unit of the block */
+                        uint32_t block_size) /**< size of the block */
+{
+  const uint32_t first_unit_index = mem_heap_get_unit_index (block_p);
+  const uint32_t end_unit_index = first_unit_index + (block_size >> MEM_ALIGNMENT_LOG);
+  const uint32_t unit_count = block_size >> MEM_ALIGNMENT_LOG;
+
+  JERRY_ASSERT (end_unit_index <= MEM_HEAP_UNIT_COUNT);
+  JERRY_ASSERT (!mem_heap_is_free_unit (first_unit_index));
+  JERRY_ASSERT (!mem_heap_is_free_unit (end_unit_index - 1));
+
+  // Merge with the previous region
+  if (first_unit_index > 0 && mem_heap_is_free_unit (first_unit_index - 1))
+  {
+    mem_heap_free_t *const prev_p = mem_heap_get_region_from_last_unit (first_unit_index - 1);
+    const uint32_t prev_size = mem_heap_get_region_size (prev_p);
+
+    mem_heap_remove_region (prev_p, prev_size);
+
+    block_p = prev_p;
+    block_size += prev_size;
+    MEM_HEAP_STAT_FREE_ITER ();
+  }
+
+  // Merge with the next region
+  if (end_unit_index < MEM_HEAP_UNIT_COUNT && mem_heap_is_free_unit (end_unit_index))
+  {
+    mem_heap_free_t *const next_p = mem_heap_get_unit_region (end_unit_index);
+    const uint32_t next_size = mem_heap_get_region_size (next_p);
+
+    mem_heap_remove_region (next_p, next_size);
+
+    block_size += next_size;
+    MEM_HEAP_STAT_FREE_ITER ();
+  }
+
+  mem_heap_mark_units (first_unit_index, unit_count, true);
+  mem_heap_insert_region (block_p, block_size);
+} /* mem_heap_release_units */
+
+/**
+ * Find the first free unit in a range of units
+ *
+ * @return index of the free unit - if there is a free unit in the range,
+ *         end_index - otherwise
+ */
+static uint32_t
+mem_heap_find_free_unit (uint32_t unit_index, /**< first unit of the range */
+                         uint32_t end_index) /**< end of the range */
+{
+  JERRY_ASSERT (end_index <= MEM_HEAP_UNIT_COUNT);
+
+  while (unit_index < end_index)
+  {
+    uint32_t bits = JERRY_HEAP_CONTEXT (free_map)[unit_index >> 5] >> (unit_index & 0x1f);
+
+    if (bits != 0)
+    {
+      unit_index += (uint32_t) __builtin_ctz (bits);
+      return JERRY_MIN (unit_index, end_index);
+    }
+
+    unit_index = (unit_index | 0x1f) + 1;
+  }
+
+  return end_index;
+} /* mem_heap_find_free_unit */
+
 /**
  * Startup initialization of heap
  */
 void
 mem_heap_init (void)
 {
-  JERRY_STATIC_ASSERT ((uintptr_t) mem_heap.area % MEM_ALIGNMENT == 0,
+  JERRY_STATIC_ASSERT (offsetof (mem_heap_t, area) % MEM_ALIGNMENT == 0,
                        mem_heap_area_must_be_multiple_of_MEM_ALIGNMENT);
 
   JERRY_STATIC_ASSERT ((1u << MEM_HEAP_OFFSET_LOG) >= MEM_HEAP_SIZE,
                        two_pow_mem_heap_offset_should_not_be_less_than_mem_heap_size);
 
-  mem_heap_allocated_size = 0;
-  mem_heap_limit = CONFIG_MEM_HEAP_DESIRED_LIMIT;
-  mem_heap.first.size = 0;
-  mem_heap_free_t *const region_p = (mem_heap_free_t *) mem_heap.area;
-  mem_heap.first.next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (region_p);
-  region_p->size = sizeof (mem_heap.area);
-  region_p->next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST);
+  JERRY_STATIC_ASSERT (MEM_HEAP_FREE_MAP_WORDS * 32 >= MEM_HEAP_UNIT_COUNT,
+                       mem_heap_free_map_must_contain_a_bit_for_each_unit);
+
+  JERRY_CONTEXT (mem_heap_allocated_size) = 0;
+  JERRY_CONTEXT (mem_heap_limit) = CONFIG_MEM_HEAP_DESIRED_LIMIT;
+
+  for (uint32_t i = 0; i < MEM_HEAP_SMALL_LIST_COUNT + MEM_HEAP_LARGE_LIST_COUNT; i++)
+  {
+    JERRY_HEAP_CONTEXT (list_first_offset)[i] = MEM_HEAP_END_OF_LIST;
+  }
 
-  mem_heap_list_skip_p = &mem_heap.first;
+  JERRY_HEAP_CONTEXT (small_list_map) = 0;
+  JERRY_HEAP_CONTEXT (large_list_map) = 0;
+  memset (JERRY_HEAP_CONTEXT (free_map), 0, sizeof (JERRY_HEAP_CONTEXT (free_map)));
 
-  VALGRIND_NOACCESS_SPACE (mem_heap.area, MEM_HEAP_AREA_SIZE);
+  VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), MEM_HEAP_AREA_SIZE);
+
+  mem_heap_mark_units (0, MEM_HEAP_UNIT_COUNT, true);
+  mem_heap_insert_region ((mem_heap_free_t *) JERRY_HEAP_CONTEXT (area), MEM_HEAP_UNIT_COUNT * MEM_ALIGNMENT);
 
   MEM_HEAP_STAT_INIT ();
 } /* mem_heap_init */
@@ -225,8 +601,8 @@ mem_heap_init (void)
  */
 void mem_heap_finalize (void)
 {
-  JERRY_ASSERT (mem_heap_allocated_size == 0);
-  VALGRIND_NOACCESS_SPACE (&mem_heap, sizeof (mem_heap));
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_allocated_size) == 0);
+  VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT_ADDR, sizeof (mem_heap_t));
 } /* mem_heap_finalize */
 
 /**
@@ -243,115 +619,69 @@ void *mem_heap_alloc_block_internal (const size_t size)
 {
   // Align size
   const size_t required_size = ((size + MEM_ALIGNMENT - 1) / MEM_ALIGNMENT) * MEM_ALIGNMENT;
-  mem_heap_free_t *data_space_p = NULL;
-
-  VALGRIND_DEFINED_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
 
-  // Fast path for 8 byte chunks, first region is guaranteed to be sufficient
-  if (required_size == MEM_ALIGNMENT
-      && likely (mem_heap.first.next_offset != MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST)))
+  if (unlikely (required_size > MEM_HEAP_AREA_SIZE))
   {
-    data_space_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap.first.next_offset);
-    JERRY_ASSERT (mem_is_heap_pointer (data_space_p));
-
-    VALGRIND_DEFINED_SPACE (data_space_p, sizeof (mem_heap_free_t));
-    mem_heap_allocated_size += MEM_ALIGNMENT;
-    MEM_HEAP_STAT_ALLOC_ITER ();
-
-    if (data_space_p->size == MEM_ALIGNMENT)
-    {
-      mem_heap.first.next_offset = data_space_p->next_offset;
-    }
-    else
-    {
-      JERRY_ASSERT (data_space_p->size > MEM_ALIGNMENT);
-      mem_heap_free_t *const remaining_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap.first.next_offset) + 1;
-
-      VALGRIND_DEFINED_SPACE (remaining_p, sizeof (mem_heap_free_t));
-      remaining_p->size = data_space_p->size - MEM_ALIGNMENT;
-      remaining_p->next_offset = data_space_p->next_offset;
-      VALGRIND_NOACCESS_SPACE (remaining_p, sizeof (mem_heap_free_t));
+    return NULL;
+  }
 
-      mem_heap.first.next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (remaining_p);
-    }
+  const uint32_t list_index = mem_heap_get_list_index ((uint32_t) required_size);
+  mem_heap_free_t *data_space_p = NULL;
 
-    VALGRIND_UNDEFINED_SPACE (data_space_p, sizeof (mem_heap_free_t));
+  MEM_HEAP_STAT_ALLOC_ITER ();
 
-    if (unlikely (data_space_p == mem_heap_list_skip_p))
-    {
-      mem_heap_list_skip_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap.first.next_offset);
-    }
+  // Fast path for small regions: every region of the list has the required size
+  if (list_index < MEM_HEAP_SMALL_LIST_COUNT
+      && JERRY_HEAP_CONTEXT (list_first_offset)[list_index] != MEM_HEAP_END_OF_LIST)
+  {
+    data_space_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (JERRY_HEAP_CONTEXT (list_first_offset)[list_index]);
   }
   // Slow path for larger regions
   else
   {
-    mem_heap_free_t *current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap.first.next_offset);
-    mem_heap_free_t *prev_p = &mem_heap.first;
-    while (current_p != MEM_HEAP_END_OF_LIST)
+    if (list_index >= MEM_HEAP_SMALL_LIST_COUNT)
     {
-      JERRY_ASSERT (mem_is_heap_pointer (current_p));
-      VALGRIND_DEFINED_SPACE (current_p, sizeof (mem_heap_free_t));
-      MEM_HEAP_STAT_ALLOC_ITER ();
-
-      const uint32_t next_offset = current_p->next_offset;
-      JERRY_ASSERT (mem_is_heap_pointer (MEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset))
-                    || next_offset == MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST));
+      // First fit in the list of the required size
+      uint32_t current_offset = JERRY_HEAP_CONTEXT (list_first_offset)[list_index];
 
-      if (current_p->size >= required_size)
+      while (current_offset != MEM_HEAP_END_OF_LIST)
       {
-        // Region is sufficiently big, store address
-        data_space_p = current_p;
-        mem_heap_allocated_size += required_size;
+        mem_heap_free_t *const current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (current_offset);
+        JERRY_ASSERT (mem_is_heap_pointer (current_p));
 
-        // Region was larger than necessary
-        if (current_p->size > required_size)
-        {
-          // Get address of remaining space
-          mem_heap_free_t *const remaining_p = (mem_heap_free_t *) ((uint8_t *) current_p + required_size);
-
-          // Update metadata
-          VALGRIND_DEFINED_SPACE (remaining_p, sizeof (mem_heap_free_t));
-          remaining_p->size = current_p->size - (uint32_t) required_size;
-          remaining_p->next_offset = next_offset;
-          VALGRIND_NOACCESS_SPACE (remaining_p, sizeof (mem_heap_free_t));
-
-          // Update list
-          VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-          prev_p->next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (remaining_p);
-          VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
-        }
-        // Block is an exact fit
-        else
+        if (mem_heap_get_region_size (current_p) >= required_size)
         {
-          // Remove the region from the list
-          VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-          prev_p->next_offset = next_offset;
-          VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
+          data_space_p = current_p;
+          break;
         }
 
-        mem_heap_list_skip_p = prev_p;
+        VALGRIND_DEFINED_SPACE (current_p, sizeof (mem_heap_free_t));
+        current_offset = current_p->next_offset;
+        VALGRIND_NOACCESS_SPACE (current_p, sizeof (mem_heap_free_t));
 
-        // Found enough space
-        break;
+        MEM_HEAP_STAT_ALLOC_ITER ();
       }
+    }
+
+    if (data_space_p == NULL)
+    {
+      // Any region of a larger list is sufficiently big
+      data_space_p = mem_heap_find_larger_region (list_index);
 
-      VALGRIND_NOACCESS_SPACE (current_p, sizeof (mem_heap_free_t));
-      // Next in list
-      prev_p = current_p;
-      current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset);
+      if (unlikely (data_space_p == NULL))
+      {
+        return NULL;
+      }
     }
   }
 
-  while (mem_heap_allocated_size >= mem_heap_limit)
-  {
-    mem_heap_limit += CONFIG_MEM_HEAP_DESIRED_LIMIT;
-  }
+  mem_heap_take_region (data_space_p, mem_heap_get_region_size (data_space_p), (uint32_t) required_size);
 
-  VALGRIND_NOACCESS_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
+  JERRY_CONTEXT (mem_heap_allocated_size) += required_size;
 
-  if (unlikely (!data_space_p))
+  while (JERRY_CONTEXT (mem_heap_allocated_size) >= JERRY_CONTEXT (mem_heap_limit))
   {
-    return NULL;
+    JERRY_CONTEXT (mem_heap_limit) += CONFIG_MEM_HEAP_DESIRED_LIMIT;
   }
 
   JERRY_ASSERT ((uintptr_t) data_space_p % MEM_ALIGNMENT == 0);
@@ -359,7 +689,7 @@ void *mem_heap_alloc_block_internal (const size_t size)
   MEM_HEAP_STAT_ALLOC (size);
 
   return (void *) data_space_p;
-} /* mem_heap_finalize */
+} /* mem_heap_alloc_block_internal */
 
 /**
  * Allocation of memory block, running 'try to give memory back' callbacks, if there is not enough memory.
@@ -383,7 +713,7 @@ mem_heap_alloc_block (const size_t size)
   mem_run_try_to_give_memory_back_callbacks (MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH);
 #endif /* MEM_GC_BEFORE_EACH_ALLOC */
 
-  if (mem_heap_allocated_size + size >= mem_heap_limit)
+  if (JERRY_CONTEXT (mem_heap_allocated_size) + size >= JERRY_CONTEXT (mem_heap_limit))
   {
     mem_run_try_to_give_memory_back_callbacks (MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_LOW);
   }
@@ -418,8 +748,6 @@ mem_heap_alloc_block (const size_t size)
 
 /**
  *  Allocate block and store block size.
- *
- * Note: block will only be aligned to 4 bytes.
  */
 inline void * __attr_always_inline___
 mem_heap_alloc_block_store_size (size_t size) /**< required size */
@@ -429,9 +757,9 @@ mem_heap_alloc_block_store_size (size_t size) /**< required size */
     return NULL;
   }
 
-  size += sizeof (mem_heap_free_t);
+  size += sizeof (mem_heap_size_header_t);
 
-  mem_heap_free_t *const data_space_p = (mem_heap_free_t *) mem_heap_alloc_block (size);
+  mem_heap_size_header_t *const data_space_p = (mem_heap_size_header_t *) mem_heap_alloc_block (size);
   data_space_p->size = (uint32_t) size;
   return (void *) (data_space_p + 1);
 } /* mem_heap_alloc_block_store_size */
@@ -448,116 +776,152 @@ mem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the b
   /* checking that ptr points to the heap */
   JERRY_ASSERT (mem_is_heap_pointer (ptr));
   JERRY_ASSERT (size > 0);
-  JERRY_ASSERT (mem_heap_limit >= mem_heap_allocated_size);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_limit) >= JERRY_CONTEXT (mem_heap_allocated_size));
 
   VALGRIND_FREYA_FREELIKE_SPACE (ptr);
   VALGRIND_NOACCESS_SPACE (ptr, size);
   MEM_HEAP_STAT_FREE_ITER ();
 
-  mem_heap_free_t *block_p = (mem_heap_free_t *) ptr;
-  mem_heap_free_t *prev_p;
-  mem_heap_free_t *next_p;
+  /* Realign size */
+  const size_t aligned_size = (size + MEM_ALIGNMENT - 1) / MEM_ALIGNMENT * MEM_ALIGNMENT;
 
-  VALGRIND_DEFINED_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
+  mem_heap_release_units ((mem_heap_free_t *) ptr, (uint32_t) aligned_size);
 
-  if (block_p > mem_heap_list_skip_p)
-  {
-    prev_p = mem_heap_list_skip_p;
-    MEM_HEAP_STAT_SKIP ();
-  }
-  else
-  {
-    prev_p = &mem_heap.first;
-    MEM_HEAP_STAT_NONSKIP ();
-  }
-
-  JERRY_ASSERT (mem_is_heap_pointer (block_p));
-  const uint32_t block_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_allocated_size) > 0);
+  JERRY_CONTEXT (mem_heap_allocated_size) -= aligned_size;
 
-  VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-  // Find position of region in the list
-  while (prev_p->next_offset < block_offset)
+  while (JERRY_CONTEXT (mem_heap_allocated_size) + CONFIG_MEM_HEAP_DESIRED_LIMIT
+         <= JERRY_CONTEXT (mem_heap_limit))
   {
-    mem_heap_free_t *const next_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
-    JERRY_ASSERT (mem_is_heap_pointer (next_p));
+    JERRY_CONTEXT (mem_heap_limit) -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
+  }
 
-    VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
-    VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
-    prev_p = next_p;
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_limit) >= JERRY_CONTEXT (mem_heap_allocated_size));
+  MEM_HEAP_STAT_FREE (size);
+} /* mem_heap_free_block */
 
-    MEM_HEAP_STAT_FREE_ITER ();
-  }
+/**
+ * Free block with stored size
+ */
+inline void __attr_always_inline___
+mem_heap_free_block_size_stored (void *ptr) /**< pointer to the memory block */
+{
+  mem_heap_size_header_t *const original_p = ((mem_heap_size_header_t *) ptr) - 1;
+  JERRY_ASSERT (original_p + 1 == ptr);
+  mem_heap_free_block (original_p, original_p->size);
+} /* mem_heap_free_block_size_stored */
 
-  next_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
-  VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
+/**
+ * Move an allocated block to a lower address of the heap
+ *
+ * The block is moved to the free region with the lowest address which can hold it,
+ * or slid down over the free region which directly precedes it. The units freed
+ * by the move are merged with the neighbouring free regions. A move never increases
+ * the number of free regions: unless the block borders a free region, it is only
+ * moved to a free region of the same size.
+ *
+ * Note:
+ *      the caller must update every reference to the block
+ *
+ * @return new address of the block - if the block is moved,
+ *         ptr - otherwise
+ */
+void *
+mem_heap_relocate_block (void *ptr, /**< pointer to the block */
+                         const size_t size) /**< size of the block */
+{
+  JERRY_ASSERT (mem_is_heap_pointer (ptr));
+  JERRY_ASSERT (size > 0);
 
-  /* Realign size */
-  const size_t aligned_size = (size + MEM_ALIGNMENT - 1) / MEM_ALIGNMENT * MEM_ALIGNMENT;
+  const uint32_t aligned_size = (uint32_t) JERRY_ALIGNUP (size, MEM_ALIGNMENT);
+  const uint32_t block_unit_index = mem_heap_get_unit_index (ptr);
+  const uint32_t block_end_index = block_unit_index + (aligned_size >> MEM_ALIGNMENT_LOG);
+  const bool is_bordering_free_region = ((block_unit_index > 0 && mem_heap_is_free_unit (block_unit_index - 1))
+                                         || (block_end_index < MEM_HEAP_UNIT_COUNT
+                                             && mem_heap_is_free_unit (block_end_index)));
+  uint32_t unit_index = mem_heap_find_free_unit (0, block_unit_index);
 
-  VALGRIND_DEFINED_SPACE (block_p, sizeof (mem_heap_free_t));
-  VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-  // Update prev
-  if (mem_heap_get_region_end (prev_p) == block_p)
-  {
-    // Can be merged
-    prev_p->size += (uint32_t) aligned_size;
-    VALGRIND_NOACCESS_SPACE (block_p, sizeof (mem_heap_free_t));
-    block_p = prev_p;
-  }
-  else
+  while (unit_index < block_unit_index)
   {
-    block_p->size = (uint32_t) aligned_size;
-    prev_p->next_offset = block_offset;
-  }
+    mem_heap_free_t *const region_p = mem_heap_get_unit_region (unit_index);
+    const uint32_t region_size = mem_heap_get_region_size (region_p);
+    const uint32_t region_end_index = unit_index + (region_size >> MEM_ALIGNMENT_LOG);
 
-  VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
-  // Update next
-  if (mem_heap_get_region_end (block_p) == next_p)
-  {
-    if (unlikely (next_p == mem_heap_list_skip_p))
+    if (region_end_index == block_unit_index)
     {
-      mem_heap_list_skip_p = block_p;
+      /* Sliding over the preceding free region: the units at the end of the block are freed. */
+      mem_heap_take_region (region_p, region_size, region_size);
+
+      VALGRIND_UNDEFINED_SPACE (region_p, region_size);
+      memmove (region_p, ptr, size);
+      VALGRIND_NOACCESS_SPACE ((uint8_t *) region_p + aligned_size, region_size);
+
+      mem_heap_release_units ((mem_heap_free_t *) ((uint8_t *) region_p + aligned_size), region_size);
+      return (void *) region_p;
     }
 
-    // Can be merged
-    block_p->size += next_p->size;
-    block_p->next_offset = next_p->next_offset;
+    if (is_bordering_free_region ? (region_size >= aligned_size) : (region_size == aligned_size))
+    {
+      mem_heap_take_region (region_p, region_size, aligned_size);
 
-  }
-  else
-  {
-    block_p->next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (next_p);
+      VALGRIND_UNDEFINED_SPACE (region_p, size);
+      memcpy (region_p, ptr, size);
+
+      VALGRIND_NOACCESS_SPACE (ptr, size);
+      mem_heap_release_units ((mem_heap_free_t *) ptr, aligned_size);
+      return (void *) region_p;
+    }
+
+    unit_index = mem_heap_find_free_unit (region_end_index, block_unit_index);
   }
 
-  mem_heap_list_skip_p = prev_p;
+  return ptr;
+} /* mem_heap_relocate_block */
 
-  VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
-  VALGRIND_NOACCESS_SPACE (block_p, size);
-  VALGRIND_NOACCESS_SPACE (next_p, sizeof (mem_heap_free_t));
+/**
+ * Get the fragmentation of the free space of the heap
+ */
+void
+mem_heap_get_fragmentation (mem_heap_fragmentation_t *out_fragmentation_p) /**< [out] fragmentation */
+{
+  JERRY_ASSERT (out_fragmentation_p != NULL);
+
+  out_fragmentation_p->free_bytes = 0;
+  out_fragmentation_p->largest_free_region_size = 0;
+  out_fragmentation_p->free_region_count = 0;
 
-  JERRY_ASSERT (mem_heap_allocated_size > 0);
-  mem_heap_allocated_size -= aligned_size;
+  uint32_t unit_index = mem_heap_find_free_unit (0, MEM_HEAP_UNIT_COUNT);
 
-  while (mem_heap_allocated_size + CONFIG_MEM_HEAP_DESIRED_LIMIT <= mem_heap_limit)
+  while (unit_index < MEM_HEAP_UNIT_COUNT)
   {
-    mem_heap_limit -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
-  }
+    const uint32_t region_size = mem_heap_get_region_size (mem_heap_get_unit_region (unit_index));
 
-  VALGRIND_NOACCESS_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
-  JERRY_ASSERT (mem_heap_limit >= mem_heap_allocated_size);
-  MEM_HEAP_STAT_FREE (size);
-} /* mem_heap_free_block */
+    out_fragmentation_p->free_bytes += region_size;
+    out_fragmentation_p->largest_free_region_size = JERRY_MAX (out_fragmentation_p->largest_free_region_size,
+                                                               region_size);
+    out_fragmentation_p->free_region_count++;
+
+    unit_index = mem_heap_find_free_unit (unit_index + (region_size >> MEM_ALIGNMENT_LOG), MEM_HEAP_UNIT_COUNT);
+  }
+} /* mem_heap_get_fragmentation */
 
 /**
- * Free block with stored size
+ * Get the fragmentation of the free space in percent
+ *
+ * The fragmentation is the share of the free space which is not part of the largest free region.
+ *
+ * @return fragmentation (0 - all free space is in one region, 100 - no free space)
  */
-inline void __attr_always_inline___
-mem_heap_free_block_size_stored (void *ptr) /**< pointer to the memory block */
+uint32_t
+mem_heap_get_fragmentation_percent (const mem_heap_fragmentation_t *fragmentation_p) /**< fragmentation */
 {
-  mem_heap_free_t *const original_p = ((mem_heap_free_t *) ptr) - 1;
-  JERRY_ASSERT (original_p + 1 == ptr);
-  mem_heap_free_block (original_p, original_p->size);
-} /* mem_heap_free_block_size_stored */
+  if (fragmentation_p->free_bytes == 0)
+  {
+    return 100;
+  }
+
+  return (uint32_t) (100 - (fragmentation_p->largest_free_region_size * 100) / fragmentation_p->free_bytes);
+} /* mem_heap_get_fragmentation_percent */
 
 /**
  * Compress pointer
@@ -571,7 +935,7 @@ mem_heap_compress_pointer (const void *pointer_p) /**< pointer to compress */
   JERRY_ASSERT (mem_is_heap_pointer (pointer_p));
 
   uintptr_t int_ptr = (uintptr_t) pointer_p;
-  const uintptr_t heap_start = (uintptr_t) &mem_heap;
+  const uintptr_t heap_start = (uintptr_t) JERRY_HEAP_CONTEXT_ADDR;
 
   JERRY_ASSERT (int_ptr % MEM_ALIGNMENT == 0);
 
@@ -596,7 +960,7 @@ mem_heap_decompress_pointer (uintptr_t compressed_pointer) /**< pointer to decom
   JERRY_ASSERT (compressed_pointer != MEM_CP_NULL);
 
   uintptr_t int_ptr = compressed_pointer;
-  const uintptr_t heap_start = (uintptr_t) &mem_heap;
+  const uintptr_t heap_start = (uintptr_t) JERRY_HEAP_CONTEXT_ADDR;
 
   int_ptr <<= MEM_ALIGNMENT_LOG;
   int_ptr += heap_start;
@@ -618,8 +982,8 @@ mem_heap_decompress_pointer (uintptr_t compressed_pointer) /**< pointer to decom
 bool
 mem_is_heap_pointer (const void *pointer) /**< pointer */
 {
-  return ((uint8_t *) pointer >= mem_heap.area
-          && (uint8_t *) pointer <= ((uint8_t *) mem_heap.area + MEM_HEAP_AREA_SIZE));
+  return ((uint8_t *) pointer >= JERRY_HEAP_CONTEXT (area)
+          && (uint8_t *) pointer <= ((uint8_t *) JERRY_HEAP_CONTEXT (area) + MEM_HEAP_AREA_SIZE));
 } /* mem_is_heap_pointer */
 #endif /* !JERRY_NDEBUG */
 
@@ -632,7 +996,7 @@ mem_heap_get_stats (mem_heap_stats_t *out_heap_stats_p) /**< [out] heap stats */
 {
   JERRY_ASSERT (out_heap_stats_p != NULL);
 
-  *out_heap_stats_p = mem_heap_stats;
+  *out_heap_stats_p = JERRY_CONTEXT (mem_heap_stats);
 } /* mem_heap_get_stats */
 
 /**
@@ -641,8 +1005,8 @@ mem_heap_get_stats (mem_heap_stats_t *out_heap_stats_p) /**< [out] heap stats */
 void
 mem_heap_stats_reset_peak (void)
 {
-  mem_heap_stats.peak_allocated_bytes = mem_heap_stats.allocated_bytes;
-  mem_heap_stats.peak_waste_bytes = mem_heap_stats.waste_bytes;
+  JERRY_CONTEXT (mem_heap_stats).peak_allocated_bytes = JERRY_CONTEXT (mem_heap_stats).allocated_bytes;
+  JERRY_CONTEXT (mem_heap_stats).peak_waste_bytes = JERRY_CONTEXT (mem_heap_stats).waste_bytes;
 } /* mem_heap_stats_reset_peak */
 
 /**
@@ -651,27 +1015,26 @@ mem_heap_stats_reset_peak (void)
 void
 mem_heap_stats_print (void)
 {
+  const mem_heap_stats_t *stats_p = &JERRY_CONTEXT (mem_heap_stats);
+
   printf ("Heap stats:\n"
           "  Heap size = %zu bytes\n"
           "  Allocated = %zu bytes\n"
           "  Waste = %zu bytes\n"
           "  Peak allocated = %zu bytes\n"
           "  Peak waste = %zu bytes\n"
-          "  Skip-ahead ratio = %zu.%04zu\n"
           "  Average alloc iteration = %zu.%04zu\n"
           "  Average free iteration = %zu.%04zu\n"
           "\n",
-          mem_heap_stats.size,
-          mem_heap_stats.allocated_bytes,
-          mem_heap_stats.waste_bytes,
-          mem_heap_stats.peak_allocated_bytes,
-          mem_heap_stats.peak_waste_bytes,
-          mem_heap_stats.skip_count / mem_heap_stats.nonskip_count,
-          mem_heap_stats.skip_count % mem_heap_stats.nonskip_count * 10000 / mem_heap_stats.nonskip_count,
-          mem_heap_stats.alloc_iter_count / mem_heap_stats.alloc_count,
-          mem_heap_stats.alloc_iter_count % mem_heap_stats.alloc_count * 10000 / mem_heap_stats.alloc_count,
-          mem_heap_stats.free_iter_count / mem_heap_stats.free_count,
-          mem_heap_stats.free_iter_count % mem_heap_stats.free_count * 10000 / mem_heap_stats.free_count);
+          stats_p->size,
+          stats_p->allocated_bytes,
+          stats_p->waste_bytes,
+          stats_p->peak_allocated_bytes,
+          stats_p->peak_waste_bytes,
+          stats_p->alloc_iter_count / stats_p->alloc_count,
+          stats_p->alloc_iter_count % stats_p->alloc_count * 10000 / stats_p->alloc_count,
+          stats_p->free_iter_count / stats_p->free_count,
+          stats_p->free_iter_count % stats_p->free_count * 10000 / stats_p->free_count);
 } /* mem_heap_stats_print */
 
 /**
@@ -680,9 +1043,9 @@ mem_heap_stats_print (void)
 static void
 mem_heap_stat_init ()
 {
-  memset (&mem_heap_stats, 0, sizeof (mem_heap_stats));
+  memset (&JERRY_CONTEXT (mem_heap_stats), 0, sizeof (JERRY_CONTEXT (mem_heap_stats)));
 
-  mem_heap_stats.size = MEM_HEAP_AREA_SIZE;
+  JERRY_CONTEXT (mem_heap_stats).size = MEM_HEAP_AREA_SIZE;
 } /* mem_heap_stat_init */
 
 /**
@@ -694,27 +1057,27 @@ mem_heap_stat_alloc (size_t size) /**< Size of allocated block */
   const size_t aligned_size = (size + MEM_ALIGNMENT - 1) / MEM_ALIGNMENT * MEM_ALIGNMENT;
   const size_t waste_bytes = aligned_size - size;
 
-  mem_heap_stats.allocated_bytes += aligned_size;
-  mem_heap_stats.waste_bytes += waste_bytes;
-  mem_heap_stats.alloc_count++;
+  JERRY_CONTEXT (mem_heap_stats).allocated_bytes += aligned_size;
+  JERRY_CONTEXT (mem_heap_stats).waste_bytes += waste_bytes;
+  JERRY_CONTEXT (mem_heap_stats).alloc_count++;
 
 
-  if (mem_heap_stats.allocated_bytes > mem_heap_stats.peak_allocated_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_bytes > JERRY_CONTEXT (mem_heap_stats).peak_allocated_bytes)
   {
-    mem_heap_stats.peak_allocated_bytes = mem_heap_stats.allocated_bytes;
+    JERRY_CONTEXT (mem_heap_stats).peak_allocated_bytes = JERRY_CONTEXT (mem_heap_stats).allocated_bytes;
   }
-  if (mem_heap_stats.allocated_bytes > mem_heap_stats.global_peak_allocated_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_bytes > JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_bytes)
   {
-    mem_heap_stats.global_peak_allocated_bytes = mem_heap_stats.allocated_bytes;
+    JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_bytes = JERRY_CONTEXT (mem_heap_stats).allocated_bytes;
   }
 
-  if (mem_heap_stats.waste_bytes > mem_heap_stats.peak_waste_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).waste_bytes > JERRY_CONTEXT (mem_heap_stats).peak_waste_bytes)
   {
-    mem_heap_stats.peak_waste_bytes = mem_heap_stats.waste_bytes;
+    JERRY_CONTEXT (mem_heap_stats).peak_waste_bytes = JERRY_CONTEXT (mem_heap_stats).waste_bytes;
   }
-  if (mem_heap_stats.waste_bytes > mem_heap_stats.global_peak_waste_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).waste_bytes > JERRY_CONTEXT (mem_heap_stats).global_peak_waste_bytes)
   {
-    mem_heap_stats.global_peak_waste_bytes = mem_heap_stats.waste_bytes;
+    JERRY_CONTEXT (mem_heap_stats).global_peak_waste_bytes = JERRY_CONTEXT (mem_heap_stats).waste_bytes;
   }
 } /* mem_heap_stat_alloc */
 
@@ -727,36 +1090,18 @@ mem_heap_stat_free (size_t size) /**< Size of freed block */
   const size_t aligned_size = (size + MEM_ALIGNMENT - 1) / MEM_ALIGNMENT * MEM_ALIGNMENT;
   const size_t waste_bytes = aligned_size - size;
 
-  mem_heap_stats.free_count++;
-  mem_heap_stats.allocated_bytes -= aligned_size;
-  mem_heap_stats.waste_bytes -= waste_bytes;
+  JERRY_CONTEXT (mem_heap_stats).free_count++;
+  JERRY_CONTEXT (mem_heap_stats).allocated_bytes -= aligned_size;
+  JERRY_CONTEXT (mem_heap_stats).waste_bytes -= waste_bytes;
 } /* mem_heap_stat_free */
 
-/**
- * Counts number of skip-aheads during insertion of free block
- */
-static void
-mem_heap_stat_skip ()
-{
-  mem_heap_stats.skip_count++;
-} /* mem_heap_stat_skip  */
-
-/**
- * Counts number of times we could not skip ahead during free block insertion
- */
-static void
-mem_heap_stat_nonskip ()
-{
-  mem_heap_stats.nonskip_count++;
-} /* mem_heap_stat_nonskip */
-
 /**
  * Count number of iterations required for allocations
  */
 static void
 mem_heap_stat_alloc_iter ()
 {
-  mem_heap_stats.alloc_iter_count++;
+  JERRY_CONTEXT (mem_heap_stats).alloc_iter_count++;
 } /* mem_heap_stat_alloc_iter */
 
 /**
@@ -765,7 +1110,7 @@ mem_heap_stat_alloc_iter ()
 static void
 mem_heap_stat_free_iter ()
 {
-  mem_heap_stats.free_iter_count++;
+  JERRY_CONTEXT (mem_heap_stats).free_iter_count++;
 } /* mem_heap_stat_free_iter */
 #endif /* MEM_STATS */
 
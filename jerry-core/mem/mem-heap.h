@@ -29,12 +29,25 @@
  * @{
  */
 
+/**
+ * Fragmentation of the free space of the heap
+ */
+typedef struct
+{
+  size_t free_bytes; /**< total size of the free regions */
+  size_t largest_free_region_size; /**< size of the largest free region */
+  size_t free_region_count; /**< number of free regions */
+} mem_heap_fragmentation_t;
+
 extern void mem_heap_init (void);
 extern void mem_heap_finalize (void);
 extern void *mem_heap_alloc_block (const size_t);
 extern void mem_heap_free_block (void *, const size_t);
 extern void *mem_heap_alloc_block_store_size (size_t);
 extern void mem_heap_free_block_size_stored (void *);
+extern void *mem_heap_relocate_block (void *, const size_t);
+extern void mem_heap_get_fragmentation (mem_heap_fragmentation_t *);
+extern uint32_t mem_heap_get_fragmentation_percent (const mem_heap_fragmentation_t *);
 extern uintptr_t mem_heap_compress_pointer (const void *);
 extern void *mem_heap_decompress_pointer (uintptr_t);
 extern bool mem_is_heap_pointer (const void *);
@@ -56,9 +69,6 @@ typedef struct
   size_t peak_waste_bytes; /**< peak bytes waste */
   size_t global_peak_waste_bytes; /**< non-resettable peak bytes waste */
 
-  size_t skip_count;
-  size_t nonskip_count;
-
   size_t alloc_count;
   size_t alloc_iter_count;
 
@@ -20,6 +20,7 @@
 
 #include "jrt.h"
 #include "jrt-libc-includes.h"
+#include "jcontext.h"
 #include "mem-allocator.h"
 #include "mem-heap.h"
 #include "mem-poolman.h"
@@ -34,26 +35,7 @@
  * @{
  */
 
-/**
- * Node for free chunk list
- */
-typedef struct mem_pools_chunk
-{
-  struct mem_pools_chunk *next_p; /* pointer to next pool chunk */
-} mem_pools_chunk_t;
-
-/**
- * List of free pool chunks
- */
-mem_pools_chunk_t *mem_free_chunk_p;
-
 #ifdef MEM_STATS
-
-/**
- * Pools' memory usage statistics
- */
-mem_pools_stats_t mem_pools_stats;
-
 static void mem_pools_stat_init (void);
 static void mem_pools_stat_free_pool (void);
 static void mem_pools_stat_new_alloc (void);
@@ -107,7 +89,7 @@ mem_pools_init (void)
   JERRY_STATIC_ASSERT (sizeof (mem_pools_chunk_t) <= MEM_POOL_CHUNK_SIZE,
                        size_of_mem_pools_chunk_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
 
-  mem_free_chunk_p = NULL;
+  JERRY_CONTEXT (mem_free_chunk_p) = NULL;
 
   MEM_POOLS_STAT_INIT ();
 } /* mem_pools_init */
@@ -120,7 +102,7 @@ mem_pools_finalize (void)
 {
   mem_pools_collect_empty ();
 
-  JERRY_ASSERT (mem_free_chunk_p == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_free_chunk_p) == NULL);
 } /* mem_pools_finalize */
 
 /**
@@ -136,15 +118,15 @@ mem_pools_alloc (void)
   mem_run_try_to_give_memory_back_callbacks (MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH);
 #endif /* MEM_GC_BEFORE_EACH_ALLOC */
 
-  if (mem_free_chunk_p != NULL)
+  if (JERRY_CONTEXT (mem_free_chunk_p) != NULL)
   {
-    const mem_pools_chunk_t *const chunk_p = mem_free_chunk_p;
+    const mem_pools_chunk_t *const chunk_p = JERRY_CONTEXT (mem_free_chunk_p);
 
     MEM_POOLS_STAT_REUSE ();
 
     VALGRIND_DEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
 
-    mem_free_chunk_p = chunk_p->next_p;
+    JERRY_CONTEXT (mem_free_chunk_p) = chunk_p->next_p;
 
     VALGRIND_UNDEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
 
@@ -167,8 +149,8 @@ mem_pools_free (void *chunk_p) /**< pointer to the chunk */
 
   VALGRIND_DEFINED_SPACE (chunk_to_free_p, MEM_POOL_CHUNK_SIZE);
 
-  chunk_to_free_p->next_p = mem_free_chunk_p;
-  mem_free_chunk_p = chunk_to_free_p;
+  chunk_to_free_p->next_p = JERRY_CONTEXT (mem_free_chunk_p);
+  JERRY_CONTEXT (mem_free_chunk_p) = chunk_to_free_p;
 
   VALGRIND_NOACCESS_SPACE (chunk_to_free_p, MEM_POOL_CHUNK_SIZE);
 
@@ -181,15 +163,15 @@ mem_pools_free (void *chunk_p) /**< pointer to the chunk */
 void
 mem_pools_collect_empty ()
 {
-  while (mem_free_chunk_p)
+  while (JERRY_CONTEXT (mem_free_chunk_p))
   {
-    VALGRIND_DEFINED_SPACE (mem_free_chunk_p, sizeof (mem_pools_chunk_t));
-    mem_pools_chunk_t *const next_p = mem_free_chunk_p->next_p;
-    VALGRIND_NOACCESS_SPACE (mem_free_chunk_p, sizeof (mem_pools_chunk_t));
+    VALGRIND_DEFINED_SPACE (JERRY_CONTEXT (mem_free_chunk_p), sizeof (mem_pools_chunk_t));
+    mem_pools_chunk_t *const next_p = JERRY_CONTEXT (mem_free_chunk_p)->next_p;
+    VALGRIND_NOACCESS_SPACE (JERRY_CONTEXT (mem_free_chunk_p), sizeof (mem_pools_chunk_t));
 
-    mem_heap_free_block (mem_free_chunk_p, MEM_POOL_CHUNK_SIZE);
+    mem_heap_free_block (JERRY_CONTEXT (mem_free_chunk_p), MEM_POOL_CHUNK_SIZE);
     MEM_POOLS_STAT_DEALLOC ();
-    mem_free_chunk_p = next_p;
+    JERRY_CONTEXT (mem_free_chunk_p) = next_p;
   }
 } /* mem_pools_collect_empty */
 
@@ -202,7 +184,7 @@ mem_pools_get_stats (mem_pools_stats_t *out_pools_stats_p) /**< [out] pools' sta
 {
   JERRY_ASSERT (out_pools_stats_p != NULL);
 
-  *out_pools_stats_p = mem_pools_stats;
+  *out_pools_stats_p = JERRY_CONTEXT (mem_pools_stats);
 } /* mem_pools_get_stats */
 
 /**
@@ -211,7 +193,7 @@ mem_pools_get_stats (mem_pools_stats_t *out_pools_stats_p) /**< [out] pools' sta
 void
 mem_pools_stats_reset_peak (void)
 {
-  mem_pools_stats.peak_pools_count = mem_pools_stats.pools_count;
+  JERRY_CONTEXT (mem_pools_stats).peak_pools_count = JERRY_CONTEXT (mem_pools_stats).pools_count;
 } /* mem_pools_stats_reset_peak */
 
 /**
@@ -220,6 +202,8 @@ mem_pools_stats_reset_peak (void)
 void
 mem_pools_stats_print (void)
 {
+  const mem_pools_stats_t *stats_p = &JERRY_CONTEXT (mem_pools_stats);
+
   printf ("Pools stats:\n"
           "  Chunk size: %zu\n"
           "  Pool chunks: %zu\n"
@@ -227,11 +211,11 @@ mem_pools_stats_print (void)
           "  Free chunks: %zu\n"
           "  Pool reuse ratio: %zu.%04zu\n",
           MEM_POOL_CHUNK_SIZE,
-          mem_pools_stats.pools_count,
-          mem_pools_stats.peak_pools_count,
-          mem_pools_stats.free_chunks,
-          mem_pools_stats.reused_count / mem_pools_stats.new_alloc_count,
-          mem_pools_stats.reused_count % mem_pools_stats.new_alloc_count * 10000 / mem_pools_stats.new_alloc_count);
+          stats_p->pools_count,
+          stats_p->peak_pools_count,
+          stats_p->free_chunks,
+          stats_p->reused_count / stats_p->new_alloc_count,
+          stats_p->reused_count % stats_p->new_alloc_count * 10000 / stats_p->new_alloc_count);
 } /* mem_pools_stats_print */
 
 /**
@@ -240,7 +224,7 @@ mem_pools_stats_print (void)
 static void
 mem_pools_stat_init (void)
 {
-  memset (&mem_pools_stats, 0, sizeof (mem_pools_stats));
+  memset (&JERRY_CONTEXT (mem_pools_stats), 0, sizeof (JERRY_CONTEXT (mem_pools_stats)));
 } /* mem_pools_stat_init */
 
 /**
@@ -249,16 +233,16 @@ mem_pools_stat_init (void)
 static void
 mem_pools_stat_new_alloc (void)
 {
-  mem_pools_stats.pools_count++;
-  mem_pools_stats.new_alloc_count++;
+  JERRY_CONTEXT (mem_pools_stats).pools_count++;
+  JERRY_CONTEXT (mem_pools_stats).new_alloc_count++;
 
-  if (mem_pools_stats.pools_count > mem_pools_stats.peak_pools_count)
+  if (JERRY_CONTEXT (mem_pools_stats).pools_count > JERRY_CONTEXT (mem_pools_stats).peak_pools_count)
   {
-    mem_pools_stats.peak_pools_count = mem_pools_stats.pools_count;
+    JERRY_CONTEXT (mem_pools_stats).peak_pools_count = JERRY_CONTEXT (mem_pools_stats).pools_count;
   }
-  if (mem_pools_stats.pools_count > mem_pools_stats.global_peak_pools_count)
+  if (JERRY_CONTEXT (mem_pools_stats).pools_count > JERRY_CONTEXT (mem_pools_stats).global_peak_pools_count)
   {
-    mem_pools_stats.global_peak_pools_count = mem_pools_stats.pools_count;
+    JERRY_CONTEXT (mem_pools_stats).global_peak_pools_count = JERRY_CONTEXT (mem_pools_stats).pools_count;
   }
 } /* mem_pools_stat_new_alloc */
 
@@ -269,17 +253,17 @@ mem_pools_stat_new_alloc (void)
 static void
 mem_pools_stat_reuse (void)
 {
-  mem_pools_stats.pools_count++;
-  mem_pools_stats.free_chunks--;
-  mem_pools_stats.reused_count++;
+  JERRY_CONTEXT (mem_pools_stats).pools_count++;
+  JERRY_CONTEXT (mem_pools_stats).free_chunks--;
+  JERRY_CONTEXT (mem_pools_stats).reused_count++;
 
-  if (mem_pools_stats.pools_count > mem_pools_stats.peak_pools_count)
+  if (JERRY_CONTEXT (mem_pools_stats).pools_count > JERRY_CONTEXT (mem_pools_stats).peak_pools_count)
   {
-    mem_pools_stats.peak_pools_count = mem_pools_stats.pools_count;
+    JERRY_CONTEXT (mem_pools_stats).peak_pools_count = JERRY_CONTEXT (mem_pools_stats).pools_count;
   }
-  if (mem_pools_stats.pools_count > mem_pools_stats.global_peak_pools_count)
+  if (JERRY_CONTEXT (mem_pools_stats).pools_count > JERRY_CONTEXT (mem_pools_stats).global_peak_pools_count)
   {
-    mem_pools_stats.global_peak_pools_count = mem_pools_stats.pools_count;
+    JERRY_CONTEXT (mem_pools_stats).global_peak_pools_count = JERRY_CONTEXT (mem_pools_stats).pools_count;
   }
 } /* mem_pools_stat_reuse */
 
@@ -290,10 +274,10 @@ mem_pools_stat_reuse (void)
 static void
 mem_pools_stat_free_pool (void)
 {
-  JERRY_ASSERT (mem_pools_stats.pools_count > 0);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_pools_stats).pools_count > 0);
 
-  mem_pools_stats.pools_count--;
-  mem_pools_stats.free_chunks++;
+  JERRY_CONTEXT (mem_pools_stats).pools_count--;
+  JERRY_CONTEXT (mem_pools_stats).free_chunks++;
 } /* mem_pools_stat_free_pool */
 
 /**
@@ -302,7 +286,7 @@ mem_pools_stat_free_pool (void)
 static void
 mem_pools_stat_dealloc (void)
 {
-  mem_pools_stats.free_chunks--;
+  JERRY_CONTEXT (mem_pools_stats).free_chunks--;
 } /* mem_pools_stat_dealloc */
 #endif /* MEM_STATS */
 
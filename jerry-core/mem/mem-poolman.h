@@ -29,6 +29,14 @@
  * @{
  */
 
+/**
+ * Node for free chunk list
+ */
+typedef struct mem_pools_chunk
+{
+  struct mem_pools_chunk *next_p; /* pointer to next pool chunk */
+} mem_pools_chunk_t;
+
 extern void mem_pools_init (void);
 extern void mem_pools_finalize (void);
 extern void *mem_pools_alloc (void);
@@ -26,6 +26,19 @@
  * @{
  */
 
+JERRY_STATIC_ASSERT (CBC_BRANCH_OFFSET_LENGTH (CBC_EXT_BRANCH_IF_EQUAL) == 1,
+                     cbc_ext_branch_if_equal_must_have_one_byte_offset);
+JERRY_STATIC_ASSERT (CBC_EXT_BRANCH_IF_GREATER_EQUAL_TWO_LITERALS - CBC_EXT_BRANCH_IF_EQUAL
+                     == (CBC_GREATER_EQUAL_TWO_LITERALS - CBC_EQUAL) * CBC_BRANCH_IF_COMPARE_FORM_LENGTH,
+                     cbc_ext_branch_if_compare_opcodes_must_follow_the_binary_compare_opcodes);
+JERRY_STATIC_ASSERT (CBC_BIT_AND_TWO_LITERALS + 1 == CBC_EQUAL
+                     && CBC_INSTANCEOF_TWO_LITERALS + 1 == CBC_LEFT_SHIFT,
+                     cbc_binary_arithmetic_opcodes_must_be_in_two_ranges);
+JERRY_STATIC_ASSERT (CBC_EXT_MODULO_TWO_LITERALS_SET_IDENT_BLOCK + 1 - CBC_EXT_BIT_OR_SET_IDENT
+                     == (CBC_MODULO_TWO_LITERALS + 1 - CBC_LEFT_SHIFT + CBC_EQUAL - CBC_BIT_OR)
+                        / (CBC_BINARY_WITH_TWO_LITERALS + 1) * CBC_BINARY_OPERATION_SET_IDENT_LENGTH,
+                     cbc_ext_binary_operation_set_ident_opcodes_must_follow_the_binary_arithmetic_opcodes);
+
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) \
   ((arg2) | (((arg3) + CBC_STACK_ADJUST_BASE) << CBC_STACK_ADJUST_SHIFT)),
 
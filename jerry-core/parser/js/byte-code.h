@@ -117,6 +117,20 @@
   CBC_OPCODE (name ## _LITERAL_BLOCK, CBC_HAS_LITERAL_ARG, -3, \
               (VM_OC_ ## group) | VM_OC_GET_STACK_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_BLOCK) \
 
+#define CBC_EXT_BINARY_OPERATION_SET_IDENT(name, group) \
+  CBC_OPCODE (name ## _SET_IDENT, CBC_HAS_LITERAL_ARG, -2, \
+              (VM_OC_ ## group) | VM_OC_GET_STACK_STACK | VM_OC_PUT_IDENT) \
+  CBC_OPCODE (name ## _RIGHT_LITERAL_SET_IDENT, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, -1, \
+              (VM_OC_ ## group) | VM_OC_GET_STACK_LITERAL | VM_OC_PUT_IDENT) \
+  CBC_OPCODE (name ## _TWO_LITERALS_SET_IDENT, CBC_HAS_LITERAL_ARG2, 0, \
+              (VM_OC_ ## group) | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_IDENT) \
+  CBC_OPCODE (name ## _SET_IDENT_BLOCK, CBC_HAS_LITERAL_ARG, -2, \
+              (VM_OC_ ## group) | VM_OC_GET_STACK_STACK | VM_OC_PUT_IDENT | VM_OC_PUT_BLOCK) \
+  CBC_OPCODE (name ## _RIGHT_LITERAL_SET_IDENT_BLOCK, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, -1, \
+              (VM_OC_ ## group) | VM_OC_GET_STACK_LITERAL | VM_OC_PUT_IDENT | VM_OC_PUT_BLOCK) \
+  CBC_OPCODE (name ## _TWO_LITERALS_SET_IDENT_BLOCK, CBC_HAS_LITERAL_ARG2, 0, \
+              (VM_OC_ ## group) | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_IDENT | VM_OC_PUT_BLOCK)
+
 #define CBC_UNARY_LVALUE_WITH_IDENT 3
 
 #define CBC_BINARY_LVALUE_WITH_LITERAL 1
@@ -124,6 +138,9 @@
 #define CBC_BINARY_WITH_LITERAL 1
 #define CBC_BINARY_WITH_TWO_LITERALS 2
 
+#define CBC_BINARY_OPERATION_SET_IDENT_BLOCK 3
+#define CBC_BINARY_OPERATION_SET_IDENT_LENGTH 6
+
 /**
  * Several opcodes (mostly call and assignment opcodes) have
  * two forms: one which does not push a return value onto
@@ -187,6 +204,36 @@
   CBC_OPCODE (name ## _3, CBC_HAS_BRANCH_ARG, stack, \
               (vm_oc))
 
+/**
+ * Compare and branch instructions are organized in groups of 4 opcodes.
+ * The 1st opcode is unused, the others are backward branches with 1, 2
+ * and 3 byte offsets. Each comparison has a stack-stack, a stack-literal
+ * and a literal-literal operand form. The offset bytes precede the
+ * literal arguments.
+ */
+#define CBC_BACKWARD_BRANCH_COMPARE(name, flags, stack, vm_oc) \
+  CBC_OPCODE (name ## _UNUSED, CBC_NO_FLAG, 0, \
+              VM_OC_NONE) \
+  CBC_OPCODE (name, CBC_HAS_BRANCH_ARG | (flags), stack, \
+              (vm_oc)) \
+  CBC_OPCODE (name ## _2, CBC_HAS_BRANCH_ARG | (flags), stack, \
+              (vm_oc)) \
+  CBC_OPCODE (name ## _3, CBC_HAS_BRANCH_ARG | (flags), stack, \
+              (vm_oc))
+
+#define CBC_EXT_BRANCH_IF_COMPARE(name, group) \
+  CBC_BACKWARD_BRANCH_COMPARE (name, CBC_NO_FLAG, -2, \
+                               (VM_OC_ ## group ## _BRANCH) | VM_OC_GET_STACK_STACK) \
+  CBC_BACKWARD_BRANCH_COMPARE (name ## _RIGHT_LITERAL, CBC_HAS_LITERAL_ARG, -1, \
+                               (VM_OC_ ## group ## _BRANCH) | VM_OC_GET_STACK_LITERAL) \
+  CBC_BACKWARD_BRANCH_COMPARE (name ## _TWO_LITERALS, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+                               (VM_OC_ ## group ## _BRANCH) | VM_OC_GET_LITERAL_LITERAL)
+
+/**
+ * Distance of the operand forms of compare and branch instructions.
+ */
+#define CBC_BRANCH_IF_COMPARE_FORM_LENGTH 4
+
 #define CBC_BRANCH_OFFSET_LENGTH(opcode) \
   ((opcode) & 0x3)
 
@@ -275,23 +322,23 @@
   CBC_OPCODE (CBC_PUSH_NUMBER_1, CBC_HAS_BYTE_ARG, 1, \
               VM_OC_PUSH_NUMBER | VM_OC_PUT_STACK) \
   CBC_OPCODE (CBC_PUSH_PROP, CBC_NO_FLAG, -1, \
-              VM_OC_PROP_GET | VM_OC_GET_STACK_STACK | VM_OC_PUT_STACK) \
+              VM_OC_PROP_GET | VM_OC_GET_STACK_STACK | VM_OC_PUT_STACK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_PUSH_PROP_LITERAL, CBC_HAS_LITERAL_ARG, 0, \
-              VM_OC_PROP_GET | VM_OC_GET_STACK_LITERAL | VM_OC_PUT_STACK) \
+              VM_OC_PROP_GET | VM_OC_GET_STACK_LITERAL | VM_OC_PUT_STACK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_PUSH_PROP_LITERAL_LITERAL, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 1, \
-              VM_OC_PROP_GET | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_STACK) \
+              VM_OC_PROP_GET | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_STACK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_PUSH_PROP_THIS_LITERAL, CBC_HAS_LITERAL_ARG, 1, \
-              VM_OC_PROP_GET | VM_OC_GET_THIS_LITERAL | VM_OC_PUT_STACK) \
+              VM_OC_PROP_GET | VM_OC_GET_THIS_LITERAL | VM_OC_PUT_STACK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_PUSH_IDENT_REFERENCE, CBC_HAS_LITERAL_ARG, 3, \
               VM_OC_IDENT_REFERENCE | VM_OC_PUT_STACK) \
   CBC_OPCODE (CBC_PUSH_PROP_REFERENCE, CBC_NO_FLAG, 1, \
-              VM_OC_PROP_REFERENCE | VM_OC_PUT_STACK) \
+              VM_OC_PROP_REFERENCE | VM_OC_PUT_STACK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_PUSH_PROP_LITERAL_REFERENCE, CBC_HAS_LITERAL_ARG, 2, \
-              VM_OC_PROP_REFERENCE | VM_OC_GET_LITERAL | VM_OC_PUT_STACK) \
+              VM_OC_PROP_REFERENCE | VM_OC_GET_LITERAL | VM_OC_PUT_STACK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_PUSH_PROP_LITERAL_LITERAL_REFERENCE, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 3, \
-              VM_OC_PROP_REFERENCE | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_STACK) \
+              VM_OC_PROP_REFERENCE | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_STACK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_PUSH_PROP_THIS_LITERAL_REFERENCE, CBC_HAS_LITERAL_ARG, 3, \
-              VM_OC_PROP_REFERENCE | VM_OC_GET_THIS_LITERAL | VM_OC_PUT_STACK) \
+              VM_OC_PROP_REFERENCE | VM_OC_GET_THIS_LITERAL | VM_OC_PUT_STACK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_NEW, CBC_HAS_POP_STACK_BYTE_ARG, 0, \
               VM_OC_NEW | VM_OC_GET_BYTE | VM_OC_PUT_STACK) \
   CBC_OPCODE (CBC_NEW0, CBC_NO_FLAG, 0, \
@@ -449,11 +496,11 @@
   \
   /* Binary assignment opcodes. */ \
   CBC_OPCODE (CBC_ASSIGN, CBC_NO_FLAG, -3, \
-              VM_OC_ASSIGN | VM_OC_GET_STACK | VM_OC_PUT_REFERENCE) \
+              VM_OC_ASSIGN | VM_OC_GET_STACK | VM_OC_PUT_REFERENCE | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_ASSIGN_PUSH_RESULT, CBC_NO_FLAG, -2, \
-              VM_OC_ASSIGN | VM_OC_GET_STACK | VM_OC_PUT_REFERENCE | VM_OC_PUT_STACK) \
+              VM_OC_ASSIGN | VM_OC_GET_STACK | VM_OC_PUT_REFERENCE | VM_OC_PUT_STACK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_ASSIGN_BLOCK, CBC_NO_FLAG, -3, \
-              VM_OC_ASSIGN | VM_OC_GET_STACK | VM_OC_PUT_REFERENCE | VM_OC_PUT_BLOCK) \
+              VM_OC_ASSIGN | VM_OC_GET_STACK | VM_OC_PUT_REFERENCE | VM_OC_PUT_BLOCK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_ASSIGN_SET_IDENT, CBC_HAS_LITERAL_ARG, -1, \
               VM_OC_ASSIGN | VM_OC_GET_STACK | VM_OC_PUT_IDENT) \
   CBC_OPCODE (CBC_ASSIGN_SET_IDENT_PUSH_RESULT, CBC_HAS_LITERAL_ARG, 0, \
@@ -467,17 +514,17 @@
   CBC_OPCODE (CBC_ASSIGN_LITERAL_SET_IDENT_BLOCK, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
               VM_OC_ASSIGN | VM_OC_GET_LITERAL | VM_OC_PUT_IDENT | VM_OC_PUT_BLOCK) \
   CBC_OPCODE (CBC_ASSIGN_PROP_LITERAL, CBC_HAS_LITERAL_ARG, -2, \
-              VM_OC_ASSIGN_PROP | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE) \
+              VM_OC_ASSIGN_PROP | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_ASSIGN_PROP_LITERAL_PUSH_RESULT, CBC_HAS_LITERAL_ARG, -1, \
-              VM_OC_ASSIGN_PROP | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_STACK) \
+              VM_OC_ASSIGN_PROP | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_STACK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_ASSIGN_PROP_LITERAL_BLOCK, CBC_HAS_LITERAL_ARG, -2, \
-              VM_OC_ASSIGN_PROP | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_BLOCK) \
+              VM_OC_ASSIGN_PROP | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_BLOCK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_ASSIGN_PROP_THIS_LITERAL, CBC_HAS_LITERAL_ARG, -1, \
-              VM_OC_ASSIGN_PROP_THIS | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE) \
+              VM_OC_ASSIGN_PROP_THIS | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_ASSIGN_PROP_THIS_LITERAL_PUSH_RESULT, CBC_HAS_LITERAL_ARG, 0, \
-              VM_OC_ASSIGN_PROP_THIS | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_STACK) \
+              VM_OC_ASSIGN_PROP_THIS | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_STACK | VM_OC_INLINE_CACHE) \
   CBC_OPCODE (CBC_ASSIGN_PROP_THIS_LITERAL_BLOCK, CBC_HAS_LITERAL_ARG, -1, \
-              VM_OC_ASSIGN_PROP_THIS | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_BLOCK) \
+              VM_OC_ASSIGN_PROP_THIS | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_BLOCK | VM_OC_INLINE_CACHE) \
   \
   /* Binary compound assignment opcodes. */ \
   CBC_BINARY_LVALUE_OPERATION (CBC_ASSIGN_ADD, \
@@ -507,8 +554,9 @@
   CBC_OPCODE (CBC_END, CBC_NO_FLAG, 0, \
               VM_OC_NONE)
 
-/* All EXT branches are statement block end
- * marks, so they are always forward branches. */
+/* The EXT branches are statement block end marks
+ * (forward branches), the for-in loop branch and
+ * the compare and branch opcodes (backward branches). */
 
 #define CBC_EXT_OPCODE_LIST \
   /* Branch opcodes first. Some other opcodes are mixed. */ \
@@ -537,6 +585,24 @@
   CBC_FORWARD_BRANCH (CBC_EXT_FINALLY, 0, \
                       VM_OC_FINALLY) \
   \
+  /* Compare and branch opcodes, must be in the same order as the binary compare opcodes. */ \
+  CBC_EXT_BRANCH_IF_COMPARE (CBC_EXT_BRANCH_IF_EQUAL, \
+                             EQUAL) \
+  CBC_EXT_BRANCH_IF_COMPARE (CBC_EXT_BRANCH_IF_NOT_EQUAL, \
+                             NOT_EQUAL) \
+  CBC_EXT_BRANCH_IF_COMPARE (CBC_EXT_BRANCH_IF_STRICT_EQUAL, \
+                             STRICT_EQUAL) \
+  CBC_EXT_BRANCH_IF_COMPARE (CBC_EXT_BRANCH_IF_STRICT_NOT_EQUAL, \
+                             STRICT_NOT_EQUAL) \
+  CBC_EXT_BRANCH_IF_COMPARE (CBC_EXT_BRANCH_IF_LESS, \
+                             LESS) \
+  CBC_EXT_BRANCH_IF_COMPARE (CBC_EXT_BRANCH_IF_GREATER, \
+                             GREATER) \
+  CBC_EXT_BRANCH_IF_COMPARE (CBC_EXT_BRANCH_IF_LESS_EQUAL, \
+                             LESS_EQUAL) \
+  CBC_EXT_BRANCH_IF_COMPARE (CBC_EXT_BRANCH_IF_GREATER_EQUAL, \
+                             GREATER_EQUAL) \
+  \
   /* Basic opcodes. */ \
   CBC_OPCODE (CBC_EXT_DEBUGGER, CBC_NO_FLAG, 0, \
               VM_OC_NONE) \
@@ -589,6 +655,32 @@
   CBC_EXT_BINARY_LVALUE_BLOCK_OPERATION (CBC_EXT_ASSIGN_BIT_XOR, \
                                          BIT_XOR) \
   \
+  /* Binary operations combined with an assignment to an identifier. These superinstructions \
+   * were chosen by the byte code sequence statistics (see tools/vm-sequence-stats.sh), \
+   * and must be in the same order as the binary arithmetic opcodes. */ \
+  CBC_EXT_BINARY_OPERATION_SET_IDENT (CBC_EXT_BIT_OR, \
+                                      BIT_OR) \
+  CBC_EXT_BINARY_OPERATION_SET_IDENT (CBC_EXT_BIT_XOR, \
+                                      BIT_XOR) \
+  CBC_EXT_BINARY_OPERATION_SET_IDENT (CBC_EXT_BIT_AND, \
+                                      BIT_AND) \
+  CBC_EXT_BINARY_OPERATION_SET_IDENT (CBC_EXT_LEFT_SHIFT, \
+                                      LEFT_SHIFT) \
+  CBC_EXT_BINARY_OPERATION_SET_IDENT (CBC_EXT_RIGHT_SHIFT, \
+                                      RIGHT_SHIFT) \
+  CBC_EXT_BINARY_OPERATION_SET_IDENT (CBC_EXT_UNS_RIGHT_SHIFT, \
+                                      UNS_RIGHT_SHIFT) \
+  CBC_EXT_BINARY_OPERATION_SET_IDENT (CBC_EXT_ADD, \
+                                      ADD) \
+  CBC_EXT_BINARY_OPERATION_SET_IDENT (CBC_EXT_SUBTRACT, \
+                                      SUB) \
+  CBC_EXT_BINARY_OPERATION_SET_IDENT (CBC_EXT_MULTIPLY, \
+                                      MUL) \
+  CBC_EXT_BINARY_OPERATION_SET_IDENT (CBC_EXT_DIVIDE, \
+                                      DIV) \
+  CBC_EXT_BINARY_OPERATION_SET_IDENT (CBC_EXT_MODULO, \
+                                      MOD) \
+  \
   /* Last opcode (not a real opcode). */ \
   CBC_OPCODE (CBC_EXT_END, CBC_NO_FLAG, 0, \
               VM_OC_NONE)
@@ -602,6 +694,33 @@
 #define CBC_HIGHEST_BIT_MASK 0x80
 #define CBC_LOWER_SEVEN_BIT_MASK 0x7f
 
+/**
+ * Property access opcodes are followed by a one byte inline cache index.
+ * Since the index is stored before the literal arguments, the cbc_flags
+ * are not affected.
+ */
+#define CBC_HAS_INLINE_CACHE_ARG(op) \
+  (((op) >= CBC_PUSH_PROP && (op) <= CBC_PUSH_PROP_THIS_LITERAL) \
+   || ((op) >= CBC_PUSH_PROP_REFERENCE && (op) <= CBC_PUSH_PROP_THIS_LITERAL_REFERENCE) \
+   || ((op) >= CBC_ASSIGN && (op) <= CBC_ASSIGN_BLOCK) \
+   || ((op) >= CBC_ASSIGN_PROP_LITERAL && (op) <= CBC_ASSIGN_PROP_THIS_LITERAL_BLOCK))
+
+/**
+ * Maximum number of inline caches of a compiled code. Sites
+ * above this limit are marked with CBC_NO_INLINE_CACHE.
+ */
+#define CBC_MAXIMUM_INLINE_CACHE_COUNT 255
+#define CBC_NO_INLINE_CACHE 255
+
+/**
+ * Number of scope caches of a compiled code: one for each
+ * identifier, if the code has static scope (see ecma_scope_cache_t).
+ */
+#define CBC_SCOPE_CACHE_COUNT(bytecode_p, args_p) \
+  (((bytecode_p)->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE) \
+   ? (uint32_t) ((args_p)->ident_end - (args_p)->register_end) \
+   : 0u)
+
 /**
  * Literal indicies belong to one of the following groups:
  *
@@ -624,6 +743,10 @@ typedef struct
   uint8_t ident_end;                /**< end position of the identifier group */
   uint8_t const_literal_end;        /**< end position of the const literal group */
   uint8_t literal_end;              /**< end position of the literal group */
+  mem_cpointer_t inline_cache_cp;   /**< inline cache table (allocated on first use) */
+  uint8_t inline_cache_count;       /**< number of inline caches */
+  uint8_t binding_count;            /**< number of bindings created in the lexical environment
+                                     *   of the function before its code is executed */
 } cbc_uint8_arguments_t;
 
 /**
@@ -638,6 +761,10 @@ typedef struct
   uint16_t ident_end;               /**< end position of the identifier group */
   uint16_t const_literal_end;       /**< end position of the const literal group */
   uint16_t literal_end;             /**< end position of the literal group */
+  mem_cpointer_t inline_cache_cp;   /**< inline cache table (allocated on first use) */
+  uint8_t inline_cache_count;       /**< number of inline caches */
+  uint8_t binding_count;            /**< number of bindings created in the lexical environment
+                                     *   of the function before its code is executed */
 } cbc_uint16_arguments_t;
 
 /* When CBC_CODE_FLAGS_FULL_LITERAL_ENCODING
@@ -648,6 +775,7 @@ typedef struct
 #define CBC_CODE_FLAGS_STRICT_MODE 0x08
 #define CBC_CODE_FLAGS_ARGUMENTS_NEEDED 0x10
 #define CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED 0x20
+#define CBC_CODE_FLAGS_STATIC_SCOPE 0x40
 
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg1,
 
@@ -1180,6 +1180,7 @@ lexer_process_char_literal (parser_context_t *context_p, /**< context */
         && literal_p->prop.length == length
         && memcmp (literal_p->u.char_p, char_p, length) == 0)
     {
+      literal_p->status_flags = (uint8_t) (literal_p->status_flags & ~LEXER_FLAG_UNUSED_IDENT);
       context_p->lit_object.literal_p = literal_p;
       context_p->lit_object.index = (uint16_t) literal_index;
       return;
@@ -1616,6 +1617,7 @@ lexer_construct_function_object (parser_context_t *context_p, /**< context */
 {
   ecma_compiled_code_t *compiled_code_p;
   lexer_literal_t *literal_p;
+  uint16_t literal_index;
 
   if (context_p->literal_count >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
   {
@@ -1627,12 +1629,11 @@ lexer_construct_function_object (parser_context_t *context_p, /**< context */
     extra_status_flags |= PARSER_RESOLVE_THIS_FOR_CALLS;
   }
 
-  context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
-
   literal_p = (lexer_literal_t *) parser_list_append (context_p, &context_p->literal_pool);
   literal_p->type = LEXER_UNUSED_LITERAL;
   literal_p->status_flags = 0;
 
+  literal_index = context_p->literal_count;
   context_p->literal_count++;
 
   compiled_code_p = parser_parse_function (context_p, extra_status_flags);
@@ -1640,7 +1641,11 @@ lexer_construct_function_object (parser_context_t *context_p, /**< context */
   literal_p->u.bytecode_p = compiled_code_p;
 
   literal_p->type = LEXER_FUNCTION_LITERAL;
-  context_p->status_flags |= PARSER_NO_REG_STORE;
+
+  /* Identifiers captured by the function might be appended to the literal pool. */
+  context_p->lit_object.literal_p = literal_p;
+  context_p->lit_object.index = literal_index;
+  context_p->lit_object.type = LEXER_LITERAL_OBJECT_ANY;
 } /* lexer_construct_function_object */
 
 /**
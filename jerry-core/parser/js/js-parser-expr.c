@@ -40,12 +40,120 @@ static const uint8_t parser_binary_precedence_table[36] =
   13, 13, 14, 14, 14
 };
 
+/**
+ * Number of operand forms of a binary operation.
+ */
+#define PARSER_BINARY_OPERATION_FORMS (CBC_BINARY_WITH_TWO_LITERALS + 1)
+
+/**
+ * Combine the last binary arithmetic opcode and an assignment
+ * to an identifier into a single opcode.
+ */
+static void
+parser_emit_binary_operation_set_ident (parser_context_t *context_p, /**< context */
+                                        uint16_t literal_index) /**< literal index of the identifier */
+{
+  uint16_t opcode = context_p->last_cbc_opcode;
+  uint16_t index;
+
+  JERRY_ASSERT (PARSER_IS_BINARY_ARITHMETIC (opcode));
+
+  if (opcode < CBC_LEFT_SHIFT)
+  {
+    index = (uint16_t) (opcode - CBC_BIT_OR);
+  }
+  else
+  {
+    index = (uint16_t) (opcode - CBC_LEFT_SHIFT + (CBC_EQUAL - CBC_BIT_OR));
+  }
+
+  /* The identifier is the argument which follows the arguments of the binary operation. */
+  switch (index % PARSER_BINARY_OPERATION_FORMS)
+  {
+    case 0:
+    {
+      context_p->last_cbc.literal_index = literal_index;
+      break;
+    }
+    case CBC_BINARY_WITH_LITERAL:
+    {
+      context_p->last_cbc.value = literal_index;
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (index % PARSER_BINARY_OPERATION_FORMS == CBC_BINARY_WITH_TWO_LITERALS);
+      context_p->last_cbc.third_literal_index = literal_index;
+      break;
+    }
+  }
+
+  context_p->last_cbc_opcode = (uint16_t) (PARSER_TO_EXT_OPCODE (CBC_EXT_BIT_OR_SET_IDENT)
+                                           + (index / PARSER_BINARY_OPERATION_FORMS)
+                                             * CBC_BINARY_OPERATION_SET_IDENT_LENGTH
+                                           + index % PARSER_BINARY_OPERATION_FORMS);
+} /* parser_emit_binary_operation_set_ident */
+
+/**
+ * Split the last binary operation combined with an assignment to
+ * an identifier into its original opcodes. This is needed when the
+ * result of the assignment is used.
+ */
+static void
+parser_split_binary_operation_set_ident (parser_context_t *context_p) /**< context */
+{
+  uint16_t index = (uint16_t) (PARSER_GET_EXT_OPCODE (context_p->last_cbc_opcode) - CBC_EXT_BIT_OR_SET_IDENT);
+  uint16_t form = (uint16_t) (index % CBC_BINARY_OPERATION_SET_IDENT_LENGTH);
+  uint16_t literal_index;
+
+  JERRY_ASSERT (PARSER_IS_BINARY_OPERATION_SET_IDENT (context_p->last_cbc_opcode)
+                && form < CBC_BINARY_OPERATION_SET_IDENT_BLOCK);
+
+  index = (uint16_t) ((index / CBC_BINARY_OPERATION_SET_IDENT_LENGTH) * PARSER_BINARY_OPERATION_FORMS + form);
+
+  switch (form)
+  {
+    case 0:
+    {
+      literal_index = context_p->last_cbc.literal_index;
+      break;
+    }
+    case CBC_BINARY_WITH_LITERAL:
+    {
+      literal_index = context_p->last_cbc.value;
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (form == CBC_BINARY_WITH_TWO_LITERALS);
+      literal_index = context_p->last_cbc.third_literal_index;
+      break;
+    }
+  }
+
+  if (index < CBC_EQUAL - CBC_BIT_OR)
+  {
+    context_p->last_cbc_opcode = (uint16_t) (CBC_BIT_OR + index);
+  }
+  else
+  {
+    context_p->last_cbc_opcode = (uint16_t) (CBC_LEFT_SHIFT + index - (CBC_EQUAL - CBC_BIT_OR));
+  }
+
+  parser_emit_cbc_literal (context_p, CBC_ASSIGN_SET_IDENT, literal_index);
+} /* parser_split_binary_operation_set_ident */
+
 /**
  * Generate byte code for operators with lvalue.
  */
 static PARSER_INLINE void
 parser_push_result (parser_context_t *context_p) /**< context */
 {
+  if (PARSER_IS_BINARY_OPERATION_SET_IDENT (context_p->last_cbc_opcode))
+  {
+    parser_split_binary_operation_set_ident (context_p);
+  }
+
   if (CBC_NO_RESULT_COMPOUND_ASSIGMENT (context_p->last_cbc_opcode))
   {
     context_p->last_cbc_opcode = (uint16_t) PARSER_TO_BINARY_OPERATION_WITH_RESULT (context_p->last_cbc_opcode);
@@ -389,7 +497,7 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
 
       JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_LITERAL);
       context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (opcode);
-      context_p->last_cbc.value = (uint16_t) (context_p->literal_count - 1);
+      context_p->last_cbc.value = context_p->lit_object.index;
 
       lexer_next_token (context_p);
     }
@@ -587,20 +695,20 @@ parser_parse_unary_expression (parser_context_t *context_p, /**< context */
       {
         context_p->last_cbc_opcode = CBC_PUSH_TWO_LITERALS;
         context_p->last_cbc.literal_index = literal1;
-        context_p->last_cbc.value = (uint16_t) (context_p->literal_count - 1);
+        context_p->last_cbc.value = context_p->lit_object.index;
       }
       else if (literals == 2)
       {
         context_p->last_cbc_opcode = CBC_PUSH_THREE_LITERALS;
         context_p->last_cbc.literal_index = literal1;
         context_p->last_cbc.value = literal2;
-        context_p->last_cbc.third_literal_index = (uint16_t) (context_p->literal_count - 1);
+        context_p->last_cbc.third_literal_index = context_p->lit_object.index;
       }
       else
       {
         parser_emit_cbc_literal (context_p,
                                  CBC_PUSH_LITERAL,
-                                 (uint16_t) (context_p->literal_count - 1));
+                                 context_p->lit_object.index);
       }
 
       context_p->last_cbc.literal_type = LEXER_FUNCTION_LITERAL;
@@ -765,7 +873,10 @@ parser_process_unary_expression (parser_context_t *context_p) /**< context */
               && context_p->last_cbc.literal_object_type == LEXER_LITERAL_OBJECT_EVAL)
           {
             JERRY_ASSERT (context_p->last_cbc.literal_type == LEXER_IDENT_LITERAL);
-            context_p->status_flags |= PARSER_ARGUMENTS_NEEDED | PARSER_LEXICAL_ENV_NEEDED | PARSER_NO_REG_STORE;
+            context_p->status_flags |= (PARSER_ARGUMENTS_NEEDED
+                                         | PARSER_LEXICAL_ENV_NEEDED
+                                         | PARSER_NO_REG_STORE
+                                         | PARSER_NO_STATIC_SCOPE);
             is_eval = PARSER_TRUE;
           }
 
@@ -1246,6 +1357,13 @@ parser_process_binary_opcodes (parser_context_t *context_p, /**< context */
         }
       }
 
+      if (opcode == CBC_ASSIGN_SET_IDENT
+          && PARSER_IS_BINARY_ARITHMETIC (context_p->last_cbc_opcode))
+      {
+        parser_emit_binary_operation_set_ident (context_p, parser_stack_pop_uint16 (context_p));
+        continue;
+      }
+
       if (cbc_flags[opcode] & CBC_HAS_LITERAL_ARG)
       {
         uint16_t index = parser_stack_pop_uint16 (context_p);
@@ -1425,7 +1543,8 @@ parser_parse_expression (parser_context_t *context_p, /**< context */
     {
       if (!(options & PARSE_EXPR_NO_COMMA) || grouping_level > 0)
       {
-        if (!CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode))
+        if (!CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode)
+            && !PARSER_IS_BINARY_OPERATION_SET_IDENT (context_p->last_cbc_opcode))
         {
           parser_emit_cbc (context_p, CBC_POP);
         }
@@ -1461,7 +1580,8 @@ parser_parse_expression (parser_context_t *context_p, /**< context */
 
   if (options & PARSE_EXPR_STATEMENT)
   {
-    if (!CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode))
+    if (!CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode)
+        && !PARSER_IS_BINARY_OPERATION_SET_IDENT (context_p->last_cbc_opcode))
     {
       parser_emit_cbc (context_p, CBC_POP);
     }
@@ -1479,6 +1599,11 @@ parser_parse_expression (parser_context_t *context_p, /**< context */
       PARSER_PLUS_EQUAL_U16 (context_p->last_cbc_opcode, 2);
       parser_flush_cbc (context_p);
     }
+    else if (PARSER_IS_BINARY_OPERATION_SET_IDENT (context_p->last_cbc_opcode))
+    {
+      PARSER_PLUS_EQUAL_U16 (context_p->last_cbc_opcode, CBC_BINARY_OPERATION_SET_IDENT_BLOCK);
+      parser_flush_cbc (context_p);
+    }
     else
     {
       if (CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode))
@@ -51,6 +51,7 @@
 #define PARSER_ARGUMENTS_NOT_NEEDED           0x04000u
 #define PARSER_LEXICAL_ENV_NEEDED             0x08000u
 #define PARSER_HAS_LATE_LIT_INIT              0x10000u
+#define PARSER_NO_STATIC_SCOPE                0x20000u
 
 /* Expression parsing flags. */
 #define PARSE_EXPR                            0x00
@@ -59,7 +60,9 @@
 #define PARSE_EXPR_NO_COMMA                   0x04
 #define PARSE_EXPR_HAS_LITERAL                0x08
 
-/* The maximum of PARSER_CBC_STREAM_PAGE_SIZE is 127. */
+/* The maximum of PARSER_CBC_STREAM_PAGE_SIZE is 63, since the post processing
+ * may double the size of a page (see CBC_HAS_INLINE_CACHE_ARG) and the offsets
+ * of the copied bytes must fit into seven bits. */
 #define PARSER_CBC_STREAM_PAGE_SIZE \
   ((uint32_t) (64 - sizeof (void *)))
 
@@ -113,6 +116,21 @@ typedef struct
 #define PARSER_TO_BINARY_OPERATION_WITH_BLOCK(opcode) \
   ((uint16_t) (PARSER_TO_EXT_OPCODE(opcode) - CBC_ASSIGN_ADD + CBC_EXT_ASSIGN_ADD_BLOCK))
 
+#define PARSER_IS_BINARY_COMPARE(opcode) \
+  ((opcode) >= CBC_EQUAL && (opcode) <= CBC_GREATER_EQUAL_TWO_LITERALS)
+
+#define PARSER_TO_BRANCH_IF_COMPARE(opcode) \
+  ((uint16_t) (PARSER_TO_EXT_OPCODE (CBC_EXT_BRANCH_IF_EQUAL) \
+               + ((opcode) - CBC_EQUAL) * CBC_BRANCH_IF_COMPARE_FORM_LENGTH))
+
+#define PARSER_IS_BINARY_ARITHMETIC(opcode) \
+  (((opcode) >= CBC_BIT_OR && (opcode) <= CBC_BIT_AND_TWO_LITERALS) \
+   || ((opcode) >= CBC_LEFT_SHIFT && (opcode) <= CBC_MODULO_TWO_LITERALS))
+
+#define PARSER_IS_BINARY_OPERATION_SET_IDENT(opcode) \
+  ((opcode) >= PARSER_TO_EXT_OPCODE (CBC_EXT_BIT_OR_SET_IDENT) \
+   && (opcode) <= PARSER_TO_EXT_OPCODE (CBC_EXT_MODULO_TWO_LITERALS_SET_IDENT_BLOCK))
+
 #define PARSER_GET_FLAGS(op) \
   (PARSER_IS_BASIC_OPCODE (op) ? cbc_flags[(op)] : cbc_ext_flags[PARSER_GET_EXT_OPCODE (op)])
 
@@ -287,6 +305,7 @@ void *parser_malloc (parser_context_t *, size_t);
 void parser_free (void *, size_t);
 void *parser_malloc_local (parser_context_t *, size_t);
 void parser_free_local (void *, size_t);
+void parser_arena_free (void);
 
 /* Parser byte stream. */
 
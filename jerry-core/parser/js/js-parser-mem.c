@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "jcontext.h"
 #include "js-parser-internal.h"
 
 /** \addtogroup mem Memory allocation
@@ -27,9 +28,105 @@
 /* Memory allocation                                                  */
 /**********************************************************************/
 
+/**
+ * Index of the free list of the parser arena, which holds the blocks of the given size.
+ */
+#define PARSER_ARENA_FREE_LIST_INDEX(size) ((JERRY_ALIGNUP (size, MEM_ALIGNMENT) >> MEM_ALIGNMENT_LOG) - 1)
+
+/**
+ * Size of the header of a parser arena chunk, which links the chunk to the previous one.
+ */
+#define PARSER_ARENA_CHUNK_HEADER_SIZE JERRY_ALIGNUP (sizeof (uint8_t *), MEM_ALIGNMENT)
+
+JERRY_STATIC_ASSERT (CONFIG_PARSER_ARENA_MAX_BLOCK_SIZE % MEM_ALIGNMENT == 0
+                     && CONFIG_PARSER_ARENA_MAX_BLOCK_SIZE + PARSER_ARENA_CHUNK_HEADER_SIZE
+                        <= CONFIG_PARSER_ARENA_CHUNK_SIZE,
+                     parser_arena_chunk_must_hold_the_largest_arena_block);
+
+/**
+ * Allocate a block from the parser arena.
+ *
+ * The blocks are taken from the free list of their size first, and bumped
+ * from the last chunk otherwise. The chunks are released all at once by
+ * parser_arena_free after the parsing is completed.
+ *
+ * @return allocated memory - if success
+ *         NULL - otherwise
+ */
+static void *
+parser_arena_alloc (size_t size) /**< size of the memory block */
+{
+  void **free_list_p = JERRY_CONTEXT (parser_arena_free_blocks) + PARSER_ARENA_FREE_LIST_INDEX (size);
+
+  if (*free_list_p != NULL)
+  {
+    void *result = *free_list_p;
+    *free_list_p = *(void **) result;
+    return result;
+  }
+
+  size = JERRY_ALIGNUP (size, MEM_ALIGNMENT);
+
+  if ((size_t) (JERRY_CONTEXT (parser_arena_end_p) - JERRY_CONTEXT (parser_arena_free_p)) < size)
+  {
+    uint8_t *chunk_p = (uint8_t *) mem_heap_alloc_block (CONFIG_PARSER_ARENA_CHUNK_SIZE);
+
+    if (chunk_p == NULL)
+    {
+      return NULL;
+    }
+
+    *(uint8_t **) chunk_p = JERRY_CONTEXT (parser_arena_chunk_p);
+    JERRY_CONTEXT (parser_arena_chunk_p) = chunk_p;
+    JERRY_CONTEXT (parser_arena_free_p) = chunk_p + PARSER_ARENA_CHUNK_HEADER_SIZE;
+    JERRY_CONTEXT (parser_arena_end_p) = chunk_p + CONFIG_PARSER_ARENA_CHUNK_SIZE;
+  }
+
+  void *result = JERRY_CONTEXT (parser_arena_free_p);
+  JERRY_CONTEXT (parser_arena_free_p) += size;
+  return result;
+} /* parser_arena_alloc */
+
+/**
+ * Return a block to the free list of its size in the parser arena.
+ */
+static void
+parser_arena_free_block (void *ptr, /**< pointer to free */
+                         size_t size) /**< size of the memory block */
+{
+  void **free_list_p = JERRY_CONTEXT (parser_arena_free_blocks) + PARSER_ARENA_FREE_LIST_INDEX (size);
+
+  *(void **) ptr = *free_list_p;
+  *free_list_p = ptr;
+} /* parser_arena_free_block */
+
+/**
+ * Release the chunks of the parser arena.
+ */
+void
+parser_arena_free (void)
+{
+  uint8_t *chunk_p = JERRY_CONTEXT (parser_arena_chunk_p);
+
+  while (chunk_p != NULL)
+  {
+    uint8_t *next_p = *(uint8_t **) chunk_p;
+
+    mem_heap_free_block (chunk_p, CONFIG_PARSER_ARENA_CHUNK_SIZE);
+    chunk_p = next_p;
+  }
+
+  JERRY_CONTEXT (parser_arena_chunk_p) = NULL;
+  JERRY_CONTEXT (parser_arena_free_p) = NULL;
+  JERRY_CONTEXT (parser_arena_end_p) = NULL;
+  memset (JERRY_CONTEXT (parser_arena_free_blocks), 0, sizeof (JERRY_CONTEXT (parser_arena_free_blocks)));
+} /* parser_arena_free */
+
 /**
  * Allocate memory.
  *
+ * The small blocks are allocated from the parser arena, the larger ones from the heap.
+ *
  * @return allocated memory.
  */
 void *
@@ -39,7 +136,16 @@ parser_malloc (parser_context_t *context_p, /**< context */
   void *result;
 
   JERRY_ASSERT (size > 0);
-  result = mem_heap_alloc_block (size);
+
+  if (size <= CONFIG_PARSER_ARENA_MAX_BLOCK_SIZE)
+  {
+    result = parser_arena_alloc (size);
+  }
+  else
+  {
+    result = mem_heap_alloc_block (size);
+  }
+
   if (result == 0)
   {
     parser_raise_error (context_p, PARSER_ERR_OUT_OF_MEMORY);
@@ -53,7 +159,14 @@ parser_malloc (parser_context_t *context_p, /**< context */
 void parser_free (void *ptr, /**< pointer to free */
                   size_t size) /**< size of the memory block */
 {
-  mem_heap_free_block (ptr, size);
+  if (size <= CONFIG_PARSER_ARENA_MAX_BLOCK_SIZE)
+  {
+    parser_arena_free_block (ptr, size);
+  }
+  else
+  {
+    mem_heap_free_block (ptr, size);
+  }
 } /* parser_free */
 
 /**
@@ -65,15 +178,7 @@ void *
 parser_malloc_local (parser_context_t *context_p, /**< context */
                      size_t size) /**< size of the memory */
 {
-  void *result;
-
-  JERRY_ASSERT (size > 0);
-  result = mem_heap_alloc_block (size);
-  if (result == 0)
-  {
-    parser_raise_error (context_p, PARSER_ERR_OUT_OF_MEMORY);
-  }
-  return result;
+  return parser_malloc (context_p, size);
 } /* parser_malloc_local */
 
 /**
@@ -82,7 +187,7 @@ parser_malloc_local (parser_context_t *context_p, /**< context */
 void parser_free_local (void *ptr, /**< pointer to free */
                         size_t size) /**< size of the memory */
 {
-  mem_heap_free_block (ptr, size);
+  parser_free (ptr, size);
 } /* parser_free_local */
 
 /**********************************************************************/
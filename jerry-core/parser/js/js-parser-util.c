@@ -458,6 +458,11 @@ parser_emit_cbc_forward_branch_item (parser_context_t *context_p, /**< context *
 
 /**
  * Append a byte code with a branch argument
+ *
+ * Note:
+ *      when a CBC_BRANCH_IF_TRUE_BACKWARD follows a comparison, the
+ *      comparison is fused into the branch, and its literal arguments
+ *      are appended after the branch offset
  */
 void
 parser_emit_cbc_backward_branch (parser_context_t *context_p, /**< context */
@@ -465,11 +470,21 @@ parser_emit_cbc_backward_branch (parser_context_t *context_p, /**< context */
                                  uint32_t offset) /**< destination offset */
 {
   uint8_t flags;
+  uint16_t literal_index = 0;
+  uint16_t second_literal_index = 0;
 #ifdef PARSER_DUMP_BYTE_CODE
   const char *name;
 #endif /* PARSER_DUMP_BYTE_CODE */
 
-  if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
+  if (opcode == CBC_BRANCH_IF_TRUE_BACKWARD
+      && PARSER_IS_BINARY_COMPARE (context_p->last_cbc_opcode))
+  {
+    opcode = PARSER_TO_BRANCH_IF_COMPARE (context_p->last_cbc_opcode);
+    literal_index = context_p->last_cbc.literal_index;
+    second_literal_index = context_p->last_cbc.value;
+    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+  }
+  else if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
     parser_flush_cbc (context_p);
   }
@@ -550,6 +565,24 @@ parser_emit_cbc_backward_branch (parser_context_t *context_p, /**< context */
   }
 
   PARSER_APPEND_TO_BYTE_CODE (context_p, offset & 0xff);
+
+  if (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
+  {
+    JERRY_ASSERT (flags & CBC_HAS_LITERAL_ARG);
+
+    parser_emit_two_bytes (context_p,
+                           (uint8_t) (literal_index & 0xff),
+                           (uint8_t) (literal_index >> 8));
+    context_p->byte_code_size += 2;
+
+    if (flags & CBC_HAS_LITERAL_ARG2)
+    {
+      parser_emit_two_bytes (context_p,
+                             (uint8_t) (second_literal_index & 0xff),
+                             (uint8_t) (second_literal_index >> 8));
+      context_p->byte_code_size += 2;
+    }
+  }
 } /* parser_emit_cbc_backward_branch */
 
 #undef PARSER_CHECK_LAST_POSITION
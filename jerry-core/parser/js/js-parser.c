@@ -14,15 +14,13 @@
  * limitations under the License.
  */
 
+#include "ecma-alloc.h"
 #include "ecma-helpers.h"
 #include "jerry-snapshot.h"
 #include "js-parser-internal.h"
 #include "lit-literal.h"
 #include "lit-cpointer.h"
-
-#ifdef PARSER_DUMP_BYTE_CODE
-static int parser_show_instrs = PARSER_FALSE;
-#endif /* PARSER_DUMP_BYTE_CODE */
+#include "jcontext.h"
 
 /** \addtogroup parser Parser
  * @{
@@ -76,6 +74,20 @@ parser_compute_indicies (parser_context_t *context_p, /**< context */
   parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
   while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)))
   {
+    if (literal_p->type == LEXER_IDENT_LITERAL
+        && (literal_p->status_flags & (LEXER_FLAG_VAR | LEXER_FLAG_UNUSED_IDENT)) == LEXER_FLAG_UNUSED_IDENT)
+    {
+      /* Identifiers captured by nested functions, which are neither declared
+       * nor referenced by this function, are not part of the literal pool. */
+      if (!(literal_p->status_flags & LEXER_FLAG_SOURCE_PTR))
+      {
+        mem_heap_free_block_size_stored ((void *) literal_p->u.char_p);
+      }
+
+      literal_p->type = LEXER_UNUSED_LITERAL;
+      literal_p->status_flags = 0;
+    }
+
 #ifndef PARSER_DUMP_BYTE_CODE
     if (literal_p->type == LEXER_IDENT_LITERAL
         || literal_p->type == LEXER_STRING_LITERAL)
@@ -201,6 +213,13 @@ parser_compute_indicies (parser_context_t *context_p, /**< context */
     }
   }
 
+  if (uninitialized_var_count > 0 || initialized_var_count > 0)
+  {
+    /* Variables which are not stored in registers are bound in the lexical environment. */
+    status_flags |= PARSER_LEXICAL_ENV_NEEDED;
+    context_p->status_flags = status_flags;
+  }
+
   if (context_p->literal_count <= CBC_MAXIMUM_SMALL_VALUE)
   {
     literal_one_byte_limit = CBC_MAXIMUM_BYTE_VALUE - 1;
@@ -558,7 +577,10 @@ parser_generate_initializers (parser_context_t *context_p, /**< context */
 
       JERRY_ASSERT (literal_p->type == LEXER_IDENT_LITERAL);
 
-      context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
+      if (literal_p->status_flags & LEXER_FLAG_NO_REG_STORE)
+      {
+        context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
+      }
 
       if (literal_p->status_flags & LEXER_FLAG_FUNCTION_NAME)
       {
@@ -1019,6 +1041,8 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
   uint16_t ident_end;
   uint16_t const_literal_end;
   uint16_t literal_end;
+  uint16_t inline_cache_count;
+  uint16_t binding_count;
 
   if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
   {
@@ -1029,6 +1053,8 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
     ident_end = args->ident_end;
     const_literal_end = args->const_literal_end;
     literal_end = args->literal_end;
+    inline_cache_count = args->inline_cache_count;
+    binding_count = args->binding_count;
   }
   else
   {
@@ -1039,6 +1065,8 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
     ident_end = args->ident_end;
     const_literal_end = args->const_literal_end;
     literal_end = args->literal_end;
+    inline_cache_count = args->inline_cache_count;
+    binding_count = args->binding_count;
   }
 
   printf ("\nFinal byte code dump:\n\n  Maximum stack depth: %d\n  Flags: [", (int) stack_limit);
@@ -1076,13 +1104,20 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
     printf (",no_lexical_env");
   }
 
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE)
+  {
+    printf (",static_scope");
+  }
+
   printf ("]\n");
 
   printf ("  Argument range end: %d\n", (int) argument_end);
   printf ("  Register range end: %d\n", (int) register_end);
   printf ("  Identifier range end: %d\n", (int) ident_end);
   printf ("  Const literal range end: %d\n", (int) const_literal_end);
-  printf ("  Literal range end: %d\n\n", (int) literal_end);
+  printf ("  Literal range end: %d\n", (int) literal_end);
+  printf ("  Inline caches: %d\n", (int) inline_cache_count);
+  printf ("  Lexical environment bindings: %d\n\n", (int) binding_count);
 
   byte_code_start_p = (uint8_t *) compiled_code_p;
 
@@ -1147,6 +1182,12 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
         printf (" number:%d\n", value);
         continue;
       }
+
+      if (CBC_HAS_INLINE_CACHE_ARG (opcode))
+      {
+        printf (" ic:%d", (int) *byte_code_p);
+        byte_code_p++;
+      }
     }
     else
     {
@@ -1156,6 +1197,32 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
       byte_code_p += 2;
     }
 
+    if (flags & CBC_HAS_BRANCH_ARG)
+    {
+      size_t branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
+      size_t offset = 0;
+
+      if (opcode == CBC_EXT_OPCODE)
+      {
+        branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (ext_opcode);
+      }
+
+      do
+      {
+        offset = (offset << 8) | *byte_code_p++;
+      }
+      while (--branch_offset_length > 0);
+
+      if (CBC_BRANCH_IS_FORWARD (flags))
+      {
+        printf (" offset:%d(->%d)", (int) offset, (int) (cbc_offset + offset));
+      }
+      else
+      {
+        printf (" offset:%d(->%d)", (int) offset, (int) (cbc_offset - offset));
+      }
+    }
+
     if (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
     {
       uint16_t literal_index;
@@ -1183,32 +1250,6 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
       printf (" byte_arg:%d", *byte_code_p);
       byte_code_p++;
     }
-
-    if (flags & CBC_HAS_BRANCH_ARG)
-    {
-      size_t branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
-      size_t offset = 0;
-
-      if (opcode == CBC_EXT_OPCODE)
-      {
-        branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (ext_opcode);
-      }
-
-      do
-      {
-        offset = (offset << 8) | *byte_code_p++;
-      }
-      while (--branch_offset_length > 0);
-
-      if (CBC_BRANCH_IS_FORWARD (flags))
-      {
-        printf (" offset:%d(->%d)", (int) offset, (int) (cbc_offset + offset));
-      }
-      else
-      {
-        printf (" offset:%d(->%d)", (int) offset, (int) (cbc_offset - offset));
-      }
-    }
     printf ("\n");
   }
 } /* parse_print_final_cbc */
@@ -1259,6 +1300,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   size_t initializers_length;
   uint8_t real_offset;
   uint8_t *byte_code_p;
+  uint32_t inline_cache_count;
+  uint32_t inline_cache_index;
+  uint32_t binding_count;
   int needs_uint16_arguments;
   cbc_opcode_t last_opcode = CBC_EXT_OPCODE;
   ecma_compiled_code_t *compiled_code_p;
@@ -1296,6 +1340,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
   page_p = context_p->byte_code.first_p;
   offset = 0;
+  inline_cache_count = 0;
 
   while (page_p != last_page_p || offset < last_position)
   {
@@ -1310,6 +1355,17 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     flags = cbc_flags[last_opcode];
     length++;
 
+    if (CBC_HAS_INLINE_CACHE_ARG (last_opcode))
+    {
+      /* Space for the inline cache index. */
+      length++;
+
+      if (inline_cache_count < CBC_MAXIMUM_INLINE_CACHE_COUNT)
+      {
+        inline_cache_count++;
+      }
+    }
+
     if (last_opcode == CBC_EXT_OPCODE)
     {
       cbc_ext_opcode_t ext_opcode;
@@ -1321,6 +1377,57 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       length++;
     }
 
+    if (flags & CBC_HAS_BRANCH_ARG)
+    {
+      int prefix_zero = PARSER_TRUE;
+#if PARSER_MAXIMUM_CODE_SIZE <= 65535
+      cbc_opcode_t jump_forward = CBC_JUMP_FORWARD_2;
+#else /* PARSER_MAXIMUM_CODE_SIZE > 65535 */
+      cbc_opcode_t jump_forward = CBC_JUMP_FORWARD_3;
+#endif /* PARSER_MAXIMUM_CODE_SIZE <= 65535 */
+
+      /* The leading zeroes are dropped from the stream.
+       * Although dropping these zeroes for backward
+       * branches are unnecessary, we use the same
+       * code path for simplicity. */
+      JERRY_ASSERT (branch_offset_length > 0 && branch_offset_length <= 3);
+
+      while (--branch_offset_length > 0)
+      {
+        uint8_t byte = page_p->bytes[offset];
+        if (byte > 0 || !prefix_zero)
+        {
+          prefix_zero = PARSER_FALSE;
+          length++;
+        }
+        else
+        {
+          JERRY_ASSERT (CBC_BRANCH_IS_FORWARD (flags));
+        }
+        PARSER_NEXT_BYTE (page_p, offset);
+      }
+
+      if (last_opcode == jump_forward
+          && prefix_zero
+          && page_p->bytes[offset] == CBC_BRANCH_OFFSET_LENGTH (jump_forward) + 1)
+      {
+        /* Uncoditional jumps which jump right after the instruction
+         * are effectively NOPs. These jumps are removed from the
+         * stream. The 1 byte long CBC_JUMP_FORWARD form marks these
+         * instructions, since this form is constructed during post
+         * processing and cannot be emitted directly. */
+        *opcode_p = CBC_JUMP_FORWARD;
+        length--;
+      }
+      else
+      {
+        /* Other last bytes are always copied. */
+        length++;
+      }
+
+      PARSER_NEXT_BYTE (page_p, offset);
+    }
+
     while (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
     {
       uint8_t *first_byte = page_p->bytes + offset;
@@ -1389,57 +1496,6 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       PARSER_NEXT_BYTE (page_p, offset);
       length++;
     }
-
-    if (flags & CBC_HAS_BRANCH_ARG)
-    {
-      int prefix_zero = PARSER_TRUE;
-#if PARSER_MAXIMUM_CODE_SIZE <= 65535
-      cbc_opcode_t jump_forward = CBC_JUMP_FORWARD_2;
-#else /* PARSER_MAXIMUM_CODE_SIZE > 65535 */
-      cbc_opcode_t jump_forward = CBC_JUMP_FORWARD_3;
-#endif /* PARSER_MAXIMUM_CODE_SIZE <= 65535 */
-
-      /* The leading zeroes are dropped from the stream.
-       * Although dropping these zeroes for backward
-       * branches are unnecessary, we use the same
-       * code path for simplicity. */
-      JERRY_ASSERT (branch_offset_length > 0 && branch_offset_length <= 3);
-
-      while (--branch_offset_length > 0)
-      {
-        uint8_t byte = page_p->bytes[offset];
-        if (byte > 0 || !prefix_zero)
-        {
-          prefix_zero = PARSER_FALSE;
-          length++;
-        }
-        else
-        {
-          JERRY_ASSERT (CBC_BRANCH_IS_FORWARD (flags));
-        }
-        PARSER_NEXT_BYTE (page_p, offset);
-      }
-
-      if (last_opcode == jump_forward
-          && prefix_zero
-          && page_p->bytes[offset] == CBC_BRANCH_OFFSET_LENGTH (jump_forward) + 1)
-      {
-        /* Uncoditional jumps which jump right after the instruction
-         * are effectively NOPs. These jumps are removed from the
-         * stream. The 1 byte long CBC_JUMP_FORWARD form marks these
-         * instructions, since this form is constructed during post
-         * processing and cannot be emitted directly. */
-        *opcode_p = CBC_JUMP_FORWARD;
-        length--;
-      }
-      else
-      {
-        /* Other last bytes are always copied. */
-        length++;
-      }
-
-      PARSER_NEXT_BYTE (page_p, offset);
-    }
   }
 
   if (!(context_p->status_flags & PARSER_NO_END_LABEL)
@@ -1462,13 +1518,33 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   total_size += length + context_p->literal_count * sizeof (lit_cpointer_t);
   total_size = JERRY_ALIGNUP (total_size, MEM_ALIGNMENT);
 
-  compiled_code_p = (ecma_compiled_code_t *) parser_malloc (context_p, total_size);
+  /* The compiled code outlives the parser arena. */
+  compiled_code_p = (ecma_compiled_code_t *) mem_heap_alloc_block (total_size);
+
+  if (compiled_code_p == NULL)
+  {
+    parser_raise_error (context_p, PARSER_ERR_OUT_OF_MEMORY);
+  }
+
+  ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_BYTECODE, total_size);
 
   byte_code_p = (uint8_t *) compiled_code_p;
   compiled_code_p->size = (uint16_t) (total_size >> MEM_ALIGNMENT_LOG);
   compiled_code_p->refs = 1;
   compiled_code_p->status_flags = CBC_CODE_FLAGS_FUNCTION;
 
+  /* Vars which are not stored in registers (including the arguments
+   * in this group) and the arguments object are bound in the lexical
+   * environment when the function is called. */
+  binding_count = (uint32_t) (initialized_var_end - context_p->register_count);
+
+  if (context_p->status_flags & PARSER_ARGUMENTS_NEEDED)
+  {
+    binding_count++;
+  }
+
+  binding_count = JERRY_MIN (binding_count, UINT8_MAX);
+
   if (needs_uint16_arguments)
   {
     cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) compiled_code_p;
@@ -1479,6 +1555,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     args_p->ident_end = ident_end;
     args_p->const_literal_end = const_literal_end;
     args_p->literal_end = context_p->literal_count;
+    args_p->inline_cache_cp = ECMA_NULL_POINTER;
+    args_p->inline_cache_count = (uint8_t) inline_cache_count;
+    args_p->binding_count = (uint8_t) binding_count;
 
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_UINT16_ARGUMENTS;
     byte_code_p += sizeof (cbc_uint16_arguments_t);
@@ -1493,6 +1572,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     args_p->ident_end = (uint8_t) ident_end;
     args_p->const_literal_end = (uint8_t) const_literal_end;
     args_p->literal_end = (uint8_t) context_p->literal_count;
+    args_p->inline_cache_cp = ECMA_NULL_POINTER;
+    args_p->inline_cache_count = (uint8_t) inline_cache_count;
+    args_p->binding_count = (uint8_t) binding_count;
 
     byte_code_p += sizeof (cbc_uint8_arguments_t);
   }
@@ -1519,6 +1601,13 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED;
   }
 
+  if (!(context_p->status_flags & PARSER_NO_STATIC_SCOPE))
+  {
+    /* Without eval and with the bindings of the lexical
+     * environment are known when the function is called. */
+    compiled_code_p->status_flags |= CBC_CODE_FLAGS_STATIC_SCOPE;
+  }
+
   literal_pool_p = (lit_cpointer_t *) byte_code_p;
   byte_code_p += context_p->literal_count * sizeof (lit_cpointer_t);
 
@@ -1535,6 +1624,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   page_p = context_p->byte_code.first_p;
   offset = 0;
   real_offset = 0;
+  inline_cache_index = 0;
 
   while (page_p != last_page_p || offset < last_position)
   {
@@ -1570,6 +1660,21 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     /* Storing the opcode */
     *dst_p++ = opcode;
     real_offset++;
+
+    if (CBC_HAS_INLINE_CACHE_ARG (opcode))
+    {
+      /* Storing the inline cache index, which is not part of the stream. */
+      if (inline_cache_index < inline_cache_count)
+      {
+        *dst_p++ = (uint8_t) inline_cache_index++;
+      }
+      else
+      {
+        *dst_p++ = CBC_NO_INLINE_CACHE;
+      }
+      real_offset++;
+    }
+
     PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
     flags = cbc_flags[opcode];
 
@@ -1593,9 +1698,39 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       *branch_mark_p |= CBC_HIGHEST_BIT_MASK;
     }
 
-    /* Only literal and call arguments can be combined. */
+    /* Only literal and call arguments, or literal and branch arguments can be combined. */
     JERRY_ASSERT (!(flags & CBC_HAS_BRANCH_ARG)
-                   || !(flags & (CBC_HAS_BYTE_ARG | CBC_HAS_LITERAL_ARG)));
+                   || !(flags & CBC_HAS_BYTE_ARG));
+
+    if (flags & CBC_HAS_BRANCH_ARG)
+    {
+      int prefix_zero = PARSER_TRUE;
+
+      /* The leading zeroes are dropped from the stream. */
+      JERRY_ASSERT (branch_offset_length > 0 && branch_offset_length <= 3);
+
+      while (--branch_offset_length > 0)
+      {
+        uint8_t byte = page_p->bytes[offset];
+        if (byte > 0 || !prefix_zero)
+        {
+          prefix_zero = PARSER_FALSE;
+          *dst_p++ = page_p->bytes[offset];
+          real_offset++;
+        }
+        else
+        {
+          /* When a leading zero is dropped, the branch
+           * offset length must be decreased as well. */
+          (*opcode_p)--;
+        }
+        PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
+      }
+
+      *dst_p++ = page_p->bytes[offset];
+      real_offset++;
+      PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
+    }
 
     while (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
     {
@@ -1636,36 +1771,6 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       real_offset++;
       PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
     }
-
-    if (flags & CBC_HAS_BRANCH_ARG)
-    {
-      int prefix_zero = PARSER_TRUE;
-
-      /* The leading zeroes are dropped from the stream. */
-      JERRY_ASSERT (branch_offset_length > 0 && branch_offset_length <= 3);
-
-      while (--branch_offset_length > 0)
-      {
-        uint8_t byte = page_p->bytes[offset];
-        if (byte > 0 || !prefix_zero)
-        {
-          prefix_zero = PARSER_FALSE;
-          *dst_p++ = page_p->bytes[offset];
-          real_offset++;
-        }
-        else
-        {
-          /* When a leading zero is dropped, the branch
-           * offset length must be decreased as well. */
-          (*opcode_p)--;
-        }
-        PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
-      }
-
-      *dst_p++ = page_p->bytes[offset];
-      real_offset++;
-      PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
-    }
   }
 
   if (!(context_p->status_flags & PARSER_NO_END_LABEL))
@@ -1829,6 +1934,8 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
     context.status_flags |= PARSER_IS_STRICT;
   }
 
+  JERRY_ASSERT (JERRY_CONTEXT (parser_arena_chunk_p) == NULL);
+
   context.source_p = source_p;
   context.source_end_p = source_p + size;
   context.line = 1;
@@ -1852,7 +1959,7 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
 #endif /* PARSER_DEBUG */
 
 #ifdef PARSER_DUMP_BYTE_CODE
-  context.is_show_opcodes = parser_show_instrs;
+  context.is_show_opcodes = JERRY_CONTEXT (parser_show_instrs);
   context.total_byte_code_size = 0;
 
   if (context.is_show_opcodes)
@@ -1930,10 +2037,96 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
 #endif /* PARSER_DUMP_BYTE_CODE */
 
   parser_stack_free (&context);
+  parser_arena_free ();
 
   return compiled_code;
 } /* parser_parse_source */
 
+/**
+ * Pass the identifiers referenced by a nested function to the enclosing function.
+ *
+ * The variables of the enclosing function which are captured this way are not stored
+ * in registers. The other identifiers are passed further when the parsing of the
+ * enclosing function is completed, so a function only gets a lexical environment
+ * when one of its variables is captured by a closure.
+ */
+static void
+parser_capture_identifiers (parser_context_t *context_p, /**< context */
+                            parser_saved_context_t *saved_context_p) /**< context of the enclosing function */
+{
+  parser_list_iterator_t literal_iterator;
+  lexer_literal_t *literal_p;
+  parser_list_t parent_literal_pool;
+
+  if (saved_context_p->status_flags & PARSER_NO_REG_STORE)
+  {
+    /* Nothing is stored in registers by the enclosing function, and the flag
+     * is also propagated to the functions which enclose it (if any). */
+    return;
+  }
+
+  if (context_p->status_flags & PARSER_NO_REG_STORE)
+  {
+    /* Direct eval calls can access any variable of the enclosing functions. */
+    saved_context_p->status_flags |= PARSER_NO_REG_STORE;
+    return;
+  }
+
+  parent_literal_pool = context_p->literal_pool;
+
+  parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
+  while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)))
+  {
+    parser_list_iterator_t parent_iterator;
+    lexer_literal_t *parent_literal_p;
+
+    if (literal_p->type != LEXER_IDENT_LITERAL
+        || (literal_p->status_flags & LEXER_FLAG_VAR))
+    {
+      continue;
+    }
+
+    parent_literal_pool.data = saved_context_p->literal_pool_data;
+    parser_list_iterator_init (&parent_literal_pool, &parent_iterator);
+
+    while ((parent_literal_p = (lexer_literal_t *) parser_list_iterator_next (&parent_iterator)))
+    {
+      if (parent_literal_p->type == LEXER_IDENT_LITERAL
+          && parent_literal_p->prop.length == literal_p->prop.length
+          && memcmp (parent_literal_p->u.char_p, literal_p->u.char_p, literal_p->prop.length) == 0)
+      {
+        break;
+      }
+    }
+
+    if (parent_literal_p == NULL)
+    {
+      if (saved_context_p->literal_count >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
+      {
+        saved_context_p->status_flags |= PARSER_NO_REG_STORE;
+        return;
+      }
+
+      /* The literal might be declared later by the enclosing function. */
+      parent_literal_p = (lexer_literal_t *) parser_list_append (context_p, &parent_literal_pool);
+      saved_context_p->literal_pool_data = parent_literal_pool.data;
+      saved_context_p->literal_count++;
+
+      *parent_literal_p = *literal_p;
+      parent_literal_p->status_flags &= LEXER_FLAG_SOURCE_PTR;
+      parent_literal_p->status_flags |= LEXER_FLAG_UNUSED_IDENT;
+
+      if (!(literal_p->status_flags & LEXER_FLAG_SOURCE_PTR))
+      {
+        parent_literal_p->u.char_p = (uint8_t *) mem_heap_alloc_block_store_size (literal_p->prop.length);
+        memcpy ((uint8_t *) parent_literal_p->u.char_p, literal_p->u.char_p, literal_p->prop.length);
+      }
+    }
+
+    parent_literal_p->status_flags |= LEXER_FLAG_NO_REG_STORE;
+  }
+} /* parser_capture_identifiers */
+
 /**
  * Parse function code
  *
@@ -2152,6 +2345,7 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 
   lexer_next_token (context_p);
   parser_parse_statements (context_p);
+  parser_capture_identifiers (context_p, &saved_context);
   compiled_code_p = parser_post_processing (context_p);
 
 #ifdef PARSER_DUMP_BYTE_CODE
@@ -2230,7 +2424,7 @@ void
 parser_set_show_instrs (int show_instrs) /**< flag indicating whether to dump bytecode */
 {
 #ifdef PARSER_DUMP_BYTE_CODE
-  parser_show_instrs = show_instrs;
+  JERRY_CONTEXT (parser_show_instrs) = show_instrs;
 #else /* !PARSER_DUMP_BYTE_CODE */
   (void) show_instrs;
 #endif /* PARSER_DUMP_BYTE_CODE */
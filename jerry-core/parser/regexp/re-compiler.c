@@ -14,10 +14,12 @@
  * limitations under the License.
  */
 
+#include "ecma-alloc.h"
 #include "ecma-exceptions.h"
 #include "ecma-helpers.h"
 #include "ecma-regexp-object.h"
 #include "ecma-try-catch-macro.h"
+#include "jcontext.h"
 #include "jrt-libc-includes.h"
 #include "mem-heap.h"
 #include "re-bytecode.h"
@@ -444,9 +446,6 @@ re_parse_alternative (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context
   return ret_value;
 } /* re_parse_alternative */
 
-static const re_compiled_code_t *re_cache[RE_CACHE_SIZE];
-static uint8_t re_cache_idx = RE_CACHE_SIZE;
-
 /**
  * Search for the given pattern in the RegExp cache
  *
@@ -461,7 +460,7 @@ re_find_bytecode_in_cache (ecma_string_t *pattern_str_p, /**< pattern string */
 
   for (uint8_t idx = 0u; idx < RE_CACHE_SIZE; idx++)
   {
-    const re_compiled_code_t *cached_bytecode_p = re_cache[idx];
+    const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[idx];
 
     if (cached_bytecode_p != NULL)
     {
@@ -494,14 +493,14 @@ re_cache_gc_run ()
 {
   for (uint32_t i = 0u; i < RE_CACHE_SIZE; i++)
   {
-    const re_compiled_code_t *cached_bytecode_p = re_cache[i];
+    const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[i];
 
     if (cached_bytecode_p != NULL
         && cached_bytecode_p->header.refs == 1)
     {
       /* Only the cache has reference for the bytecode */
       ecma_bytecode_deref ((ecma_compiled_code_t *) cached_bytecode_p);
-      re_cache[i] = NULL;
+      JERRY_CONTEXT (re_cache)[i] = NULL;
     }
   }
 } /* re_cache_gc_run */
@@ -524,7 +523,7 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
 
   if (cache_idx < RE_CACHE_SIZE)
   {
-    *out_bytecode_p = re_cache[cache_idx];
+    *out_bytecode_p = JERRY_CONTEXT (re_cache)[cache_idx];
 
     if (*out_bytecode_p != NULL)
     {
@@ -611,28 +610,30 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
     *out_bytecode_p = (re_compiled_code_t *) bc_ctx.block_start_p;
 
     ((re_compiled_code_t *) bc_ctx.block_start_p)->header.size = (uint16_t) (byte_code_size >> MEM_ALIGNMENT_LOG);
+    ECMA_ALLOC_STATS_ADD (ECMA_ALLOC_KIND_REGEXP_BYTECODE,
+                          ((size_t) (*out_bytecode_p)->header.size) << MEM_ALIGNMENT_LOG);
 
     if (cache_idx == RE_CACHE_SIZE)
     {
-      if (re_cache_idx == 0u)
+      if (JERRY_CONTEXT (re_cache_idx) == 0u)
       {
-        re_cache_idx = RE_CACHE_SIZE;
+        JERRY_CONTEXT (re_cache_idx) = RE_CACHE_SIZE;
       }
 
-      const re_compiled_code_t *cached_bytecode_p = re_cache[--re_cache_idx];
-      JERRY_DDLOG ("RegExp cache is full! Remove the element on idx: %d\n", re_cache_idx);
+      const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[--JERRY_CONTEXT (re_cache_idx)];
+      JERRY_DDLOG ("RegExp cache is full! Remove the element on idx: %d\n", JERRY_CONTEXT (re_cache_idx));
 
       if (cached_bytecode_p != NULL)
       {
         ecma_bytecode_deref ((ecma_compiled_code_t *) cached_bytecode_p);
       }
 
-      cache_idx = re_cache_idx;
+      cache_idx = JERRY_CONTEXT (re_cache_idx);
     }
 
     JERRY_DDLOG ("Insert bytecode into RegExp cache (idx: %d).\n", cache_idx);
     ecma_bytecode_ref ((ecma_compiled_code_t *) *out_bytecode_p);
-    re_cache[cache_idx] = *out_bytecode_p;
+    JERRY_CONTEXT (re_cache)[cache_idx] = *out_bytecode_p;
   }
 
   return ret_value;
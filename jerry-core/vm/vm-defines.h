@@ -54,6 +54,10 @@ typedef struct
   uint16_t context_depth;                             /**< current context depth */
   uint8_t is_eval_code;                               /**< eval mode flag */
   uint8_t call_operation;                             /**< perform a call or construct operation */
+#ifdef MEM_STATS
+  uint8_t *current_instruction_p;                     /**< start of the currently executed instruction,
+                                                       *   the allocations are accounted to it */
+#endif /* MEM_STATS */
 } vm_frame_ctx_t;
 
 /**
@@ -0,0 +1,649 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry-port.h"
+#include "jrt-libc-includes.h"
+#include "vm-stats.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_stats Byte code statistics
+ * @{
+ */
+
+#if defined (JERRY_VM_SEQUENCE_STATS) || defined (JERRY_VM_PROFILE)
+
+#define CBC_OPCODE(arg1, arg2, arg3, arg4) #arg1,
+
+/**
+ * Names of the opcodes, indexed by opcode identifiers.
+ */
+static const char * const vm_stats_opcode_names[VM_STATS_OPCODE_COUNT] =
+{
+  CBC_OPCODE_LIST
+  CBC_EXT_OPCODE_LIST
+};
+
+#undef CBC_OPCODE
+
+#endif /* JERRY_VM_SEQUENCE_STATS || JERRY_VM_PROFILE */
+
+#ifdef JERRY_VM_SEQUENCE_STATS
+
+/**
+ * Number of entries in the hash table of the opcode triples (must be a power of 2).
+ */
+#define VM_STATS_TRIPLE_TABLE_SIZE (1u << 16)
+
+/**
+ * Entry of the opcode triple hash table.
+ */
+typedef struct
+{
+  uint32_t key; /**< VM_STATS_TRIPLE_KEY of the triple, 0 for unused entries */
+  uint32_t count; /**< number of executions */
+} vm_stats_triple_t;
+
+/**
+ * Key of an opcode triple, which is never zero.
+ */
+#define VM_STATS_TRIPLE_KEY(first, second, third) \
+  ((((first) * VM_STATS_OPCODE_COUNT + (second)) * VM_STATS_OPCODE_COUNT + (third)) + 1)
+
+JERRY_STATIC_ASSERT ((uint64_t) VM_STATS_OPCODE_COUNT * VM_STATS_OPCODE_COUNT * VM_STATS_OPCODE_COUNT < UINT32_MAX,
+                     vm_stats_triple_keys_must_fit_into_uint32);
+
+/**
+ * Number of executions of each opcode.
+ */
+static uint32_t vm_stats_opcodes[VM_STATS_OPCODE_COUNT];
+
+/**
+ * Number of executions of each opcode pair.
+ */
+static uint32_t vm_stats_pairs[VM_STATS_OPCODE_COUNT][VM_STATS_OPCODE_COUNT];
+
+/**
+ * Number of executions of the opcode triples.
+ */
+static vm_stats_triple_t vm_stats_triples[VM_STATS_TRIPLE_TABLE_SIZE];
+
+/**
+ * Number of opcode triple executions which were not recorded because the triple table is full.
+ */
+static uint32_t vm_stats_dropped_triples;
+
+/**
+ * Record the execution of an opcode.
+ *
+ * Sequences are terminated by branches, because the next
+ * instruction executed after a branch depends on the run-time
+ * values, so superinstructions cannot contain them.
+ */
+void
+vm_stats_record_opcode (vm_stats_history_t *history_p, /**< [in, out] last opcodes of the current sequence */
+                        uint32_t opcode_id, /**< opcode identifier */
+                        uint8_t opcode_flags) /**< flags of the opcode */
+{
+  JERRY_ASSERT (opcode_id < VM_STATS_OPCODE_COUNT);
+
+  uint32_t prev1 = *history_p & 0xffff;
+  uint32_t prev2 = *history_p >> 16;
+
+  vm_stats_opcodes[opcode_id]++;
+
+  if (prev1 != VM_STATS_NO_OPCODE)
+  {
+    vm_stats_pairs[prev1][opcode_id]++;
+
+    if (prev2 != VM_STATS_NO_OPCODE)
+    {
+      uint32_t key = VM_STATS_TRIPLE_KEY (prev2, prev1, opcode_id);
+      uint32_t index = (key * 2654435761u) >> 16;
+      uint32_t probes = 0;
+
+      while (vm_stats_triples[index].key != key && vm_stats_triples[index].key != 0)
+      {
+        if (++probes == VM_STATS_TRIPLE_TABLE_SIZE)
+        {
+          vm_stats_dropped_triples++;
+          break;
+        }
+        index = (index + 1) & (VM_STATS_TRIPLE_TABLE_SIZE - 1);
+      }
+
+      if (probes < VM_STATS_TRIPLE_TABLE_SIZE)
+      {
+        vm_stats_triples[index].key = key;
+        vm_stats_triples[index].count++;
+      }
+    }
+  }
+
+  if (opcode_flags & CBC_HAS_BRANCH_ARG)
+  {
+    *history_p = VM_STATS_HISTORY_EMPTY;
+  }
+  else
+  {
+    *history_p = (prev1 << 16) | opcode_id;
+  }
+} /* vm_stats_record_opcode */
+
+/**
+ * Print the collected statistics.
+ *
+ * Each line contains the number of executions followed by the names of the opcodes.
+ */
+void
+vm_stats_print (void)
+{
+  printf ("Byte code sequence statistics:\n");
+
+  for (uint32_t i = 0; i < VM_STATS_OPCODE_COUNT; i++)
+  {
+    if (vm_stats_opcodes[i] != 0)
+    {
+      printf ("  opcode %u %s\n", (unsigned int) vm_stats_opcodes[i], vm_stats_opcode_names[i]);
+    }
+  }
+
+  for (uint32_t i = 0; i < VM_STATS_OPCODE_COUNT; i++)
+  {
+    for (uint32_t j = 0; j < VM_STATS_OPCODE_COUNT; j++)
+    {
+      if (vm_stats_pairs[i][j] != 0)
+      {
+        printf ("  pair %u %s %s\n",
+                (unsigned int) vm_stats_pairs[i][j],
+                vm_stats_opcode_names[i],
+                vm_stats_opcode_names[j]);
+      }
+    }
+  }
+
+  for (uint32_t i = 0; i < VM_STATS_TRIPLE_TABLE_SIZE; i++)
+  {
+    if (vm_stats_triples[i].key != 0)
+    {
+      uint32_t key = vm_stats_triples[i].key - 1;
+
+      printf ("  triple %u %s %s %s\n",
+              (unsigned int) vm_stats_triples[i].count,
+              vm_stats_opcode_names[key / (VM_STATS_OPCODE_COUNT * VM_STATS_OPCODE_COUNT)],
+              vm_stats_opcode_names[(key / VM_STATS_OPCODE_COUNT) % VM_STATS_OPCODE_COUNT],
+              vm_stats_opcode_names[key % VM_STATS_OPCODE_COUNT]);
+    }
+  }
+
+  if (vm_stats_dropped_triples != 0)
+  {
+    printf ("  dropped-triples %u\n", (unsigned int) vm_stats_dropped_triples);
+  }
+} /* vm_stats_print */
+
+#endif /* JERRY_VM_SEQUENCE_STATS */
+
+#ifdef JERRY_VM_PROFILE
+
+/**
+ * Number of entries in the hash table of the compiled code profiles (must be a power of 2).
+ */
+#define VM_STATS_FUNCTION_TABLE_SIZE (1u << 12)
+
+/**
+ * Opcode identifier which means that no instruction is executed.
+ */
+#define VM_STATS_PROFILE_NO_OPCODE VM_STATS_OPCODE_COUNT
+
+/**
+ * Profile of a compiled code.
+ */
+struct vm_stats_function_t
+{
+  const ecma_compiled_code_t *bytecode_p; /**< compiled code, NULL for unused entries */
+  uint32_t id; /**< order of the first execution */
+  uint32_t size; /**< size of the compiled code in bytes */
+  bool is_freed; /**< the compiled code is freed, so its address can be reused by another one */
+  uint64_t calls; /**< number of executions of the compiled code */
+  uint64_t instructions; /**< number of executed instructions */
+  uint64_t ticks; /**< ticks spent in the compiled code */
+};
+
+/**
+ * Number of executions of each opcode.
+ */
+static uint64_t vm_stats_profile_opcode_counts[VM_STATS_OPCODE_COUNT];
+
+/**
+ * Ticks spent executing each opcode.
+ */
+static uint64_t vm_stats_profile_opcode_ticks[VM_STATS_OPCODE_COUNT];
+
+/**
+ * Profiles of the compiled codes.
+ */
+static vm_stats_function_t vm_stats_profile_functions[VM_STATS_FUNCTION_TABLE_SIZE];
+
+/**
+ * Profile of the compiled codes which do not fit into the hash table.
+ */
+static vm_stats_function_t vm_stats_profile_other_functions;
+
+/**
+ * Number of compiled codes executed so far.
+ */
+static uint32_t vm_stats_profile_function_count;
+
+/**
+ * Profile of the currently executed compiled code.
+ */
+static vm_stats_function_t *vm_stats_profile_current_function_p;
+
+/**
+ * Identifier of the currently executed opcode.
+ */
+static uint32_t vm_stats_profile_current_opcode = VM_STATS_PROFILE_NO_OPCODE;
+
+/**
+ * Tick count when the time was last accounted.
+ */
+static uint64_t vm_stats_profile_last_ticks;
+
+/**
+ * Get the current value of the tick counter.
+ *
+ * The time stamp counter of the CPU is used when it is available,
+ * otherwise the time is measured in microseconds.
+ *
+ * @return tick count
+ */
+static inline uint64_t __attr_always_inline___
+vm_stats_profile_get_ticks (void)
+{
+#if defined (__x86_64__) || defined (__i386__)
+  uint32_t low, high;
+  __asm__ __volatile__ ("rdtsc" : "=a" (low), "=d" (high));
+  return (((uint64_t) high) << 32) | low;
+#elif defined (__aarch64__)
+  uint64_t ticks;
+  __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (ticks));
+  return ticks;
+#else /* !__x86_64__ && !__i386__ && !__aarch64__ */
+  return (uint64_t) (jerry_port_get_current_time () * 1000.0);
+#endif /* __x86_64__ || __i386__ */
+} /* vm_stats_profile_get_ticks */
+
+/**
+ * Name of the tick counter.
+ */
+#if defined (__x86_64__) || defined (__i386__)
+#define VM_STATS_PROFILE_TICK_SOURCE "rdtsc"
+#elif defined (__aarch64__)
+#define VM_STATS_PROFILE_TICK_SOURCE "cntvct_el0"
+#else /* !__x86_64__ && !__i386__ && !__aarch64__ */
+#define VM_STATS_PROFILE_TICK_SOURCE "microseconds"
+#endif /* __x86_64__ || __i386__ */
+
+/**
+ * Account the time elapsed since the last call to the current opcode and compiled code.
+ */
+static inline void __attr_always_inline___
+vm_stats_profile_account_ticks (void)
+{
+  uint64_t ticks = vm_stats_profile_get_ticks ();
+  uint64_t elapsed = ticks - vm_stats_profile_last_ticks;
+
+  vm_stats_profile_last_ticks = ticks;
+
+  if (vm_stats_profile_current_opcode != VM_STATS_PROFILE_NO_OPCODE)
+  {
+    /* An opcode is only executed by a compiled code, so the totals of the two tables are the same. */
+    vm_stats_profile_opcode_ticks[vm_stats_profile_current_opcode] += elapsed;
+    vm_stats_profile_current_function_p->ticks += elapsed;
+  }
+} /* vm_stats_profile_account_ticks */
+
+/**
+ * Record the start of an opcode execution.
+ *
+ * The time until the next opcode starts (including the time spent in
+ * built-in routines) is accounted to this opcode. When the opcode calls
+ * a function with byte code, the time spent in the callee is accounted
+ * to the opcodes of the callee.
+ */
+void
+vm_stats_profile_opcode (uint32_t opcode_id) /**< opcode identifier */
+{
+  JERRY_ASSERT (opcode_id < VM_STATS_OPCODE_COUNT);
+  JERRY_ASSERT (vm_stats_profile_current_function_p != NULL);
+
+  vm_stats_profile_account_ticks ();
+
+  vm_stats_profile_opcode_counts[opcode_id]++;
+  vm_stats_profile_current_function_p->instructions++;
+  vm_stats_profile_current_opcode = opcode_id;
+} /* vm_stats_profile_opcode */
+
+/**
+ * Find or create the profile of a compiled code.
+ *
+ * @return profile of the compiled code
+ */
+static vm_stats_function_t *
+vm_stats_profile_find_function (const ecma_compiled_code_t *bytecode_p) /**< compiled code */
+{
+  uint32_t index = (uint32_t) (((uintptr_t) bytecode_p >> MEM_ALIGNMENT_LOG) & (VM_STATS_FUNCTION_TABLE_SIZE - 1));
+
+  for (uint32_t probes = 0; probes < VM_STATS_FUNCTION_TABLE_SIZE; probes++)
+  {
+    vm_stats_function_t *function_p = vm_stats_profile_functions + index;
+
+    if (function_p->bytecode_p == NULL)
+    {
+      function_p->bytecode_p = bytecode_p;
+      function_p->id = vm_stats_profile_function_count++;
+      function_p->size = ((uint32_t) bytecode_p->size) << MEM_ALIGNMENT_LOG;
+      return function_p;
+    }
+
+    if (function_p->bytecode_p == bytecode_p && !function_p->is_freed)
+    {
+      return function_p;
+    }
+
+    index = (index + 1) & (VM_STATS_FUNCTION_TABLE_SIZE - 1);
+  }
+
+  return &vm_stats_profile_other_functions;
+} /* vm_stats_profile_find_function */
+
+/**
+ * Record the start of a compiled code execution.
+ */
+void
+vm_stats_profile_enter_function (const ecma_compiled_code_t *bytecode_p, /**< compiled code */
+                                 vm_stats_profile_frame_t *saved_frame_p) /**< [out] state of the caller */
+{
+  vm_stats_profile_account_ticks ();
+
+  saved_frame_p->function_p = vm_stats_profile_current_function_p;
+  saved_frame_p->opcode_id = vm_stats_profile_current_opcode;
+
+  vm_stats_profile_current_function_p = vm_stats_profile_find_function (bytecode_p);
+  vm_stats_profile_current_function_p->calls++;
+  vm_stats_profile_current_opcode = VM_STATS_PROFILE_NO_OPCODE;
+} /* vm_stats_profile_enter_function */
+
+/**
+ * Record the end of a compiled code execution.
+ */
+void
+vm_stats_profile_leave_function (const vm_stats_profile_frame_t *saved_frame_p) /**< state of the caller */
+{
+  vm_stats_profile_account_ticks ();
+
+  vm_stats_profile_current_function_p = saved_frame_p->function_p;
+  vm_stats_profile_current_opcode = saved_frame_p->opcode_id;
+} /* vm_stats_profile_leave_function */
+
+/**
+ * Record that a compiled code is freed.
+ *
+ * The address of the compiled code might be reused later, so its profile is closed.
+ */
+void
+vm_stats_profile_free_function (const ecma_compiled_code_t *bytecode_p) /**< compiled code */
+{
+  uint32_t index = (uint32_t) (((uintptr_t) bytecode_p >> MEM_ALIGNMENT_LOG) & (VM_STATS_FUNCTION_TABLE_SIZE - 1));
+
+  for (uint32_t probes = 0; probes < VM_STATS_FUNCTION_TABLE_SIZE; probes++)
+  {
+    vm_stats_function_t *function_p = vm_stats_profile_functions + index;
+
+    if (function_p->bytecode_p == NULL)
+    {
+      return;
+    }
+
+    if (function_p->bytecode_p == bytecode_p && !function_p->is_freed)
+    {
+      function_p->is_freed = true;
+      return;
+    }
+
+    index = (index + 1) & (VM_STATS_FUNCTION_TABLE_SIZE - 1);
+  }
+} /* vm_stats_profile_free_function */
+
+/**
+ * Size of a buffer, which can hold any 64 bit unsigned integer in decimal form with the terminating zero.
+ */
+#define VM_STATS_UINT64_STRING_SIZE 21
+
+/**
+ * Convert a 64 bit unsigned integer to decimal form.
+ *
+ * Note:
+ *      jerry-libc prints only 32 bit integers in decimal form,
+ *      so the 64 bit counters are printed as strings
+ *
+ * @return pointer to the first digit in the buffer
+ */
+static const char *
+vm_stats_profile_uint64_to_string (uint64_t value, /**< value */
+                                   char *buffer_p) /**< [out] buffer of VM_STATS_UINT64_STRING_SIZE bytes */
+{
+  char *string_p = buffer_p + VM_STATS_UINT64_STRING_SIZE - 1;
+  *string_p = '\0';
+
+  do
+  {
+    *(--string_p) = (char) ('0' + (value % 10));
+    value /= 10;
+  }
+  while (value != 0);
+
+  return string_p;
+} /* vm_stats_profile_uint64_to_string */
+
+/**
+ * Print a value and its ratio to the total as a percentage with two decimals.
+ */
+static void
+vm_stats_profile_print_ratio (FILE *file_p, /**< output file */
+                              uint64_t value, /**< value */
+                              uint64_t total) /**< total */
+{
+  char value_buffer[VM_STATS_UINT64_STRING_SIZE];
+  uint64_t ratio = (total == 0) ? 0 : (value * 10000) / total;
+
+  fprintf (file_p, "%14s %3u.%02u%%",
+           vm_stats_profile_uint64_to_string (value, value_buffer),
+           (unsigned int) (ratio / 100),
+           (unsigned int) (ratio % 100));
+} /* vm_stats_profile_print_ratio */
+
+/**
+ * Write the collected profile.
+ *
+ * A table sorted by the ticks is printed to the standard output,
+ * and the same data is written to the given file in JSON format.
+ */
+void
+vm_stats_profile_dump (const char *file_name_p) /**< name of the JSON output file */
+{
+  static uint32_t opcode_order[VM_STATS_OPCODE_COUNT];
+  static vm_stats_function_t *function_order[VM_STATS_FUNCTION_TABLE_SIZE + 1];
+  uint32_t opcode_count = 0;
+  uint32_t function_count = 0;
+  uint64_t total_instructions = 0;
+  uint64_t total_ticks = 0;
+  char buffers[3][VM_STATS_UINT64_STRING_SIZE];
+
+  /* Insertion sort: the tables are small and this runs only once. */
+  for (uint32_t i = 0; i < VM_STATS_OPCODE_COUNT; i++)
+  {
+    uint32_t j = opcode_count;
+
+    if (vm_stats_profile_opcode_counts[i] == 0)
+    {
+      continue;
+    }
+
+    total_instructions += vm_stats_profile_opcode_counts[i];
+    total_ticks += vm_stats_profile_opcode_ticks[i];
+
+    while (j > 0 && vm_stats_profile_opcode_ticks[opcode_order[j - 1]] < vm_stats_profile_opcode_ticks[i])
+    {
+      opcode_order[j] = opcode_order[j - 1];
+      j--;
+    }
+
+    opcode_order[j] = i;
+    opcode_count++;
+  }
+
+  for (uint32_t i = 0; i <= VM_STATS_FUNCTION_TABLE_SIZE; i++)
+  {
+    vm_stats_function_t *function_p = vm_stats_profile_functions + i;
+    uint32_t j = function_count;
+
+    if (i == VM_STATS_FUNCTION_TABLE_SIZE)
+    {
+      function_p = &vm_stats_profile_other_functions;
+    }
+
+    if (function_p->calls == 0)
+    {
+      continue;
+    }
+
+    while (j > 0 && function_order[j - 1]->ticks < function_p->ticks)
+    {
+      function_order[j] = function_order[j - 1];
+      j--;
+    }
+
+    function_order[j] = function_p;
+    function_count++;
+  }
+
+  printf ("Opcode profile (%s ticks):\n", VM_STATS_PROFILE_TICK_SOURCE);
+  printf ("  %14s %8s %14s %8s %10s  %s\n", "count", "count%", "ticks", "ticks%", "ticks/exec", "opcode");
+
+  for (uint32_t i = 0; i < opcode_count; i++)
+  {
+    uint32_t opcode_id = opcode_order[i];
+    uint64_t count = vm_stats_profile_opcode_counts[opcode_id];
+    uint64_t ticks = vm_stats_profile_opcode_ticks[opcode_id];
+
+    printf ("  ");
+    vm_stats_profile_print_ratio (stdout, count, total_instructions);
+    printf (" ");
+    vm_stats_profile_print_ratio (stdout, ticks, total_ticks);
+    printf (" %10s  %s\n",
+            vm_stats_profile_uint64_to_string (ticks / count, buffers[0]),
+            vm_stats_opcode_names[opcode_id]);
+  }
+
+  printf ("\nFunction profile:\n");
+  printf ("  %6s %18s %8s %10s %14s %14s %8s\n", "id", "byte code", "size", "calls", "instructions", "ticks", "ticks%");
+
+  for (uint32_t i = 0; i < function_count; i++)
+  {
+    vm_stats_function_t *function_p = function_order[i];
+
+    if (function_p == &vm_stats_profile_other_functions)
+    {
+      printf ("  %6s %18s %8s", "-", "(other)", "-");
+    }
+    else
+    {
+      printf ("  %6u 0x%016llx %8u",
+              (unsigned int) function_p->id,
+              (unsigned long long) (uintptr_t) function_p->bytecode_p,
+              (unsigned int) function_p->size);
+    }
+
+    printf (" %10s %14s",
+            vm_stats_profile_uint64_to_string (function_p->calls, buffers[0]),
+            vm_stats_profile_uint64_to_string (function_p->instructions, buffers[1]));
+    vm_stats_profile_print_ratio (stdout, function_p->ticks, total_ticks);
+    printf ("\n");
+  }
+
+  FILE *file_p = fopen (file_name_p, "w");
+
+  if (file_p == NULL)
+  {
+    printf ("Failed to open opcode profile file: %s\n", file_name_p);
+    return;
+  }
+
+  fprintf (file_p, "{\n  \"tick_source\": \"%s\",\n", VM_STATS_PROFILE_TICK_SOURCE);
+  fprintf (file_p, "  \"total_instructions\": %s,\n  \"total_ticks\": %s,\n",
+           vm_stats_profile_uint64_to_string (total_instructions, buffers[0]),
+           vm_stats_profile_uint64_to_string (total_ticks, buffers[1]));
+  fprintf (file_p, "  \"opcodes\": [");
+
+  for (uint32_t i = 0; i < opcode_count; i++)
+  {
+    uint32_t opcode_id = opcode_order[i];
+
+    fprintf (file_p, "%s\n    { \"name\": \"%s\", \"count\": %s, \"ticks\": %s }",
+             (i == 0) ? "" : ",",
+             vm_stats_opcode_names[opcode_id],
+             vm_stats_profile_uint64_to_string (vm_stats_profile_opcode_counts[opcode_id], buffers[0]),
+             vm_stats_profile_uint64_to_string (vm_stats_profile_opcode_ticks[opcode_id], buffers[1]));
+  }
+
+  fprintf (file_p, "\n  ],\n  \"functions\": [");
+
+  for (uint32_t i = 0; i < function_count; i++)
+  {
+    vm_stats_function_t *function_p = function_order[i];
+
+    fprintf (file_p, "%s\n    { ", (i == 0) ? "" : ",");
+
+    if (function_p == &vm_stats_profile_other_functions)
+    {
+      fprintf (file_p, "\"id\": null, \"byte_code\": null, \"size\": null");
+    }
+    else
+    {
+      fprintf (file_p, "\"id\": %u, \"byte_code\": \"0x%llx\", \"size\": %u",
+               (unsigned int) function_p->id,
+               (unsigned long long) (uintptr_t) function_p->bytecode_p,
+               (unsigned int) function_p->size);
+    }
+
+    fprintf (file_p, ", \"calls\": %s, \"instructions\": %s, \"ticks\": %s }",
+             vm_stats_profile_uint64_to_string (function_p->calls, buffers[0]),
+             vm_stats_profile_uint64_to_string (function_p->instructions, buffers[1]),
+             vm_stats_profile_uint64_to_string (function_p->ticks, buffers[2]));
+  }
+
+  fprintf (file_p, "\n  ]\n}\n");
+  fclose (file_p);
+} /* vm_stats_profile_dump */
+
+#endif /* JERRY_VM_PROFILE */
+
+/**
+ * @}
+ * @}
+ */
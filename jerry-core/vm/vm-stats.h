@@ -0,0 +1,98 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_STATS_H
+#define VM_STATS_H
+
+#include "ecma-globals.h"
+#include "byte-code.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_stats Byte code statistics
+ * @{
+ */
+
+#if defined (JERRY_VM_SEQUENCE_STATS) || defined (JERRY_VM_PROFILE)
+
+/**
+ * Number of opcode identifiers: the basic opcode list is followed by the extended opcode list
+ * (both lists include their terminating CBC_END and CBC_EXT_END entries).
+ */
+#define VM_STATS_OPCODE_COUNT (CBC_END + 1 + CBC_EXT_END + 1)
+
+/**
+ * Identifier of an extended opcode.
+ */
+#define VM_STATS_EXT_OPCODE_ID(ext_opcode) (CBC_END + 1 + (ext_opcode))
+
+#endif /* JERRY_VM_SEQUENCE_STATS || JERRY_VM_PROFILE */
+
+#ifdef JERRY_VM_SEQUENCE_STATS
+
+/**
+ * Opcode identifier which marks an empty history entry.
+ */
+#define VM_STATS_NO_OPCODE 0xffffu
+
+/**
+ * Empty history: no instruction was executed in the current sequence.
+ */
+#define VM_STATS_HISTORY_EMPTY ((VM_STATS_NO_OPCODE << 16) | VM_STATS_NO_OPCODE)
+
+/**
+ * The last two opcode identifiers executed by a vm_loop invocation.
+ *
+ * The lower half contains the identifier of the previous opcode,
+ * the upper half contains the identifier of the opcode before it.
+ */
+typedef uint32_t vm_stats_history_t;
+
+extern void vm_stats_record_opcode (vm_stats_history_t *, uint32_t, uint8_t);
+extern void vm_stats_print (void);
+
+#endif /* JERRY_VM_SEQUENCE_STATS */
+
+#ifdef JERRY_VM_PROFILE
+
+/**
+ * Profile of a compiled code (global code, eval code or function).
+ */
+typedef struct vm_stats_function_t vm_stats_function_t;
+
+/**
+ * Profiler state of a caller, which is restored when the callee returns.
+ */
+typedef struct
+{
+  vm_stats_function_t *function_p; /**< profile of the compiled code of the caller */
+  uint32_t opcode_id; /**< opcode which called the callee */
+} vm_stats_profile_frame_t;
+
+extern void vm_stats_profile_opcode (uint32_t);
+extern void vm_stats_profile_enter_function (const ecma_compiled_code_t *, vm_stats_profile_frame_t *);
+extern void vm_stats_profile_leave_function (const vm_stats_profile_frame_t *);
+extern void vm_stats_profile_free_function (const ecma_compiled_code_t *);
+extern void vm_stats_profile_dump (const char *);
+
+#endif /* JERRY_VM_PROFILE */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !VM_STATS_H */
@@ -24,15 +24,18 @@
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
+#include "ecma-inline-cache.h"
 #include "ecma-lex-env.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-regexp-object.h"
 #include "ecma-try-catch-macro.h"
+#include "jcontext.h"
 #include "lit-literal-storage.h"
 #include "opcodes.h"
 #include "vm.h"
 #include "vm-stack.h"
+#include "vm-stats.h"
 
 #include <alloca.h>
 
@@ -43,21 +46,6 @@
  * @{
  */
 
-/**
- * Top (current) interpreter context
- */
-static vm_frame_ctx_t *vm_top_context_p = NULL;
-
-/**
- * Direct call from eval;
- */
-static bool is_direct_eval_form_call = false;
-
-/**
- * Program bytecode pointer
- */
-static ecma_compiled_code_t *__program = NULL;
-
 /**
  * Get the value of object[property].
  *
@@ -73,6 +61,45 @@ vm_op_get_value (ecma_value_t object, /**< base object */
     return ecma_raise_type_error (ECMA_ERR_MSG (""));
   }
 
+  if (ecma_is_value_object (object)
+      && ecma_get_object_type (ecma_get_object_from_value (object)) == ECMA_OBJECT_TYPE_ARRAY)
+  {
+    ecma_object_t *array_obj_p = ecma_get_object_from_value (object);
+
+    if (ecma_is_value_integer_number (property))
+    {
+      /* Existing elements of fast arrays are read directly. */
+      ecma_array_elements_t *elements_p = ecma_op_array_get_elements (array_obj_p);
+      ecma_integer_value_t index = ecma_get_integer_from_value (property);
+
+      if (elements_p != NULL && index >= 0)
+      {
+        ecma_property_t *element_p = ecma_op_array_find_element (elements_p, (uint32_t) index);
+
+        if (element_p != NULL)
+        {
+          return ecma_copy_value (ecma_get_named_data_property_value (element_p));
+        }
+      }
+    }
+    else if (ecma_is_value_string (property))
+    {
+      ecma_string_t *property_p = ecma_get_string_from_value (property);
+
+      /* The length property of arrays is never an accessor. */
+      if (ECMA_STRING_GET_CONTAINER (property_p) == ECMA_STRING_CONTAINER_MAGIC_STRING
+          && property_p->u.magic_string_id == LIT_MAGIC_STRING_LENGTH)
+      {
+        ecma_property_t *length_prop_p = ecma_op_object_get_own_property (array_obj_p, property_p);
+
+        JERRY_ASSERT (length_prop_p != NULL
+                      && ECMA_PROPERTY_GET_TYPE (length_prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+        return ecma_copy_value (ecma_get_named_data_property_value (length_prop_p));
+      }
+    }
+  }
+
   ecma_value_t completion_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (property_val,
@@ -103,6 +130,27 @@ vm_op_set_value (ecma_value_t object, /**< base object */
                  ecma_value_t value, /**< ecma value */
                  bool is_strict) /**< strict mode */
 {
+  if (ecma_is_value_object (object)
+      && ecma_is_value_integer_number (property)
+      && ecma_get_object_type (ecma_get_object_from_value (object)) == ECMA_OBJECT_TYPE_ARRAY)
+  {
+    /* Existing elements of fast arrays are writable data properties, so they are assigned directly. */
+    ecma_object_t *array_obj_p = ecma_get_object_from_value (object);
+    ecma_array_elements_t *elements_p = ecma_op_array_get_elements (array_obj_p);
+    ecma_integer_value_t index = ecma_get_integer_from_value (property);
+
+    if (elements_p != NULL && index >= 0)
+    {
+      ecma_property_t *element_p = ecma_op_array_find_element (elements_p, (uint32_t) index);
+
+      if (element_p != NULL)
+      {
+        ecma_named_data_property_assign_value (array_obj_p, element_p, value);
+        return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+      }
+    }
+  }
+
   ecma_value_t completion_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (obj_val,
@@ -137,17 +185,328 @@ vm_op_set_value (ecma_value_t object, /**< base object */
   return completion_value;
 } /* vm_op_set_value */
 
+/**
+ * Get the inline cache of a property access site.
+ *
+ * @return pointer to the inline cache
+ */
+static ecma_inline_cache_t *
+vm_get_inline_cache (const ecma_compiled_code_t *bytecode_header_p, /**< byte code header */
+                     uint8_t inline_cache_index) /**< inline cache index */
+{
+  JERRY_ASSERT (inline_cache_index != CBC_NO_INLINE_CACHE);
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
+
+    return ecma_inline_cache_get (&args_p->inline_cache_cp,
+                                  args_p->inline_cache_count,
+                                  CBC_SCOPE_CACHE_COUNT (bytecode_header_p, args_p),
+                                  inline_cache_index);
+  }
+
+  cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
+
+  return ecma_inline_cache_get (&args_p->inline_cache_cp,
+                                args_p->inline_cache_count,
+                                CBC_SCOPE_CACHE_COUNT (bytecode_header_p, args_p),
+                                inline_cache_index);
+} /* vm_get_inline_cache */
+
+/**
+ * Get the scope cache of an identifier.
+ *
+ * @return pointer to the scope cache
+ */
+static ecma_scope_cache_t *
+vm_get_scope_cache (const ecma_compiled_code_t *bytecode_header_p, /**< byte code header */
+                    uint32_t literal_index) /**< literal index of the identifier */
+{
+  JERRY_ASSERT (bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE);
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
+
+    JERRY_ASSERT (literal_index >= args_p->register_end && literal_index < args_p->ident_end);
+
+    return ecma_inline_cache_get_scope_cache (&args_p->inline_cache_cp,
+                                              args_p->inline_cache_count,
+                                              CBC_SCOPE_CACHE_COUNT (bytecode_header_p, args_p),
+                                              literal_index - args_p->register_end);
+  }
+
+  cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
+
+  JERRY_ASSERT (literal_index >= args_p->register_end && literal_index < args_p->ident_end);
+
+  return ecma_inline_cache_get_scope_cache (&args_p->inline_cache_cp,
+                                            args_p->inline_cache_count,
+                                            CBC_SCOPE_CACHE_COUNT (bytecode_header_p, args_p),
+                                            literal_index - args_p->register_end);
+} /* vm_get_scope_cache */
+
+/**
+ * Find the binding of an identifier using the scope cache of the identifier.
+ *
+ * @return pointer to the writable data property which stores the binding - if the binding is cached,
+ *         NULL - otherwise (the identifier must be resolved by its name)
+ */
+static ecma_property_t *
+vm_scope_cache_lookup (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                       uint32_t literal_index, /**< literal index of the identifier */
+                       ecma_object_t **binding_lex_env_p) /**< [out] environment of the binding (can be NULL) */
+{
+  ecma_object_t *lex_env_p = frame_ctx_p->lex_env_p;
+
+  /* The environment of the frame is checked first, so no cache
+   * table is allocated for global code or inside catch blocks. */
+  if (!(frame_ctx_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE)
+      || !ecma_get_lex_env_has_static_bindings (lex_env_p))
+  {
+    return NULL;
+  }
+
+  ecma_scope_cache_t *scope_cache_p = vm_get_scope_cache (frame_ctx_p->bytecode_header_p, literal_index);
+
+  if (scope_cache_p->shape_cp == ECMA_NULL_POINTER)
+  {
+    return NULL;
+  }
+
+  for (uint32_t depth = scope_cache_p->depth; depth > 0; depth--)
+  {
+    lex_env_p = ecma_get_lex_env_outer_reference (lex_env_p);
+
+    if (!ecma_get_lex_env_has_static_bindings (lex_env_p))
+    {
+      return NULL;
+    }
+  }
+
+  ecma_property_slots_t *slots_p = ecma_shape_get_property_slots (lex_env_p);
+
+  if (slots_p == NULL || slots_p->shape_cp != scope_cache_p->shape_cp)
+  {
+    return NULL;
+  }
+
+  ecma_property_t *binding_p = ECMA_PROPERTY_SLOTS_GET (slots_p, scope_cache_p->slot_index);
+
+  if (ECMA_PROPERTY_GET_TYPE (binding_p) != ECMA_PROPERTY_TYPE_NAMEDDATA)
+  {
+    return NULL;
+  }
+
+  JERRY_ASSERT (ecma_is_property_writable (binding_p));
+
+  if (binding_lex_env_p != NULL)
+  {
+    *binding_lex_env_p = lex_env_p;
+  }
+
+  return binding_p;
+} /* vm_scope_cache_lookup */
+
+/**
+ * Store the location of a binding in the scope cache of an identifier.
+ *
+ * Note:
+ *      the location is stored only if every lexical environment between the
+ *      environment of the frame and the environment of the binding (including
+ *      both) has static bindings, and the binding is a writable slot
+ */
+static void
+vm_scope_cache_insert (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                       uint32_t literal_index, /**< literal index of the identifier */
+                       ecma_object_t *ref_base_lex_env_p, /**< environment of the binding */
+                       ecma_string_t *name_p) /**< name of the identifier */
+{
+  if (!(frame_ctx_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE))
+  {
+    return;
+  }
+
+  ecma_object_t *lex_env_p = frame_ctx_p->lex_env_p;
+  uint32_t depth = 0;
+
+  while (true)
+  {
+    if (!ecma_get_lex_env_has_static_bindings (lex_env_p))
+    {
+      return;
+    }
+
+    if (lex_env_p == ref_base_lex_env_p)
+    {
+      break;
+    }
+
+    if (depth == UINT8_MAX)
+    {
+      return;
+    }
+
+    lex_env_p = ecma_get_lex_env_outer_reference (lex_env_p);
+    depth++;
+  }
+
+  ecma_property_slots_t *slots_p = ecma_shape_get_property_slots (lex_env_p);
+
+  if (slots_p == NULL)
+  {
+    return;
+  }
+
+  ecma_property_t *binding_p = ecma_find_named_property (lex_env_p, name_p);
+
+  if (binding_p == NULL
+      || !ecma_shape_is_slot (slots_p, binding_p)
+      || !ecma_is_property_writable (binding_p))
+  {
+    return;
+  }
+
+  ecma_scope_cache_t *scope_cache_p = vm_get_scope_cache (frame_ctx_p->bytecode_header_p, literal_index);
+
+  scope_cache_p->shape_cp = slots_p->shape_cp;
+  scope_cache_p->depth = (uint8_t) depth;
+  scope_cache_p->slot_index = (uint8_t) ecma_shape_get_slot_index (slots_p, binding_p);
+} /* vm_scope_cache_insert */
+
+/**
+ * Get the value of object[property] using the inline cache of the site.
+ *
+ * Own named data properties which are stored in the slot vector
+ * of the object (except arguments objects) are cached, other property
+ * accesses are performed by vm_op_get_value.
+ *
+ * @return ecma value
+ */
+static ecma_value_t
+vm_op_get_value_cached (const ecma_compiled_code_t *bytecode_header_p, /**< byte code header */
+                        uint8_t inline_cache_index, /**< inline cache index */
+                        ecma_value_t object, /**< base object */
+                        ecma_value_t property, /**< property name */
+                        bool is_strict) /**< strict mode */
+{
+  if (ecma_is_value_object (object)
+      && ecma_is_value_string (property)
+      && inline_cache_index != CBC_NO_INLINE_CACHE)
+  {
+    ecma_object_t *object_p = ecma_get_object_from_value (object);
+    ecma_property_slots_t *slots_p = ecma_shape_get_property_slots (object_p);
+
+    /* Mapped arguments objects receive their type after their slots are created. */
+    if (slots_p != NULL
+        && ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_ARGUMENTS)
+    {
+      ecma_string_t *property_p = ecma_get_string_from_value (property);
+      ecma_inline_cache_t *inline_cache_p = vm_get_inline_cache (bytecode_header_p, inline_cache_index);
+      ecma_property_t *prop_p = ecma_inline_cache_lookup (inline_cache_p, slots_p, property_p);
+
+      if (prop_p == NULL)
+      {
+        prop_p = ecma_op_object_get_own_property (object_p, property_p);
+
+        if (prop_p != NULL
+            && ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+            && ecma_shape_is_slot (slots_p, prop_p))
+        {
+          ecma_inline_cache_insert (inline_cache_p, slots_p, prop_p);
+        }
+      }
+
+      if (prop_p != NULL && ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+      {
+        return ecma_copy_value (ecma_get_named_data_property_value (prop_p));
+      }
+    }
+  }
+
+  return vm_op_get_value (object, property, is_strict);
+} /* vm_op_get_value_cached */
+
+/**
+ * Set the value of object[property] using the inline cache of the site.
+ *
+ * Writable own named data properties which are stored in the slot
+ * vector of the object (except arguments objects) are cached, other
+ * property accesses are performed by vm_op_set_value.
+ *
+ * @return ecma value
+ */
+static ecma_value_t
+vm_op_set_value_cached (const ecma_compiled_code_t *bytecode_header_p, /**< byte code header */
+                        uint8_t inline_cache_index, /**< inline cache index */
+                        ecma_value_t object, /**< base object */
+                        ecma_value_t property, /**< property name */
+                        ecma_value_t value, /**< ecma value */
+                        bool is_strict) /**< strict mode */
+{
+  if (ecma_is_value_object (object)
+      && ecma_is_value_string (property)
+      && inline_cache_index != CBC_NO_INLINE_CACHE)
+  {
+    ecma_object_t *object_p = ecma_get_object_from_value (object);
+    ecma_property_slots_t *slots_p = ecma_shape_get_property_slots (object_p);
+
+    /* Mapped arguments objects receive their type after their slots are created. */
+    if (slots_p != NULL
+        && ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_ARGUMENTS)
+    {
+      ecma_string_t *property_p = ecma_get_string_from_value (property);
+      ecma_inline_cache_t *inline_cache_p = vm_get_inline_cache (bytecode_header_p, inline_cache_index);
+      ecma_property_t *prop_p = ecma_inline_cache_lookup (inline_cache_p, slots_p, property_p);
+
+      if (prop_p == NULL)
+      {
+        prop_p = ecma_op_object_get_own_property (object_p, property_p);
+
+        if (prop_p != NULL
+            && ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+            && ecma_is_property_writable (prop_p)
+            && ecma_shape_is_slot (slots_p, prop_p))
+        {
+          ecma_inline_cache_insert (inline_cache_p, slots_p, prop_p);
+        }
+      }
+
+      if (prop_p != NULL
+          && ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+          && ecma_is_property_writable (prop_p))
+      {
+        ecma_named_data_property_assign_value (object_p, prop_p, value);
+        return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+      }
+    }
+  }
+
+  return vm_op_set_value (object, property, value, is_strict);
+} /* vm_op_set_value_cached */
+
 /**
  * Initialize interpreter.
  */
 void
 vm_init (ecma_compiled_code_t *program_p) /**< pointer to byte-code data */
 {
-  JERRY_ASSERT (__program == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_program_p) == NULL);
 
-  __program = program_p;
+  JERRY_CONTEXT (vm_program_p) = program_p;
 } /* vm_init */
 
+/**
+ * Threaded dispatch requires the labels as values extension of the compiler.
+ * Other compilers use the switch based dispatch.
+ */
+#if defined (JERRY_VM_THREADED_DISPATCH) && defined (__GNUC__)
+# define VM_USE_THREADED_DISPATCH
+#endif /* JERRY_VM_THREADED_DISPATCH && __GNUC__ */
+
+#ifndef VM_USE_THREADED_DISPATCH
+
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg4,
 
 /**
@@ -168,6 +527,8 @@ static const uint32_t vm_ext_decode_table[] =
 
 #undef CBC_OPCODE
 
+#endif /* !VM_USE_THREADED_DISPATCH */
+
 /**
  * Run global code
  *
@@ -182,12 +543,12 @@ vm_run_global (ecma_value_t *error_value_p) /**< [out] error value */
 {
   jerry_completion_code_t ret_code;
 
-  JERRY_ASSERT (__program != NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_program_p) != NULL);
 
   ecma_object_t *glob_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_GLOBAL);
   ecma_object_t *lex_env_p = ecma_get_global_environment ();
 
-  ecma_value_t ret_value = vm_run (__program,
+  ecma_value_t ret_value = vm_run (JERRY_CONTEXT (vm_program_p),
                                    ecma_make_object_value (glob_obj_p),
                                    lex_env_p,
                                    false,
@@ -229,9 +590,9 @@ vm_run_eval (ecma_compiled_code_t *bytecode_data_p, /**< byte-code data */
   /* ECMA-262 v5, 10.4.2 */
   if (is_direct)
   {
-    this_binding = ecma_copy_value (vm_top_context_p->this_binding);
-    lex_env_p = vm_top_context_p->lex_env_p;
-    ecma_ref_object (vm_top_context_p->lex_env_p);
+    this_binding = ecma_copy_value (JERRY_CONTEXT (vm_top_context_p)->this_binding);
+    lex_env_p = JERRY_CONTEXT (vm_top_context_p)->lex_env_p;
+    ecma_ref_object (JERRY_CONTEXT (vm_top_context_p)->lex_env_p);
   }
   else
   {
@@ -376,13 +737,18 @@ opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   {
     ecma_object_t *func_obj_p = ecma_get_object_from_value (func_value);
 
+    JERRY_CONTEXT (is_arguments_list_moved) = (arguments_list_len > 0
+                               && ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_FUNCTION
+                               && !ecma_get_object_is_builtin (func_obj_p));
+
     completion_value = ecma_op_function_call (func_obj_p,
                                               this_value,
                                               stack_top_p,
                                               arguments_list_len);
   }
 
-  is_direct_eval_form_call = false;
+  JERRY_CONTEXT (is_direct_eval_form_call) = false;
+  JERRY_ASSERT (!JERRY_CONTEXT (is_arguments_list_moved));
 
   /* Free registers. */
   for (uint32_t i = 0; i < arguments_list_len; i++)
@@ -487,28 +853,38 @@ enum
       } \
       else \
       { \
-        ecma_string_t *name_p = ecma_new_ecma_string_from_lit_cp (literal_start_p[literal_index]); \
-        ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (frame_ctx_p->lex_env_p, \
-                                                                            name_p); \
-        if (ref_base_lex_env_p != NULL) \
+        ecma_property_t *binding_p = vm_scope_cache_lookup (frame_ctx_p, literal_index, NULL); \
+        if (binding_p != NULL) \
         { \
-          last_completion_value = ecma_op_get_value_lex_env_base (ref_base_lex_env_p, \
-                                                                  name_p, \
-                                                                  is_strict); \
+          (target_value) = ecma_copy_value (ecma_get_named_data_property_value (binding_p)); \
+          target_free_op; \
         } \
         else \
         { \
-          last_completion_value = ecma_raise_reference_error (ECMA_ERR_MSG ("")); \
-        } \
-        \
-        ecma_deref_ecma_string (name_p); \
-        \
-        if (ecma_is_value_error (last_completion_value)) \
-        { \
-          goto error; \
+          ecma_string_t *name_p = ecma_new_ecma_string_from_lit_cp (literal_start_p[literal_index]); \
+          ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (frame_ctx_p->lex_env_p, \
+                                                                              name_p); \
+          if (ref_base_lex_env_p != NULL) \
+          { \
+            last_completion_value = ecma_op_get_value_lex_env_base (ref_base_lex_env_p, \
+                                                                    name_p, \
+                                                                    is_strict); \
+            vm_scope_cache_insert (frame_ctx_p, literal_index, ref_base_lex_env_p, name_p); \
+          } \
+          else \
+          { \
+            last_completion_value = ecma_raise_reference_error (ECMA_ERR_MSG ("")); \
+          } \
+          \
+          ecma_deref_ecma_string (name_p); \
+          \
+          if (ecma_is_value_error (last_completion_value)) \
+          { \
+            goto error; \
+          } \
+          (target_value) = last_completion_value; \
+          target_free_op; \
         } \
-        (target_value) = last_completion_value; \
-        target_free_op; \
       } \
     } \
     else if (literal_index < const_literal_end) \
@@ -517,9 +893,7 @@ enum
       lit_literal_t lit = lit_cpointer_decompress (lit_cpointer); \
       if (unlikely (LIT_RECORD_IS_NUMBER (lit))) \
       { \
-        ecma_number_t *number_p = ecma_alloc_number (); \
-        *number_p = lit_number_literal_get_number (lit); \
-        (target_value) = ecma_make_number_value (number_p); \
+        (target_value) = ecma_make_number_value (lit_number_literal_get_number (lit)); \
       } \
       else \
       { \
@@ -537,18 +911,262 @@ enum
   } \
   while (0)
 
+/**
+ * Decode the branch offset and fetch the operands of the current instruction.
+ *
+ * Note:
+ *      opcode, opcode_flags and opcode_data must be set before. When they are
+ *      compile time constants (see threaded dispatch), the unused decoding
+ *      paths are removed, so the operand fetch is specialized for the opcode.
+ */
+#define VM_DECODE_OPERANDS() \
+  do \
+  { \
+    if (opcode_data & VM_OC_INLINE_CACHE) \
+    { \
+      inline_cache_index = *(byte_code_p++); \
+    } \
+    \
+    if (opcode_flags & CBC_HAS_BRANCH_ARG) \
+    { \
+      branch_offset = 0; \
+      switch (CBC_BRANCH_OFFSET_LENGTH (opcode)) \
+      { \
+        case 3: \
+        { \
+          branch_offset = *(byte_code_p++); \
+          /* FALLTHRU */ \
+        } \
+        case 2: \
+        { \
+          branch_offset <<= 8; \
+          branch_offset |= *(byte_code_p++); \
+          /* FALLTHRU */ \
+        } \
+        default: \
+        { \
+          JERRY_ASSERT (CBC_BRANCH_OFFSET_LENGTH (opcode) > 0); \
+          branch_offset <<= 8; \
+          branch_offset |= *(byte_code_p++); \
+          break; \
+        } \
+      } \
+      if (CBC_BRANCH_IS_BACKWARD (opcode_flags)) \
+      { \
+        branch_offset = -branch_offset; \
+      } \
+    } \
+    \
+    free_flags = 0; \
+    if (opcode_data & (VM_OC_GET_DATA_MASK << VM_OC_GET_DATA_SHIFT)) \
+    { \
+      uint32_t operands = VM_OC_GET_DATA_GET_ID (opcode_data); \
+    \
+      if (operands >= VM_OC_GET_DATA_GET_ID (VM_OC_GET_LITERAL)) \
+      { \
+        uint16_t literal_index; \
+        READ_LITERAL_INDEX (literal_index); \
+        READ_LITERAL (literal_index, \
+                      left_value, \
+                      free_flags = VM_FREE_LEFT_VALUE); \
+    \
+        switch (operands) \
+        { \
+          case VM_OC_GET_DATA_GET_ID (VM_OC_GET_STACK_LITERAL): \
+          { \
+            JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end); \
+            right_value = left_value; \
+            left_value = *(--stack_top_p); \
+            free_flags = (uint8_t) ((free_flags << 1) | VM_FREE_LEFT_VALUE); \
+            break; \
+          } \
+          case VM_OC_GET_DATA_GET_ID (VM_OC_GET_LITERAL_BYTE): \
+          { \
+            right_value = *(byte_code_p++); \
+            break; \
+          } \
+          case VM_OC_GET_DATA_GET_ID (VM_OC_GET_LITERAL_LITERAL): \
+          { \
+            uint16_t literal_index; \
+            READ_LITERAL_INDEX (literal_index); \
+            READ_LITERAL (literal_index, \
+                          right_value, \
+                          free_flags |= VM_FREE_RIGHT_VALUE); \
+            break; \
+          } \
+          case VM_OC_GET_DATA_GET_ID (VM_OC_GET_THIS_LITERAL): \
+          { \
+            right_value = left_value; \
+            left_value = ecma_copy_value (frame_ctx_p->this_binding); \
+            free_flags = (uint8_t) ((free_flags << 1) | VM_FREE_LEFT_VALUE); \
+            break; \
+          } \
+          default: \
+          { \
+            JERRY_ASSERT (operands == VM_OC_GET_DATA_GET_ID (VM_OC_GET_LITERAL)); \
+            break; \
+          } \
+        } \
+      } \
+      else \
+      { \
+        switch (operands) \
+        { \
+          case VM_OC_GET_DATA_GET_ID (VM_OC_GET_STACK): \
+          { \
+            JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end); \
+            left_value = *(--stack_top_p); \
+            free_flags = VM_FREE_LEFT_VALUE; \
+            break; \
+          } \
+          case VM_OC_GET_DATA_GET_ID (VM_OC_GET_STACK_STACK): \
+          { \
+            JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end + 1); \
+            right_value = *(--stack_top_p); \
+            left_value = *(--stack_top_p); \
+            free_flags = VM_FREE_LEFT_VALUE | VM_FREE_RIGHT_VALUE; \
+            break; \
+          } \
+          case VM_OC_GET_DATA_GET_ID (VM_OC_GET_BYTE): \
+          { \
+            right_value = *(byte_code_p++); \
+            break; \
+          } \
+          default: \
+          { \
+            JERRY_UNREACHABLE (); \
+            break; \
+          } \
+        } \
+      } \
+    } \
+  } \
+  while (0)
+
+/**
+ * Compare the left and right values and take the branch if the result is true.
+ *
+ * Note:
+ *      numbers are compared inline without creating the boolean result
+ */
+#define VM_COMPARE_AND_BRANCH(number_compare_op, compare_function) \
+  do \
+  { \
+    bool is_true; \
+    \
+    if (ecma_are_values_integer_numbers (left_value, right_value)) \
+    { \
+      is_true = (ecma_get_integer_from_value (left_value) \
+                 number_compare_op ecma_get_integer_from_value (right_value)); \
+    } \
+    else if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value)) \
+    { \
+      is_true = (ecma_get_number_from_value (left_value) \
+                 number_compare_op ecma_get_number_from_value (right_value)); \
+    } \
+    else \
+    { \
+      last_completion_value = compare_function (left_value, right_value); \
+      \
+      if (ecma_is_value_error (last_completion_value)) \
+      { \
+        goto error; \
+      } \
+      \
+      is_true = ecma_is_value_true (last_completion_value); \
+    } \
+    \
+    if (is_true) \
+    { \
+      byte_code_p = byte_code_start_p + branch_offset; \
+    } \
+  } \
+  while (0)
+
+#ifdef VM_USE_THREADED_DISPATCH
+
+/**
+ * Jump to a label address.
+ */
+#define VM_THREADED_GOTO(label_p) \
+  __extension__ ({ goto *(label_p); })
+
+/**
+ * Entry point of an opcode: decode its operands and jump to its group handler.
+ */
+#define VM_THREADED_OPCODE_ENTRY(name, flags, data) \
+  do \
+  { \
+    opcode = (uint8_t) (name); \
+    opcode_flags = (uint8_t) (flags); \
+    opcode_data = (uint32_t) (data); \
+    VM_DECODE_OPERANDS (); \
+    VM_THREADED_GOTO (vm_oc_labels[VM_OC_GROUP_GET_INDEX (opcode_data)]); \
+  } \
+  while (0)
+
+/**
+ * Case of an opcode group, which is also a jump target of the opcode entries.
+ */
+#define VM_OC_CASE(group) \
+  case group: vm_label_ ## group
+
+#else /* !VM_USE_THREADED_DISPATCH */
+
+/**
+ * Case of an opcode group.
+ */
+#define VM_OC_CASE(group) \
+  case group
+
+#endif /* VM_USE_THREADED_DISPATCH */
+
+#ifdef JERRY_VM_SEQUENCE_STATS
+
+/**
+ * Record the execution of an opcode in the byte code sequence statistics.
+ */
+#define VM_STATS_RECORD_OPCODE(opcode_id, flags) \
+  vm_stats_record_opcode (&stats_history, (uint32_t) (opcode_id), (uint8_t) (flags))
+
+#else /* !JERRY_VM_SEQUENCE_STATS */
+
+/**
+ * Byte code sequence statistics are not collected.
+ */
+#define VM_STATS_RECORD_OPCODE(opcode_id, flags)
+
+#endif /* JERRY_VM_SEQUENCE_STATS */
+
+#ifdef JERRY_VM_PROFILE
+
+/**
+ * Record the start of an opcode execution in the opcode profile.
+ */
+#define VM_PROFILE_RECORD_OPCODE(opcode_id) \
+  vm_stats_profile_opcode ((uint32_t) (opcode_id))
+
+#else /* !JERRY_VM_PROFILE */
+
+/**
+ * Opcode profile is not collected.
+ */
+#define VM_PROFILE_RECORD_OPCODE(opcode_id)
+
+#endif /* JERRY_VM_PROFILE */
+
 /**
  * Cleanup interpreter
  */
 void
 vm_finalize (void)
 {
-  if (__program)
+  if (JERRY_CONTEXT (vm_program_p))
   {
-    ecma_bytecode_deref (__program);
+    ecma_bytecode_deref (JERRY_CONTEXT (vm_program_p));
   }
 
-  __program = NULL;
+  JERRY_CONTEXT (vm_program_p) = NULL;
 } /* vm_finalize */
 
 /**
@@ -632,6 +1250,22 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           READ_LITERAL_INDEX (literal_index_end);
         }
 
+        if (literal_index < register_end)
+        {
+          /* Function declarations which are not captured by closures are stored in registers. */
+          uint32_t value_index;
+
+          JERRY_ASSERT (type == CBC_INITIALIZE_VAR);
+
+          READ_LITERAL_INDEX (value_index);
+          JERRY_ASSERT (value_index >= register_end);
+
+          ecma_free_value (frame_ctx_p->registers_p[literal_index]);
+          frame_ctx_p->registers_p[literal_index] = vm_construct_literal_object (frame_ctx_p,
+                                                                                literal_start_p[value_index]);
+          break;
+        }
+
         while (literal_index <= literal_index_end)
         {
           uint32_t value_index;
@@ -711,6 +1345,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   uint16_t ident_end;
   uint16_t const_literal_end;
   int32_t branch_offset = 0;
+  uint8_t inline_cache_index = CBC_NO_INLINE_CACHE;
   ecma_value_t left_value = 0;
   ecma_value_t right_value = 0;
   ecma_value_t result = 0;
@@ -718,6 +1353,122 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   uint8_t free_flags = 0;
   bool is_strict = ((frame_ctx_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0);
 
+#ifdef VM_USE_THREADED_DISPATCH
+#define CBC_OPCODE(arg1, arg2, arg3, arg4) &&vm_opcode_ ## arg1,
+
+  /* Entry points of opcodes. */
+  __extension__ static const void * const vm_opcode_labels[] =
+  {
+    CBC_OPCODE_LIST
+  };
+
+  /* Entry points of extended opcodes. */
+  __extension__ static const void * const vm_ext_opcode_labels[] =
+  {
+    CBC_EXT_OPCODE_LIST
+  };
+
+#undef CBC_OPCODE
+
+  /* Handlers of opcode groups. */
+  __extension__ static const void * const vm_oc_labels[] =
+  {
+    [VM_OC_NONE] = &&vm_label_VM_OC_NONE,
+    [VM_OC_POP] = &&vm_label_VM_OC_POP,
+    [VM_OC_POP_BLOCK] = &&vm_label_VM_OC_POP_BLOCK,
+    [VM_OC_PUSH] = &&vm_label_VM_OC_PUSH,
+    [VM_OC_PUSH_TWO] = &&vm_label_VM_OC_PUSH_TWO,
+    [VM_OC_PUSH_THREE] = &&vm_label_VM_OC_PUSH_THREE,
+    [VM_OC_PUSH_UNDEFINED] = &&vm_label_VM_OC_PUSH_UNDEFINED,
+    [VM_OC_PUSH_TRUE] = &&vm_label_VM_OC_PUSH_TRUE,
+    [VM_OC_PUSH_FALSE] = &&vm_label_VM_OC_PUSH_FALSE,
+    [VM_OC_PUSH_NULL] = &&vm_label_VM_OC_PUSH_NULL,
+    [VM_OC_PUSH_THIS] = &&vm_label_VM_OC_PUSH_THIS,
+    [VM_OC_PUSH_NUMBER] = &&vm_label_VM_OC_PUSH_NUMBER,
+    [VM_OC_PUSH_OBJECT] = &&vm_label_VM_OC_PUSH_OBJECT,
+    [VM_OC_SET_PROPERTY] = &&vm_label_VM_OC_SET_PROPERTY,
+    [VM_OC_SET_GETTER] = &&vm_label_VM_OC_SET_GETTER,
+    [VM_OC_SET_SETTER] = &&vm_label_VM_OC_SET_SETTER,
+    [VM_OC_PUSH_UNDEFINED_BASE] = &&vm_label_VM_OC_PUSH_UNDEFINED_BASE,
+    [VM_OC_PUSH_ARRAY] = &&vm_label_VM_OC_PUSH_ARRAY,
+    [VM_OC_PUSH_ELISON] = &&vm_label_VM_OC_PUSH_ELISON,
+    [VM_OC_APPEND_ARRAY] = &&vm_label_VM_OC_APPEND_ARRAY,
+    [VM_OC_IDENT_REFERENCE] = &&vm_label_VM_OC_IDENT_REFERENCE,
+    [VM_OC_PROP_REFERENCE] = &&vm_label_VM_OC_PROP_REFERENCE,
+    [VM_OC_PROP_GET] = &&vm_label_VM_OC_PROP_GET,
+    [VM_OC_PROP_PRE_INCR] = &&vm_label_VM_OC_PROP_PRE_INCR,
+    [VM_OC_PRE_INCR] = &&vm_label_VM_OC_PRE_INCR,
+    [VM_OC_PROP_PRE_DECR] = &&vm_label_VM_OC_PROP_PRE_DECR,
+    [VM_OC_PRE_DECR] = &&vm_label_VM_OC_PRE_DECR,
+    [VM_OC_PROP_POST_INCR] = &&vm_label_VM_OC_PROP_POST_INCR,
+    [VM_OC_POST_INCR] = &&vm_label_VM_OC_POST_INCR,
+    [VM_OC_PROP_POST_DECR] = &&vm_label_VM_OC_PROP_POST_DECR,
+    [VM_OC_POST_DECR] = &&vm_label_VM_OC_POST_DECR,
+    [VM_OC_PROP_DELETE] = &&vm_label_VM_OC_PROP_DELETE,
+    [VM_OC_DELETE] = &&vm_label_VM_OC_DELETE,
+    [VM_OC_ASSIGN] = &&vm_label_VM_OC_ASSIGN,
+    [VM_OC_ASSIGN_PROP] = &&vm_label_VM_OC_ASSIGN_PROP,
+    [VM_OC_ASSIGN_PROP_THIS] = &&vm_label_VM_OC_ASSIGN_PROP_THIS,
+    [VM_OC_RET] = &&vm_label_VM_OC_RET,
+    [VM_OC_THROW] = &&vm_label_VM_OC_THROW,
+    [VM_OC_THROW_REFERENCE_ERROR] = &&vm_label_VM_OC_THROW_REFERENCE_ERROR,
+    [VM_OC_EVAL] = &&vm_label_VM_OC_EVAL,
+    [VM_OC_CALL] = &&vm_label_VM_OC_CALL,
+    [VM_OC_NEW] = &&vm_label_VM_OC_NEW,
+    [VM_OC_JUMP] = &&vm_label_VM_OC_JUMP,
+    [VM_OC_BRANCH_IF_STRICT_EQUAL] = &&vm_label_VM_OC_BRANCH_IF_STRICT_EQUAL,
+    [VM_OC_BRANCH_IF_TRUE] = &&vm_label_VM_OC_BRANCH_IF_TRUE,
+    [VM_OC_BRANCH_IF_FALSE] = &&vm_label_VM_OC_BRANCH_IF_FALSE,
+    [VM_OC_BRANCH_IF_LOGICAL_TRUE] = &&vm_label_VM_OC_BRANCH_IF_LOGICAL_TRUE,
+    [VM_OC_BRANCH_IF_LOGICAL_FALSE] = &&vm_label_VM_OC_BRANCH_IF_LOGICAL_FALSE,
+    [VM_OC_EQUAL_BRANCH] = &&vm_label_VM_OC_EQUAL_BRANCH,
+    [VM_OC_NOT_EQUAL_BRANCH] = &&vm_label_VM_OC_NOT_EQUAL_BRANCH,
+    [VM_OC_STRICT_EQUAL_BRANCH] = &&vm_label_VM_OC_STRICT_EQUAL_BRANCH,
+    [VM_OC_STRICT_NOT_EQUAL_BRANCH] = &&vm_label_VM_OC_STRICT_NOT_EQUAL_BRANCH,
+    [VM_OC_LESS_BRANCH] = &&vm_label_VM_OC_LESS_BRANCH,
+    [VM_OC_GREATER_BRANCH] = &&vm_label_VM_OC_GREATER_BRANCH,
+    [VM_OC_LESS_EQUAL_BRANCH] = &&vm_label_VM_OC_LESS_EQUAL_BRANCH,
+    [VM_OC_GREATER_EQUAL_BRANCH] = &&vm_label_VM_OC_GREATER_EQUAL_BRANCH,
+    [VM_OC_PLUS] = &&vm_label_VM_OC_PLUS,
+    [VM_OC_MINUS] = &&vm_label_VM_OC_MINUS,
+    [VM_OC_NOT] = &&vm_label_VM_OC_NOT,
+    [VM_OC_BIT_NOT] = &&vm_label_VM_OC_BIT_NOT,
+    [VM_OC_VOID] = &&vm_label_VM_OC_VOID,
+    [VM_OC_TYPEOF_IDENT] = &&vm_label_VM_OC_TYPEOF_IDENT,
+    [VM_OC_TYPEOF] = &&vm_label_VM_OC_TYPEOF,
+    [VM_OC_ADD] = &&vm_label_VM_OC_ADD,
+    [VM_OC_SUB] = &&vm_label_VM_OC_SUB,
+    [VM_OC_MUL] = &&vm_label_VM_OC_MUL,
+    [VM_OC_DIV] = &&vm_label_VM_OC_DIV,
+    [VM_OC_MOD] = &&vm_label_VM_OC_MOD,
+    [VM_OC_EQUAL] = &&vm_label_VM_OC_EQUAL,
+    [VM_OC_NOT_EQUAL] = &&vm_label_VM_OC_NOT_EQUAL,
+    [VM_OC_STRICT_EQUAL] = &&vm_label_VM_OC_STRICT_EQUAL,
+    [VM_OC_STRICT_NOT_EQUAL] = &&vm_label_VM_OC_STRICT_NOT_EQUAL,
+    [VM_OC_LESS] = &&vm_label_VM_OC_LESS,
+    [VM_OC_GREATER] = &&vm_label_VM_OC_GREATER,
+    [VM_OC_LESS_EQUAL] = &&vm_label_VM_OC_LESS_EQUAL,
+    [VM_OC_GREATER_EQUAL] = &&vm_label_VM_OC_GREATER_EQUAL,
+    [VM_OC_IN] = &&vm_label_VM_OC_IN,
+    [VM_OC_INSTANCEOF] = &&vm_label_VM_OC_INSTANCEOF,
+    [VM_OC_BIT_OR] = &&vm_label_VM_OC_BIT_OR,
+    [VM_OC_BIT_XOR] = &&vm_label_VM_OC_BIT_XOR,
+    [VM_OC_BIT_AND] = &&vm_label_VM_OC_BIT_AND,
+    [VM_OC_LEFT_SHIFT] = &&vm_label_VM_OC_LEFT_SHIFT,
+    [VM_OC_RIGHT_SHIFT] = &&vm_label_VM_OC_RIGHT_SHIFT,
+    [VM_OC_UNS_RIGHT_SHIFT] = &&vm_label_VM_OC_UNS_RIGHT_SHIFT,
+    [VM_OC_WITH] = &&vm_label_VM_OC_WITH,
+    [VM_OC_FOR_IN_CREATE_CONTEXT] = &&vm_label_VM_OC_FOR_IN_CREATE_CONTEXT,
+    [VM_OC_FOR_IN_GET_NEXT] = &&vm_label_VM_OC_FOR_IN_GET_NEXT,
+    [VM_OC_FOR_IN_HAS_NEXT] = &&vm_label_VM_OC_FOR_IN_HAS_NEXT,
+    [VM_OC_TRY] = &&vm_label_VM_OC_TRY,
+    [VM_OC_CATCH] = &&vm_label_VM_OC_CATCH,
+    [VM_OC_FINALLY] = &&vm_label_VM_OC_FINALLY,
+    [VM_OC_CONTEXT_END] = &&vm_label_VM_OC_CONTEXT_END,
+    [VM_OC_JUMP_AND_EXIT_CONTEXT] = &&vm_label_VM_OC_JUMP_AND_EXIT_CONTEXT,
+  };
+#endif /* VM_USE_THREADED_DISPATCH */
+
   /* Prepare for byte code execution. */
   if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING))
   {
@@ -750,6 +1501,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   /* Outer loop for exception handling. */
   while (true)
   {
+#ifdef JERRY_VM_SEQUENCE_STATS
+    vm_stats_history_t stats_history = VM_STATS_HISTORY_EMPTY;
+#endif /* JERRY_VM_SEQUENCE_STATS */
+
     /* Internal loop for byte code execution. */
     while (true)
     {
@@ -758,163 +1513,101 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       uint8_t opcode_flags;
       uint32_t opcode_data;
 
+#ifdef MEM_STATS
+      frame_ctx_p->current_instruction_p = byte_code_start_p;
+#endif /* MEM_STATS */
+
+#ifdef VM_USE_THREADED_DISPATCH
+      /* The compiler assumes that any label can be reached by
+       * the computed gotos, so these must be initialized. */
+      opcode_flags = 0;
+      opcode_data = 0;
+#endif /* VM_USE_THREADED_DISPATCH */
+
       opcode = *byte_code_p++;
+
+#ifdef VM_USE_THREADED_DISPATCH
+      JERRY_ASSERT (opcode < CBC_END);
+      VM_THREADED_GOTO (vm_opcode_labels[opcode]);
+
+      /* Each opcode has its own entry point. Since the opcode, its flags
+       * and its decode data are constants here, VM_DECODE_OPERANDS is
+       * specialized for the opcode and the jump to the group handler
+       * is resolved at compile time. */
+#define CBC_OPCODE(arg1, arg2, arg3, arg4) \
+vm_opcode_ ## arg1: \
+      if ((arg1) == CBC_EXT_OPCODE) \
+      { \
+        opcode = *byte_code_p++; \
+        JERRY_ASSERT (opcode < CBC_EXT_END); \
+        VM_THREADED_GOTO (vm_ext_opcode_labels[opcode]); \
+      } \
+      VM_STATS_RECORD_OPCODE (arg1, arg2); \
+      VM_PROFILE_RECORD_OPCODE (arg1); \
+      VM_THREADED_OPCODE_ENTRY (arg1, arg2, arg4);
+
+      CBC_OPCODE_LIST
+
+#undef CBC_OPCODE
+#define CBC_OPCODE(arg1, arg2, arg3, arg4) \
+vm_opcode_ ## arg1: \
+      VM_STATS_RECORD_OPCODE (VM_STATS_EXT_OPCODE_ID (arg1), arg2); \
+      VM_PROFILE_RECORD_OPCODE (VM_STATS_EXT_OPCODE_ID (arg1)); \
+      VM_THREADED_OPCODE_ENTRY (arg1, arg2, arg4);
+
+      CBC_EXT_OPCODE_LIST
+
+#undef CBC_OPCODE
+#else /* !VM_USE_THREADED_DISPATCH */
       if (opcode == CBC_EXT_OPCODE)
       {
         opcode = *byte_code_p++;
         opcode_flags = cbc_ext_flags[opcode];
         opcode_data = vm_ext_decode_table[opcode];
+        VM_STATS_RECORD_OPCODE (VM_STATS_EXT_OPCODE_ID (opcode), opcode_flags);
+        VM_PROFILE_RECORD_OPCODE (VM_STATS_EXT_OPCODE_ID (opcode));
       }
       else
       {
         opcode_flags = cbc_flags[opcode];
         opcode_data = vm_decode_table[opcode];
+        VM_STATS_RECORD_OPCODE (opcode, opcode_flags);
+        VM_PROFILE_RECORD_OPCODE (opcode);
       }
 
-      if (opcode_flags & CBC_HAS_BRANCH_ARG)
-      {
-        branch_offset = 0;
-        switch (CBC_BRANCH_OFFSET_LENGTH (opcode))
-        {
-          case 3:
-          {
-            branch_offset = *(byte_code_p++);
-            /* FALLTHRU */
-          }
-          case 2:
-          {
-            branch_offset <<= 8;
-            branch_offset |= *(byte_code_p++);
-            /* FALLTHRU */
-          }
-          default:
-          {
-            JERRY_ASSERT (CBC_BRANCH_OFFSET_LENGTH (opcode) > 0);
-            branch_offset <<= 8;
-            branch_offset |= *(byte_code_p++);
-            break;
-          }
-        }
-        if (CBC_BRANCH_IS_BACKWARD (opcode_flags))
-        {
-          branch_offset = -branch_offset;
-        }
-      }
-
-      free_flags = 0;
-      if (opcode_data & (VM_OC_GET_DATA_MASK << VM_OC_GET_DATA_SHIFT))
-      {
-        uint32_t operands = VM_OC_GET_DATA_GET_ID (opcode_data);
-
-        if (operands >= VM_OC_GET_DATA_GET_ID (VM_OC_GET_LITERAL))
-        {
-          uint16_t literal_index;
-          READ_LITERAL_INDEX (literal_index);
-          READ_LITERAL (literal_index,
-                        left_value,
-                        free_flags = VM_FREE_LEFT_VALUE);
-
-          switch (operands)
-          {
-            case VM_OC_GET_DATA_GET_ID (VM_OC_GET_STACK_LITERAL):
-            {
-              JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end);
-              right_value = left_value;
-              left_value = *(--stack_top_p);
-              free_flags = (uint8_t) ((free_flags << 1) | VM_FREE_LEFT_VALUE);
-              break;
-            }
-            case VM_OC_GET_DATA_GET_ID (VM_OC_GET_LITERAL_BYTE):
-            {
-              right_value = *(byte_code_p++);
-              break;
-            }
-            case VM_OC_GET_DATA_GET_ID (VM_OC_GET_LITERAL_LITERAL):
-            {
-              uint16_t literal_index;
-              READ_LITERAL_INDEX (literal_index);
-              READ_LITERAL (literal_index,
-                            right_value,
-                            free_flags |= VM_FREE_RIGHT_VALUE);
-              break;
-            }
-            case VM_OC_GET_DATA_GET_ID (VM_OC_GET_THIS_LITERAL):
-            {
-              right_value = left_value;
-              left_value = ecma_copy_value (frame_ctx_p->this_binding);
-              free_flags = (uint8_t) ((free_flags << 1) | VM_FREE_LEFT_VALUE);
-              break;
-            }
-            default:
-            {
-              JERRY_ASSERT (operands == VM_OC_GET_DATA_GET_ID (VM_OC_GET_LITERAL));
-              break;
-            }
-          }
-        }
-        else
-        {
-          switch (operands)
-          {
-            case VM_OC_GET_DATA_GET_ID (VM_OC_GET_STACK):
-            {
-              JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end);
-              left_value = *(--stack_top_p);
-              free_flags = VM_FREE_LEFT_VALUE;
-              break;
-            }
-            case VM_OC_GET_DATA_GET_ID (VM_OC_GET_STACK_STACK):
-            {
-              JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end + 1);
-              right_value = *(--stack_top_p);
-              left_value = *(--stack_top_p);
-              free_flags = VM_FREE_LEFT_VALUE | VM_FREE_RIGHT_VALUE;
-              break;
-            }
-            case VM_OC_GET_DATA_GET_ID (VM_OC_GET_BYTE):
-            {
-              right_value = *(byte_code_p++);
-              break;
-            }
-            default:
-            {
-              JERRY_UNREACHABLE ();
-              break;
-            }
-          }
-        }
-      }
+      VM_DECODE_OPERANDS ();
+#endif /* VM_USE_THREADED_DISPATCH */
 
       switch (VM_OC_GROUP_GET_INDEX (opcode_data))
       {
-        case VM_OC_NONE:
+        VM_OC_CASE (VM_OC_NONE):
         {
           JERRY_ASSERT (opcode == CBC_EXT_DEBUGGER);
           break;
         }
-        case VM_OC_POP:
+        VM_OC_CASE (VM_OC_POP):
         {
           JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end);
           ecma_free_value (*(--stack_top_p));
           break;
         }
-        case VM_OC_POP_BLOCK:
+        VM_OC_CASE (VM_OC_POP_BLOCK):
         {
           result = *(--stack_top_p);
           break;
         }
-        case VM_OC_PUSH:
+        VM_OC_CASE (VM_OC_PUSH):
         {
           *(stack_top_p++) = left_value;
           continue;
         }
-        case VM_OC_PUSH_TWO:
+        VM_OC_CASE (VM_OC_PUSH_TWO):
         {
           *(stack_top_p++) = left_value;
           *(stack_top_p++) = right_value;
           continue;
         }
-        case VM_OC_PUSH_THREE:
+        VM_OC_CASE (VM_OC_PUSH_THREE):
         {
           uint16_t literal_index;
 
@@ -929,39 +1622,37 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *(stack_top_p++) = left_value;
           continue;
         }
-        case VM_OC_PUSH_UNDEFINED:
-        case VM_OC_VOID:
+        VM_OC_CASE (VM_OC_PUSH_UNDEFINED):
+        VM_OC_CASE (VM_OC_VOID):
         {
           result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
           break;
         }
-        case VM_OC_PUSH_TRUE:
+        VM_OC_CASE (VM_OC_PUSH_TRUE):
         {
           result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
           break;
         }
-        case VM_OC_PUSH_FALSE:
+        VM_OC_CASE (VM_OC_PUSH_FALSE):
         {
           result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE);
           break;
         }
-        case VM_OC_PUSH_NULL:
+        VM_OC_CASE (VM_OC_PUSH_NULL):
         {
           result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_NULL);
           break;
         }
-        case VM_OC_PUSH_THIS:
+        VM_OC_CASE (VM_OC_PUSH_THIS):
         {
           result = ecma_copy_value (frame_ctx_p->this_binding);
           break;
         }
-        case VM_OC_PUSH_NUMBER:
+        VM_OC_CASE (VM_OC_PUSH_NUMBER):
         {
-          ecma_number_t *number_p = ecma_alloc_number ();
-
           if (opcode == CBC_PUSH_NUMBER_0)
           {
-            *number_p = 0;
+            result = ecma_make_integer_value (0);
           }
           else
           {
@@ -973,13 +1664,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             {
               value = -(value - CBC_PUSH_NUMBER_1_RANGE_END);
             }
-            *number_p = (ecma_number_t) value;
+            result = ecma_make_integer_value ((ecma_integer_value_t) value);
           }
-
-          result = ecma_make_number_value (number_p);
           break;
         }
-        case VM_OC_PUSH_OBJECT:
+        VM_OC_CASE (VM_OC_PUSH_OBJECT):
         {
           ecma_object_t *prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
           ecma_object_t *obj_p = ecma_create_object (prototype_p,
@@ -989,7 +1678,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_deref_object (prototype_p);
           break;
         }
-        case VM_OC_SET_PROPERTY:
+        VM_OC_CASE (VM_OC_SET_PROPERTY):
         {
           ecma_object_t *object_p = ecma_get_object_from_value (stack_top_p[-1]);
           ecma_string_t *prop_name_p;
@@ -1036,8 +1725,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_SET_GETTER:
-        case VM_OC_SET_SETTER:
+        VM_OC_CASE (VM_OC_SET_GETTER):
+        VM_OC_CASE (VM_OC_SET_SETTER):
         {
           opfunc_set_accessor (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_SET_GETTER ? true : false,
                                stack_top_p[-1],
@@ -1045,7 +1734,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                                right_value);
           break;
         }
-        case VM_OC_PUSH_ARRAY:
+        VM_OC_CASE (VM_OC_PUSH_ARRAY):
         {
           last_completion_value = ecma_op_create_array_object (NULL, 0, false);
 
@@ -1056,17 +1745,18 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_PUSH_ELISON:
+        VM_OC_CASE (VM_OC_PUSH_ELISON):
         {
           result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_ARRAY_HOLE);
           break;
         }
-        case VM_OC_APPEND_ARRAY:
+        VM_OC_CASE (VM_OC_APPEND_ARRAY):
         {
           ecma_object_t *array_obj_p;
           ecma_string_t *length_str_p;
           ecma_property_t *length_prop_p;
-          ecma_number_t *length_num_p;
+          ecma_value_t length_value;
+          uint32_t length_num;
           ecma_property_descriptor_t prop_desc;
 
           prop_desc = ecma_make_empty_property_descriptor ();
@@ -1089,8 +1779,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (length_prop_p != NULL);
 
-          left_value = ecma_get_named_data_property_value (length_prop_p);
-          length_num_p = ecma_get_number_from_value (left_value);
+          length_value = ecma_get_named_data_property_value (length_prop_p);
+          length_num = (uint32_t) ecma_get_number_from_value (length_value);
 
           ecma_deref_ecma_string (length_str_p);
 
@@ -1098,32 +1788,37 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             if (!ecma_is_value_array_hole (stack_top_p[i]))
             {
-              ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 ((uint32_t) *length_num_p);
+              if (!ecma_op_array_create_fast_element (array_obj_p, length_num, stack_top_p[i]))
+              {
+                ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (length_num);
 
-              prop_desc.value = stack_top_p[i];
+                prop_desc.value = stack_top_p[i];
 
-              ecma_op_general_object_define_own_property (array_obj_p,
-                                                          index_str_p,
-                                                          &prop_desc,
-                                                          false);
+                ecma_op_general_object_define_own_property (array_obj_p,
+                                                            index_str_p,
+                                                            &prop_desc,
+                                                            false);
 
-              ecma_deref_ecma_string (index_str_p);
+                ecma_deref_ecma_string (index_str_p);
+              }
 
               ecma_free_value (stack_top_p[i]);
             }
 
-            (*length_num_p)++;
+            length_num++;
           }
 
+          ecma_free_value (length_value);
+          ecma_set_named_data_property_value (length_prop_p, ecma_make_uint32_value (length_num));
           break;
         }
-        case VM_OC_PUSH_UNDEFINED_BASE:
+        VM_OC_CASE (VM_OC_PUSH_UNDEFINED_BASE):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
           break;
         }
-        case VM_OC_IDENT_REFERENCE:
+        VM_OC_CASE (VM_OC_IDENT_REFERENCE):
         {
           uint16_t literal_index;
 
@@ -1170,7 +1865,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_PROP_REFERENCE:
+        VM_OC_CASE (VM_OC_PROP_REFERENCE):
         {
           /* Forms with reference requires preserving the base and offset. */
 
@@ -1195,15 +1890,26 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_PROP_GET:
-        case VM_OC_PROP_PRE_INCR:
-        case VM_OC_PROP_PRE_DECR:
-        case VM_OC_PROP_POST_INCR:
-        case VM_OC_PROP_POST_DECR:
+        VM_OC_CASE (VM_OC_PROP_GET):
+        VM_OC_CASE (VM_OC_PROP_PRE_INCR):
+        VM_OC_CASE (VM_OC_PROP_PRE_DECR):
+        VM_OC_CASE (VM_OC_PROP_POST_INCR):
+        VM_OC_CASE (VM_OC_PROP_POST_DECR):
         {
-          last_completion_value = vm_op_get_value (left_value,
-                                                   right_value,
-                                                   is_strict);
+          if (opcode_data & VM_OC_INLINE_CACHE)
+          {
+            last_completion_value = vm_op_get_value_cached (bytecode_header_p,
+                                                            inline_cache_index,
+                                                            left_value,
+                                                            right_value,
+                                                            is_strict);
+          }
+          else
+          {
+            last_completion_value = vm_op_get_value (left_value,
+                                                     right_value,
+                                                     is_strict);
+          }
 
           if (ecma_is_value_error (last_completion_value))
           {
@@ -1222,30 +1928,36 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           free_flags = VM_FREE_LEFT_VALUE;
           /* FALLTHRU */
         }
-        case VM_OC_PRE_INCR:
-        case VM_OC_PRE_DECR:
-        case VM_OC_POST_INCR:
-        case VM_OC_POST_DECR:
+        VM_OC_CASE (VM_OC_PRE_INCR):
+        VM_OC_CASE (VM_OC_PRE_DECR):
+        VM_OC_CASE (VM_OC_POST_INCR):
+        VM_OC_CASE (VM_OC_POST_DECR):
         {
           uint32_t base = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
-          ecma_number_t increase = ECMA_NUMBER_ONE;
-          ecma_number_t *result_p;
-
-          last_completion_value = ecma_op_to_number (left_value);
+          ecma_integer_value_t increase = 1;
 
-          if (ecma_is_value_error (last_completion_value))
+          if (ecma_is_value_integer_number (left_value))
           {
-            goto error;
+            result = left_value;
+          }
+          else
+          {
+            last_completion_value = ecma_op_to_number (left_value);
+
+            if (ecma_is_value_error (last_completion_value))
+            {
+              goto error;
+            }
+
+            result = last_completion_value;
           }
 
           byte_code_p = byte_code_start_p + 1;
-          result = last_completion_value;
-          result_p = ecma_get_number_from_value (result);
 
           if (base & 0x2)
           {
             /* For decrement operators */
-            increase = ECMA_NUMBER_MINUS_ONE;
+            increase = -1;
           }
 
           /* Post operators require the unmodifed number value. */
@@ -1283,23 +1995,32 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             }
           }
 
-          *result_p = ecma_number_add (*result_p, increase);
+          if (ecma_is_value_integer_number (result))
+          {
+            result = ecma_make_int32_value (ecma_get_integer_from_value (result) + increase);
+          }
+          else
+          {
+            ecma_number_t result_number = ecma_get_number_from_value (result);
+
+            result = ecma_update_float_number (result, ecma_number_add (result_number, (ecma_number_t) increase));
+          }
           break;
         }
-        case VM_OC_ASSIGN:
+        VM_OC_CASE (VM_OC_ASSIGN):
         {
           result = left_value;
           free_flags = 0;
           break;
         }
-        case VM_OC_ASSIGN_PROP:
+        VM_OC_CASE (VM_OC_ASSIGN_PROP):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = left_value;
           free_flags = 0;
           break;
         }
-        case VM_OC_ASSIGN_PROP_THIS:
+        VM_OC_CASE (VM_OC_ASSIGN_PROP_THIS):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = ecma_copy_value (frame_ctx_p->this_binding);
@@ -1307,7 +2028,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           free_flags = 0;
           break;
         }
-        case VM_OC_RET:
+        VM_OC_CASE (VM_OC_RET):
         {
           JERRY_ASSERT (opcode == CBC_RETURN
                         || opcode == CBC_RETURN_WITH_BLOCK
@@ -1323,24 +2044,24 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           free_flags = 0;
           goto error;
         }
-        case VM_OC_THROW:
+        VM_OC_CASE (VM_OC_THROW):
         {
           last_completion_value = ecma_make_error_value (left_value);
           free_flags = 0;
           goto error;
         }
-        case VM_OC_THROW_REFERENCE_ERROR:
+        VM_OC_CASE (VM_OC_THROW_REFERENCE_ERROR):
         {
           last_completion_value = ecma_raise_reference_error (ECMA_ERR_MSG (""));
           goto error;
         }
-        case VM_OC_EVAL:
+        VM_OC_CASE (VM_OC_EVAL):
         {
-          is_direct_eval_form_call = true;
+          JERRY_CONTEXT (is_direct_eval_form_call) = true;
           JERRY_ASSERT (*byte_code_p >= CBC_CALL && *byte_code_p <= CBC_CALL2_PROP_BLOCK);
           continue;
         }
-        case VM_OC_CALL:
+        VM_OC_CASE (VM_OC_CALL):
         {
           JERRY_ASSERT (free_flags == 0);
 
@@ -1372,7 +2093,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_NEW:
+        VM_OC_CASE (VM_OC_NEW):
         {
           JERRY_ASSERT (free_flags == 0);
 
@@ -1398,7 +2119,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_PROP_DELETE:
+        VM_OC_CASE (VM_OC_PROP_DELETE):
         {
           last_completion_value = vm_op_delete_prop (left_value, right_value, is_strict);
 
@@ -1410,7 +2131,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_DELETE:
+        VM_OC_CASE (VM_OC_DELETE):
         {
           uint16_t literal_index;
 
@@ -1434,12 +2155,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_JUMP:
+        VM_OC_CASE (VM_OC_JUMP):
         {
           byte_code_p = byte_code_start_p + branch_offset;
           break;
         }
-        case VM_OC_BRANCH_IF_STRICT_EQUAL:
+        VM_OC_CASE (VM_OC_BRANCH_IF_STRICT_EQUAL):
         {
           JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end);
 
@@ -1460,10 +2181,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_BRANCH_IF_TRUE:
-        case VM_OC_BRANCH_IF_FALSE:
-        case VM_OC_BRANCH_IF_LOGICAL_TRUE:
-        case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+        VM_OC_CASE (VM_OC_BRANCH_IF_TRUE):
+        VM_OC_CASE (VM_OC_BRANCH_IF_FALSE):
+        VM_OC_CASE (VM_OC_BRANCH_IF_LOGICAL_TRUE):
+        VM_OC_CASE (VM_OC_BRANCH_IF_LOGICAL_FALSE):
         {
           uint32_t base = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_BRANCH_IF_TRUE;
 
@@ -1487,7 +2208,47 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_PLUS:
+        VM_OC_CASE (VM_OC_EQUAL_BRANCH):
+        {
+          VM_COMPARE_AND_BRANCH (==, opfunc_equal_value);
+          break;
+        }
+        VM_OC_CASE (VM_OC_NOT_EQUAL_BRANCH):
+        {
+          VM_COMPARE_AND_BRANCH (!=, opfunc_not_equal_value);
+          break;
+        }
+        VM_OC_CASE (VM_OC_STRICT_EQUAL_BRANCH):
+        {
+          VM_COMPARE_AND_BRANCH (==, opfunc_equal_value_type);
+          break;
+        }
+        VM_OC_CASE (VM_OC_STRICT_NOT_EQUAL_BRANCH):
+        {
+          VM_COMPARE_AND_BRANCH (!=, opfunc_not_equal_value_type);
+          break;
+        }
+        VM_OC_CASE (VM_OC_LESS_BRANCH):
+        {
+          VM_COMPARE_AND_BRANCH (<, opfunc_less_than);
+          break;
+        }
+        VM_OC_CASE (VM_OC_GREATER_BRANCH):
+        {
+          VM_COMPARE_AND_BRANCH (>, opfunc_greater_than);
+          break;
+        }
+        VM_OC_CASE (VM_OC_LESS_EQUAL_BRANCH):
+        {
+          VM_COMPARE_AND_BRANCH (<=, opfunc_less_or_equal_than);
+          break;
+        }
+        VM_OC_CASE (VM_OC_GREATER_EQUAL_BRANCH):
+        {
+          VM_COMPARE_AND_BRANCH (>=, opfunc_greater_or_equal_than);
+          break;
+        }
+        VM_OC_CASE (VM_OC_PLUS):
         {
           last_completion_value = opfunc_unary_plus (left_value);
 
@@ -1499,7 +2260,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_MINUS:
+        VM_OC_CASE (VM_OC_MINUS):
         {
           last_completion_value = opfunc_unary_minus (left_value);
 
@@ -1511,7 +2272,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_NOT:
+        VM_OC_CASE (VM_OC_NOT):
         {
           last_completion_value = opfunc_logical_not (left_value);
 
@@ -1523,8 +2284,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_BIT_NOT:
+        VM_OC_CASE (VM_OC_BIT_NOT):
         {
+          if (ecma_is_value_integer_number (left_value))
+          {
+            result = ecma_make_integer_value (~ecma_get_integer_from_value (left_value));
+            break;
+          }
+
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_NOT,
                                                            left_value,
                                                            left_value);
@@ -1537,7 +2304,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_TYPEOF_IDENT:
+        VM_OC_CASE (VM_OC_TYPEOF_IDENT):
         {
           uint16_t literal_index;
 
@@ -1581,7 +2348,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_TYPEOF:
+        VM_OC_CASE (VM_OC_TYPEOF):
         {
           last_completion_value = opfunc_typeof (left_value);
 
@@ -1593,8 +2360,18 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_ADD:
+        VM_OC_CASE (VM_OC_ADD):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+            /* The sum cannot overflow int32_t, but it may leave the small integer range. */
+            result = ecma_make_int32_value ((int32_t) (left_integer + right_integer));
+            break;
+          }
+
           last_completion_value = opfunc_addition (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1605,8 +2382,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_SUB:
+        VM_OC_CASE (VM_OC_SUB):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+            result = ecma_make_int32_value ((int32_t) (left_integer - right_integer));
+            break;
+          }
+
           last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_SUBSTRACTION,
                                                         left_value,
                                                         right_value);
@@ -1619,8 +2405,23 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_MUL:
+        VM_OC_CASE (VM_OC_MUL):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+            int64_t product = (int64_t) left_integer * (int64_t) right_integer;
+
+            /* Zero product of a negative operand is negative zero, which is not a small integer. */
+            if (ECMA_IS_INTEGER_NUMBER (product)
+                && (product != 0 || (left_integer | right_integer) >= 0))
+            {
+              result = ecma_make_integer_value ((ecma_integer_value_t) product);
+              break;
+            }
+          }
+
           last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_MULTIPLICATION,
                                                         left_value,
                                                         right_value);
@@ -1633,7 +2434,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_DIV:
+        VM_OC_CASE (VM_OC_DIV):
         {
           last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_DIVISION,
                                                         left_value,
@@ -1647,8 +2448,23 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_MOD:
+        VM_OC_CASE (VM_OC_MOD):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+            /* The sign of the result equals to the sign of the dividend,
+             * so a zero remainder of a negative dividend is negative zero. */
+            if (right_integer != 0
+                && (left_integer >= 0 || left_integer % right_integer != 0))
+            {
+              result = ecma_make_integer_value (left_integer % right_integer);
+              break;
+            }
+          }
+
           last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_REMAINDER,
                                                         left_value,
                                                         right_value);
@@ -1661,8 +2477,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_EQUAL:
+        VM_OC_CASE (VM_OC_EQUAL):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_equal = (left_value == right_value);
+            result = ecma_make_simple_value (is_equal ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_equal_value (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1673,8 +2496,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_NOT_EQUAL:
+        VM_OC_CASE (VM_OC_NOT_EQUAL):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_equal = (left_value != right_value);
+            result = ecma_make_simple_value (is_equal ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_not_equal_value (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1685,8 +2515,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_STRICT_EQUAL:
+        VM_OC_CASE (VM_OC_STRICT_EQUAL):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_equal = (left_value == right_value);
+            result = ecma_make_simple_value (is_equal ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_equal_value_type (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1697,8 +2534,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_STRICT_NOT_EQUAL:
+        VM_OC_CASE (VM_OC_STRICT_NOT_EQUAL):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_equal = (left_value != right_value);
+            result = ecma_make_simple_value (is_equal ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_not_equal_value_type (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1709,8 +2553,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_BIT_OR:
+        VM_OC_CASE (VM_OC_BIT_OR):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            /* The result of bitwise operations on small integers is a small integer. */
+            result = ecma_make_integer_value (ecma_get_integer_from_value (left_value)
+                                              | ecma_get_integer_from_value (right_value));
+            break;
+          }
+
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_OR,
                                                            left_value,
                                                            right_value);
@@ -1723,8 +2575,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_BIT_XOR:
+        VM_OC_CASE (VM_OC_BIT_XOR):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            /* The result of bitwise operations on small integers is a small integer. */
+            result = ecma_make_integer_value (ecma_get_integer_from_value (left_value)
+                                              ^ ecma_get_integer_from_value (right_value));
+            break;
+          }
+
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_XOR,
                                                            left_value,
                                                            right_value);
@@ -1737,8 +2597,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_BIT_AND:
+        VM_OC_CASE (VM_OC_BIT_AND):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            /* The result of bitwise operations on small integers is a small integer. */
+            result = ecma_make_integer_value (ecma_get_integer_from_value (left_value)
+                                              & ecma_get_integer_from_value (right_value));
+            break;
+          }
+
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_AND,
                                                            left_value,
                                                            right_value);
@@ -1751,8 +2619,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_LEFT_SHIFT:
+        VM_OC_CASE (VM_OC_LEFT_SHIFT):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            uint32_t left_uint32 = (uint32_t) ecma_get_integer_from_value (left_value);
+            uint32_t right_uint32 = (uint32_t) ecma_get_integer_from_value (right_value);
+
+            result = ecma_make_int32_value ((int32_t) (left_uint32 << (right_uint32 & 0x1f)));
+            break;
+          }
+
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_LEFT,
                                                            left_value,
                                                            right_value);
@@ -1765,8 +2642,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_RIGHT_SHIFT:
+        VM_OC_CASE (VM_OC_RIGHT_SHIFT):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            uint32_t right_uint32 = (uint32_t) ecma_get_integer_from_value (right_value);
+
+            result = ecma_make_integer_value (left_integer >> (right_uint32 & 0x1f));
+            break;
+          }
+
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_RIGHT,
                                                            left_value,
                                                            right_value);
@@ -1779,8 +2665,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_UNS_RIGHT_SHIFT:
+        VM_OC_CASE (VM_OC_UNS_RIGHT_SHIFT):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            uint32_t left_uint32 = (uint32_t) ecma_get_integer_from_value (left_value);
+            uint32_t right_uint32 = (uint32_t) ecma_get_integer_from_value (right_value);
+
+            result = ecma_make_uint32_value (left_uint32 >> (right_uint32 & 0x1f));
+            break;
+          }
+
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_URIGHT,
                                                            left_value,
                                                            right_value);
@@ -1793,8 +2688,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_LESS:
+        VM_OC_CASE (VM_OC_LESS):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_true = (ecma_get_integer_from_value (left_value) < ecma_get_integer_from_value (right_value));
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_less_than (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1805,8 +2707,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_GREATER:
+        VM_OC_CASE (VM_OC_GREATER):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_true = (ecma_get_integer_from_value (left_value) > ecma_get_integer_from_value (right_value));
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_greater_than (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1817,8 +2726,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_LESS_EQUAL:
+        VM_OC_CASE (VM_OC_LESS_EQUAL):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_true = (ecma_get_integer_from_value (left_value) <= ecma_get_integer_from_value (right_value));
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_less_or_equal_than (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1829,8 +2745,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_GREATER_EQUAL:
+        VM_OC_CASE (VM_OC_GREATER_EQUAL):
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_true = (ecma_get_integer_from_value (left_value) >= ecma_get_integer_from_value (right_value));
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
           last_completion_value = opfunc_greater_or_equal_than (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1841,7 +2764,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_IN:
+        VM_OC_CASE (VM_OC_IN):
         {
           last_completion_value = opfunc_in (left_value, right_value);
 
@@ -1853,7 +2776,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_INSTANCEOF:
+        VM_OC_CASE (VM_OC_INSTANCEOF):
         {
           last_completion_value = opfunc_instanceof (left_value, right_value);
 
@@ -1865,7 +2788,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_WITH:
+        VM_OC_CASE (VM_OC_WITH):
         {
           ecma_object_t *object_p;
           ecma_object_t *with_env_p;
@@ -1898,7 +2821,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = with_env_p;
           break;
         }
-        case VM_OC_FOR_IN_CREATE_CONTEXT:
+        VM_OC_CASE (VM_OC_FOR_IN_CREATE_CONTEXT):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -1922,7 +2845,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_dealloc_collection_header (header_p);
           break;
         }
-        case VM_OC_FOR_IN_GET_NEXT:
+        VM_OC_CASE (VM_OC_FOR_IN_GET_NEXT):
         {
           ecma_value_t *context_top_p = frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth;
           ecma_collection_chunk_t *chunk_p = MEM_CP_GET_NON_NULL_POINTER (ecma_collection_chunk_t, context_top_p[-2]);
@@ -1936,7 +2859,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_dealloc_collection_chunk (chunk_p);
           break;
         }
-        case VM_OC_FOR_IN_HAS_NEXT:
+        VM_OC_CASE (VM_OC_FOR_IN_HAS_NEXT):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -1972,7 +2895,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           break;
         }
-        case VM_OC_TRY:
+        VM_OC_CASE (VM_OC_TRY):
         {
           /* Try opcode simply creates the try context. */
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
@@ -1985,7 +2908,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-1] = (ecma_value_t) VM_CREATE_CONTEXT (VM_CONTEXT_TRY, branch_offset);
           break;
         }
-        case VM_OC_CATCH:
+        VM_OC_CASE (VM_OC_CATCH):
         {
           /* Catches are ignored and turned to jumps. */
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
@@ -1994,7 +2917,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           byte_code_p = byte_code_start_p + branch_offset;
           break;
         }
-        case VM_OC_FINALLY:
+        VM_OC_CASE (VM_OC_FINALLY):
         {
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
 
@@ -2013,7 +2936,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-2] = (ecma_value_t) branch_offset;
           break;
         }
-        case VM_OC_CONTEXT_END:
+        VM_OC_CASE (VM_OC_CONTEXT_END):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -2069,7 +2992,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
           break;
         }
-        case VM_OC_JUMP_AND_EXIT_CONTEXT:
+        VM_OC_CASE (VM_OC_JUMP_AND_EXIT_CONTEXT):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -2120,24 +3043,39 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           else
           {
-            ecma_string_t *var_name_str_p;
-            ecma_object_t *ref_base_lex_env_p;
+            ecma_object_t *binding_lex_env_p;
+            ecma_property_t *binding_p = vm_scope_cache_lookup (frame_ctx_p, literal_index, &binding_lex_env_p);
 
-            var_name_str_p = ecma_new_ecma_string_from_lit_cp (literal_start_p[literal_index]);
-            ref_base_lex_env_p = ecma_op_resolve_reference_base (frame_ctx_p->lex_env_p,
-                                                                 var_name_str_p);
+            if (binding_p != NULL)
+            {
+              ecma_named_data_property_assign_value (binding_lex_env_p, binding_p, result);
+            }
+            else
+            {
+              ecma_string_t *var_name_str_p;
+              ecma_object_t *ref_base_lex_env_p;
 
-            last_completion_value = ecma_op_put_value_lex_env_base (ref_base_lex_env_p,
-                                                                    var_name_str_p,
-                                                                    is_strict,
-                                                                    result);
+              var_name_str_p = ecma_new_ecma_string_from_lit_cp (literal_start_p[literal_index]);
+              ref_base_lex_env_p = ecma_op_resolve_reference_base (frame_ctx_p->lex_env_p,
+                                                                   var_name_str_p);
 
-            ecma_deref_ecma_string (var_name_str_p);
+              last_completion_value = ecma_op_put_value_lex_env_base (ref_base_lex_env_p,
+                                                                      var_name_str_p,
+                                                                      is_strict,
+                                                                      result);
 
-            if (ecma_is_value_error (last_completion_value))
-            {
-              ecma_free_value (result);
-              goto error;
+              if (ref_base_lex_env_p != NULL && !ecma_is_value_error (last_completion_value))
+              {
+                vm_scope_cache_insert (frame_ctx_p, literal_index, ref_base_lex_env_p, var_name_str_p);
+              }
+
+              ecma_deref_ecma_string (var_name_str_p);
+
+              if (ecma_is_value_error (last_completion_value))
+              {
+                ecma_free_value (result);
+                goto error;
+              }
             }
 
             if (!(opcode_data & (VM_OC_PUT_STACK | VM_OC_PUT_BLOCK)))
@@ -2164,10 +3102,22 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           else
           {
-            last_completion_value = vm_op_set_value (object,
-                                                     property,
-                                                     result,
-                                                     is_strict);
+            if (opcode_data & VM_OC_INLINE_CACHE)
+            {
+              last_completion_value = vm_op_set_value_cached (bytecode_header_p,
+                                                              inline_cache_index,
+                                                              object,
+                                                              property,
+                                                              result,
+                                                              is_strict);
+            }
+            else
+            {
+              last_completion_value = vm_op_set_value (object,
+                                                       property,
+                                                       result,
+                                                       is_strict);
+            }
 
             ecma_free_value (object);
             ecma_free_value (property);
@@ -2340,6 +3290,11 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
   vm_frame_ctx_t *prev_context_p;
   uint16_t argument_end;
   uint16_t register_end;
+#ifdef JERRY_VM_PROFILE
+  vm_stats_profile_frame_t profile_frame;
+
+  vm_stats_profile_enter_function (bytecode_header_p, &profile_frame);
+#endif /* JERRY_VM_PROFILE */
 
   if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
   {
@@ -2390,12 +3345,26 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
       arg_list_len = argument_end;
     }
 
-    for (uint32_t i = 0; i < arg_list_len; i++)
+    if (JERRY_CONTEXT (is_arguments_list_moved))
+    {
+      /* The caller frees the (now undefined) stack entries after the call. */
+      for (uint32_t i = 0; i < arg_list_len; i++)
+      {
+        frame_ctx_p->registers_p[i] = src_p[i];
+        src_p[i] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+      }
+    }
+    else
     {
-      frame_ctx_p->registers_p[i] = ecma_copy_value (src_p[i]);
+      for (uint32_t i = 0; i < arg_list_len; i++)
+      {
+        frame_ctx_p->registers_p[i] = ecma_copy_value (src_p[i]);
+      }
     }
   }
 
+  JERRY_CONTEXT (is_arguments_list_moved) = false;
+
   /* The arg_list_len contains the end of the copied arguments.
    * Fill everything else with undefined. */
   if (register_end > arg_list_len)
@@ -2408,10 +3377,10 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
     }
   }
 
-  is_direct_eval_form_call = false;
+  JERRY_CONTEXT (is_direct_eval_form_call) = false;
 
-  prev_context_p = vm_top_context_p;
-  vm_top_context_p = frame_ctx_p;
+  prev_context_p = JERRY_CONTEXT (vm_top_context_p);
+  JERRY_CONTEXT (vm_top_context_p) = frame_ctx_p;
 
   completion_value = vm_init_loop (frame_ctx_p);
 
@@ -2444,7 +3413,12 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
     ecma_free_value (frame_ctx_p->registers_p[i]);
   }
 
-  vm_top_context_p = prev_context_p;
+  JERRY_CONTEXT (vm_top_context_p) = prev_context_p;
+
+#ifdef JERRY_VM_PROFILE
+  vm_stats_profile_leave_function (&profile_frame);
+#endif /* JERRY_VM_PROFILE */
+
   return completion_value;
 } /* vm_execute */
 
@@ -2533,6 +3507,9 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
   frame_ctx.context_depth = 0;
   frame_ctx.is_eval_code = is_eval_code;
   frame_ctx.call_operation = VM_NO_EXEC_OP;
+#ifdef MEM_STATS
+  frame_ctx.current_instruction_p = (uint8_t *) literal_p;
+#endif /* MEM_STATS */
 
   arg_list_len++;
 
@@ -2560,9 +3537,9 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
 bool
 vm_is_strict_mode (void)
 {
-  JERRY_ASSERT (vm_top_context_p != NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_top_context_p) != NULL);
 
-  return vm_top_context_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE;
+  return JERRY_CONTEXT (vm_top_context_p)->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE;
 } /* vm_is_strict_mode */
 
 /**
@@ -2580,7 +3557,7 @@ vm_is_strict_mode (void)
 bool
 vm_is_direct_eval_form_call (void)
 {
-  return is_direct_eval_form_call;
+  return JERRY_CONTEXT (is_direct_eval_form_call);
 } /* vm_is_direct_eval_form_call */
 
 /**
@@ -120,6 +120,15 @@ typedef enum
   VM_OC_BRANCH_IF_LOGICAL_TRUE,  /**< branch if logical true */
   VM_OC_BRANCH_IF_LOGICAL_FALSE, /**< branch if logical false */
 
+  VM_OC_EQUAL_BRANCH,            /**< branch if equal */
+  VM_OC_NOT_EQUAL_BRANCH,        /**< branch if not equal */
+  VM_OC_STRICT_EQUAL_BRANCH,     /**< branch if strict equal */
+  VM_OC_STRICT_NOT_EQUAL_BRANCH, /**< branch if strict not equal */
+  VM_OC_LESS_BRANCH,             /**< branch if less */
+  VM_OC_GREATER_BRANCH,          /**< branch if greater */
+  VM_OC_LESS_EQUAL_BRANCH,       /**< branch if less equal */
+  VM_OC_GREATER_EQUAL_BRANCH,    /**< branch if greater equal */
+
   VM_OC_PLUS,                    /**< unary plus */
   VM_OC_MINUS,                   /**< unary minus */
   VM_OC_NOT,                     /**< not */
@@ -179,6 +188,11 @@ typedef enum
   VM_OC_PUT_BLOCK = VM_OC_PUT_DATA_CREATE_FLAG (0x8),
 } vm_oc_put_types;
 
+/**
+ * The opcode is followed by an inline cache index (see CBC_HAS_INLINE_CACHE_ARG).
+ */
+#define VM_OC_INLINE_CACHE (1u << 16)
+
 /**
  * Non-recursive vm_loop: the vm_loop can be suspended
  * to execute a call /construct operation. These return
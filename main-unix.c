@@ -112,6 +112,20 @@ read_sources (const char *script_file_names[],
   }
 } /* read_sources */
 
+/**
+ * Write a part of the heap dump to a file
+ *
+ * @return true - if the data is written,
+ *         false - otherwise
+ */
+static bool
+heap_dump_writer (const jerry_api_char_t *buffer_p, /**< data */
+                  jerry_api_size_t size, /**< size of the data */
+                  void *user_data_p) /**< file */
+{
+  return fwrite (buffer_p, 1, size, (FILE *) user_data_p) == size;
+} /* heap_dump_writer */
+
 static bool
 read_snapshot (const char *snapshot_file_name_p,
                size_t *out_snapshot_size_p)
@@ -210,12 +224,15 @@ print_help (char *name)
           "  --mem-stats-separate\n"
           "  --parse-only\n"
           "  --show-opcodes\n"
+          "  --vm-sequence-stats\n"
+          "  --profile-opcodes FILE\n"
           "  --save-snapshot-for-global FILE\n"
           "  --save-snapshot-for-eval FILE\n"
           "  --exec-snapshot FILE\n"
           "  --log-level [0-3]\n"
           "  --log-file FILE\n"
           "  --abort-on-fail\n"
+          "  --heap-dump FILE\n"
           "\n",
           name);
 } /* print_help */
@@ -253,6 +270,8 @@ main (int argc,
 
   bool is_repl_mode = false;
 
+  const char *heap_dump_file_name_p = NULL;
+
 #ifdef JERRY_ENABLE_LOG
   const char *log_file_name = NULL;
 #endif /* JERRY_ENABLE_LOG */
@@ -287,6 +306,24 @@ main (int argc,
     {
       flags |= JERRY_FLAG_SHOW_OPCODES;
     }
+    else if (!strcmp ("--vm-sequence-stats", argv[i]))
+    {
+      flags |= JERRY_FLAG_VM_SEQUENCE_STATS;
+    }
+    else if (!strcmp ("--profile-opcodes", argv[i]))
+    {
+      if (++i >= argc)
+      {
+        jerry_port_errormsg ("Error: no file specified for %s\n", argv[i - 1]);
+        print_usage (argv[0]);
+        return JERRY_STANDALONE_EXIT_CODE_FAIL;
+      }
+
+      flags |= JERRY_FLAG_VM_PROFILE;
+#ifdef JERRY_VM_PROFILE
+      jerry_vm_profile_file_name = argv[i];
+#endif /* JERRY_VM_PROFILE */
+    }
     else if (!strcmp ("--save-snapshot-for-global", argv[i])
              || !strcmp ("--save-snapshot-for-eval", argv[i]))
     {
@@ -361,6 +398,17 @@ main (int argc,
     {
       jerry_port_default_set_abort_on_fail (true);
     }
+    else if (!strcmp ("--heap-dump", argv[i]))
+    {
+      if (++i >= argc)
+      {
+        jerry_port_errormsg ("Error: no file specified for %s\n", argv[i - 1]);
+        print_usage (argv[0]);
+        return JERRY_STANDALONE_EXIT_CODE_FAIL;
+      }
+
+      heap_dump_file_name_p = argv[i];
+    }
     else if (!strncmp ("-", argv[i], 1))
     {
       jerry_port_errormsg ("Error: unrecognized option: %s\n", argv[i]);
@@ -578,6 +626,22 @@ main (int argc,
     jerry_api_release_value (&print_function);
   }
 
+  if (heap_dump_file_name_p != NULL)
+  {
+    FILE *heap_dump_file_p = fopen (heap_dump_file_name_p, "w");
+
+    if (heap_dump_file_p == NULL
+        || !jerry_api_heap_dump (heap_dump_writer, heap_dump_file_p))
+    {
+      jerry_port_errormsg ("Failed to write the heap dump: %s\n", heap_dump_file_name_p);
+    }
+
+    if (heap_dump_file_p != NULL)
+    {
+      fclose (heap_dump_file_p);
+    }
+  }
+
 #ifdef JERRY_ENABLE_LOG
   if (jerry_log_file && jerry_log_file != stdout)
   {
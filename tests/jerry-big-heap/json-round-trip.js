@@ -0,0 +1,46 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The data of this test needs a heap of several megabytes
+// (see the test-js-big-heap make target).
+
+var count = 8000;
+var padding = "0123456789abcdef";
+
+for (var i = 0; i < 4; i++)
+{
+  padding += padding;
+}
+
+var records = [];
+
+for (var i = 0; i < count; i++)
+{
+  records.push ({ id: i, name: "record" + i, data: padding + i });
+}
+
+var json = JSON.stringify (records);
+assert (json.length > 2 * 1024 * 1024);
+
+var parsed = JSON.parse (json);
+assert (parsed.length === count);
+
+for (var i = 0; i < count; i += 7)
+{
+  assert (parsed[i].id === i);
+  assert (parsed[i].name === "record" + i);
+  assert (parsed[i].data === padding + i);
+}
+
+assert (JSON.stringify (parsed) === json);
@@ -0,0 +1,52 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// More than 65536 objects share the same shape. These tests need a heap
+// larger than 512 KB (see the test-js-big-heap make target).
+
+var records = [];
+
+for (var i = 0; i < 66000; i++)
+{
+  records.push ({ x: i, y: -i });
+}
+
+/* Objects with other shapes are created and freed by the garbage collector. */
+for (var i = 0; i < 20000; i++)
+{
+  var garbage = { p: i, q: i, r: i };
+}
+
+for (var i = 0; i < records.length; i++)
+{
+  assert (records[i].x === i);
+  assert (records[i].y === -i);
+}
+
+/* Release most of the objects, so the reference counter of the shape decreases below 65536. */
+records.length = 1000;
+
+for (var i = 0; i < 20000; i++)
+{
+  var garbage = { p: i, q: i, r: i };
+}
+
+for (var i = 0; i < records.length; i++)
+{
+  assert (records[i].x === i);
+  assert (records[i].y === -i);
+}
+
+var record = { x: 1, y: 2 };
+assert (record.x === 1 && record.y === 2);
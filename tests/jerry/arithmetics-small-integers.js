@@ -0,0 +1,78 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function isNegativeZero (x)
+{
+  return x === 0 && (1 / x) === -Infinity;
+}
+
+var max = 134217727;
+var min = -134217728;
+
+// Leaving the small integer range
+assert (max + 1 === 134217728);
+assert (min - 1 === -134217729);
+assert (max * 2 === 268435454);
+assert (min * min === 18014398509481984);
+assert (max * -3 === -402653181);
+assert ((max + 1) - 1 === max);
+
+var a = max;
+a++;
+assert (a === 134217728);
+a--;
+assert (a === max);
+var b = min;
+--b;
+assert (b === -134217729);
+++b;
+assert (b === min);
+
+// Negative zero is never a small integer
+assert (isNegativeZero (-5 * 0));
+assert (isNegativeZero (0 * -5));
+assert (!isNegativeZero (0 * 5));
+assert (isNegativeZero (-6 % 3));
+assert (!isNegativeZero (6 % -3));
+assert (-7 % 3 === -1);
+assert (7 % -3 === 1);
+assert (isNaN (7 % 0));
+assert (isNegativeZero (-(0)));
+
+var c = 1;
+c -= 1;
+assert (!isNegativeZero (c));
+
+// Comparison
+assert (min < max);
+assert (!(max < min));
+assert (-1 <= -1);
+assert (-2 >= -3);
+assert (max > max - 1);
+assert (3 == 3);
+assert (3 !== -3);
+assert (0 === -0);
+
+// Bitwise operations
+assert ((min | 0) === min);
+assert ((-1 & max) === max);
+assert ((-1 ^ max) === min);
+assert (~min === max);
+assert (~0 === -1);
+assert ((1 << 31) === -2147483648);
+assert ((max << 4) === 2147483632);
+assert ((-1 >> 40) === -1);
+assert ((-1 >>> 0) === 4294967295);
+assert ((min >>> 1) === 2080374784);
+assert ((8 >>> 33) === 4);
@@ -0,0 +1,170 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function keys (o)
+{
+  var result = [];
+  for (var name in o)
+  {
+    result.push (name);
+  }
+  return result.join (",");
+}
+
+// Growing and shrinking.
+var a = [];
+for (var i = 0; i < 100; i++)
+{
+  a.push (i * 2);
+}
+assert (a.length === 100);
+for (var i = 0; i < 100; i++)
+{
+  assert (a[i] === i * 2);
+  a[i] = i;
+}
+assert (a.indexOf (50) === 50);
+assert (a.indexOf (50, 51) === -1);
+assert (a.slice (10, 13).join () === "10,11,12");
+for (var i = 99; i >= 0; i--)
+{
+  assert (a.pop () === i);
+}
+assert (a.length === 0);
+assert (a.pop () === undefined);
+
+// Holes.
+var b = [1, , 3];
+assert (b.length === 3);
+assert (!(1 in b));
+assert (keys (b) === "0,2");
+b[1] = 2;
+assert (keys (b) === "0,1,2");
+delete b[0];
+assert (b[0] === undefined && !b.hasOwnProperty ("0"));
+assert (keys (b) === "1,2");
+delete b[2];
+assert (b.length === 3);
+assert (keys (b) === "1");
+
+// Holes are looked up in the prototype chain.
+Array.prototype[1] = "proto";
+var c = [0, , 2];
+assert (c[1] === "proto");
+assert (c.indexOf ("proto") === 1);
+c.forEach (function (value, index) { assert (index !== 1 || value === "proto"); });
+delete Array.prototype[1];
+assert (c[1] === undefined);
+
+// Appending an element which is defined by a prototype.
+Object.defineProperty (Array.prototype, "2", { set: function (v) { this.setterValue = v; }, configurable: true });
+var d = [0, 1];
+d.push (2);
+assert (d.setterValue === 2);
+assert (!d.hasOwnProperty ("2"));
+delete Array.prototype[2];
+
+// Sparse arrays.
+var e = [];
+e[0] = 0;
+e[1000] = 1000;
+assert (e.length === 1001);
+assert (e[500] === undefined);
+assert (keys (e) === "0,1000");
+e[500] = 500;
+assert (e[500] === 500);
+
+var f = [];
+for (var i = 0; i < 200; i++)
+{
+  f[i] = i;
+}
+for (var i = 0; i < 200; i += 2)
+{
+  delete f[i];
+}
+for (var i = 0; i < 200; i++)
+{
+  assert (f[i] === (i % 2 ? i : undefined));
+}
+assert (f.length === 200);
+
+// Length truncation.
+var g = [1, 2, 3, 4, 5];
+g.length = 2;
+assert (g.join () === "1,2");
+assert (g[3] === undefined);
+g.length = 4;
+assert (g.length === 4 && !(2 in g));
+g.push (6);
+assert (g.join () === "1,2,,,6");
+
+// Non-writable elements and accessors.
+var h = [1, 2, 3];
+Object.defineProperty (h, "1", { writable: false });
+h[1] = 5;
+assert (h[1] === 2);
+assert (h.join () === "1,2,3");
+
+var k = [1, 2, 3];
+Object.defineProperty (k, "0", { get: function () { return 10; } });
+assert (k[0] === 10);
+assert (k.indexOf (10) === 0);
+assert (keys (k) === "0,1,2");
+
+// Frozen arrays.
+var m = [1, 2];
+Object.freeze (m);
+m[0] = 3;
+assert (m[0] === 1);
+assert (Object.isFrozen (m));
+try
+{
+  m.push (3);
+  assert (false);
+}
+catch (ex)
+{
+  assert (ex instanceof TypeError);
+}
+assert (m.length === 2);
+
+// Non-writable length.
+var n = [1, 2, 3];
+Object.defineProperty (n, "length", { writable: false });
+try
+{
+  n.pop ();
+  assert (false);
+}
+catch (ex)
+{
+  assert (ex instanceof TypeError);
+}
+
+// Elements referencing objects survive garbage collections.
+var p = [];
+for (var i = 0; i < 100; i++)
+{
+  p.push ({ value: i });
+}
+p.length = 50;
+for (var i = 0; i < 50; i++)
+{
+  p[i + 50] = { value: i + 50 };
+}
+for (var i = 0; i < 100; i++)
+{
+  assert (p[i].value === i);
+}
@@ -0,0 +1,153 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// All operators with register, literal and stack operands.
+function operators (a, b)
+{
+  var o = { a: a, b: b };
+  var r = [];
+  var x;
+
+  x = a | b; r.push (x);
+  x = a ^ b; r.push (x);
+  x = a & b; r.push (x);
+  x = a << b; r.push (x);
+  x = a >> b; r.push (x);
+  x = a >>> b; r.push (x);
+  x = a + b; r.push (x);
+  x = a - b; r.push (x);
+  x = a * b; r.push (x);
+  x = a / b; r.push (x);
+  x = a % b; r.push (x);
+
+  x = o.a | 3; r.push (x);
+  x = o.a - 3; r.push (x);
+  x = o.a * o.b; r.push (x);
+  x = o.a + b; r.push (x);
+  x = -a >>> 28; r.push (x);
+
+  return r.join ();
+}
+
+assert (operators (13, 2) === "15,15,0,52,3,3,15,11,26,6.5,1,15,10,26,15,15");
+assert (operators (-7, 3) === "-5,-6,1,-56,-1,536870911,-4,-10,-21,-2.3333333333333335,-1,-5,-10,-21,-4,0");
+
+// Global code keeps the value of the last assignment as the completion value.
+var g1 = 5, g2 = 8, g3;
+g3 = g1 * g2;
+assert (g3 === 40);
+assert (eval ("g3 = g1 - g2") === -3);
+assert (eval ("var v; v = g1 + 'x'") === "5x");
+assert (g3 === -3);
+
+// The result of the assignment is used.
+function results (a, b)
+{
+  var x, y;
+  y = x = a + b;
+  var z = (x = a * b) + 1;
+  var w = (x = a - b, x * 2);
+  return [x, y, z, w, (x = a / b)].join ();
+}
+
+assert (results (6, 3) === "3,9,19,6,2");
+
+// Identifiers which are not registers.
+function closure (a)
+{
+  var c;
+  function set (b)
+  {
+    c = a * b;
+  }
+  set (3);
+  return c;
+}
+
+assert (closure (7) === 21);
+
+var obj = { w: 1 };
+with (obj)
+{
+  w = g1 + g2;
+  nw = g1 * g2;
+}
+assert (obj.w === 13);
+assert (nw === 40 && !obj.hasOwnProperty ("nw"));
+
+function withEval (code)
+{
+  var x = 1;
+  eval (code);
+  x = x + 1;
+  return x;
+}
+
+assert (withEval ("") === 2);
+assert (withEval ("x = 10") === 11);
+
+// Exceptions thrown by the operation leave the identifier unchanged.
+var thrower = { valueOf: function () { throw "valueOf"; } };
+var t = "unchanged";
+try
+{
+  t = g1 + thrower;
+  assert (false);
+}
+catch (e)
+{
+  assert (e === "valueOf");
+}
+assert (t === "unchanged");
+
+function strictUndeclared ()
+{
+  "use strict";
+  undeclaredVariable = g1 * g2;
+}
+
+try
+{
+  strictUndeclared ();
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof ReferenceError);
+}
+
+// Conversion order of the operands.
+var calls = [];
+var left = { valueOf: function () { calls.push ("left"); return 6; } };
+var right = { valueOf: function () { calls.push ("right"); return 4; } };
+var res;
+res = left - right;
+assert (res === 2);
+assert (calls.join () === "left,right");
+
+// Loops with many assignments.
+function loop (n)
+{
+  var sum = 0, prod = 1, i, t;
+  for (i = 1; i <= n; i++)
+  {
+    t = i * i;
+    sum = sum + t;
+    prod = prod * 2 % 1000;
+  }
+  return sum + "," + prod;
+}
+
+assert (loop (10) === "385,24");
+assert (loop (100) === "338350,376");
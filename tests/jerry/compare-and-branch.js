@@ -0,0 +1,167 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Loop conditions with register, literal and stack operands.
+function countLoops (n)
+{
+  var o = { n: n };
+  var counts = [];
+  var i, count;
+
+  for (i = 0, count = 0; i < n; i++) count++;
+  counts.push (count);
+  for (i = 0, count = 0; i < o.n; i++) count++;
+  counts.push (count);
+  for (i = 0, count = 0; o.n > i; i++) count++;
+  counts.push (count);
+  for (i = 0, count = 0; i <= 4; i++) count++;
+  counts.push (count);
+  for (i = n, count = 0; i >= 0; i--) count++;
+  counts.push (count);
+  for (i = 0, count = 0; i != n; i++) count++;
+  counts.push (count);
+  for (i = 0, count = 0; i !== o.n; i++) count++;
+  counts.push (count);
+
+  i = 0;
+  count = 0;
+  while (i < n) { i++; count++; }
+  counts.push (count);
+
+  i = 0;
+  count = 0;
+  do { i++; count++; } while (i <= n);
+  counts.push (count);
+
+  i = 0;
+  count = 0;
+  do { i++; count++; } while (i == 1);
+  counts.push (count);
+
+  i = 0;
+  count = 0;
+  do { i++; count++; } while (i === 1);
+  counts.push (count);
+
+  return counts.join ();
+}
+
+assert (countLoops (5) === "5,5,5,5,6,5,5,5,6,2,2");
+assert (countLoops (0) === "0,0,0,5,1,0,0,0,1,2,2");
+
+// Floating point numbers, NaN and negative zero.
+var count = 0;
+for (var x = 0.5; x < 3; x += 0.5) count++;
+assert (count === 5);
+
+count = 0;
+for (var x = 0; x < NaN; x++) count++;
+assert (count === 0);
+
+count = 0;
+for (var x = 0; x >= NaN; x++) count++;
+assert (count === 0);
+
+count = 0;
+var y = NaN;
+do { count++; } while (y === y);
+assert (count === 1);
+
+count = 0;
+do { count++; } while (y != y && count < 3);
+assert (count === 3);
+
+count = 0;
+var z = -0;
+do { count++; } while (z !== 0);
+assert (count === 1);
+
+count = 0;
+for (var x = 1.5; x > 1; x -= 0.25) count++;
+assert (count === 2);
+
+count = 0;
+for (var x = 0; x < 2147483648 + 3; x = (x === 0 ? 2147483648 : x + 1)) count++;
+assert (count === 4);
+
+// Strings, objects and abstract equality.
+var result = [];
+for (var s = "a"; s < "aaaa"; s += "a") result.push (s);
+assert (result.join () === "a,aa,aaa");
+
+count = 0;
+for (var s = "10"; s > 9; s = String (s - 1)) count++;
+assert (count === 1);
+
+count = 0;
+var u;
+do { count++; u = null; } while (u == undefined && count < 5);
+assert (count === 5);
+
+count = 0;
+do { count++; } while (u === undefined);
+assert (count === 1);
+
+var calls = [];
+var left = { valueOf: function () { calls.push ("left"); return 1; } };
+var right = { valueOf: function () { calls.push ("right"); return 2; } };
+count = 0;
+do { count++; } while (left < right && count < 2);
+assert (count === 2);
+assert (calls.join () === "left,right,left,right");
+
+calls = [];
+do { } while (left > right);
+assert (calls.join () === "left,right");
+
+calls = [];
+do { } while (left >= right);
+assert (calls.join () === "left,right");
+
+// Exceptions thrown by the comparison.
+var thrower = { valueOf: function () { throw "valueOf"; } };
+try
+{
+  for (var i = 0; i < thrower; i++) { }
+  assert (false);
+}
+catch (e)
+{
+  assert (e === "valueOf");
+}
+
+try
+{
+  var i = 0;
+  do { i++; } while (i != thrower);
+  assert (false);
+}
+catch (e)
+{
+  assert (e === "valueOf" && i === 1);
+}
+
+// Loop bodies which need longer branch offsets.
+function longLoop (bodyLength)
+{
+  var body = "";
+  for (var i = 0; i < bodyLength; i++)
+  {
+    body += "sum += i;";
+  }
+  return new Function ("n", "var sum = 0; for (var i = 0; i < n; i++) { " + body + " } return sum;");
+}
+
+assert (longLoop (100) (4) === 100 * 6);
+assert (longLoop (2000) (3) === 2000 * 3);
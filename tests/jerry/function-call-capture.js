@@ -0,0 +1,172 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Only the captured variables and arguments are stored in the lexical environment.
+function captureSome (a, b)
+{
+  var x = 1, y = 2, z;
+  function inner () { return x + a; }
+  function notCaptured () { return 5; }
+  z = inner () + notCaptured () + y + b;
+  x = 100;
+  return z + inner ();
+}
+
+assert (captureSome (10, 20) === 38 + 110);
+
+// The captured variable is declared after the closure.
+function declaredLater ()
+{
+  var f = function () { return q; };
+  var q = 7;
+  return f ();
+}
+
+assert (declaredLater () === 7);
+
+function functionDeclaredLater ()
+{
+  var f = function () { return g (); };
+  return f ();
+  function g () { return "g"; }
+}
+
+assert (functionDeclaredLater () === "g");
+
+// Variables captured by deeply nested functions.
+function nested ()
+{
+  var d = 3;
+  return function () { return function () { return function () { return d++; }; }; };
+}
+
+var counter = nested () () ();
+assert (counter () === 3);
+assert (counter () === 4);
+
+function nestedUnrelated ()
+{
+  var local = 1;
+  return function (local) { return function () { return local; }; };
+}
+
+assert (nestedUnrelated () (8) () === 8);
+
+// Direct eval in a nested function can access any variable.
+function nestedEval ()
+{
+  var e = 4;
+  return function () { return function (code) { return eval (code); }; };
+}
+
+assert (nestedEval () () ("e * 2") === 8);
+
+// Getters, setters and escaped identifiers.
+function accessors ()
+{
+  var value = 1;
+  var o = {
+    get v () { return value; },
+    set v (n) { value = n; }
+  };
+  o.v = 6;
+  return value + o.v;
+}
+
+assert (accessors () === 12);
+
+function escaped ()
+{
+  var abc = 9;
+  return function () { return \u0061bc; } ();
+}
+
+assert (escaped () === 9);
+
+// Catch variables and with statements.
+function catchCapture ()
+{
+  try
+  {
+    throw 11;
+  }
+  catch (e)
+  {
+    return function () { return e; };
+  }
+}
+
+assert (catchCapture () () === 11);
+
+function withCapture (o)
+{
+  var w = "local";
+  with (o)
+  {
+    return function () { return w; };
+  }
+}
+
+assert (withCapture ({ w: "object" }) () === "object");
+assert (withCapture ({}) () === "local");
+
+// Arguments are moved to the callee, the caller keeps its values.
+function sum (a, b, c)
+{
+  a += 0.5;
+  return a + b + (c === undefined ? 0 : c);
+}
+
+function caller ()
+{
+  var f = 1.25, s = "s", o = { v: 2 };
+  var r1 = sum (f, f);
+  var r2 = sum (f, 1, 2, 3, 4);
+  var r3 = sum (s, o.v);
+  return [r1, r2, r3, f, s, o.v].join ();
+}
+
+assert (caller () === "3,4.75,s0.520,1.25,s,2");
+
+function argumentsObject (a)
+{
+  a = 2;
+  return arguments[0] + arguments.length;
+}
+
+assert (argumentsObject (1.5, 2.5) === 4);
+assert (sum.call (null, 1, 2, 3) === 6.5);
+assert (sum.apply (null, [1, 2]) === 3.5);
+
+function fib (n)
+{
+  return n < 2 ? n : fib (n - 1) + fib (n - 2);
+}
+
+assert (fib (15) === 610);
+
+function thrower (v)
+{
+  throw v;
+}
+
+try
+{
+  thrower (1.5);
+  assert (false);
+}
+catch (e)
+{
+  assert (e === 1.5);
+}
@@ -0,0 +1,91 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Long reference chains and objects with many references, which
+// overflow the mark stack of the garbage collector, must survive
+// garbage collections.
+var head = { value: 0 };
+var last = head;
+
+for (var i = 1; i < 50; i++)
+{
+  last.next = (i % 3 == 0) ? { value: i } : [i];
+  last = last.next;
+}
+
+var wide = [];
+for (var i = 0; i < 260; i++)
+{
+  wide.push ({ value: i });
+}
+
+// Chains through closures, getters and lexical environments.
+function makeCounter (next)
+{
+  var count = 0;
+  return { get count () { return count + next.count; }, inc: function () { count++; } };
+}
+
+var counter = { count: 0 };
+for (var i = 0; i < 10; i++)
+{
+  counter = makeCounter (counter);
+  counter.inc ();
+}
+
+// Cycles.
+var ring = { id: 0 };
+var ring_last = ring;
+for (var i = 1; i < 50; i++)
+{
+  ring_last.next = { id: i, prev: ring_last };
+  ring_last = ring_last.next;
+}
+ring_last.next = ring;
+ring.prev = ring_last;
+
+// Produce garbage to trigger garbage collections.
+for (var i = 0; i < 5; i++)
+{
+  var garbage = [];
+  for (var j = 0; j < 10; j++)
+  {
+    garbage.push ({ a: j, b: [j] });
+  }
+}
+
+var sum = 0;
+for (var node = head; node !== undefined; node = node.next)
+{
+  sum += (node instanceof Array) ? node[0] : node.value;
+}
+assert (sum === 49 * 50 / 2);
+
+for (var i = 0; i < wide.length; i++)
+{
+  assert (wide[i].value === i);
+}
+
+assert (counter.count === 10);
+
+var count = 0;
+var node = ring;
+do
+{
+  assert (node.next.prev === node);
+  node = node.next;
+  count++;
+}
+while (node !== ring);
+assert (count === 50);
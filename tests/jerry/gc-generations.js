@@ -0,0 +1,97 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Young objects which are referenced only by old objects must survive
+// the collections of the young generation.
+var old = [];
+for (var i = 0; i < 20; i++)
+{
+  old.push ({ value: null });
+}
+
+function getter_value ()
+{
+  return this.base + 1;
+}
+
+for (var round = 0; round < 10; round++)
+{
+  for (var i = 0; i < old.length; i++)
+  {
+    var young = { value: round * 100 + i, chain: [{ value: i }] };
+
+    switch (i % 4)
+    {
+      case 0:
+      {
+        old[i].value = young;
+        break;
+      }
+      case 1:
+      {
+        old[i] = young;
+        break;
+      }
+      case 2:
+      {
+        Object.defineProperty (old[i], 'value', { get: getter_value.bind ({ base: young.value - 1 }),
+                                                  configurable: true });
+        break;
+      }
+      default:
+      {
+        old[i].value = (function (captured) { return function () { return captured; }; }) (young);
+        break;
+      }
+    }
+  }
+
+  // Produce garbage to trigger garbage collections.
+  for (var j = 0; j < 20; j++)
+  {
+    var garbage = { a: [j], b: { c: j } };
+  }
+}
+
+for (var i = 0; i < old.length; i++)
+{
+  var expected = 900 + i;
+
+  switch (i % 4)
+  {
+    case 0:
+    {
+      assert (old[i].value.value === expected);
+      assert (old[i].value.chain[0].value === i);
+      break;
+    }
+    case 1:
+    {
+      assert (old[i].value === expected);
+      assert (old[i].chain[0].value === i);
+      break;
+    }
+    case 2:
+    {
+      assert (old[i].value === expected);
+      break;
+    }
+    default:
+    {
+      assert (old[i].value ().value === expected);
+      assert (old[i].value ().chain[0].value === i);
+      break;
+    }
+  }
+}
@@ -0,0 +1,110 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function keys (o)
+{
+  var result = [];
+  for (var name in o)
+  {
+    result.push (name);
+  }
+  return result.join (",");
+}
+
+function getX (o)
+{
+  return o.x;
+}
+
+// Objects which share a shape.
+function Point (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+var points = [];
+for (var i = 0; i < 10; i++)
+{
+  points.push (new Point (i, -i));
+}
+
+for (var i = 0; i < 10; i++)
+{
+  assert (getX (points[i]) === i);
+  assert (points[i].y === -i);
+}
+
+// Objects with the same names in a different order.
+var a = { x: 1, y: 2 };
+var b = { y: 3, x: 4 };
+assert (getX (a) === 1);
+assert (getX (b) === 4);
+assert (keys (a) === "x,y");
+assert (keys (b) === "y,x");
+
+// More properties than slots.
+var big = {};
+var expected = [];
+for (var i = 0; i < 40; i++)
+{
+  big["p" + i] = i;
+  expected.push ("p" + i);
+}
+
+for (var i = 0; i < 40; i++)
+{
+  assert (big["p" + i] === i);
+}
+assert (keys (big) === expected.join (","));
+assert (Object.keys (big).length === 40);
+
+// Deleting and adding properties.
+var c = { p: 1, q: 2, r: 3 };
+delete c.q;
+assert (c.q === undefined);
+assert (!c.hasOwnProperty ("q"));
+assert (keys (c) === "p,r");
+c.q = 4;
+c.s = 5;
+assert (keys (c) === "p,r,q,s");
+assert (c.p === 1 && c.q === 4 && c.r === 3 && c.s === 5);
+
+// Enumeration and serialization order.
+var d = { z: 1, y: 2, x: 3 };
+d.w = 4;
+assert (JSON.stringify (d) === '{"z":1,"y":2,"x":3,"w":4}');
+assert (Object.getOwnPropertyNames (d).join (",") === "z,y,x,w");
+
+// Property attributes of slots.
+var e = { x: 1, y: 2 };
+Object.defineProperty (e, "x", { get: function () { return 3; } });
+assert (getX (e) === 3);
+Object.defineProperty (e, "y", { enumerable: false });
+assert (keys (e) === "x");
+Object.freeze (e);
+e.z = 4;
+assert (e.z === undefined);
+assert (Object.isFrozen (e));
+
+// Many different shapes.
+for (var i = 0; i < 200; i++)
+{
+  var f = {};
+  f["a" + i] = i;
+  f["b" + (i % 7)] = i;
+  f.x = i;
+  assert (getX (f) === i);
+  assert (f["a" + i] === i);
+}
@@ -0,0 +1,66 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Each failed parse releases the parser arena, so a long chain of syntax errors
+// does not exhaust the heap. The escaped string literals are decoded into buffers
+// larger than the biggest arena block, which are allocated from the heap.
+
+var escaped = "\\u0041";
+var expected = "A";
+
+for (var i = 0; i < 9; i++)
+{
+  escaped += escaped;
+  expected += expected;
+}
+
+function check_syntax_error (source)
+{
+  try
+  {
+    eval (source);
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+var nested = "";
+
+for (var i = 0; i < 20; i++)
+{
+  nested += "function f" + i + " (a, b) { var c = [a, b, '" + escaped + "']; ";
+}
+
+for (var i = 0; i < 400; i++)
+{
+  /* Errors after a large decoded literal, inside nested functions and inside an escape sequence. */
+  check_syntax_error ("var s = '" + escaped + "'; var = 5;");
+  check_syntax_error (nested + "return (a + b; }");
+  check_syntax_error ("var s = '" + escaped + "\\u00G1';");
+
+  assert (eval ("'" + escaped + "'") === expected);
+}
+
+var closing = "return c[2]; }";
+
+for (var i = 18; i >= 0; i--)
+{
+  closing += " return f" + (i + 1) + " (a, b); }";
+}
+
+eval (nested + closing);
+assert (f0 (1, 2) === expected);
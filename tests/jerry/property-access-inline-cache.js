@@ -0,0 +1,153 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function getX (o)
+{
+  return o.x;
+}
+
+function setX (o, v)
+{
+  o.x = v;
+}
+
+function getKey (o, k)
+{
+  return o[k];
+}
+
+function setKey (o, k, v)
+{
+  o[k] = v;
+}
+
+// Monomorphic and polymorphic sites.
+var a = { x: 1 };
+var b = { y: 0, x: 2 };
+var c = { z: 0, y: 0, x: 3 };
+
+for (var i = 0; i < 3; i++)
+{
+  assert (getX (a) === 1);
+  assert (getX (b) === 2);
+  assert (getX (c) === 3);
+}
+
+// Deleting a cached property.
+delete a.x;
+assert (getX (a) === undefined);
+a.x = 4;
+assert (getX (a) === 4);
+
+// Prototype properties are not cached, but must not be shadowed by stale entries.
+var proto = { x: 5 };
+var d = Object.create (proto);
+assert (getX (d) === 5);
+d.x = 6;
+assert (getX (d) === 6);
+delete d.x;
+assert (getX (d) === 5);
+
+// Changing the attributes of a cached property.
+var e = { x: 7 };
+setX (e, 8);
+assert (e.x === 8);
+Object.defineProperty (e, "x", { writable: false });
+setX (e, 9);
+assert (getX (e) === 8);
+
+// Converting a cached data property to an accessor property.
+var f = { x: 10 };
+assert (getX (f) === 10);
+Object.defineProperty (f, "x", { get: function () { return 11; }, set: function (v) { this.y = v; } });
+assert (getX (f) === 11);
+setX (f, 12);
+assert (f.y === 12);
+
+// Strict mode errors must still be reported.
+function setXStrict (o, v)
+{
+  "use strict";
+  o.x = v;
+}
+
+var g = { x: 13 };
+setXStrict (g, 14);
+assert (g.x === 14);
+Object.freeze (g);
+
+try
+{
+  setXStrict (g, 15);
+  assert (false);
+}
+catch (ex)
+{
+  assert (ex instanceof TypeError);
+}
+assert (g.x === 14);
+
+// Computed property names.
+var h = { p: 1, q: 2, 0: "zero" };
+assert (getKey (h, "p") === 1);
+assert (getKey (h, "q") === 2);
+assert (getKey (h, "p") === 1);
+assert (getKey (h, 0) === "zero");
+assert (getKey (h, "0") === "zero");
+assert (getKey (h, "r") === undefined);
+
+// Arrays and arguments objects.
+var arr = [1, 2, 3];
+assert (getKey (arr, "length") === 3);
+setX (arr, 16);
+arr.length = 1;
+assert (getKey (arr, "length") === 1);
+assert (getX (arr) === 16);
+
+function mapped (x)
+{
+  assert (getKey (arguments, "0") === 18);
+  setKey (arguments, "0", 17);
+  assert (getKey (arguments, "0") === 17);
+  return x;
+}
+assert (mapped (18) === 17);
+
+// Objects which are freed and reallocated.
+for (var i = 0; i < 100; i++)
+{
+  var tmp = { x: i };
+  assert (getX (tmp) === i);
+  setX (tmp, i + 1);
+  assert (tmp.x === i + 1);
+}
+
+// Assignments through this.
+function Point (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+Point.prototype.sum = function ()
+{
+  return this.x + this.y;
+};
+
+var sum = 0;
+for (var i = 0; i < 10; i++)
+{
+  sum += new Point (i, 1).sum ();
+}
+assert (sum === 55);
@@ -0,0 +1,194 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Closure variables updated in a loop.
+function counter ()
+{
+  var count = 0;
+  return function () { count++; return count; };
+}
+
+var c1 = counter ();
+var c2 = counter ();
+for (var i = 0; i < 100; i++)
+{
+  c1 ();
+}
+assert (c1 () === 101);
+assert (c2 () === 1);
+
+// Variables of several outer functions.
+function outer (a)
+{
+  var b = a * 2;
+  function middle (c)
+  {
+    var d = c + 1;
+    function inner ()
+    {
+      var sum = 0;
+      for (var j = 0; j < 10; j++)
+      {
+        sum += a + b + d;
+        b++;
+      }
+      return sum;
+    }
+    return inner;
+  }
+  return middle (a);
+}
+
+assert (outer (1) () === 10 * (1 + 2 + 2) + 45);
+assert (outer (2) () === 10 * (2 + 4 + 3) + 45);
+
+// Inner functions using the same names as the outer ones.
+function shadow ()
+{
+  var x = "outer";
+  function f ()
+  {
+    var x = "inner";
+    return x;
+  }
+  function g ()
+  {
+    return x;
+  }
+  var result = "";
+  for (var k = 0; k < 3; k++)
+  {
+    result += f () + g ();
+  }
+  return result;
+}
+
+assert (shadow () === "innerouterinnerouterinnerouter");
+
+// Catch blocks introduce bindings between the environments.
+function withCatch ()
+{
+  var e = "var";
+  var results = [];
+  function get ()
+  {
+    return e;
+  }
+  for (var k = 0; k < 3; k++)
+  {
+    results.push (get ());
+    try
+    {
+      throw "catch";
+    }
+    catch (e)
+    {
+      results.push (e);
+      results.push ((function () { return e; }) ());
+    }
+  }
+  return results.join ();
+}
+
+assert (withCatch () === "var,catch,catch,var,catch,catch,var,catch,catch");
+
+// Eval can add bindings to the environment of the function.
+var y = "global";
+function withEval (code)
+{
+  function get ()
+  {
+    return y;
+  }
+  var results = [get ()];
+  eval (code);
+  results.push (get ());
+  return results.join ();
+}
+
+assert (withEval ("") === "global,global");
+assert (withEval ("var y = 'local'") === "global,local");
+
+function evalInner ()
+{
+  var z = 1;
+  function f (code)
+  {
+    eval (code);
+    return z;
+  }
+  return f ("") + f ("var z = 2") + z;
+}
+
+assert (evalInner () === 4);
+
+// With statements can shadow outer variables.
+function withStatement (o)
+{
+  var v = "local";
+  var results = [];
+  for (var k = 0; k < 2; k++)
+  {
+    with (o)
+    {
+      results.push (v);
+      v = "assigned";
+    }
+  }
+  results.push (v);
+  return results.join ();
+}
+
+assert (withStatement ({}) === "local,assigned,assigned");
+var o = { v: "object" };
+assert (withStatement (o) === "object,assigned,local");
+assert (o.v === "assigned");
+
+// Functions with more variables than slots.
+function manyVars ()
+{
+  var v0 = 0, v1 = 1, v2 = 2, v3 = 3, v4 = 4, v5 = 5, v6 = 6, v7 = 7, v8 = 8, v9 = 9;
+  var v10 = 10, v11 = 11, v12 = 12, v13 = 13, v14 = 14, v15 = 15, v16 = 16, v17 = 17, v18 = 18, v19 = 19;
+  return function ()
+  {
+    var sum = 0;
+    for (var k = 0; k < 2; k++)
+    {
+      sum += v0 + v5 + v10 + v15 + v19;
+      v0++;
+      v19++;
+    }
+    return sum;
+  };
+}
+
+assert (manyVars () () === 2 * (0 + 5 + 10 + 15 + 19) + 2);
+
+// Named function expressions and arguments.
+var fact = function f (n)
+{
+  return n <= 1 ? 1 : n * f (n - 1);
+};
+assert (fact (5) === 120);
+
+function args (a)
+{
+  function get ()
+  {
+    return a;
+  }
+  arguments[0] = "changed";
+  return get ();
+}
+assert (args ("original") === "changed");
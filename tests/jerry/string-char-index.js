@@ -0,0 +1,64 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Characters of long non-ascii strings are found by a character index
+var pieces = ["a", "é", "€", "b", "😀"];
+var codes = [];
+var str = "";
+
+for (var i = 0; i < 200; i++) {
+  var piece = pieces[i % pieces.length];
+  str = str + piece;
+  for (var j = 0; j < piece.length; j++) {
+    codes.push(piece.charCodeAt(j));
+  }
+}
+
+assert(str.length === codes.length);
+
+for (var i = codes.length - 1; i >= 0; i--) {
+  assert(str.charCodeAt(i) === codes[i]);
+  assert(str.charAt(i) === String.fromCharCode(codes[i]));
+  assert(str[i] === String.fromCharCode(codes[i]));
+}
+
+assert(isNaN(str.charCodeAt(str.length)));
+assert(str.charAt(str.length) === "");
+
+for (var i = 0; i <= 96; i += 31) {
+  var sub = str.substring(i, i + 33);
+  assert(sub.length === 33);
+  for (var j = 0; j < sub.length; j++) {
+    assert(sub.charCodeAt(j) === codes[i + j]);
+  }
+}
+
+assert(str.substring(32, str.length) === str.slice(32));
+assert(str.substring(str.length - 1) === "\ude00");
+assert(str.substring(64, 64) === "");
+
+var parts = str.split("€");
+assert(parts.length === 41);
+assert(parts[0] === "aé");
+assert(parts[40] === "b😀");
+assert(parts.join("€") === str);
+
+parts = str.split("b\ud83d");
+assert(parts.length === 41);
+assert(parts[1] === "\ude00aé€");
+
+assert("abc".split("é").length === 1);
+assert("abé".split("béé").length === 1);
+assert("xéyéz".split("é").join() === "x,y,z");
+assert("1234".split(23).join() === "1,4");
@@ -0,0 +1,66 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Strings larger than 64 KB
+var piece = "0123456789abcdef";
+var block = piece + piece + piece + piece;
+var ascii = "";
+
+for (var i = 0; i < 1100; i++) {
+  ascii += block;
+}
+
+assert(ascii.length === 70400);
+assert(ascii.charAt(70399) === "f");
+assert(ascii.charCodeAt(65536) === 48);
+assert(ascii.substring(70390) === "6789abcdef");
+assert(ascii.indexOf("fx") === -1);
+assert(ascii.lastIndexOf("f0") === 70383);
+assert(ascii.slice(65530, 65540) === "abcdef0123");
+
+var copy = ascii.substring(0, 70384) + piece;
+assert(copy === ascii);
+assert(!(copy < ascii) && !(copy > ascii));
+copy = undefined;
+
+assert(ascii.substring(1) > ascii);
+
+var json = JSON.stringify({ value: ascii });
+assert(json.length === 70400 + 12);
+assert(JSON.parse(json).value === ascii);
+
+ascii = undefined;
+json = undefined;
+
+block = "";
+for (var i = 0; i < 10; i++) {
+  block += "ab€dé" + i + "xyz";
+}
+
+var utf8 = "";
+for (var i = 0; i < 600; i++) {
+  utf8 += block;
+}
+
+assert(utf8.length === 54000);
+assert(utf8.charAt(53996) === "9");
+assert(utf8.charCodeAt(53993) === 0x20ac);
+assert(utf8.substring(53992, 53996) === "b€dé");
+assert(utf8.indexOf("é9") === 85);
+assert(utf8.lastIndexOf("é0") === 53914);
+
+var parts = utf8.split("é0xyz");
+assert(parts.length === 601);
+assert(parts[600] === "ab€dé1xyzab€dé2xyzab€dé3xyzab€dé4xyzab€dé5xyzab€dé6xyzab€dé7xyzab€dé8xyzab€dé9xyz");
+assert(parts.join("é0xyz") === utf8);
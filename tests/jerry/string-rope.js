@@ -0,0 +1,65 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Long concatenations are represented by ropes, which are flattened on demand
+var str = "";
+for (var i = 0; i < 3000; i++)
+{
+  str += "ab" + (i % 10);
+}
+
+var other = "";
+for (var i = 0; i < 3000; i++)
+{
+  other = other + "ab" + (i % 10);
+}
+
+assert (str.length === 9000);
+assert (str.charAt (8999) === "9");
+assert (str.substring (3, 6) === "ab1");
+assert (str === other);
+assert (str < other + "x");
+
+// Non-ascii ropes
+var utf8 = "é";
+for (var i = 0; i < 400; i++)
+{
+  utf8 = utf8 + "xé";
+}
+
+assert (utf8.length === 801);
+assert (utf8.charCodeAt (800) === 0xe9);
+
+// Ropes as property names
+var obj = {};
+obj[str] = 5;
+assert (obj[other] === 5);
+
+// Prepending builds right leaning ropes
+var prefixed = "";
+for (var i = 0; i < 1000; i++)
+{
+  prefixed = "xy" + prefixed;
+}
+
+assert (prefixed.length === 2000);
+assert (prefixed[1999] === "y");
+
+// Ropes of ropes
+var big = str + other + utf8;
+assert (big.length === 18801);
+assert (big.indexOf ("é") === 18000);
+assert (big.lastIndexOf ("ab0") === 17970);
+assert (JSON.parse (JSON.stringify (big)) === big);
+assert (big.slice (8997, 9003) === "ab9ab0");
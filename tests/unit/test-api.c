@@ -318,6 +318,41 @@ static bool foreach_subset (const jerry_api_string_t *name, const jerry_api_valu
   return true;
 } /* foreach_subset */
 
+/**
+ * State of the heap dump test
+ */
+typedef struct
+{
+  uint32_t line_count; /**< number of the received lines */
+  uint32_t line_limit; /**< the dump is aborted after this number of lines */
+  bool is_header_found; /**< the first line is the header */
+  bool is_edge_found; /**< the edge of the 'heapDumpTest' property is found */
+} heap_dump_state_t;
+
+static bool
+heap_dump_writer (const jerry_api_char_t *buffer_p, jerry_api_size_t size, void *user_data_p)
+{
+  heap_dump_state_t *state_p = (heap_dump_state_t *) user_data_p;
+  const char *edge_p = " value \"heapDumpTest\"\n";
+  size_t edge_size = strlen (edge_p);
+
+  JERRY_ASSERT (size > 0 && buffer_p[size - 1] == '\n');
+
+  if (state_p->line_count == 0)
+  {
+    state_p->is_header_found = (size == 18 && !strncmp ((const char *) buffer_p, "jerry-heap-dump 1\n", size));
+  }
+
+  if (buffer_p[0] == 'E'
+      && size > edge_size
+      && !strncmp ((const char *) buffer_p + size - edge_size, edge_p, edge_size))
+  {
+    state_p->is_edge_found = true;
+  }
+
+  return ++state_p->line_count < state_p->line_limit;
+} /* heap_dump_writer */
+
 int
 main (void)
 {
@@ -678,6 +713,98 @@ main (void)
   // TEST: run gc.
   jerry_api_gc ();
 
+  // TEST: incremental gc, while references to new objects are stored into traced objects.
+  const char *gc_init_src_p = "var list = null; for (var i = 0; i < 100; i++) { list = { next: list, value: i }; }";
+  status = jerry_api_eval ((jerry_api_char_t *) gc_init_src_p, strlen (gc_init_src_p), false, false, &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  jerry_api_release_value (&res);
+
+  const char *gc_mutate_src_p = "list.next = { next: list.next, value: -1 }; list.next.next.value++;";
+  const char *gc_check_src_p = ("var sum = 0; "
+                                "for (var node = list; node !== null; node = node.next) { "
+                                "  sum += node.value; "
+                                "} "
+                                "sum");
+  double expected_sum = 99 * 100 / 2;
+  uint32_t step_count = 0;
+
+  while (!jerry_api_gc_step (16))
+  {
+    status = jerry_api_eval ((jerry_api_char_t *) gc_mutate_src_p, strlen (gc_mutate_src_p), false, false, &res);
+    JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+    jerry_api_release_value (&res);
+
+    step_count++;
+    JERRY_ASSERT (step_count < 1000);
+  }
+
+  JERRY_ASSERT (step_count > 1);
+
+  status = jerry_api_eval ((jerry_api_char_t *) gc_check_src_p, strlen (gc_check_src_p), false, false, &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_FLOAT64
+                && res.u.v_float64 == expected_sum);
+  jerry_api_release_value (&res);
+
+  // TEST: heap compaction, after every second element vector is freed.
+  const char *compact_init_src_p = ("var kept = []; var dropped = []; "
+                                    "for (var i = 0; i < 64; i++) { "
+                                    "  kept.push ([i, i, i, i, i, i, i, i]); dropped.push ([i, i, i, i, i, i, i, i]); "
+                                    "} "
+                                    "dropped = null;");
+  status = jerry_api_eval ((jerry_api_char_t *) compact_init_src_p, strlen (compact_init_src_p), false, false, &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  jerry_api_release_value (&res);
+
+  jerry_api_gc ();
+
+  jerry_api_heap_fragmentation_t before, after;
+  jerry_api_heap_compact (&before, &after);
+  printf ("Heap compaction: %u free regions before, %u after\n",
+          (unsigned int) before.free_region_count,
+          (unsigned int) after.free_region_count);
+
+  JERRY_ASSERT (after.free_bytes >= before.free_bytes);
+  JERRY_ASSERT (after.free_region_count < before.free_region_count);
+  JERRY_ASSERT (after.largest_free_region_size >= before.largest_free_region_size);
+
+  const char *compact_check_src_p = ("var sum = 0; for (var i = 0; i < kept.length; i++) { "
+                                     "  for (var j = 0; j < kept[i].length; j++) { sum += kept[i][j]; } "
+                                     "} "
+                                     "sum");
+  status = jerry_api_eval ((jerry_api_char_t *) compact_check_src_p, strlen (compact_check_src_p), false, false, &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_FLOAT64
+                && res.u.v_float64 == 8 * 63 * 64 / 2);
+  jerry_api_release_value (&res);
+
+  // TEST: heap dump
+  const char *heap_dump_src_p = "var heapDumpTest = { items: [1, 'two', { three: 3 }] };";
+  status = jerry_api_eval ((jerry_api_char_t *) heap_dump_src_p, strlen (heap_dump_src_p), false, false, &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  jerry_api_release_value (&res);
+
+  heap_dump_state_t heap_dump_state = { 0, UINT32_MAX, false, false };
+  is_ok = jerry_api_heap_dump (heap_dump_writer, &heap_dump_state);
+  JERRY_ASSERT (is_ok);
+  JERRY_ASSERT (heap_dump_state.is_header_found && heap_dump_state.is_edge_found);
+
+  uint32_t heap_dump_line_count = heap_dump_state.line_count;
+  heap_dump_state.line_count = 0;
+  heap_dump_state.line_limit = 10;
+  is_ok = jerry_api_heap_dump (heap_dump_writer, &heap_dump_state);
+  JERRY_ASSERT (!is_ok && heap_dump_state.line_count == 10 && heap_dump_line_count > 10);
+
+  // TEST: memory statistics (only collected by the MEM_STATS builds)
+  jerry_api_memory_stats_t memory_stats;
+  if (jerry_api_get_memory_stats (JERRY_API_MEMORY_KIND_OBJECT, &memory_stats))
+  {
+    JERRY_ASSERT (memory_stats.count > 0
+                  && memory_stats.bytes > 0
+                  && memory_stats.peak_bytes >= memory_stats.bytes
+                  && memory_stats.total_count >= memory_stats.count);
+  }
+
   jerry_cleanup ();
 
   JERRY_ASSERT (test_api_is_free_callback_was_called);
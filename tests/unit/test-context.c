@@ -0,0 +1,227 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+#include "jerry-api.h"
+
+#include "test-common.h"
+
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+#include <pthread.h>
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
+/**
+ * Script which creates objects, strings, regular expressions and
+ * closures, so most parts of the engine state are used
+ */
+static const char *test_source = (
+                                  "var objects = []; "
+                                  "for (var i = 0; i < 200; i++) { "
+                                  "  objects.push ({ index: i, name: 'object' + i, "
+                                  "                  get: function () { return this.index; } }); "
+                                  "} "
+                                  "var sum = 0; "
+                                  "for (var i = 0; i < objects.length; i++) { "
+                                  "  sum += objects[i].get () + objects[i].name.length; "
+                                  "} "
+                                  "if (!/^object1[0-9]+$/.test (objects[150].name)) { "
+                                  "  sum = -1; "
+                                  "} "
+                                  "this.result = sum + this.id; "
+                                  );
+
+/**
+ * Expected value of 'result' without the context identifier
+ */
+#define TEST_EXPECTED_SUM (19900 + 10 * 7 + 90 * 8 + 100 * 9)
+
+/**
+ * Set a number property of the global object
+ */
+static void
+set_global_number (const char *name_p, /**< property name */
+                   double value) /**< property value */
+{
+  jerry_api_object_t *global_obj_p = jerry_api_get_global ();
+  jerry_api_value_t value_t;
+
+  value_t.type = JERRY_API_DATA_TYPE_FLOAT64;
+  value_t.u.v_float64 = value;
+
+  bool is_ok = jerry_api_set_object_field_value (global_obj_p, (const jerry_api_char_t *) name_p, &value_t);
+  JERRY_ASSERT (is_ok);
+
+  jerry_api_release_object (global_obj_p);
+} /* set_global_number */
+
+/**
+ * Get a number property of the global object
+ *
+ * @return value of the property, or -1 if the property is not a number
+ */
+static double
+get_global_number (const char *name_p) /**< property name */
+{
+  jerry_api_object_t *global_obj_p = jerry_api_get_global ();
+  jerry_api_value_t value_t;
+  double result = -1;
+
+  if (jerry_api_get_object_field_value (global_obj_p, (const jerry_api_char_t *) name_p, &value_t))
+  {
+    if (value_t.type == JERRY_API_DATA_TYPE_FLOAT64)
+    {
+      result = value_t.u.v_float64;
+    }
+
+    jerry_api_release_value (&value_t);
+  }
+
+  jerry_api_release_object (global_obj_p);
+  return result;
+} /* get_global_number */
+
+/**
+ * Run the test script in the current context
+ */
+static void
+run_test_source (void)
+{
+  jerry_api_value_t res;
+  jerry_completion_code_t status = jerry_api_eval ((const jerry_api_char_t *) test_source,
+                                                   strlen (test_source),
+                                                   false,
+                                                   false,
+                                                   &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  jerry_api_release_value (&res);
+} /* run_test_source */
+
+/**
+ * Run the test script in a fresh engine instance of the current context
+ */
+static void
+run_engine (double id) /**< context identifier */
+{
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  /* State of a previous engine instance must not be visible. */
+  JERRY_ASSERT (get_global_number ("id") == -1);
+  JERRY_ASSERT (get_global_number ("result") == -1);
+
+  set_global_number ("id", id);
+  run_test_source ();
+  JERRY_ASSERT (get_global_number ("result") == TEST_EXPECTED_SUM + id);
+
+  jerry_api_gc ();
+  jerry_cleanup ();
+} /* run_engine */
+
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+
+/**
+ * Number of threads which run engine instances at the same time
+ */
+#define TEST_THREAD_COUNT 4
+
+/**
+ * Number of engine instances which are created by a thread
+ */
+#define TEST_ITERATION_COUNT 8
+
+/**
+ * Thread which runs engine instances in its own context
+ *
+ * @return NULL
+ */
+static void *
+run_thread (void *arg_p) /**< identifier of the thread */
+{
+  size_t thread_id = *(size_t *) arg_p;
+  jerry_context_t *context_p = (jerry_context_t *) malloc (jerry_get_context_size ());
+  JERRY_ASSERT (context_p != NULL);
+
+  jerry_set_current_context (context_p);
+  JERRY_ASSERT (jerry_get_current_context () == context_p);
+
+  for (size_t i = 0; i < TEST_ITERATION_COUNT; i++)
+  {
+    run_engine ((double) (thread_id * TEST_ITERATION_COUNT + i));
+  }
+
+  free (context_p);
+  return NULL;
+} /* run_thread */
+
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  /* Consecutive engine instances of the same context are independent. */
+  run_engine (1);
+  run_engine (2);
+
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+  /* Two engine instances alive at the same time in the same thread. */
+  jerry_context_t *default_context_p = jerry_get_current_context ();
+  jerry_context_t *first_context_p = (jerry_context_t *) malloc (jerry_get_context_size ());
+  jerry_context_t *second_context_p = (jerry_context_t *) malloc (jerry_get_context_size ());
+  JERRY_ASSERT (first_context_p != NULL && second_context_p != NULL);
+
+  jerry_set_current_context (first_context_p);
+  jerry_init (JERRY_FLAG_EMPTY);
+  set_global_number ("id", 10);
+
+  jerry_set_current_context (second_context_p);
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (get_global_number ("id") == -1);
+  set_global_number ("id", 20);
+  run_test_source ();
+
+  jerry_set_current_context (first_context_p);
+  run_test_source ();
+  JERRY_ASSERT (get_global_number ("result") == TEST_EXPECTED_SUM + 10);
+  jerry_cleanup ();
+
+  jerry_set_current_context (second_context_p);
+  JERRY_ASSERT (get_global_number ("result") == TEST_EXPECTED_SUM + 20);
+  jerry_cleanup ();
+
+  jerry_set_current_context (default_context_p);
+  free (first_context_p);
+  free (second_context_p);
+
+  /* Engine instances running in parallel threads. */
+  pthread_t threads[TEST_THREAD_COUNT];
+  size_t thread_ids[TEST_THREAD_COUNT];
+
+  for (size_t i = 0; i < TEST_THREAD_COUNT; i++)
+  {
+    thread_ids[i] = i;
+    int result = pthread_create (threads + i, NULL, run_thread, thread_ids + i);
+    JERRY_ASSERT (result == 0);
+  }
+
+  for (size_t i = 0; i < TEST_THREAD_COUNT; i++)
+  {
+    int result = pthread_join (threads[i], NULL);
+    JERRY_ASSERT (result == 0);
+  }
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
+  return 0;
+} /* main */
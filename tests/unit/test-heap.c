@@ -112,6 +112,38 @@ main (int __attr_unused___ argc,
     }
   }
 
+  // Free neighbouring blocks in different orders, so they are merged with both the previous and the next block
+  for (uint32_t i = 0; i < test_sub_iters; i++)
+  {
+    for (uint32_t j = 0; j <= i; j++)
+    {
+      sizes[j] = sizeof (uint64_t) * (j + 1);
+      ptrs[j] = (uint8_t *) mem_heap_alloc_block (sizes[j]);
+      JERRY_ASSERT (ptrs[j] != NULL);
+    }
+
+    for (uint32_t j = i % 2; j <= i; j += 2)
+    {
+      mem_heap_free_block (ptrs[j], sizes[j]);
+      ptrs[j] = NULL;
+    }
+
+    for (uint32_t j = 0; j <= i; j++)
+    {
+      if (ptrs[j] != NULL)
+      {
+        mem_heap_free_block (ptrs[j], sizes[j]);
+        ptrs[j] = NULL;
+      }
+    }
+  }
+
+  // All free blocks are merged, so a block of half of the heap fits into the heap
+  ptrs[0] = (uint8_t *) mem_heap_alloc_block (MEM_HEAP_SIZE / 2);
+  JERRY_ASSERT (ptrs[0] != NULL);
+  mem_heap_free_block (ptrs[0], MEM_HEAP_SIZE / 2);
+  ptrs[0] = NULL;
+
 #ifdef MEM_STATS
   mem_heap_stats_print ();
 #endif /* MEM_STATS */
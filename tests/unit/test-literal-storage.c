@@ -17,6 +17,7 @@
 #include "ecma-helpers.h"
 #include "lit-literal.h"
 #include "lit-literal-storage.h"
+#include "lit-snapshot.h"
 #include "test-common.h"
 
 // Iterations count
@@ -28,6 +29,18 @@
 // Max characters in a string
 #define max_characters_in_string 256
 
+// Number of the literals with colliding hash table keys
+#define test_collision_count 64
+
+// Characters of the literals with colliding hash table keys
+#define test_collision_string_size 6
+
+// Lower bits of the colliding hash table keys (the hash tables of the test are smaller than this)
+#define test_collision_key_mask 0xffffu
+
+// Size of the snapshot buffer of the literal storage
+#define test_snapshot_buffer_size 4096
+
 static void
 generate_string (lit_utf8_byte_t *str, lit_utf8_size_t len)
 {
@@ -80,6 +93,58 @@ compare_utf8_string_and_string_literal (const lit_utf8_byte_t *str_p, lit_utf8_s
   return false;
 } /* compare_utf8_string_and_string_literal */
 
+static void
+generate_colliding_strings (lit_utf8_byte_t strings[][test_collision_string_size], uint32_t count)
+{
+  uint32_t key = 0;
+  uint32_t found = 0;
+
+  for (uint32_t i = 0; found < count; i++)
+  {
+    lit_utf8_byte_t *str_p = strings[found];
+    uint32_t value = i;
+
+    str_p[0] = 'k';
+
+    for (uint32_t j = 1; j < test_collision_string_size; j++)
+    {
+      str_p[j] = (lit_utf8_byte_t) ('a' + value % 26);
+      value /= 26;
+    }
+
+    uint32_t str_key = lit_hash_table_get_string_key (str_p, test_collision_string_size) & test_collision_key_mask;
+
+    if (found == 0)
+    {
+      key = str_key;
+    }
+
+    if (str_key == key)
+    {
+      found++;
+    }
+  }
+} /* generate_colliding_strings */
+
+static void
+check_colliding_literals (lit_utf8_byte_t strings[][test_collision_string_size], uint32_t count)
+{
+  for (uint32_t i = 0; i < count; i++)
+  {
+    lit_literal_t lit = lit_find_literal_by_utf8_string (strings[i], test_collision_string_size);
+    JERRY_ASSERT (lit != NULL);
+    JERRY_ASSERT (compare_utf8_string_and_string_literal (strings[i], test_collision_string_size, lit));
+
+    lit = lit_find_literal_by_num ((ecma_number_t) i);
+    JERRY_ASSERT (lit != NULL);
+    JERRY_ASSERT (lit_number_literal_get_number (lit) == (ecma_number_t) i);
+  }
+
+  // The probe sequence of a missing string with the same key is also checked until its end
+  JERRY_ASSERT (lit_find_literal_by_utf8_string (strings[count], test_collision_string_size) == NULL);
+  JERRY_ASSERT (lit_find_literal_by_num ((ecma_number_t) count) == NULL);
+} /* check_colliding_literals */
+
 int
 main (int __attr_unused___ argc,
       char __attr_unused___ **argv)
@@ -158,6 +223,79 @@ main (int __attr_unused___ argc,
     JERRY_ASSERT (lit_find_literal_by_utf8_string (NULL, 0));
   }
 
+  // Check the literals, whose hash table keys have the same lower bits, so they collide at every size of the table
+  lit_finalize ();
+  lit_init ();
+
+  static lit_utf8_byte_t colliding_strings[test_collision_count + 1][test_collision_string_size];
+  generate_colliding_strings (colliding_strings, test_collision_count + 1);
+
+  for (uint32_t i = 0; i < test_collision_count; i++)
+  {
+    lit_literal_t lit = lit_find_or_create_literal_from_utf8_string (colliding_strings[i], test_collision_string_size);
+    JERRY_ASSERT (lit == lit_find_or_create_literal_from_utf8_string (colliding_strings[i],
+                                                                      test_collision_string_size));
+
+    lit = lit_find_or_create_literal_from_num ((ecma_number_t) i);
+    JERRY_ASSERT (lit == lit_find_or_create_literal_from_num ((ecma_number_t) i));
+  }
+
+  // The duplicates are found instead of creating new records
+  JERRY_ASSERT (lit_count_literals () == 2 * test_collision_count);
+  check_colliding_literals (colliding_strings, test_collision_count);
+
+  // Check the lookup after the literals are loaded from a snapshot, which rebuilds the hash table
+  static uint8_t snapshot_buffer[test_snapshot_buffer_size];
+  size_t snapshot_offset = 0;
+  lit_mem_to_snapshot_id_map_entry_t *map_p;
+  uint32_t map_num;
+  uint32_t lit_table_size;
+
+  JERRY_ASSERT (lit_save_literals_for_snapshot (snapshot_buffer,
+                                                sizeof (snapshot_buffer),
+                                                &snapshot_offset,
+                                                &map_p,
+                                                &map_num,
+                                                &lit_table_size));
+  JERRY_ASSERT (map_num == 2 * test_collision_count);
+  mem_heap_free_block_size_stored (map_p);
+
+  lit_finalize ();
+  lit_init ();
+
+  // A literal of the snapshot already exists, so it is inserted again when the table is rebuilt
+  lit_find_or_create_literal_from_utf8_string (colliding_strings[0], test_collision_string_size);
+
+  JERRY_ASSERT (lit_load_literals_from_snapshot (snapshot_buffer, lit_table_size, &map_p, &map_num));
+  JERRY_ASSERT (map_num == 2 * test_collision_count);
+  mem_heap_free_block_size_stored (map_p);
+
+  JERRY_ASSERT (lit_count_literals () == 2 * test_collision_count);
+  check_colliding_literals (colliding_strings, test_collision_count);
+
+  // Check the lookup of the external magic strings, which are not registered in sorted order
+  static const lit_utf8_byte_t *ex_strings[] =
+  {
+    (const lit_utf8_byte_t *) "console",
+    (const lit_utf8_byte_t *) "process",
+    (const lit_utf8_byte_t *) "ab",
+    (const lit_utf8_byte_t *) "global"
+  };
+  static const lit_utf8_size_t ex_sizes[] = { 7, 7, 2, 6 };
+
+  lit_magic_strings_ex_set (ex_strings, 4, ex_sizes);
+
+  for (lit_magic_string_ex_id_t id = 0; id < 4; id++)
+  {
+    lit_magic_string_ex_id_t found_id;
+    JERRY_ASSERT (lit_is_ex_utf8_string_magic (ex_strings[id], ex_sizes[id], &found_id));
+    JERRY_ASSERT (found_id == id);
+  }
+
+  lit_magic_string_ex_id_t not_found_id;
+  JERRY_ASSERT (!lit_is_ex_utf8_string_magic ((const lit_utf8_byte_t *) "consolf", 7, &not_found_id));
+  JERRY_ASSERT (not_found_id == 4);
+
   lit_finalize ();
   mem_finalize (true);
   return 0;
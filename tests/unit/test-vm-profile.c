@@ -0,0 +1,141 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+#include "jerry-api.h"
+
+#include "test-common.h"
+
+#ifdef JERRY_VM_PROFILE
+
+/**
+ * Name of the JSON output file of the profiler
+ */
+#define TEST_PROFILE_FILE_NAME "unit-test-vm-profile.json"
+
+/**
+ * Maximum size of the JSON output file of the profiler
+ */
+#define TEST_PROFILE_MAX_SIZE (64 * 1024)
+
+/**
+ * Script which runs long enough that the tick counters of the profiler exceed 32 bits
+ * (4 seconds are more than 2^32 ticks of any time stamp counter faster than 1.1 GHz)
+ */
+static const char *test_source = (
+                                  "var end = Date.now () + 4000; "
+                                  "var count = 0; "
+                                  "while (Date.now () < end) { "
+                                  "  count++; "
+                                  "} "
+                                  );
+
+/**
+ * Find a string in the JSON output
+ *
+ * @return pointer to the first character after the found string
+ */
+static const char *
+find_string (const char *json_p, /**< JSON output */
+             const char *string_p) /**< string to find */
+{
+  size_t length = strlen (string_p);
+
+  while (*json_p != '\0')
+  {
+    if (strncmp (json_p, string_p, length) == 0)
+    {
+      return json_p + length;
+    }
+
+    json_p++;
+  }
+
+  JERRY_UNREACHABLE ();
+  return NULL;
+} /* find_string */
+
+/**
+ * Read a number field of the JSON output
+ *
+ * @return value of the field
+ */
+static uint64_t
+get_number_field (const char *json_p, /**< JSON output */
+                  const char *name_p) /**< field name with the quotes and the colon */
+{
+  const char *digit_p = find_string (json_p, name_p);
+  uint64_t value = 0;
+
+  while (*digit_p == ' ')
+  {
+    digit_p++;
+  }
+
+  JERRY_ASSERT (*digit_p >= '0' && *digit_p <= '9');
+
+  while (*digit_p >= '0' && *digit_p <= '9')
+  {
+    JERRY_ASSERT (value <= (UINT64_MAX - 9) / 10);
+    value = value * 10 + (uint64_t) (*digit_p - '0');
+    digit_p++;
+  }
+
+  return value;
+} /* get_number_field */
+
+#endif /* JERRY_VM_PROFILE */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+#ifdef JERRY_VM_PROFILE
+  static char json[TEST_PROFILE_MAX_SIZE];
+
+  jerry_vm_profile_file_name = TEST_PROFILE_FILE_NAME;
+
+  /* The profile is written by jerry_cleanup, and the tables of the profiler are
+   * printed to the standard output, so every counter is printed two times. */
+  jerry_completion_code_t code = jerry_run_simple ((const jerry_api_char_t *) test_source,
+                                                   strlen (test_source),
+                                                   JERRY_FLAG_VM_PROFILE);
+  JERRY_ASSERT (code == JERRY_COMPLETION_CODE_OK);
+
+  FILE *file_p = fopen (TEST_PROFILE_FILE_NAME, "r");
+  JERRY_ASSERT (file_p != NULL);
+
+  size_t size = fread (json, 1, sizeof (json) - 1, file_p);
+  fclose (file_p);
+
+  JERRY_ASSERT (size > 0 && size < sizeof (json) - 1);
+  json[size] = '\0';
+
+  uint64_t total_instructions = get_number_field (json, "\"total_instructions\":");
+  uint64_t total_ticks = get_number_field (json, "\"total_ticks\":");
+  uint64_t opcode_ticks = get_number_field (find_string (json, "\"opcodes\":"), "\"ticks\":");
+
+  JERRY_ASSERT (total_instructions > 0);
+  JERRY_ASSERT (opcode_ticks > 0 && opcode_ticks <= total_ticks);
+
+  if (strncmp (find_string (json, "\"tick_source\":"), " \"rdtsc\"", 8) == 0)
+  {
+    JERRY_ASSERT (total_ticks > UINT32_MAX);
+  }
+#endif /* JERRY_VM_PROFILE */
+
+  return 0;
+} /* main */
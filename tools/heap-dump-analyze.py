@@ -0,0 +1,171 @@
+#!/usr/bin/env python
+
+# Copyright 2016 University of Szeged.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#  This file computes the dominator tree and the retained sizes of a heap dump,
+#  which is written by jerry_api_heap_dump (see the --heap-dump option of jerry).
+#  The objects referenced by native code are retained by a synthetic root node.
+
+from __future__ import print_function
+
+import argparse
+import re
+import sys
+
+ROOT = 'root'
+
+def unquote(text):
+    return re.sub(r'\\x([0-9a-f]{2})', lambda match: chr(int(match.group(1), 16)), text[1:-1])
+
+def parse_dump(dump_file):
+    nodes = {}
+    edges = {}
+
+    header = dump_file.readline().split()
+    if header[:1] != ['jerry-heap-dump'] or header[1:] != ['1']:
+        sys.exit('Unsupported heap dump format')
+
+    for line in dump_file:
+        # Spaces are escaped in the quoted fields
+        fields = line.split()
+        kind = fields[0]
+
+        if kind == 'O':
+            label = fields[2] if fields[6] == '-' else unquote(fields[6])
+            nodes[fields[1]] = {'label': label, 'size': int(fields[3]), 'refs': int(fields[4])}
+        elif kind == 'S':
+            nodes.setdefault(fields[1], {'label': 'string ' + fields[3], 'size': int(fields[2]), 'refs': 0})
+        elif kind == 'B':
+            nodes.setdefault(fields[1], {'label': '(byte code)', 'size': int(fields[2]), 'refs': 0})
+        elif kind == 'C':
+            nodes.setdefault(fields[1], {'label': '(collection)', 'size': int(fields[2]), 'refs': 0})
+        elif kind == 'E':
+            name = unquote(fields[4])
+            edges.setdefault(fields[1], []).append((fields[2], fields[3], name))
+        else:
+            sys.exit('Invalid heap dump line: ' + line)
+
+    edges[ROOT] = [(node_id, 'root', '') for node_id, node in nodes.items() if node['refs'] > 0]
+    nodes[ROOT] = {'label': '(root)', 'size': 0, 'refs': 0}
+    return nodes, edges
+
+def reverse_postorder(edges):
+    order = []
+    visited = set([ROOT])
+    stack = [(ROOT, iter(edges.get(ROOT, [])))]
+
+    while stack:
+        node_id, successors = stack[-1]
+        for target_id, _, _ in successors:
+            if target_id not in visited:
+                visited.add(target_id)
+                stack.append((target_id, iter(edges.get(target_id, []))))
+                break
+        else:
+            order.append(node_id)
+            stack.pop()
+
+    order.reverse()
+    return order
+
+def compute_dominators(edges, order):
+    # A simple, fast dominance algorithm (Cooper, Harvey and Kennedy)
+    index = dict((node_id, i) for i, node_id in enumerate(order))
+    predecessors = dict((node_id, []) for node_id in order)
+
+    for node_id in order:
+        for target_id, _, _ in edges.get(node_id, []):
+            predecessors[target_id].append(node_id)
+
+    dominators = {ROOT: ROOT}
+
+    def intersect(first, second):
+        while first != second:
+            while index[first] > index[second]:
+                first = dominators[first]
+            while index[second] > index[first]:
+                second = dominators[second]
+        return first
+
+    changed = True
+    while changed:
+        changed = False
+        for node_id in order[1:]:
+            new_dominator = None
+            for predecessor_id in predecessors[node_id]:
+                if predecessor_id in dominators:
+                    new_dominator = predecessor_id if new_dominator is None \
+                                    else intersect(predecessor_id, new_dominator)
+            if dominators.get(node_id) != new_dominator:
+                dominators[node_id] = new_dominator
+                changed = True
+
+    return dominators
+
+def compute_retained_sizes(nodes, order, dominators):
+    retained = dict((node_id, nodes[node_id]['size']) for node_id in order)
+
+    for node_id in reversed(order[1:]):
+        retained[dominators[node_id]] += retained[node_id]
+
+    return retained
+
+def retaining_path(edges, dominators, node_id):
+    path = []
+
+    while node_id != ROOT:
+        dominator_id = dominators[node_id]
+        names = [name or kind for target_id, kind, name in edges.get(dominator_id, []) if target_id == node_id]
+        path.append(names[0] if names else '...')
+        node_id = dominator_id
+
+    return '.'.join(reversed(path))
+
+def main():
+    parser = argparse.ArgumentParser(description='Analyze a heap dump of jerry')
+    parser.add_argument('dump', help='heap dump file')
+    parser.add_argument('--top', type=int, default=20, help='number of the largest retainers to print')
+    args = parser.parse_args()
+
+    with open(args.dump) as dump_file:
+        nodes, edges = parse_dump(dump_file)
+
+    order = reverse_postorder(edges)
+    dominators = compute_dominators(edges, order)
+    retained = compute_retained_sizes(nodes, order, dominators)
+
+    total_size = sum(node['size'] for node in nodes.values())
+    print('Nodes: %d, total size: %d bytes, unreachable from the roots: %d' %
+          (len(nodes) - 1, total_size, len(nodes) - len(order)))
+
+    groups = {}
+    for node_id in order[1:]:
+        label = nodes[node_id]['label']
+        group = groups.setdefault('string' if label.startswith('string ') else label, [0, 0])
+        group[0] += 1
+        group[1] += nodes[node_id]['size']
+
+    print('\n%8s %10s  %s' % ('Count', 'Size', 'Class or type'))
+    for label, (count, size) in sorted(groups.items(), key=lambda item: -item[1][1]):
+        print('%8d %10d  %s' % (count, size, label))
+
+    print('\n%10s %10s  %s' % ('Retained', 'Size', 'Node (path from the roots)'))
+    largest = sorted(order[1:], key=lambda node_id: -retained[node_id])[:args.top]
+    for node_id in largest:
+        print('%10d %10d  %s %s (%s)' % (retained[node_id], nodes[node_id]['size'], nodes[node_id]['label'],
+                                         node_id, retaining_path(edges, dominators, node_id)))
+
+if __name__ == '__main__':
+    main()
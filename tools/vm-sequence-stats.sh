@@ -0,0 +1,125 @@
+#!/bin/bash
+
+# Copyright 2016 University of Szeged.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Collects the byte code sequence statistics of a corpus and ranks the opcode
+# pairs and triples by the number of dispatches a superinstruction would save.
+#
+# The engine must be built with VM_SEQUENCE_STATS=ON, e.g.:
+#
+#   make release.linux VM_SEQUENCE_STATS=ON
+#   tools/vm-sequence-stats.sh build/bin/release.linux-VM_SEQUENCE_STATS-ON/jerry tests/jerry tests/benchmarks
+#
+# The report is followed by candidate CBC_EXT_OPCODE_LIST entries for the top
+# sequences. Their flags, stack adjustment and VM decode data must be filled in
+# when they are added to byte-code.h, together with the parser emission rule.
+
+if [ $# -lt 2 ]
+then
+  echo "Usage: $0 ENGINE [-n TOP] FILE_OR_DIRECTORY..."
+  exit 1
+fi
+
+ENGINE=$1
+shift
+
+TOP=20
+if [ "$1" == "-n" ]
+then
+  TOP=$2
+  shift 2
+fi
+
+TIMEOUT=${TIMEOUT:=60}
+STATS_FILE=`mktemp`
+trap "rm -f $STATS_FILE" EXIT
+
+for path in "$@"
+do
+  find "$path" -name "*.js" -type f | sort
+done | while read test
+do
+  timeout $TIMEOUT $ENGINE --vm-sequence-stats "$test" 2>/dev/null | grep -E "^  (opcode|pair|triple) " >> $STATS_FILE
+done
+
+awk -v top=$TOP '
+  {
+    key = $3
+    for (i = 4; i <= NF; i++)
+    {
+      key = key " " $i
+    }
+    counts[$1, key] += $2
+    if ($1 == "opcode")
+    {
+      total += $2
+    }
+  }
+  END {
+    if (total == 0)
+    {
+      print "No statistics were collected (is the engine built with VM_SEQUENCE_STATS=ON?)"
+      exit 1
+    }
+
+    # Rank the sequences by the dispatches saved by a superinstruction.
+    n = 0
+    for (entry in counts)
+    {
+      split (entry, parts, SUBSEP)
+      if (parts[1] == "opcode")
+      {
+        continue
+      }
+      length_of_sequence = (parts[1] == "pair") ? 2 : 3
+      n++
+      saved[n] = counts[entry] * (length_of_sequence - 1)
+      sequence[n] = parts[2]
+    }
+
+    for (i = 1; i <= n && i <= top; i++)
+    {
+      best = i
+      for (j = i + 1; j <= n; j++)
+      {
+        if (saved[j] > saved[best])
+        {
+          best = j
+        }
+      }
+      tmp = saved[i]; saved[i] = saved[best]; saved[best] = tmp
+      tmp = sequence[i]; sequence[i] = sequence[best]; sequence[best] = tmp
+    }
+
+    printf ("Total dispatches: %d\n\n", total)
+    printf ("%12s %7s  %s\n", "saved", "saved%", "sequence")
+    for (i = 1; i <= n && i <= top; i++)
+    {
+      printf ("%12d %6.2f%%  %s\n", saved[i], saved[i] * 100.0 / total, sequence[i])
+    }
+
+    printf ("\n/* Superinstruction candidates. */\n")
+    for (i = 1; i <= n && i <= top; i++)
+    {
+      count = split (sequence[i], names, " ")
+      name = "CBC_EXT"
+      for (j = 1; j <= count; j++)
+      {
+        sub (/^CBC_(EXT_)?/, "", names[j])
+        name = name "_" names[j]
+      }
+      printf ("  CBC_OPCODE (%s, CBC_NO_FLAG, 0, \\\n              VM_OC_NONE) \\\n", name)
+    }
+  }' $STATS_FILE